@@ -4,8 +4,23 @@
  *
  * Funcionalidades:
  *  - Lista arquivos na pasta client_cpp/storage.
- *  - Envia arquivo ao servidor via streaming para os 4 serviços.
+ *  - Envia arquivo ao servidor via streaming para os serviços disponíveis.
  *  - Recebe arquivos de saída e grava em client_cpp/storage.
+ *  - Upload retomável: após queda de conexão, reenvia apenas o trecho que falta.
+ *  - Download retomável: se a resposta for interrompida, busca o restante da saída retida (FetchOutput).
+ *  - Job assíncrono: envia, acompanha o estado e busca o resultado depois (SubmitJob/GetJobStatus/FetchResult).
+ *  - Compressão gRPC por chamada, apenas para conteúdo compressível (GRPC_COMPRESSION: gzip, deflate ou none).
+ *  - Tamanho de chunk negociado com o servidor (CHUNK_SIZE_KB) e adaptado à vazão observada.
+ *  - CRC32C em cada chunk enviado; nas saídas, chunks corrompidos são buscados de novo (FetchOutput)
+ *    e o CRC32C do arquivo inteiro é conferido.
+ *  - Servidor escolhido por GRPC_TARGET (TCP ou socket Unix unix:/caminho).
+ *  - Entrega local por descritores (LOCAL_HANDOFF_SOCKET): no mesmo host, o arquivo aberto é passado
+ *    ao servidor por SCM_RIGHTS e a saída volta como descritor, sem os bytes passarem pelo socket.
+ *  - Upload por delta: reenviando um arquivo já enviado, só os trechos alterados trafegam
+ *    (assinaturas estilo rsync da versão anterior, guardada no servidor).
+ *  - Latência por fase registrada no servidor (GetLatencyStats).
+ *  - Requisições em andamento no servidor, com fase, bytes e ferramenta em execução (GetServerState).
+ *  - Tracing (TRACE_DIR): spans das opções e das RPCs em OTLP-JSON, com o contexto propagado ao servidor.
  */
 
 #include <iostream>
@@ -14,8 +29,39 @@
 #include <fstream>
 #include <vector>
 #include <filesystem>
+#include <sstream>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <array>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
+#include <random>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+#include <openssl/evp.h>
+
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/support/client_interceptor.h>
 
 #include "../config_cpp/file_processor.grpc.pb.h"
 #include "../config_cpp/file_processor.pb.h"
@@ -30,6 +76,22 @@ using file_processor::FileRequest;
 using file_processor::FileResponse;
 using file_processor::FileChunk;
 using file_processor::CompressPDFRequest;
+using file_processor::StartUploadRequest;
+using file_processor::UploadChunk;
+using file_processor::UploadQuery;
+using file_processor::UploadStatus;
+using file_processor::FetchOutputRequest;
+using file_processor::JobQuery;
+using file_processor::JobStatus;
+using file_processor::PipelineRequest;
+using file_processor::SignatureRequest;
+using file_processor::SignatureBatch;
+using file_processor::DeltaChunk;
+using file_processor::LatencyQuery;
+using file_processor::LatencyReport;
+using file_processor::ServerState;
+using file_processor::ServerStateQuery;
+using grpc::ClientReader;
 
 namespace fs = std::filesystem;
 
@@ -50,6 +112,8 @@ static std::vector<std::string> ListStorageFiles() {
         if (p.is_regular_file()) files.push_back(p.path().filename().string()); 
     }
 
+    // Ordem estável: o número de cada arquivo não muda entre execuções
+    std::sort(files.begin(), files.end());
     return files;
 }
 
@@ -84,7 +148,415 @@ static std::string ChooseFile() {
     }
 }
 
+// Verifica pelo início do conteúdo se vale a pena comprimir
+// (formatos já comprimidos pela assinatura; demais pela entropia dos bytes)
+static bool LooksCompressible(const char* data, size_t n) {
+    if (n > 64 * 1024) n = 64 * 1024;
+    if (n < 64) return false;
+    auto starts = [&](const char* magic, size_t len) { return n >= len && std::memcmp(data, magic, len) == 0; };
+    if (starts("\xFF\xD8\xFF", 3) || starts("\x89PNG", 4) || starts("GIF8", 4) || starts("\x1F\x8B", 2) ||
+        starts("PK\x03\x04", 4) || starts("\x28\xB5\x2F\xFD", 4) || (starts("RIFF", 4) && n >= 12 && std::memcmp(data + 8, "WEBP", 4) == 0))
+        return false;
+    if (starts("%PDF", 4)) {
+        std::string sample(data, n);
+        return sample.find("/FlateDecode") == std::string::npos && sample.find("/DCTDecode") == std::string::npos &&
+               sample.find("/JPXDecode") == std::string::npos && sample.find("/ObjStm") == std::string::npos;
+    }
+    size_t hist[256] = {0};
+    for (size_t i = 0; i < n; ++i) hist[(unsigned char)data[i]]++;
+    double entropy = 0;
+    for (size_t c : hist) if (c) { double p = (double)c / n; entropy -= p * std::log2(p); }
+    return entropy < 7.5;
+}
+
+// Compressão da chamada: o envio só é comprimido se o arquivo parecer compressível;
+// a preferência para as respostas segue em metadado (o servidor desliga a compressão
+// por mensagem para saídas já comprimidas)
+static void ConfigureCompression(ClientContext& context, const std::string& input_path) {
+    const char* env = std::getenv("GRPC_COMPRESSION");
+    std::string pref = (env && *env) ? env : "gzip";
+    context.AddMetadata("response-compression", pref);
+    if (input_path.empty() || pref == "none") return;
+
+    std::ifstream in(input_path, std::ios::binary);
+    std::vector<char> buf(64 * 1024);
+    in.read(buf.data(), buf.size());
+    if (LooksCompressible(buf.data(), (size_t)in.gcount()))
+        context.set_compression_algorithm(pref == "deflate" ? GRPC_COMPRESS_DEFLATE : GRPC_COMPRESS_GZIP);
+}
+
+// CRC32C (Castagnoli), o mesmo do servidor: instruções de hardware (SSE4.2 / ARMv8 CRC)
+// quando disponíveis, senão tabela em software
+static uint32_t Crc32cSoftware(uint32_t crc, const uint8_t* p, size_t n) {
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? (c >> 1) ^ 0x82F63B78 : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+    crc = ~crc;
+    while (n--) crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xFF];
+    return ~crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t Crc32cHardware(uint32_t crc, const uint8_t* p, size_t n) {
+    uint64_t c = ~crc;
+    for (; n >= 8; p += 8, n -= 8) { uint64_t v; std::memcpy(&v, p, 8); c = _mm_crc32_u64(c, v); }
+    uint32_t c32 = (uint32_t)c;
+    while (n--) c32 = _mm_crc32_u8(c32, *p++);
+    return ~c32;
+}
+static bool Crc32cHardwareAvailable() { return __builtin_cpu_supports("sse4.2"); }
+#elif defined(__aarch64__)
+__attribute__((target("+crc")))
+static uint32_t Crc32cHardware(uint32_t crc, const uint8_t* p, size_t n) {
+    crc = ~crc;
+    for (; n >= 8; p += 8, n -= 8) { uint64_t v; std::memcpy(&v, p, 8); crc = __crc32cd(crc, v); }
+    while (n--) crc = __crc32cb(crc, *p++);
+    return ~crc;
+}
+static bool Crc32cHardwareAvailable() { return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0; }
+#else
+static uint32_t Crc32cHardware(uint32_t crc, const uint8_t* p, size_t n) { return Crc32cSoftware(crc, p, n); }
+static bool Crc32cHardwareAvailable() { return false; }
+#endif
+
+static uint32_t Crc32c(const void* data, size_t n, uint32_t crc = 0) {
+    static const bool hw = Crc32cHardwareAvailable();
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    return hw ? Crc32cHardware(crc, p, n) : Crc32cSoftware(crc, p, n);
+}
+
+// Integridade de uma saída recebida: confere o CRC32C de cada chunk, guarda os trechos
+// corrompidos (buscados de novo com FetchOutput) e o CRC32C da saída inteira
+struct OutputIntegrity {
+    std::string handle;
+    uint64_t received = 0;
+    std::vector<std::pair<uint64_t, uint64_t>> bad;     // (offset, tamanho)
+    bool has_digest = false;
+    uint32_t digest = 0;
+
+    void Add(const FileResponse& resp) {
+        if (!resp.result_handle().empty()) handle = resp.result_handle();
+        if (resp.has_output_crc32c()) { has_digest = true; digest = resp.output_crc32c(); }
+        if (!resp.has_file_content()) return;
+        const auto& c = resp.file_content().content();
+        if (resp.file_content().has_crc32c() && Crc32c(c.data(), c.size()) != resp.file_content().crc32c())
+            bad.emplace_back(received, c.size());
+        received += c.size();
+    }
+};
+
+// Limites de chunk (os mesmos do servidor; o máximo fica abaixo dos 4 MB por mensagem do gRPC)
+static const size_t CHUNK_MIN = 16 * 1024;
+static const size_t CHUNK_MAX = 2 * 1024 * 1024;
+static const int CHUNK_TARGET_MS = 20;
+
+// Tamanho de chunk adaptativo: cada chunk é dimensionado para levar ~CHUNK_TARGET_MS
+// na vazão observada nas escritas anteriores (o Write bloqueia pelo controle de fluxo)
+class ChunkSizer {
+public:
+    explicit ChunkSizer(size_t initial) : size_(Clamp(initial)) {}
+
+    size_t Size() const { return size_; }
+
+    void Observe(size_t bytes, std::chrono::steady_clock::duration elapsed) {
+        double secs = std::chrono::duration<double>(elapsed).count();
+        if (secs <= 0 || bytes < size_) return; // chunks parciais não medem a vazão
+        double sample = bytes / secs;
+        bps_ = bps_ == 0 ? sample : 0.7 * bps_ + 0.3 * sample;
+        if (!adaptive_) return;
+        size_t target = (size_t)(bps_ * CHUNK_TARGET_MS / 1000.0);
+        if (target > size_ * 2) target = size_ * 2;
+        if (target < size_ / 2) target = size_ / 2;
+        size_ = Clamp(target / CHUNK_MIN * CHUNK_MIN);
+    }
+
+    void SetAdaptive(bool adaptive) { adaptive_ = adaptive; }
+
+private:
+    static size_t Clamp(size_t n) { return n < CHUNK_MIN ? CHUNK_MIN : (n > CHUNK_MAX ? CHUNK_MAX : n); }
+
+    size_t size_;
+    bool adaptive_ = true;
+    double bps_ = 0;
+};
+
+// Preferência de chunk enviada ao servidor (CHUNK_SIZE_KB fixa o tamanho; sem ela o servidor decide e ambos adaptam)
+static void ConfigureChunking(ClientContext& context) {
+    const char* env = std::getenv("CHUNK_SIZE_KB");
+    if (!env || !*env) return;
+    context.AddMetadata("chunk-size", std::to_string(std::atoll(env) * 1024));
+    context.AddMetadata("chunk-adapt", "0");
+}
+
+// Aguarda os metadados iniciais e cria o sizer com o tamanho escolhido pelo servidor
+template <typename Stream>
+static ChunkSizer NegotiatedChunk(ClientContext& context, Stream& stream) {
+    stream.WaitForInitialMetadata();
+    size_t size = 256 * 1024;
+    auto it = context.GetServerInitialMetadata().find("chunk-size");
+    if (it != context.GetServerInitialMetadata().end()) size = (size_t)std::atoll(std::string(it->second.data(), it->second.size()).c_str());
+    ChunkSizer sizer(size);
+    const char* env = std::getenv("CHUNK_SIZE_KB");
+    if (env && *env) sizer.SetAdaptive(false);
+    return sizer;
+}
+
+// Envia um chunk e realimenta o sizer com o tempo da escrita
+template <typename Stream, typename Msg>
+static bool TimedWrite(Stream& stream, const Msg& msg, ChunkSizer& sizer, size_t n) {
+    auto t0 = std::chrono::steady_clock::now();
+    if (!stream.Write(msg)) return false;
+    sizer.Observe(n, std::chrono::steady_clock::now() - t0);
+    return true;
+}
+
 // Cliente gRPC para FileProcessorService
+// Digest de n bytes (MD5 dos blocos; SHA-256 do arquivo inteiro)
+static std::string Digest(const EVP_MD* md, const void* data, size_t n) {
+    unsigned char out[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    if (EVP_Digest(data, n, out, &len, md, nullptr) != 1) return "";
+    return std::string(reinterpret_cast<const char*>(out), len);
+}
+
+static std::string Hex(const std::string& bytes) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    for (unsigned char c : bytes) { hex += digits[c >> 4]; hex += digits[c & 0xf]; }
+    return hex;
+}
+
+// Checksum rolante do rsync (o mesmo do servidor): a = soma dos bytes, b = soma ponderada.
+// Mantido em 32 bits e truncado para 16 bits por componente só no valor final.
+struct RollingSum {
+    uint32_t a = 0, b = 0;
+
+    void Init(const uint8_t* p, size_t n) {
+        a = b = 0;
+        for (size_t i = 0; i < n; i++) { a += p[i]; b += (uint32_t)(n - i) * p[i]; }
+    }
+    // Desliza a janela de n bytes: sai out, entra in
+    void Roll(uint8_t out, uint8_t in, size_t n) { a += in - out; b += a - (uint32_t)n * out; }
+    uint32_t Value() const { return ((b & 0xffff) << 16) | (a & 0xffff); }
+};
+
+// Copia todo o conteúdo do descritor recebido para path dentro do kernel (copy_file_range,
+// com sendfile quando os sistemas de arquivos não permitem)
+static bool CopyFdToFile(int fd, const std::string& path) {
+    int out = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (out < 0) return false;
+    off_t off = 0;
+    bool ok = true;
+    while (true) {
+        ssize_t n = copy_file_range(fd, &off, out, nullptr, 1 << 30, 0);
+        if (n < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL)) n = sendfile(out, fd, &off, 1 << 30);
+        if (n == 0) break;
+        if (n < 0) { ok = false; break; }
+    }
+    return close(out) == 0 && ok;
+}
+
+// Processa um arquivo pelo socket local do servidor (mesmo host): a requisição leva só os
+// parâmetros e o descritor da entrada; cada saída volta como descritor (ver server_cpp/fd_handoff.h)
+static bool LocalProcess(const std::string& socket_path, const std::string& input_path, FileRequest req, const std::string& output_path) {
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) { std::cerr << "Caminho do socket longo demais" << std::endl; return false; }
+    std::memcpy(addr.sun_path, socket_path.c_str(), socket_path.size());
+
+    int sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (sock < 0 || connect(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        std::cerr << "Falha ao conectar em " << socket_path << ": " << std::strerror(errno) << std::endl;
+        if (sock >= 0) close(sock);
+        return false;
+    }
+    int in = open(input_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) { std::cerr << "Falha ao abrir " << input_path << std::endl; close(sock); return false; }
+
+    // Requisição: parâmetros serializados + descritor da entrada
+    req.set_file_name(fs::path(input_path).filename().string());
+    std::string payload = req.SerializeAsString();
+    struct iovec iov = {&payload[0], payload.size()};
+    char cbuf[CMSG_SPACE(sizeof(int))];
+    std::memset(cbuf, 0, sizeof(cbuf));
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov; msg.msg_iovlen = 1;
+    msg.msg_control = cbuf; msg.msg_controllen = sizeof(cbuf);
+    struct cmsghdr* c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET; c->cmsg_type = SCM_RIGHTS; c->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(c), &in, sizeof(int));
+    bool sent = sendmsg(sock, &msg, MSG_NOSIGNAL) == (ssize_t)payload.size();
+    close(in);
+
+    // Respostas: uma por saída (com descritor) e a final, sem descritor. Mesmo com o envio
+    // recusado a final é lida: o servidor ocupado responde e fecha sem ler a requisição
+    bool ok = true;
+    size_t outputs = 0;
+    std::vector<char> buf(64 * 1024);
+    while (true) {
+        iov = {buf.data(), buf.size()};
+        msg.msg_iov = &iov; msg.msg_iovlen = 1;
+        msg.msg_control = cbuf; msg.msg_controllen = sizeof(cbuf);
+        ssize_t n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+        if (n <= 0) {
+            std::cerr << (sent ? "Conexão local encerrada sem resposta final" : "Falha ao enviar a requisição local") << std::endl;
+            ok = false;
+            break;
+        }
+        int fd = -1;
+        for (c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c))
+            if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_RIGHTS) std::memcpy(&fd, CMSG_DATA(c), sizeof(int));
+        FileResponse resp;
+        resp.ParseFromArray(buf.data(), (int)n);
+        if (fd < 0) {
+            std::cout << "[server] success=" << resp.success() << " message=" << resp.status_message() << std::endl;
+            ok = resp.success();
+            break;
+        }
+        // Primeira saída no caminho pedido; as demais (ResizeImageMulti) com o nome do servidor
+        std::string path = outputs++ == 0 ? output_path : (fs::path(output_path).parent_path() / resp.file_name()).string();
+        if (!CopyFdToFile(fd, path)) { std::cerr << "Falha ao gravar " << path << std::endl; ok = false; }
+        close(fd);
+    }
+    close(sock);
+    return ok;
+}
+
+// Tracing (TRACE_DIR): cada opção do menu abre um span raiz e cada RPC um span filho, criado por um
+// interceptor do canal e propagado ao servidor no metadado traceparent (W3C). Os spans são gravados
+// em TRACE_DIR/client.otlp.jsonl, uma ExportTraceServiceRequest em JSON por linha (OTLP-JSON).
+struct ClientSpan {
+    std::string trace_id, span_id, parent_id, name;
+    int kind = 1;                                   // 1 interno, 3 cliente (valores do OTLP)
+    std::chrono::system_clock::time_point start = std::chrono::system_clock::now();
+    bool ok = true;
+    std::string message;
+};
+
+static std::string RandomHex(size_t bytes) {
+    thread_local std::mt19937_64 rng{std::random_device{}()};
+    std::string out;
+    char buf[3];
+    for (size_t i = 0; i < bytes; i++) { std::snprintf(buf, sizeof(buf), "%02x", (unsigned)(rng() & 0xff)); out += buf; }
+    return out;
+}
+
+// Arquivo de traces do cliente (vazio com o tracing desligado)
+static std::string TraceFilePath() {
+    const char* dir = std::getenv("TRACE_DIR");
+    if (!dir || !*dir) return "";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    return (fs::path(dir) / "client.otlp.jsonl").string();
+}
+
+static std::string JsonString(const std::string& s) {
+    std::string out = "\"";
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') { out += '\\'; out += (char)c; }
+        else if (c < 0x20) { char buf[8]; std::snprintf(buf, sizeof(buf), "\\u%04x", c); out += buf; }
+        else out += (char)c;
+    }
+    return out + "\"";
+}
+
+// Grava o span terminado (o cliente é interativo: um span por linha, sem buffer)
+static void ExportClientSpan(const ClientSpan& s) {
+    static std::mutex mu;
+    static const std::string path = TraceFilePath();
+    if (path.empty()) return;
+    auto nanos = [](std::chrono::system_clock::time_point t) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count());
+    };
+    std::string line = "{\"resourceSpans\":[{\"resource\":{\"attributes\":[{\"key\":\"service.name\",\"value\":{\"stringValue\":\"file-processor-client-cpp\"}}]},"
+                       "\"scopeSpans\":[{\"scope\":{\"name\":\"projeto_grpc\"},\"spans\":[{\"traceId\":\"" + s.trace_id + "\",\"spanId\":\"" + s.span_id + "\"";
+    if (!s.parent_id.empty()) line += ",\"parentSpanId\":\"" + s.parent_id + "\"";
+    line += ",\"name\":" + JsonString(s.name) + ",\"kind\":" + std::to_string(s.kind) +
+            ",\"startTimeUnixNano\":\"" + nanos(s.start) + "\",\"endTimeUnixNano\":\"" + nanos(std::chrono::system_clock::now()) + "\"" +
+            ",\"status\":{\"code\":" + (s.ok ? "0" : "2") + (s.message.empty() ? "" : ",\"message\":" + JsonString(s.message)) + "}}]}]}]}\n";
+    std::lock_guard<std::mutex> lk(mu);
+    std::ofstream(path, std::ios::app) << line;
+}
+
+// Span da opção do menu em andamento (pai das RPCs feitas por ela)
+static thread_local const ClientSpan* t_workflow = nullptr;
+
+class WorkflowSpan {
+public:
+    explicit WorkflowSpan(const std::string& name) {
+        if (TraceFilePath().empty()) return;
+        span_.trace_id = RandomHex(16);
+        span_.span_id = RandomHex(8);
+        span_.name = name;
+        t_workflow = &span_;
+    }
+    ~WorkflowSpan() {
+        if (t_workflow != &span_) return;
+        t_workflow = nullptr;
+        ExportClientSpan(span_);
+    }
+
+private:
+    ClientSpan span_;
+};
+
+// Span de uma RPC: injeta o traceparent nos metadados iniciais e termina com o status da chamada
+class TraceInterceptor : public grpc::experimental::Interceptor {
+public:
+    explicit TraceInterceptor(const std::string& method) {
+        span_.trace_id = t_workflow ? t_workflow->trace_id : RandomHex(16);
+        span_.parent_id = t_workflow ? t_workflow->span_id : "";
+        span_.span_id = RandomHex(8);
+        span_.name = method.substr(method.rfind('/') + 1);
+        span_.kind = 3;
+    }
+    ~TraceInterceptor() override { if (!exported_) ExportClientSpan(span_); }
+
+    void Intercept(grpc::experimental::InterceptorBatchMethods* methods) override {
+        using grpc::experimental::InterceptionHookPoints;
+        if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_INITIAL_METADATA)) {
+            span_.start = std::chrono::system_clock::now();
+            methods->GetSendInitialMetadata()->insert({"traceparent", "00-" + span_.trace_id + "-" + span_.span_id + "-01"});
+        }
+        if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_STATUS)) {
+            Status* st = methods->GetRecvStatus();
+            span_.ok = st->ok();
+            span_.message = st->error_message();
+            ExportClientSpan(span_);
+            exported_ = true;
+        }
+        methods->Proceed();
+    }
+
+private:
+    ClientSpan span_;
+    bool exported_ = false;
+};
+
+class TraceInterceptorFactory : public grpc::experimental::ClientInterceptorFactoryInterface {
+public:
+    grpc::experimental::Interceptor* CreateClientInterceptor(grpc::experimental::ClientRpcInfo* info) override {
+        return new TraceInterceptor(info->method());
+    }
+};
+
+// Canal com o servidor; com tracing, cada chamada passa pelo interceptor
+static std::shared_ptr<Channel> CreateClientChannel(const std::string& target) {
+    if (TraceFilePath().empty()) return grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
+    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>> factories;
+    factories.emplace_back(new TraceInterceptorFactory());
+    return grpc::experimental::CreateCustomChannelWithInterceptors(target, grpc::InsecureChannelCredentials(), grpc::ChannelArguments(), std::move(factories));
+}
+
 class FileProcessorClient {
 public:
     // Cria stub gRPC para comunicação com o servidor
@@ -95,6 +567,8 @@ public:
     bool CompressPDF(const std::string& input_path, const std::string& output_path) {
         // Cria contexto gRPC
         ClientContext context;
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
 
         // Inicia chamada GRPC bidirecional para o método CompressPDF
         std::unique_ptr<ClientReaderWriter<FileRequest, FileResponse>> stream(stub_->CompressPDF(&context));
@@ -118,11 +592,11 @@ public:
 
         // Envia o arquivo em pedaços
         {
-            const size_t CHUNK = 1024 * 1024;
-            std::vector<char> buf(CHUNK);
+            ChunkSizer sizer = NegotiatedChunk(context, *stream);
+            std::vector<char> buf(CHUNK_MAX);
             while (in) {
                 // Lê parte pré determinada pelo tamanho do chunk
-                in.read(buf.data(), buf.size());
+                in.read(buf.data(), sizer.Size());
                 std::streamsize n = in.gcount(); // Tamanho do stream
 
                 if (n <= 0) break;
@@ -130,9 +604,10 @@ public:
                 FileRequest req; // Cria nova requisição para envio
                 req.set_file_name(fs::path(input_path).filename().string());
                 req.mutable_file_content()->set_content(buf.data(), static_cast<size_t>(n));
+                req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), static_cast<size_t>(n)));
 
                 // Envia o chunk para o servidor
-                if (!stream->Write(req)) break;
+                if (!TimedWrite(*stream, req, sizer, (size_t)n)) break;
             }
         }
         stream->WritesDone();
@@ -140,26 +615,88 @@ public:
         // Recebe as respostas do servidor e grava no arquivo de saída
         FileResponse resp;
         std::ofstream out(output_path, std::ios::binary);
+        OutputIntegrity chk;
+        uint64_t total = 0;
         while (stream->Read(&resp)) { // Enquanto houver conteúdo para leitura no arquivo recebido
-            if (resp.has_file_content()) { // Se tiver conteúdo, escrever no arquivo de saída
+            chk.Add(resp);
+            if (resp.has_file_content()) // Se tiver conteúdo, escrever no arquivo de saída
                 out.write(resp.file_content().content().data(), resp.file_content().content().size());
-            }
+            if (!resp.result_handle().empty()) total = resp.output_size();
             // Exibe status da operação
             std::cout << "[server] success=" << resp.success() << " message=" << resp.status_message() << std::endl;
         }
 
         // Finaliza a chamada gRPC e verifica o status
         Status status = stream->Finish();
-        if (!status.ok()) {
+
+        // Resposta interrompida: busca apenas o restante da saída retida no servidor
+        if (!chk.handle.empty() && chk.received < total) {
+            std::cerr << "Resposta interrompida em " << chk.received << "/" << total << " bytes; retomando" << std::endl;
+            if (!FetchOutput(chk.handle, chk.received, 0, out, &chk)) return false;
+        } else if (!status.ok()) {
             std::cerr << "gRPC failed: " << status.error_message() << std::endl;
             return false;
         }
+        out.close();
+        return VerifyOutput(output_path, chk);
+    }
+
+    // Baixa o intervalo [offset, offset+length) de uma saída retida (length 0 = até o fim).
+    // Com chk, os chunks corrompidos ficam anotados nele; sem chk, um chunk corrompido é falha.
+    bool FetchOutput(const std::string& handle, uint64_t offset, uint64_t length, std::ostream& out, OutputIntegrity* chk = nullptr) {
+        ClientContext context;
+        ConfigureCompression(context, "");
+        ConfigureChunking(context);
+        FetchOutputRequest req;
+        req.set_result_handle(handle); req.set_offset(offset); req.set_length(length);
+        std::unique_ptr<ClientReader<FileResponse>> reader(stub_->FetchOutput(&context, req));
+
+        FileResponse resp;
+        bool ok = true;
+        while (reader->Read(&resp)) {
+            if (!resp.success()) { std::cout << "[server] success=0 message=" << resp.status_message() << std::endl; ok = false; }
+            if (!resp.has_file_content()) continue;
+            const auto& c = resp.file_content().content();
+            if (chk) chk->Add(resp);
+            else if (resp.file_content().has_crc32c() && Crc32c(c.data(), c.size()) != resp.file_content().crc32c()) ok = false;
+            out.write(c.data(), c.size());
+        }
+        Status status = reader->Finish();
+        if (!status.ok()) { std::cerr << "gRPC failed: " << status.error_message() << std::endl; return false; }
+        return ok;
+    }
+
+    // Busca de novo os trechos corrompidos de uma saída já gravada em path (sem refazer a
+    // transformação) e confere o CRC32C do arquivo inteiro
+    bool VerifyOutput(const std::string& path, const OutputIntegrity& chk) {
+        for (const auto& r : chk.bad) {
+            std::cerr << "Chunk corrompido em " << r.first << " (" << r.second << " bytes); buscando de novo" << std::endl;
+            bool fixed = false;
+            for (int attempt = 0; attempt < 3 && !fixed && !chk.handle.empty(); ++attempt) {
+                std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+                f.seekp((std::streamoff)r.first);
+                fixed = FetchOutput(chk.handle, r.first, r.second, f);
+            }
+            if (!fixed) { std::cerr << "Não foi possível recuperar o trecho corrompido" << std::endl; return false; }
+        }
+        if (!chk.has_digest) return true;
+
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> buf(1024 * 1024);
+        uint32_t crc = 0;
+        while (in) {
+            in.read(buf.data(), buf.size());
+            if (in.gcount() > 0) crc = Crc32c(buf.data(), (size_t)in.gcount(), crc);
+        }
+        if (crc != chk.digest) { std::cerr << "CRC32C da saída não confere: " << path << std::endl; return false; }
         return true;
     }
 
     bool ConvertToTXT(const std::string& input_path, const std::string& output_path) {
         // Cria contexto gRPC
         ClientContext context;
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
         // Inicia chamada GRPC bidirecional para o método ConvertToTXT
         auto stream = stub_->ConvertToTXT(&context);
         {
@@ -171,11 +708,11 @@ public:
 
         // Cria fluxo de leitura do arquivo de entrada
         std::ifstream in(input_path, std::ios::binary);
-        const size_t CHUNK = 1024*1024; std::vector<char> buf(CHUNK);
+        ChunkSizer sizer = NegotiatedChunk(context, *stream); std::vector<char> buf(CHUNK_MAX);
 
         // Envia o arquivo em pedaços
         while (in) { 
-            in.read(buf.data(), buf.size()); 
+            in.read(buf.data(), sizer.Size()); 
             auto n=in.gcount();
 
             if (n<=0) break;
@@ -183,23 +720,29 @@ public:
             FileRequest req; 
             req.set_file_name(fs::path(input_path).filename().string()); 
             req.mutable_file_content()->set_content(buf.data(), (size_t)n);
+            req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), (size_t)n));
 
-            if(!stream->Write(req)) break; 
+            if (!TimedWrite(*stream, req, sizer, (size_t)n)) break; 
         }
 
         stream->WritesDone();
 
         // Recebe as respostas do servidor e grava no arquivo de saída
-        std::ofstream out(output_path, std::ios::binary); FileResponse resp;
-        while (stream->Read(&resp)) 
+        std::ofstream out(output_path, std::ios::binary); FileResponse resp; OutputIntegrity chk;
+        while (stream->Read(&resp)) {
+            chk.Add(resp);
             if (resp.has_file_content()) 
                 out.write(resp.file_content().content().data(), resp.file_content().content().size());
+        }
         auto status = stream->Finish(); if(!status.ok()){ std::cerr<<"gRPC failed: "<<status.error_message()<<std::endl; return false; }
-        return true;
+        out.close();
+        return VerifyOutput(output_path, chk);
     }
 
     bool ConvertImageFormat(const std::string& input_path, const std::string& output_path, const std::string& format) {
         ClientContext context; 
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
         auto stream = stub_->ConvertImageFormat(&context);
         { 
             FileRequest req; 
@@ -209,25 +752,29 @@ public:
         }
 
             std::ifstream in(input_path, std::ios::binary); 
-            const size_t CHUNK=1024*1024; std::vector<char> buf(CHUNK);
+            ChunkSizer sizer = NegotiatedChunk(context, *stream); std::vector<char> buf(CHUNK_MAX);
             
             while(in){ 
-                in.read(buf.data(), buf.size()); auto n=in.gcount();
+                in.read(buf.data(), sizer.Size()); auto n=in.gcount();
 
                 if(n<=0) break;
 
                 FileRequest req; 
                 req.set_file_name(fs::path(input_path).filename().string()); 
-                req.mutable_file_content()->set_content(buf.data(), (size_t)n); 
-                if(!stream->Write(req)) break; 
+                req.mutable_file_content()->set_content(buf.data(), (size_t)n);
+                req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), (size_t)n)); 
+                if (!TimedWrite(*stream, req, sizer, (size_t)n)) break; 
             }
 
             stream->WritesDone(); std::ofstream out(output_path, std::ios::binary); 
             FileResponse resp;
+            OutputIntegrity chk;
 
-            while(stream->Read(&resp)) 
+            while(stream->Read(&resp)) {
+                chk.Add(resp);
                 if(resp.has_file_content()) 
                     out.write(resp.file_content().content().data(), resp.file_content().content().size());
+            }
             
             auto status=stream->Finish(); 
             
@@ -236,12 +783,15 @@ public:
                 return false;
             } 
             
-            return true;
+            out.close();
+            return VerifyOutput(output_path, chk);
     }
 
     bool ResizeImage(const std::string& input_path, const std::string& output_path, int width, int height) {
         // Cria contexto gRPC
         ClientContext context; 
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
         auto stream = stub_->ResizeImage(&context);
 
         // Envia parâmetros da requisição
@@ -255,21 +805,22 @@ public:
 
             // Cria fluxo de leitura do arquivo de entrada
             std::ifstream in(input_path, std::ios::binary); 
-            const size_t CHUNK=1024*1024; 
-            std::vector<char> buf(CHUNK);
+            ChunkSizer sizer = NegotiatedChunk(context, *stream);
+            std::vector<char> buf(CHUNK_MAX);
 
             // Envia o arquivo em pedaços
             while(in){ 
-                in.read(buf.data(), buf.size()); 
+                in.read(buf.data(), sizer.Size()); 
                 auto n=in.gcount(); 
 
                 if(n<=0) break; 
 
                 FileRequest req; 
                 req.set_file_name(fs::path(input_path).filename().string()); 
-                req.mutable_file_content()->set_content(buf.data(), (size_t)n); 
+                req.mutable_file_content()->set_content(buf.data(), (size_t)n);
+                req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), (size_t)n)); 
 
-                if(!stream->Write(req)) break; 
+                if (!TimedWrite(*stream, req, sizer, (size_t)n)) break; 
             }
 
             // Indica que todos os dados foram enviados
@@ -279,11 +830,14 @@ public:
             // Passa o que foi recebido do servidor ao diretório de saída
             std::ofstream out(output_path, std::ios::binary); 
             FileResponse resp;
+            OutputIntegrity chk;
 
             // Recebe as respostas do servidor e grava no arquivo de saída
-            while(stream->Read(&resp)) 
+            while(stream->Read(&resp)) {
+                chk.Add(resp);
                 if(resp.has_file_content()) 
                     out.write(resp.file_content().content().data(), resp.file_content().content().size());
+            }
 
             auto status=stream->Finish(); 
 
@@ -292,23 +846,506 @@ public:
                 return false;
             } 
 
-            return true;
+            out.close();
+            return VerifyOutput(output_path, chk);
+    }
+
+    // Gera várias miniaturas a partir de um único envio; cada saída é gravada em out_dir com o nome informado pelo servidor
+    bool ResizeImageMulti(const std::string& input_path, const std::string& out_dir, const std::vector<std::pair<int,int>>& sizes) {
+        ClientContext context; 
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
+        auto stream = stub_->ResizeImageMulti(&context);
+
+        // Envia a lista de tamanhos no primeiro chunk
+        { 
+            FileRequest req; 
+            req.set_file_name(fs::path(input_path).filename().string()); 
+            auto* p=req.mutable_resize_image_multi_params(); 
+            for (const auto& sz : sizes) { auto* s=p->add_sizes(); s->set_width(sz.first); s->set_height(sz.second); }
+            stream->Write(req);
+        }
+
+        // Envia o arquivo em pedaços
+        std::ifstream in(input_path, std::ios::binary); 
+        ChunkSizer sizer = NegotiatedChunk(context, *stream);
+        std::vector<char> buf(CHUNK_MAX);
+        while(in){ 
+            in.read(buf.data(), sizer.Size()); 
+            auto n=in.gcount(); 
+
+            if(n<=0) break; 
+
+            FileRequest req; 
+            req.set_file_name(fs::path(input_path).filename().string()); 
+            req.mutable_file_content()->set_content(buf.data(), (size_t)n);
+            req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), (size_t)n)); 
+
+            if (!TimedWrite(*stream, req, sizer, (size_t)n)) break; 
+        }
+        stream->WritesDone(); 
+
+        // Recebe as saídas; um novo arquivo é aberto sempre que o nome muda
+        // (cada saída é verificada ao terminar)
+        std::string current, path;
+        std::ofstream out;
+        OutputIntegrity chk;
+        FileResponse resp;
+        bool verified = true;
+        while(stream->Read(&resp)) {
+            if (!resp.file_name().empty() && resp.file_name() != current) {
+                current = resp.file_name();
+                out.close();
+                if (!path.empty()) verified = VerifyOutput(path, chk) && verified;
+                chk = OutputIntegrity();
+                path = (fs::path(out_dir) / fs::path(current).filename()).string();
+                out.open(path, std::ios::binary);
+                std::cout << "Saída: " << path << std::endl;
+            }
+            chk.Add(resp);
+            if(resp.has_file_content() && out.is_open()) 
+                out.write(resp.file_content().content().data(), resp.file_content().content().size());
+            if(!resp.success()) std::cout << "[server] success=0 message=" << resp.status_message() << std::endl;
+        }
+        out.close();
+
+        auto status=stream->Finish(); 
+        if(!status.ok()){ 
+            std::cerr<<"gRPC failed: "<<status.error_message()<<std::endl; 
+            return false;
+        } 
+        return (path.empty() || VerifyOutput(path, chk)) && verified;
+    }
+
+    // Envia o arquivo por upload retomável. O upload_id fica salvo em storage/.uploads/
+    // para que uma nova execução continue do offset confirmado pelo servidor.
+    bool ResumableUpload(const std::string& input_path, std::string& upload_id) {
+        const int MAX_ATTEMPTS = 5;
+        std::string name = fs::path(input_path).filename().string();
+        uint64_t total = fs::file_size(input_path);
+        fs::path state = fs::path(StorageDir()) / ".uploads" / (name + ".id");
+
+        // Sessão anterior para o mesmo arquivo (mesmo tamanho)
+        {
+            std::ifstream st(state);
+            uint64_t saved_total = 0;
+            if (!(st >> upload_id >> saved_total) || saved_total != total) upload_id.clear();
+        }
+
+        bool done = false;
+        std::string sha256;
+        for (int attempt = 1; attempt <= MAX_ATTEMPTS && !done; ++attempt) {
+            // Consulta quanto o servidor já tem; sessão desconhecida/expirada recomeça do zero
+            uint64_t committed = 0;
+            bool known = false;
+            if (!upload_id.empty()) {
+                ClientContext qctx; UploadQuery q; UploadStatus st;
+                q.set_upload_id(upload_id);
+                Status s = stub_->QueryUpload(&qctx, q, &st);
+                if (!s.ok()) { std::cerr << "gRPC failed: " << s.error_message() << std::endl; std::this_thread::sleep_for(std::chrono::seconds(1)); continue; }
+                known = st.success();
+                committed = st.committed_offset();
+            }
+            if (!known) {
+                ClientContext sctx; StartUploadRequest sr; UploadStatus st;
+                sr.set_file_name(name); sr.set_total_size(total);
+                Status s = stub_->StartUpload(&sctx, sr, &st);
+                if (!s.ok() || !st.success()) { std::cerr << "Falha ao iniciar upload: " << (s.ok() ? st.status_message() : s.error_message()) << std::endl; std::this_thread::sleep_for(std::chrono::seconds(1)); continue; }
+                upload_id = st.upload_id();
+                committed = 0;
+                fs::create_directories(state.parent_path());
+                std::ofstream(state) << upload_id << " " << total << "\n";
+            }
+            if (committed == total) { done = true; break; }
+            std::cout << "Enviando a partir do byte " << committed << " de " << total << std::endl;
+
+            // Envia apenas o trecho ainda não confirmado
+            ClientContext context;
+            ConfigureCompression(context, input_path);
+            ConfigureChunking(context);
+            auto stream = stub_->UploadChunks(&context);
+            std::ifstream in(input_path, std::ios::binary);
+            in.seekg((std::streamoff)committed);
+            ChunkSizer sizer = NegotiatedChunk(context, *stream); std::vector<char> buf(CHUNK_MAX);
+            uint64_t offset = committed;
+            while (in) {
+                in.read(buf.data(), sizer.Size());
+                auto n = in.gcount();
+                if (n <= 0) break;
+                UploadChunk ch;
+                ch.set_upload_id(upload_id); ch.set_offset(offset); ch.set_content(buf.data(), (size_t)n); ch.set_crc32c(Crc32c(buf.data(), (size_t)n));
+                if (!TimedWrite(*stream, ch, sizer, (size_t)n)) break;
+                offset += (uint64_t)n;
+            }
+            stream->WritesDone();
+            UploadStatus st;
+            bool got = stream->Read(&st);
+            Status s = stream->Finish();
+            if (got && st.complete()) { sha256 = st.sha256(); done = true; break; }
+            std::cerr << "Upload interrompido (" << (got ? st.status_message() : s.error_message()) << "), tentando novamente" << std::endl;
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        if (!done) return false;
+
+        // Upload concluído: a sessão não precisa mais ser retomada; o hash identifica esta
+        // versão como base do próximo upload por delta
+        std::error_code ec;
+        fs::remove(state, ec);
+        if (!sha256.empty()) std::ofstream(BasisStatePath(name)) << sha256 << "\n";
+        return true;
+    }
+
+    // Envia só as diferenças em relação à versão do arquivo enviada por último (base guardada no
+    // servidor, identificada pelo SHA-256 em storage/.uploads/<nome>.basis). Sem base disponível,
+    // ou se o servidor recusar o delta, faz o upload retomável do arquivo inteiro.
+    bool DeltaUpload(const std::string& input_path, std::string& upload_id) {
+        std::string name = fs::path(input_path).filename().string();
+        std::string basis;
+        std::ifstream(BasisStatePath(name)) >> basis;
+        if (basis.empty()) {
+            std::cout << "Nenhuma versão anterior registrada; enviando o arquivo inteiro" << std::endl;
+            return ResumableUpload(input_path, upload_id);
+        }
+
+        // Assinaturas dos blocos da base
+        size_t block_size = 0;
+        std::vector<std::string> strong;
+        std::unordered_map<uint32_t, std::vector<uint64_t>> by_weak;
+        {
+            ClientContext context;
+            SignatureRequest req;
+            req.set_basis_sha256(basis);
+            std::unique_ptr<ClientReader<SignatureBatch>> reader(stub_->GetSignatures(&context, req));
+            SignatureBatch batch;
+            bool ok = true;
+            while (reader->Read(&batch)) {
+                if (!batch.success()) { std::cout << "[server] " << batch.status_message() << std::endl; ok = false; continue; }
+                block_size = batch.block_size();
+                for (const auto& sig : batch.blocks()) {
+                    by_weak[sig.weak()].push_back(strong.size());
+                    strong.push_back(sig.strong());
+                }
+            }
+            Status s = reader->Finish();
+            if (!s.ok() || !ok || block_size == 0) {
+                if (!s.ok()) std::cerr << "gRPC failed: " << s.error_message() << std::endl;
+                std::cout << "Base indisponível; enviando o arquivo inteiro" << std::endl;
+                return ResumableUpload(input_path, upload_id);
+            }
+        }
+
+        // O arquivo novo é lido inteiro para a busca dos blocos
+        std::string data;
+        {
+            std::ifstream in(input_path, std::ios::binary);
+            std::ostringstream ss; ss << in.rdbuf();
+            data = ss.str();
+        }
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(data.data());
+        const size_t n = data.size();
+
+        ClientContext context;
+        ConfigureCompression(context, input_path);
+        auto stream = stub_->UploadDelta(&context);
+
+        // Instruções acumuladas em mensagens de até ~1 MB de literais
+        const size_t MSG_BYTES = 1024 * 1024;
+        DeltaChunk msg;
+        msg.set_basis_sha256(basis);
+        msg.set_block_size((uint32_t)block_size);
+        msg.set_file_name(name);
+        msg.set_total_size(n);
+        msg.set_file_sha256(Hex(Digest(EVP_sha256(), p, n)));
+        size_t msg_bytes = 0;
+        bool sent = true, header_sent = false;
+        auto flush = [&]() {
+            if (sent) sent = stream->Write(msg);
+            msg.Clear();
+            msg_bytes = 0;
+            header_sent = true;
+        };
+        auto literal = [&](size_t from, size_t to) {
+            for (size_t off = from; off < to; off += MSG_BYTES) {
+                size_t len = std::min(MSG_BYTES, to - off);
+                msg.add_ops()->set_literal(data.data() + off, len);
+                msg_bytes += len;
+                if (msg_bytes >= MSG_BYTES) flush();
+            }
+        };
+        // Blocos consecutivos da base viram uma única referência
+        uint64_t copy_first = 0, copy_count = 0;
+        auto flush_copy = [&]() {
+            if (copy_count == 0) return;
+            auto* c = msg.add_ops()->mutable_copy();
+            c->set_first_block(copy_first);
+            c->set_count((uint32_t)copy_count);
+            copy_count = 0;
+            if (msg.ops_size() >= 4096) flush();
+        };
+
+        // Busca estilo rsync: janela deslizante de block_size bytes; em um acerto (checksum fraco
+        // e MD5) a janela pula o bloco inteiro, senão avança um byte
+        RollingSum sum;
+        size_t pos = 0, lit = 0;
+        bool fresh = true;
+        uint64_t literal_bytes = 0;
+        while (pos + block_size <= n) {
+            if (fresh) { sum.Init(p + pos, block_size); fresh = false; }
+            long long match = -1;
+            auto it = by_weak.find(sum.Value());
+            if (it != by_weak.end()) {
+                std::string md5 = Digest(EVP_md5(), p + pos, block_size);
+                for (uint64_t idx : it->second) {
+                    if (strong[idx] != md5) continue;
+                    match = (long long)idx;
+                    if (copy_count > 0 && idx == copy_first + copy_count) break;   // Prefere continuar a sequência
+                }
+            }
+            if (match >= 0) {
+                if (pos > lit) { flush_copy(); literal(lit, pos); literal_bytes += pos - lit; }
+                if (copy_count > 0 && (uint64_t)match != copy_first + copy_count) flush_copy();
+                if (copy_count == 0) copy_first = (uint64_t)match;
+                copy_count++;
+                pos += block_size;
+                lit = pos;
+                fresh = true;
+                continue;
+            }
+            if (pos + block_size < n) sum.Roll(p[pos], p[pos + block_size], block_size);
+            pos++;
+        }
+        if (n > lit) { flush_copy(); literal(lit, n); literal_bytes += n - lit; }
+        flush_copy();
+        if (msg.ops_size() > 0 || !header_sent) flush();
+        stream->WritesDone();
+
+        UploadStatus st;
+        bool got = stream->Read(&st);
+        Status s = stream->Finish();
+        if (!got || !st.success() || !st.complete()) {
+            std::cout << "Delta recusado (" << (got ? st.status_message() : s.error_message()) << "); enviando o arquivo inteiro" << std::endl;
+            return ResumableUpload(input_path, upload_id);
+        }
+        upload_id = st.upload_id();
+        std::ofstream(BasisStatePath(name)) << st.sha256() << "\n";
+        std::cout << "Delta enviado: " << literal_bytes << " bytes literais, " << (n - literal_bytes)
+                  << " bytes reaproveitados da versão anterior (bloco " << block_size << " bytes)" << std::endl;
+        return true;
+    }
+
+    // Comprime um PDF enviado antes por upload retomável (apenas o upload_id trafega)
+    bool CompressPDFUpload(const std::string& upload_id, const std::string& output_path) {
+        ClientContext context;
+        ConfigureCompression(context, "");
+        ConfigureChunking(context);
+        auto stream = stub_->CompressPDF(&context);
+        {
+            FileRequest req;
+            req.set_upload_id(upload_id);
+            req.mutable_compress_pdf_params();
+            stream->Write(req);
+        }
+        stream->WritesDone();
+
+        std::ofstream out(output_path, std::ios::binary); FileResponse resp; OutputIntegrity chk;
+        while (stream->Read(&resp)) {
+            chk.Add(resp);
+            if (resp.has_file_content())
+                out.write(resp.file_content().content().data(), resp.file_content().content().size());
+            if (!resp.success()) std::cout << "[server] success=0 message=" << resp.status_message() << std::endl;
+        }
+        auto status = stream->Finish(); if(!status.ok()){ std::cerr<<"gRPC failed: "<<status.error_message()<<std::endl; return false; }
+        out.close();
+        return VerifyOutput(output_path, chk);
+    }
+
+    // Executa vários passos no servidor com um único envio; só o resultado final é recebido (gravado em out_dir)
+    bool RunPipeline(const std::string& input_path, const std::string& out_dir, const PipelineRequest& steps) {
+        ClientContext context; 
+        ConfigureCompression(context, input_path);
+        ConfigureChunking(context);
+        auto stream = stub_->RunPipeline(&context);
+
+        // Envia os passos no primeiro chunk
+        { 
+            FileRequest req; 
+            req.set_file_name(fs::path(input_path).filename().string()); 
+            *req.mutable_pipeline_params() = steps;
+            stream->Write(req);
+        }
+
+        // Envia o arquivo em pedaços
+        std::ifstream in(input_path, std::ios::binary); 
+        ChunkSizer sizer = NegotiatedChunk(context, *stream);
+        std::vector<char> buf(CHUNK_MAX);
+        while(in){ 
+            in.read(buf.data(), sizer.Size()); 
+            auto n=in.gcount(); 
+
+            if(n<=0) break; 
+
+            FileRequest req; 
+            req.set_file_name(fs::path(input_path).filename().string()); 
+            req.mutable_file_content()->set_content(buf.data(), (size_t)n);
+            req.mutable_file_content()->set_crc32c(Crc32c(buf.data(), (size_t)n)); 
+
+            if (!TimedWrite(*stream, req, sizer, (size_t)n)) break; 
+        }
+        stream->WritesDone(); 
+
+        // Recebe a saída final com o nome definido pelo servidor
+        std::ofstream out;
+        std::string path;
+        OutputIntegrity chk;
+        FileResponse resp;
+        while(stream->Read(&resp)) {
+            if (!out.is_open() && !resp.file_name().empty()) {
+                path = (fs::path(out_dir) / fs::path(resp.file_name()).filename()).string();
+                out.open(path, std::ios::binary);
+                std::cout << "Saída: " << path << std::endl;
+            }
+            chk.Add(resp);
+            if(resp.has_file_content() && out.is_open()) 
+                out.write(resp.file_content().content().data(), resp.file_content().content().size());
+            std::cout << "[server] success=" << resp.success() << " message=" << resp.status_message() << std::endl;
+        }
+        out.close();
+
+        auto status=stream->Finish(); 
+        if(!status.ok()){ 
+            std::cerr<<"gRPC failed: "<<status.error_message()<<std::endl; 
+            return false;
+        } 
+        return path.empty() || VerifyOutput(path, chk);
+    }
+
+    // Comprime um PDF como job assíncrono: upload retomável, SubmitJob, consulta periódica e FetchResult
+    bool CompressPDFJob(const std::string& input_path, const std::string& out_dir) {
+        std::string upload_id;
+        if (!ResumableUpload(input_path, upload_id)) return false;
+
+        JobStatus st;
+        {
+            ClientContext context;
+            FileRequest req;
+            req.set_upload_id(upload_id);
+            req.mutable_compress_pdf_params();
+            Status s = stub_->SubmitJob(&context, req, &st);
+            if (!s.ok()) { std::cerr << "gRPC failed: " << s.error_message() << std::endl; return false; }
+            if (st.job_id().empty()) { std::cout << "[server] " << st.status_message() << std::endl; return false; }
+        }
+        std::cout << "Job " << st.job_id() << ": " << st.status_message() << std::endl;
+
+        // Consulta o estado até o job terminar (a conexão não fica presa durante o processamento)
+        while (st.state() == file_processor::JOB_QUEUED || st.state() == file_processor::JOB_RUNNING) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            ClientContext context;
+            JobQuery q; q.set_job_id(st.job_id());
+            std::string id = st.job_id();
+            Status s = stub_->GetJobStatus(&context, q, &st);
+            if (!s.ok()) { std::cerr << "gRPC failed: " << s.error_message() << std::endl; st.set_job_id(id); continue; }
+        }
+        std::cout << "Job " << st.job_id() << ": " << st.status_message() << std::endl;
+        if (st.state() != file_processor::JOB_DONE) return false;
+
+        // Baixa as saídas do job
+        ClientContext context;
+        ConfigureCompression(context, "");
+        ConfigureChunking(context);
+        JobQuery q; q.set_job_id(st.job_id());
+        std::unique_ptr<ClientReader<FileResponse>> reader(stub_->FetchResult(&context, q));
+        FileResponse resp;
+        std::string current, path;
+        std::ofstream out;
+        OutputIntegrity chk;
+        bool verified = true;
+        while (reader->Read(&resp)) {
+            if (!resp.success()) { std::cout << "[server] success=0 message=" << resp.status_message() << std::endl; continue; }
+            if (resp.file_name() != current) {
+                current = resp.file_name();
+                out.close();
+                if (!path.empty()) verified = VerifyOutput(path, chk) && verified;
+                chk = OutputIntegrity();
+                path = (fs::path(out_dir) / fs::path(current).filename()).string();
+                out.open(path, std::ios::binary);
+                std::cout << "Saída: " << path << std::endl;
+            }
+            chk.Add(resp);
+            if (resp.has_file_content()) out.write(resp.file_content().content().data(), resp.file_content().content().size());
+        }
+        out.close();
+        Status status = reader->Finish();
+        if (!status.ok()) { std::cerr << "gRPC failed: " << status.error_message() << std::endl; return false; }
+        return (path.empty() || VerifyOutput(path, chk)) && verified;
+    }
+
+    // Mostra os percentis de latência por operação, resultado e fase registrados no servidor
+    void ShowLatencyStats() {
+        ClientContext context;
+        LatencyQuery q;
+        LatencyReport report;
+        Status s = stub_->GetLatencyStats(&context, q, &report);
+        if (!s.ok()) { std::cerr << "gRPC failed: " << s.error_message() << std::endl; return; }
+        if (report.series_size() == 0) { std::cout << "Nenhuma requisição registrada" << std::endl; return; }
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "%-24s %-5s %-8s %9s %9s %9s %9s", "operacao", "res", "fase", "amostras", "p50 ms", "p99 ms", "max ms");
+        std::cout << line << std::endl;
+        for (const auto& x : report.series()) {
+            std::snprintf(line, sizeof(line), "%-24s %-5s %-8s %9llu %9.1f %9.1f %9.1f", x.operation().c_str(), x.success() ? "ok" : "falha",
+                          x.phase().c_str(), (unsigned long long)x.count(), x.p50_us() / 1000.0, x.p99_us() / 1000.0, x.max_us() / 1000.0);
+            std::cout << line << std::endl;
+        }
+    }
+
+    // Mostra as requisições em andamento no servidor e a ocupação do pool e da fila de jobs
+    void ShowServerState() {
+        ClientContext context;
+        ServerStateQuery q;
+        ServerState state;
+        Status s = stub_->GetServerState(&context, q, &state);
+        if (!s.ok()) { std::cerr << "gRPC failed: " << s.error_message() << std::endl; return; }
+        std::cout << "Pool: " << state.worker_active() << "/" << state.worker_threads() << " threads ocupadas, " << state.worker_queued() << " na fila"
+                  << " | Jobs: " << state.jobs_running() << " em execução, " << state.jobs_queued() << " na fila"
+                  << " | Buffers de entrada: " << state.ingest_buffer_bytes() / 1024 << " KB | Uptime: " << state.uptime_s() << " s" << std::endl;
+        if (state.requests_size() == 0) { std::cout << "Nenhuma requisição em andamento" << std::endl; return; }
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-5s %-14s %-20s %-8s %9s %9s %10s %10s  %s", "id", "rpc", "operacao", "fase", "total ms", "fase ms", "recebido", "enviado", "arquivo / ferramenta");
+        std::cout << line << std::endl;
+        for (const auto& r : state.requests()) {
+            std::string what = r.file_name();
+            if (r.child_pid() != 0) what += " [" + r.child_tool() + " pid " + std::to_string(r.child_pid()) + "]";
+            std::snprintf(line, sizeof(line), "%-5llu %-14s %-20s %-8s %9.1f %9.1f %10llu %10llu  %s", (unsigned long long)r.id(), r.rpc().c_str(),
+                          r.operation().c_str(), r.phase().c_str(), r.elapsed_us() / 1000.0, r.phase_elapsed_us() / 1000.0,
+                          (unsigned long long)r.bytes_received(), (unsigned long long)r.bytes_sent(), what.c_str());
+            std::cout << line << std::endl;
+        }
     }
 
 private:
+    // Hash da última versão enviada de um arquivo (base do próximo upload por delta)
+    static fs::path BasisStatePath(const std::string& name) {
+        fs::path p = fs::path(StorageDir()) / ".uploads" / (name + ".basis");
+        fs::create_directories(p.parent_path());
+        return p;
+    }
+
     // Stub gRPC para comunicação com o servidor
     std::unique_ptr<FileProcessorService::Stub> stub_;
 };
 
 int main() {
-    std::string server = "localhost:50051";
+    // GRPC_TARGET escolhe o servidor: host:porta ou unix:/caminho.sock (mesmo host, sem TCP/IP)
+    const char* target = std::getenv("GRPC_TARGET");
+    std::string server = (target && *target) ? target : "localhost:50051";
 
     // Cria canal de comunicação com o servidor
-    FileProcessorClient client(grpc::CreateChannel(server, grpc::InsecureChannelCredentials()));
+    FileProcessorClient client(CreateClientChannel(server));
 
     // Criação de Menu para seleção dos serviços
     while (true) {
-        std::cout << "\n=== Cliente C++ ===\n1) CompressPDF\n2) ConvertToTXT\n3) ConvertImageFormat\n4) ResizeImage\n0) Sair\nEscolha: ";
+        std::cout << "\n=== Cliente C++ ===\n1) CompressPDF\n2) ConvertToTXT\n3) ConvertImageFormat\n4) ResizeImage\n5) ResizeImageMulti\n6) CompressPDF (upload retomável)\n7) CompressPDF (job assíncrono)\n8) Pipeline\n9) CompressPDF (upload por delta)\n10) CompressPDF (local, por descritor)\n11) Latências do servidor\n12) Estado do servidor\n0) Sair\nEscolha: ";
 
         int opt; 
         
@@ -322,6 +1359,10 @@ int main() {
 
         std::cin.ignore(1024,'\n');
 
+        // Opção sem arquivo de entrada
+        if (opt==11) { WorkflowSpan wf("Latências do servidor"); client.ShowLatencyStats(); continue; }
+        if (opt==12) { WorkflowSpan wf("Estado do servidor"); client.ShowServerState(); continue; }
+
         std::string input_path = ChooseFile();
 
         if (input_path.empty()) continue;
@@ -329,22 +1370,84 @@ int main() {
 
         if (opt==1) {
             std::string out = (fs::path(StorageDir()) / (base+"_compressed.pdf")).string();
+            WorkflowSpan wf("CompressPDF");
             client.CompressPDF(input_path, out);
             std::cout << "Saída: " << out << std::endl;
         } else if (opt==2) {
             std::string out = (fs::path(StorageDir()) / (base+".txt")).string();
+            WorkflowSpan wf("ConvertToTXT");
             client.ConvertToTXT(input_path, out);
             std::cout << "Saída: " << out << std::endl;
         } else if (opt==3) {
             std::string format; std::cout << "Formato de saída (png/jpg/webp): "; std::getline(std::cin, format);
             std::string out = (fs::path(StorageDir()) / (base+"."+format)).string();
+            WorkflowSpan wf("ConvertImageFormat");
             client.ConvertImageFormat(input_path, out, format);
             std::cout << "Saída: " << out << std::endl;
         } else if (opt==4) {
             int w,h; std::cout << "Largura: "; std::cin>>w; std::cout << " Altura: "; std::cin>>h; std::cin.ignore(1024,'\n');
             std::string out = (fs::path(StorageDir()) / (base+"_"+std::to_string(w)+"x"+std::to_string(h)+".img")).string();
+            WorkflowSpan wf("ResizeImage");
             client.ResizeImage(input_path, out, w, h);
             std::cout << "Saída: " << out << std::endl;
+        } else if (opt==5) {
+            // Aceita "64" (quadrado) ou "64x48" separados por espaço
+            std::string line; std::cout << "Tamanhos (ex: 64 128 256x192): "; std::getline(std::cin >> std::ws, line);
+            std::istringstream iss(line); std::string tok; std::vector<std::pair<int,int>> sizes;
+            while (iss >> tok) {
+                auto x = tok.find('x');
+                int w = std::atoi(tok.substr(0, x).c_str());
+                int h = (x == std::string::npos) ? w : std::atoi(tok.substr(x+1).c_str());
+                if (w>0 && h>0) sizes.emplace_back(w, h);
+            }
+            if (sizes.empty()) { std::cout << "Nenhum tamanho válido." << std::endl; continue; }
+            WorkflowSpan wf("ResizeImageMulti");
+            client.ResizeImageMulti(input_path, StorageDir(), sizes);
+        } else if (opt==6) {
+            WorkflowSpan wf("CompressPDF (upload retomável)");
+            std::string upload_id;
+            if (!client.ResumableUpload(input_path, upload_id)) { std::cout << "Upload não concluído; execute novamente para retomar." << std::endl; continue; }
+            std::string out = (fs::path(StorageDir()) / (base+"_compressed.pdf")).string();
+            client.CompressPDFUpload(upload_id, out);
+            std::cout << "Saída: " << out << std::endl;
+        } else if (opt==7) {
+            WorkflowSpan wf("CompressPDF (job assíncrono)");
+            client.CompressPDFJob(input_path, StorageDir());
+        } else if (opt==10) {
+            const char* sock = std::getenv("LOCAL_HANDOFF_SOCKET");
+            if (!sock || !*sock) { std::cout << "Defina LOCAL_HANDOFF_SOCKET com o socket local do servidor." << std::endl; continue; }
+            FileRequest req; req.mutable_compress_pdf_params();
+            std::string out = (fs::path(StorageDir()) / (base+"_compressed.pdf")).string();
+            WorkflowSpan wf("CompressPDF (local, por descritor)");
+            if (LocalProcess(sock, input_path, req, out)) std::cout << "Saída: " << out << std::endl;
+        } else if (opt==9) {
+            WorkflowSpan wf("CompressPDF (upload por delta)");
+            std::string upload_id;
+            if (!client.DeltaUpload(input_path, upload_id)) { std::cout << "Upload não concluído; execute novamente para retomar." << std::endl; continue; }
+            std::string out = (fs::path(StorageDir()) / (base+"_compressed.pdf")).string();
+            client.CompressPDFUpload(upload_id, out);
+            std::cout << "Saída: " << out << std::endl;
+        } else if (opt==8) {
+            // Passos separados por espaço: convert:webp resize:64x64 compress txt
+            std::string line; std::cout << "Passos (ex: convert:webp resize:64x64): "; std::getline(std::cin >> std::ws, line);
+            std::istringstream iss(line); std::string tok; PipelineRequest steps;
+            while (iss >> tok) {
+                auto c = tok.find(':');
+                std::string op = tok.substr(0, c), arg = (c == std::string::npos) ? "" : tok.substr(c+1);
+                if (op == "convert") steps.add_steps()->mutable_convert_image_format()->set_output_format(arg);
+                else if (op == "resize") {
+                    auto x = arg.find('x');
+                    int w = std::atoi(arg.substr(0, x).c_str());
+                    int h = (x == std::string::npos) ? w : std::atoi(arg.substr(x+1).c_str());
+                    auto* r = steps.add_steps()->mutable_resize_image(); r->set_width(w); r->set_height(h);
+                }
+                else if (op == "compress") steps.add_steps()->mutable_compress_pdf();
+                else if (op == "txt") steps.add_steps()->mutable_convert_to_txt();
+                else std::cout << "Passo ignorado: " << tok << std::endl;
+            }
+            if (steps.steps_size() == 0) { std::cout << "Nenhum passo válido." << std::endl; continue; }
+            WorkflowSpan wf("Pipeline");
+            client.RunPipeline(input_path, StorageDir(), steps);
         }
     }
     return 0;
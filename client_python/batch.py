@@ -2,59 +2,96 @@ import os
 import grpc
 from config_python import file_processor_pb2 as pb2
 from config_python import file_processor_pb2_grpc as pb2_grpc
+from client_python.chunking import NegotiatedChunk, chunk_metadata
+from client_python.integrity import OutputIntegrity, file_chunk
+from client_python.tracing import traced_channel, workflow_span
 
 # Arquivo batch.py: processa arquivos em lote sem interação do usuário.
+# Todos os arquivos seguem em um único stream ProcessBatch (multiplexados por file_id);
+# o servidor processa em paralelo e devolve cada resultado assim que fica pronto.
 
 STORAGE_DIR = os.path.join(os.path.dirname(__file__), 'storage')
 
 
-def stream_file_requests(path: str, params_filler):
-    file_name = os.path.basename(path)
-    first = True
-    with open(path, 'rb') as f:
-        while True:
-            data = f.read(1024 * 1024)
-            if not data:
-                break
-            req = pb2.FileRequest(file_name=file_name, file_content=pb2.FileChunk(content=data))
-            if first:
-                params_filler(req)
-                first = False
-            yield req
-
-
-def save_responses(responses, out_path: str):
-    os.makedirs(os.path.dirname(out_path), exist_ok=True)
-    with open(out_path, 'wb') as f:
+# Parâmetros na primeira mensagem de cada arquivo, depois os chunks no tamanho negociado
+# (um único sizer para o stream inteiro: a vazão é da conexão, não do arquivo)
+def stream_batch_requests(jobs, negotiated):
+    sizer = None
+    for file_id, (path, params_filler, _) in jobs.items():
+        file_name = os.path.basename(path)
+        total = os.path.getsize(path)
+        req = pb2.FileRequest(file_name=file_name)
+        params_filler(req)
+        # O último chunk dispara o processamento do arquivo no servidor
+        yield pb2.BatchRequest(file_id=file_id, request=req, last_chunk=total == 0)
+        if total == 0:
+            continue
+
+        sizer = sizer or negotiated.sizer()
+        sent = 0
+        with open(path, 'rb') as f:
+            for data in sizer.read_chunks(f):
+                sent += len(data)
+                req = pb2.FileRequest(file_name=file_name, file_content=file_chunk(data))
+                yield pb2.BatchRequest(file_id=file_id, request=req, last_chunk=sent >= total)
+
+
+# Grava cada saída ao chegar; no fim de cada arquivo os chunks corrompidos (CRC32C)
+# são buscados de novo com FetchOutput
+def save_batch_responses(responses, jobs, stub):
+    outputs, checks = {}, {}
+    try:
         for r in responses:
-            if r.file_content and r.file_content.content:
-                f.write(r.file_content.content)
+            _, _, out_path = jobs[r.file_id]
+            if r.done:
+                # Fim do arquivo: fecha a saída e mostra o status final
+                f = outputs.pop(r.file_id, None)
+                if f:
+                    f.close()
+                    checks.pop(r.file_id).verify(stub, out_path)
+                print(f"{r.file_id}: {r.response.status_message} -> {out_path}")
+                continue
+            checks.setdefault(r.file_id, OutputIntegrity()).add(r.response)
+            if r.response.file_content and r.response.file_content.content:
+                if r.file_id not in outputs:
+                    os.makedirs(os.path.dirname(out_path), exist_ok=True)
+                    outputs[r.file_id] = open(out_path, 'wb')
+                outputs[r.file_id].write(r.response.file_content.content)
+    finally:
+        for f in outputs.values():
+            f.close()
 
 
 def run_batch():
     host = os.environ.get('GRPC_HOST', 'localhost')
     port = os.environ.get('GRPC_PORT', '50051')
-    address = f"{host}:{port}"
+    # GRPC_TARGET tem precedência: host:porta ou unix:/caminho.sock (mesmo host, sem TCP/IP)
+    address = os.environ.get('GRPC_TARGET') or f"{host}:{port}"
+
+    # file_id -> (entrada, preenchimento dos parâmetros, saída)
+    jobs = {}
+    in_pdf = os.path.join(STORAGE_DIR, 'sample.pdf')
+    if os.path.exists(in_pdf):
+        jobs['compress_pdf'] = (in_pdf, lambda r: r.compress_pdf_params.CopyFrom(pb2.CompressPDFRequest()),
+                                os.path.join(STORAGE_DIR, 'sample_compressed.pdf'))
+        jobs['convert_to_txt'] = (in_pdf, lambda r: r.convert_to_txt_params.CopyFrom(pb2.ConvertToTXTRequest()),
+                                  os.path.join(STORAGE_DIR, 'sample.txt'))
+    in_png = os.path.join(STORAGE_DIR, 'pixel.png')
+    if os.path.exists(in_png):
+        jobs['convert_image'] = (in_png, lambda r: r.convert_image_format_params.CopyFrom(pb2.ConvertImageFormatRequest(output_format='jpg')),
+                                 os.path.join(STORAGE_DIR, 'pixel.jpg'))
+        jobs['resize_image'] = (in_png, lambda r: r.resize_image_params.CopyFrom(pb2.ResizeImageRequest(width=64, height=64)),
+                                os.path.join(STORAGE_DIR, 'pixel_64x64.img'))
+    if not jobs:
+        return
+
     with grpc.insecure_channel(address) as channel:
-        stub = pb2_grpc.FileProcessorServiceStub(channel)
-        # CompressPDF
-        in_pdf = os.path.join(STORAGE_DIR, 'sample.pdf')
-        if os.path.exists(in_pdf):
-            resp = stub.CompressPDF(stream_file_requests(in_pdf, lambda r: r.compress_pdf_params.CopyFrom(pb2.CompressPDFRequest())))
-            save_responses(resp, os.path.join(STORAGE_DIR, 'sample_compressed.pdf'))
-        # ConvertToTXT
-        if os.path.exists(in_pdf):
-            resp = stub.ConvertToTXT(stream_file_requests(in_pdf, lambda r: r.convert_to_txt_params.CopyFrom(pb2.ConvertToTXTRequest())))
-            save_responses(resp, os.path.join(STORAGE_DIR, 'sample.txt'))
-        # ConvertImageFormat
-        in_png = os.path.join(STORAGE_DIR, 'pixel.png')
-        if os.path.exists(in_png):
-            resp = stub.ConvertImageFormat(stream_file_requests(in_png, lambda r: r.convert_image_format_params.CopyFrom(pb2.ConvertImageFormatRequest(output_format='jpg'))))
-            save_responses(resp, os.path.join(STORAGE_DIR, 'pixel.jpg'))
-        # ResizeImage
-        if os.path.exists(in_png):
-            resp = stub.ResizeImage(stream_file_requests(in_png, lambda r: r.resize_image_params.CopyFrom(pb2.ResizeImageRequest(width=64, height=64))))
-            save_responses(resp, os.path.join(STORAGE_DIR, 'pixel_64x64.img'))
+        stub = pb2_grpc.FileProcessorServiceStub(traced_channel(channel))
+        # Respostas comprimidas por padrão; o servidor desliga a compressão para saídas já comprimidas
+        metadata = (('response-compression', os.environ.get('GRPC_COMPRESSION', 'gzip')),) + chunk_metadata()
+        negotiated = NegotiatedChunk()
+        with workflow_span('batch'):
+            save_batch_responses(negotiated.bind(stub.ProcessBatch(stream_batch_requests(jobs, negotiated), metadata=metadata)), jobs, stub)
 
 
 if __name__ == '__main__':
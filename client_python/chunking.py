@@ -0,0 +1,77 @@
+import os
+import threading
+import time
+
+# Tamanho de chunk negociado com o servidor e adaptado à vazão observada (usado por cliente.py e batch.py).
+# O servidor informa o tamanho inicial no metadado "chunk-size" da resposta; CHUNK_SIZE_KB fixa o
+# tamanho nos dois lados (sem adaptação), útil para comparar tamanhos.
+
+# Limites (os mesmos do servidor; o máximo fica abaixo dos 4 MB por mensagem do gRPC)
+CHUNK_MIN = 16 * 1024
+CHUNK_MAX = 2 * 1024 * 1024
+CHUNK_DEFAULT = 256 * 1024
+CHUNK_TARGET_SECONDS = 0.020
+
+
+def _clamp(n: int) -> int:
+    return max(CHUNK_MIN, min(CHUNK_MAX, n))
+
+
+# Metadados com a preferência de chunk (vazio quando o servidor decide)
+def chunk_metadata() -> tuple:
+    kb = os.environ.get('CHUNK_SIZE_KB', '')
+    if not kb:
+        return ()
+    return (('chunk-size', str(int(kb) * 1024)), ('chunk-adapt', '0'))
+
+
+# Cada chunk é dimensionado para levar ~CHUNK_TARGET_SECONDS na vazão observada nos envios anteriores
+class ChunkSizer:
+    def __init__(self, initial: int = CHUNK_DEFAULT, adaptive: bool = True):
+        self.size = _clamp(initial)
+        self.adaptive = adaptive
+        self.bps = 0.0
+
+    def observe(self, nbytes: int, seconds: float):
+        # Chunks parciais (fim do arquivo) medem mais a latência por mensagem que a vazão
+        if seconds <= 0 or nbytes < self.size:
+            return
+        sample = nbytes / seconds
+        self.bps = sample if self.bps == 0 else 0.7 * self.bps + 0.3 * sample
+        if not self.adaptive:
+            return
+        target = int(self.bps * CHUNK_TARGET_SECONDS)
+        target = max(self.size // 2, min(self.size * 2, target))
+        self.size = _clamp(target // CHUNK_MIN * CHUNK_MIN)
+
+    # Lê do arquivo em chunks do tamanho atual; o tempo até o próximo pedido realimenta o tamanho
+    # (o gRPC só pede a próxima mensagem depois de enviar a anterior)
+    def read_chunks(self, f):
+        while True:
+            data = f.read(self.size)
+            if not data:
+                return
+            t0 = time.monotonic()
+            yield data
+            self.observe(len(data), time.monotonic() - t0)
+
+
+# Tamanho escolhido pelo servidor nos metadados iniciais da chamada. O gerador de envio roda em
+# outra thread e só consulta a chamada depois que ela foi criada (bind).
+class NegotiatedChunk:
+    def __init__(self):
+        self._call = None
+        self._ready = threading.Event()
+
+    def bind(self, call):
+        self._call = call
+        self._ready.set()
+        return call
+
+    def sizer(self) -> ChunkSizer:
+        self._ready.wait()
+        size = CHUNK_DEFAULT
+        for key, value in self._call.initial_metadata() or ():
+            if key == 'chunk-size':
+                size = int(value)
+        return ChunkSizer(size, adaptive=not os.environ.get('CHUNK_SIZE_KB'))
@@ -2,11 +2,19 @@ import grpc
 import grpc
 import sys
 import os
+import math
+import time
+import hashlib
+import socket
 from typing import Iterator
 
 # Import gerados pelo protoc (assumidos em config_python)
 from config_python import file_processor_pb2 as pb2
 from config_python import file_processor_pb2_grpc as pb2_grpc
+from client_python.chunking import ChunkSizer, NegotiatedChunk, chunk_metadata
+from client_python.integrity import OutputIntegrity, crc_field, file_chunk
+from client_python.delta import compute_delta, delta_requests, fetch_signatures, literal_bytes
+from client_python.tracing import traced_channel, workflow_span
 
 STORAGE_DIR = os.path.join(os.path.dirname(__file__), 'storage')
 
@@ -38,39 +46,87 @@ def choose_file() -> str:
             pass
         print("Seleção inválida. Tente novamente.")
 
-# Gera stream de FileRequest a partir do arquivo e preenche os parâmetros
-def stream_file_requests(path: str, params_filler) -> Iterator[pb2.FileRequest]:
+# Verifica pelo início do conteúdo se vale a pena comprimir
+# (formatos já comprimidos pela assinatura; demais pela entropia dos bytes)
+def looks_compressible(data: bytes) -> bool:
+    data = data[:64 * 1024]
+    if len(data) < 64:
+        return False
+    magics = (b'\xff\xd8\xff', b'\x89PNG', b'GIF8', b'\x1f\x8b', b'PK\x03\x04', b'\x28\xb5\x2f\xfd')
+    if data.startswith(magics) or (data.startswith(b'RIFF') and data[8:12] == b'WEBP'):
+        return False
+    if data.startswith(b'%PDF'):
+        return not any(m in data for m in (b'/FlateDecode', b'/DCTDecode', b'/JPXDecode', b'/ObjStm'))
+    hist = [0] * 256
+    for b in data:
+        hist[b] += 1
+    entropy = -sum(c / len(data) * math.log2(c / len(data)) for c in hist if c)
+    return entropy < 7.5
+
+
+# Compressão da chamada: o envio só é comprimido se o arquivo parecer compressível;
+# a preferência para as respostas (GRPC_COMPRESSION: gzip, deflate ou none) segue em metadado,
+# junto com a preferência de tamanho de chunk
+def call_options(input_path: str = '') -> dict:
+    pref = os.environ.get('GRPC_COMPRESSION', 'gzip')
+    compression = grpc.Compression.NoCompression
+    if input_path and pref != 'none':
+        with open(input_path, 'rb') as f:
+            if looks_compressible(f.read(64 * 1024)):
+                compression = grpc.Compression.Deflate if pref == 'deflate' else grpc.Compression.Gzip
+    return {'metadata': (('response-compression', pref),) + chunk_metadata(), 'compression': compression}
+
+
+# Gera stream de FileRequest a partir do arquivo: parâmetros na primeira requisição,
+# depois os chunks no tamanho negociado com o servidor (negotiated ligado à chamada)
+def stream_file_requests(path: str, params_filler, negotiated: NegotiatedChunk = None) -> Iterator[pb2.FileRequest]:
     file_name = os.path.basename(path)
-    first = True
+
+    # Preenche os parâmetros específicos da operação na primeira requisição
+    req = pb2.FileRequest(file_name=file_name)
+    params_filler(req)
+    yield req
 
     # Abre o arquivo e lê em chunks pouco a pouco para envio
+    sizer = negotiated.sizer() if negotiated else ChunkSizer()
     with open(path, 'rb') as f:
-        while True:
-            data = f.read(1024 * 1024)
-
-            if not data:
-                break
-
+        for data in sizer.read_chunks(f):
             # Cria chunk para requisição de envio
-            chunk = pb2.FileChunk(content=data)
-            req = pb2.FileRequest(file_name=file_name, file_content=chunk) # envia o chunk
-
-            # Preenche os parâmetros específicos da operação na primeira requisição
-            if first:
-                params_filler(req)
-                first = False
-            yield req # Envia a requisição
+            chunk = file_chunk(data)
+            yield pb2.FileRequest(file_name=file_name, file_content=chunk) # envia o chunk
 
-# Grava as respostas do servidor em um arquivo de saída
-def write_responses_to_file(responses, output_path: str):
+# Grava as respostas do servidor em um arquivo de saída.
+# Com stub, uma resposta interrompida é completada com FetchOutput a partir da saída retida
+# e os chunks corrompidos (CRC32C) são buscados de novo.
+def write_responses_to_file(responses, output_path: str, stub=None):
     os.makedirs(os.path.dirname(output_path), exist_ok=True)
+    chk, total = OutputIntegrity(), 0
     with open(output_path, 'wb') as out:
         # Itera as respostas do servidor
-        for resp in responses:
-            if resp.file_content and resp.file_content.content:
-                out.write(resp.file_content.content) # grava o conteúdo recebido
-            if resp.status_message:
-                print(f"[server] {resp.status_message} (success={resp.success})") # mostra mensagens de status
+        try:
+            for resp in responses:
+                chk.add(resp)
+                if resp.file_content and resp.file_content.content:
+                    out.write(resp.file_content.content) # grava o conteúdo recebido
+                if resp.result_handle:
+                    total = resp.output_size
+                if resp.status_message:
+                    print(f"[server] {resp.status_message} (success={resp.success})") # mostra mensagens de status
+        except grpc.RpcError:
+            if not (stub and chk.handle):
+                raise
+
+        # Busca apenas o trecho que faltou
+        if stub and chk.handle and chk.received < total:
+            print(f"Resposta interrompida em {chk.received}/{total} bytes; retomando")
+            for resp in stub.FetchOutput(pb2.FetchOutputRequest(result_handle=chk.handle, offset=chk.received), **call_options()):
+                chk.add(resp)
+                if resp.file_content and resp.file_content.content:
+                    out.write(resp.file_content.content)
+                if not resp.success:
+                    print(f"[server] {resp.status_message} (success={resp.success})")
+    if stub:
+        chk.verify(stub, output_path)
 
 # Serviço de Compressão de PDF
 def do_compress_pdf(stub, input_path: str):
@@ -78,14 +134,15 @@ def do_compress_pdf(stub, input_path: str):
         req.compress_pdf_params.CopyFrom(pb2.CompressPDFRequest())
 
     # Chama o serviço do servidor
-    responses = stub.CompressPDF(stream_file_requests(input_path, fill_params))
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.CompressPDF(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
 
     # Define o caminho de saída
     base = os.path.splitext(os.path.basename(input_path))[0]
     output_path = os.path.join(STORAGE_DIR, f"{base}_compressed.pdf")
     
     # Escreve a resposta da requisição em arquivo de saída
-    write_responses_to_file(responses, output_path)
+    write_responses_to_file(responses, output_path, stub)
     print(f"Saída salva em: {output_path}")
 
 
@@ -94,14 +151,15 @@ def do_convert_to_txt(stub, input_path: str):
         req.convert_to_txt_params.CopyFrom(pb2.ConvertToTXTRequest())
 
     # Chama o serviço do servidor
-    responses = stub.ConvertToTXT(stream_file_requests(input_path, fill_params))
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.ConvertToTXT(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
 
     # Define o caminho de saída
     base = os.path.splitext(os.path.basename(input_path))[0]
     output_path = os.path.join(STORAGE_DIR, f"{base}.txt")
 
     # Escreve a resposta da requisição em arquivo de saída
-    write_responses_to_file(responses, output_path)
+    write_responses_to_file(responses, output_path, stub)
     print(f"Saída salva em: {output_path}")
 
 
@@ -113,14 +171,15 @@ def do_convert_image_format(stub, input_path: str):
         req.convert_image_format_params.CopyFrom(pb2.ConvertImageFormatRequest(output_format=out_format))
 
     # Chama o serviço do servidor
-    responses = stub.ConvertImageFormat(stream_file_requests(input_path, fill_params))
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.ConvertImageFormat(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
 
     # Define o caminho de saída
     base = os.path.splitext(os.path.basename(input_path))[0]
     output_path = os.path.join(STORAGE_DIR, f"{base}.{out_format}")
 
     # Escreve a resposta da requisição em arquivo de saída
-    write_responses_to_file(responses, output_path)
+    write_responses_to_file(responses, output_path, stub)
     print(f"Saída salva em: {output_path}")
 
 
@@ -138,40 +197,422 @@ def do_resize_image(stub, input_path: str):
         req.resize_image_params.CopyFrom(pb2.ResizeImageRequest(width=width, height=height))
 
     # Chama o serviço do servidor
-    responses = stub.ResizeImage(stream_file_requests(input_path, fill_params))
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.ResizeImage(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
 
     # Define o caminho de saída
     base = os.path.splitext(os.path.basename(input_path))[0]
     output_path = os.path.join(STORAGE_DIR, f"{base}_{width}x{height}.img")
 
     # Escreve a resposta da requisição em arquivo de saída
-    write_responses_to_file(responses, output_path)
+    write_responses_to_file(responses, output_path, stub)
     print(f"Saída salva em: {output_path}")
 
 
+# Gera várias miniaturas com um único envio; cada saída chega identificada por file_name
+def do_resize_image_multi(stub, input_path: str):
+    sizes = []
+    while not sizes:
+        # Aceita "64" (quadrado) ou "64x48", separados por espaço
+        for tok in input("Tamanhos (ex: 64 128 256x192): ").split():
+            w, _, h = tok.partition('x')
+            try:
+                w = int(w)
+                h = int(h) if h else w
+            except ValueError:
+                continue
+            if w > 0 and h > 0:
+                sizes.append(pb2.ImageSize(width=w, height=h))
+        if not sizes:
+            print("Valores inválidos, tente novamente.")
+
+    def fill_params(req: pb2.FileRequest):
+        req.resize_image_multi_params.CopyFrom(pb2.ResizeImageMultiRequest(sizes=sizes))
+
+    # Chama o serviço do servidor
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.ResizeImageMulti(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
+
+    # Grava cada saída em um arquivo próprio, trocando de arquivo quando o nome muda
+    # (cada saída é verificada ao terminar)
+    current, out, chk = None, None, None
+    try:
+        for resp in responses:
+            if resp.file_name and resp.file_name != current:
+                if out:
+                    out.close()
+                    chk.verify(stub, out.name)
+                current, chk = resp.file_name, OutputIntegrity()
+                output_path = os.path.join(STORAGE_DIR, os.path.basename(current))
+                out = open(output_path, 'wb')
+                print(f"Saída salva em: {output_path}")
+            if chk:
+                chk.add(resp)
+            if out and resp.file_content and resp.file_content.content:
+                out.write(resp.file_content.content)
+            if not resp.success:
+                print(f"[server] {resp.status_message} (success={resp.success})")
+    finally:
+        if out:
+            out.close()
+    if out:
+        chk.verify(stub, out.name)
+
+
+# Executa vários passos no servidor com um único envio; só o resultado final é recebido
+def do_pipeline(stub, input_path: str):
+    steps = []
+    while not steps:
+        # Passos separados por espaço: convert:webp resize:64x64 compress txt
+        for tok in input("Passos (ex: convert:webp resize:64x64): ").split():
+            op, _, arg = tok.partition(':')
+            if op == 'convert':
+                steps.append(pb2.PipelineStep(convert_image_format=pb2.ConvertImageFormatRequest(output_format=arg)))
+            elif op == 'resize':
+                w, _, h = arg.partition('x')
+                try:
+                    w = int(w)
+                    h = int(h) if h else w
+                except ValueError:
+                    print(f"Passo ignorado: {tok}")
+                    continue
+                steps.append(pb2.PipelineStep(resize_image=pb2.ResizeImageRequest(width=w, height=h)))
+            elif op == 'compress':
+                steps.append(pb2.PipelineStep(compress_pdf=pb2.CompressPDFRequest()))
+            elif op == 'txt':
+                steps.append(pb2.PipelineStep(convert_to_txt=pb2.ConvertToTXTRequest()))
+            else:
+                print(f"Passo ignorado: {tok}")
+        if not steps:
+            print("Nenhum passo válido, tente novamente.")
+
+    def fill_params(req: pb2.FileRequest):
+        req.pipeline_params.CopyFrom(pb2.PipelineRequest(steps=steps))
+
+    # Chama o serviço do servidor
+    negotiated = NegotiatedChunk()
+    responses = negotiated.bind(stub.RunPipeline(stream_file_requests(input_path, fill_params, negotiated), **call_options(input_path)))
+
+    # Grava a saída final com o nome definido pelo servidor
+    out, chk = None, OutputIntegrity()
+    try:
+        for resp in responses:
+            if out is None and resp.file_name:
+                output_path = os.path.join(STORAGE_DIR, os.path.basename(resp.file_name))
+                out = open(output_path, 'wb')
+                print(f"Saída salva em: {output_path}")
+            chk.add(resp)
+            if out and resp.file_content and resp.file_content.content:
+                out.write(resp.file_content.content)
+            if resp.status_message:
+                print(f"[server] {resp.status_message} (success={resp.success})")
+    finally:
+        if out:
+            out.close()
+    if out:
+        chk.verify(stub, out.name)
+
+
+# Envia o arquivo por upload retomável e retorna o upload_id.
+# O id fica salvo em storage/.uploads/ para que uma nova execução continue de onde parou.
+def resumable_upload(stub, input_path: str, max_attempts: int = 5) -> str:
+    name = os.path.basename(input_path)
+    total = os.path.getsize(input_path)
+    state_path = os.path.join(STORAGE_DIR, '.uploads', name + '.id')
+
+    # Sessão anterior para o mesmo arquivo (mesmo tamanho)
+    upload_id = ''
+    if os.path.exists(state_path):
+        with open(state_path) as f:
+            parts = f.read().split()
+        if len(parts) == 2 and parts[1] == str(total):
+            upload_id = parts[0]
+
+    def chunks(upload_id, offset, negotiated):
+        sizer = negotiated.sizer()
+        with open(input_path, 'rb') as f:
+            f.seek(offset)
+            for data in sizer.read_chunks(f):
+                yield pb2.UploadChunk(upload_id=upload_id, offset=offset, content=data, **crc_field(data))
+                offset += len(data)
+
+    for _ in range(max_attempts):
+        try:
+            # Consulta quanto o servidor já tem; sessão desconhecida/expirada recomeça do zero
+            st = stub.QueryUpload(pb2.UploadQuery(upload_id=upload_id)) if upload_id else None
+            if not st or not st.success:
+                st = stub.StartUpload(pb2.StartUploadRequest(file_name=name, total_size=total))
+                if not st.success:
+                    raise RuntimeError(st.status_message)
+                upload_id = st.upload_id
+                os.makedirs(os.path.dirname(state_path), exist_ok=True)
+                with open(state_path, 'w') as f:
+                    f.write(f"{upload_id} {total}\n")
+            if not st.complete:
+                print(f"Enviando a partir do byte {st.committed_offset} de {total}")
+                negotiated = NegotiatedChunk()
+                for st in negotiated.bind(stub.UploadChunks(chunks(upload_id, st.committed_offset, negotiated), **call_options(input_path))):
+                    pass
+            if st.complete:
+                # Upload concluído: a sessão não precisa mais ser retomada; o hash identifica
+                # esta versão como base do próximo upload por delta
+                os.remove(state_path)
+                if st.sha256:
+                    save_basis(name, st.sha256)
+                return upload_id
+            print(f"Upload interrompido ({st.status_message}), tentando novamente")
+        except grpc.RpcError as e:
+            print(f"Upload interrompido ({e.code()}), tentando novamente")
+        time.sleep(1)
+    return ''
+
+
+# Hash da última versão enviada de um arquivo (base do próximo upload por delta)
+def basis_path(name: str) -> str:
+    return os.path.join(STORAGE_DIR, '.uploads', name + '.basis')
+
+
+def save_basis(name: str, sha256: str):
+    os.makedirs(os.path.dirname(basis_path(name)), exist_ok=True)
+    with open(basis_path(name), 'w') as f:
+        f.write(sha256 + "\n")
+
+
+# Envia só as diferenças em relação à versão do arquivo enviada por último (ver client_python/delta.py).
+# Sem base disponível, ou se o servidor recusar o delta, faz o upload retomável do arquivo inteiro.
+def delta_upload(stub, input_path: str) -> str:
+    name = os.path.basename(input_path)
+    basis = ''
+    if os.path.exists(basis_path(name)):
+        with open(basis_path(name)) as f:
+            basis = f.read().strip()
+    if not basis:
+        print("Nenhuma versão anterior registrada; enviando o arquivo inteiro")
+        return resumable_upload(stub, input_path)
+    sigs = fetch_signatures(stub, basis)
+    if sigs is None:
+        print("Base indisponível; enviando o arquivo inteiro")
+        return resumable_upload(stub, input_path)
+
+    # O arquivo novo é lido inteiro para a busca dos blocos
+    with open(input_path, 'rb') as f:
+        data = f.read()
+    ops = compute_delta(data, sigs)
+    header = dict(basis_sha256=basis, block_size=sigs.block_size, file_name=name,
+                  total_size=len(data), file_sha256=hashlib.sha256(data).hexdigest())
+    st = None
+    try:
+        for st in stub.UploadDelta(delta_requests(data, ops, header), **call_options(input_path)):
+            pass
+    except grpc.RpcError as e:
+        print(f"Erro gRPC: {e.code()} - {e.details()}")
+    if not st or not st.success or not st.complete:
+        print(f"Delta recusado ({st.status_message if st else 'sem resposta'}); enviando o arquivo inteiro")
+        return resumable_upload(stub, input_path)
+
+    save_basis(name, st.sha256)
+    literal = literal_bytes(ops)
+    print(f"Delta enviado: {literal} bytes literais, {len(data) - literal} bytes reaproveitados "
+          f"da versão anterior (bloco {sigs.block_size} bytes)")
+    return st.upload_id
+
+
+# Comprime um PDF enviado por upload retomável ou por delta (apenas o upload_id trafega na operação)
+def do_compress_pdf_resumable(stub, input_path: str, delta: bool = False):
+    upload_id = delta_upload(stub, input_path) if delta else resumable_upload(stub, input_path)
+    if not upload_id:
+        print("Upload não concluído; execute novamente para retomar.")
+        return
+
+    req = pb2.FileRequest(upload_id=upload_id, compress_pdf_params=pb2.CompressPDFRequest())
+    responses = stub.CompressPDF(iter([req]), **call_options())
+
+    base = os.path.splitext(os.path.basename(input_path))[0]
+    output_path = os.path.join(STORAGE_DIR, f"{base}_compressed.pdf")
+    write_responses_to_file(responses, output_path, stub)
+    print(f"Saída salva em: {output_path}")
+
+
+# Comprime um PDF como job assíncrono: upload retomável, SubmitJob, consulta periódica e FetchResult
+def do_compress_pdf_job(stub, input_path: str):
+    upload_id = resumable_upload(stub, input_path)
+    if not upload_id:
+        print("Upload não concluído; execute novamente para retomar.")
+        return
+
+    st = stub.SubmitJob(pb2.FileRequest(upload_id=upload_id, compress_pdf_params=pb2.CompressPDFRequest()))
+    if not st.job_id:
+        print(f"[server] {st.status_message}")
+        return
+    print(f"Job {st.job_id}: {st.status_message}")
+
+    # Consulta o estado até o job terminar (a conexão não fica presa durante o processamento)
+    while st.state in (pb2.JOB_QUEUED, pb2.JOB_RUNNING):
+        time.sleep(1)
+        st = stub.GetJobStatus(pb2.JobQuery(job_id=st.job_id))
+    print(f"Job {st.job_id}: {st.status_message}")
+    if st.state != pb2.JOB_DONE:
+        return
+
+    # Baixa as saídas do job, trocando de arquivo quando o nome muda (cada uma verificada ao terminar)
+    current, out, chk = None, None, None
+    try:
+        for resp in stub.FetchResult(pb2.JobQuery(job_id=st.job_id), **call_options()):
+            if not resp.success:
+                print(f"[server] {resp.status_message} (success={resp.success})")
+                continue
+            if resp.file_name != current:
+                if out:
+                    out.close()
+                    chk.verify(stub, out.name)
+                current, chk = resp.file_name, OutputIntegrity()
+                output_path = os.path.join(STORAGE_DIR, os.path.basename(current))
+                out = open(output_path, 'wb')
+                print(f"Saída salva em: {output_path}")
+            chk.add(resp)
+            if resp.file_content and resp.file_content.content:
+                out.write(resp.file_content.content)
+    finally:
+        if out:
+            out.close()
+    if out:
+        chk.verify(stub, out.name)
+
+
+# Copia o conteúdo do descritor recebido para path dentro do kernel (sem passar pelo Python)
+def copy_fd_to_file(fd: int, path: str):
+    with open(path, 'wb') as out:
+        offset = 0
+        while True:
+            try:
+                n = os.copy_file_range(fd, out.fileno(), 1 << 30, offset)
+            except OSError:
+                n = os.sendfile(out.fileno(), fd, offset, 1 << 30)
+            if n == 0:
+                break
+            offset += n
+
+
+# Comprime um PDF pelo socket local do servidor (mesmo host, LOCAL_HANDOFF_SOCKET): a requisição leva
+# só os parâmetros e o descritor do arquivo; a saída volta como descritor (ver server_cpp/fd_handoff.h)
+def do_compress_pdf_local(input_path: str):
+    sock_path = os.environ.get('LOCAL_HANDOFF_SOCKET', '')
+    if not sock_path:
+        print("Defina LOCAL_HANDOFF_SOCKET com o socket local do servidor.")
+        return
+    req = pb2.FileRequest(file_name=os.path.basename(input_path), compress_pdf_params=pb2.CompressPDFRequest())
+    base = os.path.splitext(os.path.basename(input_path))[0]
+    output_path = os.path.join(STORAGE_DIR, f"{base}_compressed.pdf")
+
+    with socket.socket(socket.AF_UNIX, socket.SOCK_SEQPACKET) as sock, open(input_path, 'rb') as f:
+        sock.connect(sock_path)
+        try:
+            socket.send_fds(sock, [req.SerializeToString()], [f.fileno()])
+        except (BrokenPipeError, ConnectionResetError):
+            pass  # Servidor ocupado: a resposta final com a recusa ainda pode ser lida
+        # Uma resposta por saída (com descritor) e a final, sem descritor
+        while True:
+            try:
+                data, fds, _, _ = socket.recv_fds(sock, 64 * 1024, 1)
+            except ConnectionResetError:
+                data, fds = b'', []
+            if not data and not fds:
+                print("Conexão local encerrada sem resposta final")
+                return
+            resp = pb2.FileResponse.FromString(data)
+            if not fds:
+                print(f"[server] {resp.status_message} (success={resp.success})")
+                if not resp.success:
+                    return
+                break
+            try:
+                copy_fd_to_file(fds[0], output_path)
+            finally:
+                os.close(fds[0])
+    print(f"Saída salva em: {output_path}")
+
+
+# Mostra os percentis de latência por operação, resultado e fase registrados no servidor
+def show_latency_stats(stub):
+    report = stub.GetLatencyStats(pb2.LatencyQuery())
+    if not report.series:
+        print("Nenhuma requisição registrada")
+        return
+    print(f"{'operação':<24} {'res':<5} {'fase':<8} {'amostras':>9} {'p50 ms':>9} {'p99 ms':>9} {'máx ms':>9}")
+    for s in report.series:
+        print(f"{s.operation:<24} {'ok' if s.success else 'falha':<5} {s.phase:<8} {s.count:>9} "
+              f"{s.p50_us / 1000:>9.1f} {s.p99_us / 1000:>9.1f} {s.max_us / 1000:>9.1f}")
+
+
+# Mostra as requisições em andamento no servidor e a ocupação do pool e da fila de jobs
+def show_server_state(stub):
+    st = stub.GetServerState(pb2.ServerStateQuery())
+    print(f"Pool: {st.worker_active}/{st.worker_threads} threads ocupadas, {st.worker_queued} na fila"
+          f" | Jobs: {st.jobs_running} em execução, {st.jobs_queued} na fila"
+          f" | Buffers de entrada: {st.ingest_buffer_bytes // 1024} KB | Uptime: {st.uptime_s} s")
+    if not st.requests:
+        print("Nenhuma requisição em andamento")
+        return
+    print(f"{'id':<5} {'rpc':<14} {'operação':<20} {'fase':<8} {'total ms':>9} {'fase ms':>9} "
+          f"{'recebido':>10} {'enviado':>10}  arquivo / ferramenta")
+    for r in st.requests:
+        what = r.file_name
+        if r.child_pid:
+            what += f" [{r.child_tool} pid {r.child_pid}]"
+        print(f"{r.id:<5} {r.rpc:<14} {r.operation:<20} {r.phase:<8} {r.elapsed_us / 1000:>9.1f} "
+              f"{r.phase_elapsed_us / 1000:>9.1f} {r.bytes_received:>10} {r.bytes_sent:>10}  {what}")
+
+
+# Opções do menu (o nome também identifica o span da opção no tracing)
+MENU = {
+    '1': 'CompressPDF',
+    '2': 'ConvertToTXT',
+    '3': 'ConvertImageFormat',
+    '4': 'ResizeImage',
+    '5': 'ResizeImageMulti',
+    '6': 'CompressPDF (upload retomável)',
+    '7': 'CompressPDF (job assíncrono)',
+    '8': 'Pipeline',
+    '9': 'CompressPDF (upload por delta)',
+    '10': 'CompressPDF (local, por descritor)',
+    '11': 'Latências do servidor',
+    '12': 'Estado do servidor',
+}
+
+
 def main():
     host = os.environ.get('GRPC_HOST', 'localhost')
     port = os.environ.get('GRPC_PORT', '50051')
-    address = f"{host}:{port}"
+    # GRPC_TARGET tem precedência: host:porta ou unix:/caminho.sock (mesmo host, sem TCP/IP)
+    address = os.environ.get('GRPC_TARGET') or f"{host}:{port}"
 
     # Conecta ao servidor gRPC
     with grpc.insecure_channel(address) as channel:
-        stub = pb2_grpc.FileProcessorServiceStub(channel)
+        stub = pb2_grpc.FileProcessorServiceStub(traced_channel(channel))
 
         # Apresenta menu para seleção de serviços
         while True:
             print("\n=== Cliente Python ===")
-            print("1) CompressPDF")
-            print("2) ConvertToTXT")
-            print("3) ConvertImageFormat")
-            print("4) ResizeImage")
+            for key, name in MENU.items():
+                print(f"{key}) {name}")
             print("0) Sair")
 
             opt = input("Escolha: ").strip()
 
             if opt == '0':
                 break
-            if opt not in {'1','2','3','4'}:
+            # Opção sem arquivo de entrada
+            if opt in ('11', '12'):
+                try:
+                    with workflow_span(MENU[opt]):
+                        if opt == '11':
+                            show_latency_stats(stub)
+                        else:
+                            show_server_state(stub)
+                except grpc.RpcError as e:
+                    print(f"Erro gRPC: {e.code()} - {e.details()}")
+                continue
+            if opt not in {'1','2','3','4','5','6','7','8','9','10'}:
                 print("Opção inválida")
                 continue
             path = choose_file()
@@ -180,14 +621,27 @@ def main():
 
             # Chama o serviço de acordo com a opção escolhida
             try:
-                if opt == '1':
-                    do_compress_pdf(stub, path)
-                elif opt == '2':
-                    do_convert_to_txt(stub, path)
-                elif opt == '3':
-                    do_convert_image_format(stub, path)
-                elif opt == '4':
-                    do_resize_image(stub, path)
+                with workflow_span(MENU[opt]):
+                    if opt == '1':
+                        do_compress_pdf(stub, path)
+                    elif opt == '2':
+                        do_convert_to_txt(stub, path)
+                    elif opt == '3':
+                        do_convert_image_format(stub, path)
+                    elif opt == '4':
+                        do_resize_image(stub, path)
+                    elif opt == '5':
+                        do_resize_image_multi(stub, path)
+                    elif opt == '6':
+                        do_compress_pdf_resumable(stub, path)
+                    elif opt == '7':
+                        do_compress_pdf_job(stub, path)
+                    elif opt == '8':
+                        do_pipeline(stub, path)
+                    elif opt == '9':
+                        do_compress_pdf_resumable(stub, path, delta=True)
+                    elif opt == '10':
+                        do_compress_pdf_local(path)
             # Erro na seleção do serviço
             except grpc.RpcError as e:
                 print(f"Erro gRPC: {e.code()} - {e.details()}")
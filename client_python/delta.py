@@ -0,0 +1,115 @@
+import hashlib
+from itertools import accumulate
+from typing import Iterator
+
+import grpc
+
+from config_python import file_processor_pb2 as pb2
+
+# Upload por delta estilo rsync (usado por cliente.py): o servidor devolve as assinaturas dos
+# blocos da versão enviada antes (checksum rolante + MD5) e o cliente envia só bytes literais e
+# referências a blocos dessa base.
+
+MSG_BYTES = 1024 * 1024     # Literais por mensagem
+MAX_OPS = 4096              # Instruções por mensagem
+
+
+class Signatures:
+    def __init__(self):
+        self.block_size = 0
+        self.strong = []        # MD5 de cada bloco, em ordem
+        self.by_weak = {}       # checksum rolante -> índices dos blocos
+        self.by_strong = {}     # MD5 -> primeiro índice
+
+
+# Assinaturas da base (None se o servidor não a tem mais)
+def fetch_signatures(stub, basis_sha256: str):
+    sigs = Signatures()
+    try:
+        for batch in stub.GetSignatures(pb2.SignatureRequest(basis_sha256=basis_sha256)):
+            if not batch.success:
+                print(f"[server] {batch.status_message}")
+                return None
+            sigs.block_size = batch.block_size
+            for sig in batch.blocks:
+                idx = len(sigs.strong)
+                sigs.by_weak.setdefault(sig.weak, []).append(idx)
+                sigs.by_strong.setdefault(sig.strong, idx)
+                sigs.strong.append(sig.strong)
+    except grpc.RpcError as e:
+        print(f"Erro gRPC: {e.code()} - {e.details()}")
+        return None
+    return sigs if sigs.block_size else None
+
+
+# Instruções do delta: ('L', início, fim) para bytes literais e ('C', primeiro_bloco, quantidade).
+# A janela de block_size bytes desliza um byte por vez atualizando o checksum rolante; em um
+# acerto (checksum e MD5) pula o bloco inteiro. Logo após um acerto o MD5 da janela é procurado
+# direto, o que mantém rápidas as regiões sem alteração.
+def compute_delta(data: bytes, sigs: Signatures) -> list:
+    L, n = sigs.block_size, len(data)
+    ops = []
+    pos = lit = 0
+    fresh = True
+    a = b = 0
+
+    def match(idx):
+        nonlocal pos, lit, fresh
+        if pos > lit:
+            ops.append(('L', lit, pos))
+        if ops and ops[-1][0] == 'C' and ops[-1][1] + ops[-1][2] == idx:
+            ops[-1] = ('C', ops[-1][1], ops[-1][2] + 1)
+        else:
+            ops.append(('C', idx, 1))
+        pos += L
+        lit = pos
+        fresh = True
+
+    while pos + L <= n:
+        if fresh:
+            window = data[pos:pos + L]
+            idx = sigs.by_strong.get(hashlib.md5(window).digest())
+            if idx is not None:
+                match(idx)
+                continue
+            sums = list(accumulate(window))
+            a, b = sums[-1], sum(sums)
+            fresh = False
+        else:
+            candidates = sigs.by_weak.get(((b & 0xffff) << 16) | (a & 0xffff))
+            if candidates:
+                md5 = hashlib.md5(data[pos:pos + L]).digest()
+                found = [idx for idx in candidates if sigs.strong[idx] == md5]
+                if found:
+                    match(found[0])
+                    continue
+        if pos + L < n:
+            out = data[pos]
+            a += data[pos + L] - out
+            b += a - L * out
+        pos += 1
+    if n > lit:
+        ops.append(('L', lit, n))
+    return ops
+
+
+# Mensagens do UploadDelta; a primeira leva o cabeçalho (base, nome, tamanho e SHA-256)
+def delta_requests(data: bytes, ops: list, header: dict) -> Iterator[pb2.DeltaChunk]:
+    # Literais longos são divididos em pedaços de até MSG_BYTES
+    pieces = ((kind, off, min(off + MSG_BYTES, y)) if kind == 'L' else (kind, x, y)
+              for kind, x, y in ops for off in (range(x, y, MSG_BYTES) if kind == 'L' else (x,)))
+    msg, size = pb2.DeltaChunk(**header), 0
+    for kind, x, y in pieces:
+        if kind == 'C':
+            msg.ops.add(copy=pb2.BlockRange(first_block=x, count=y))
+        else:
+            msg.ops.add(literal=data[x:y])
+            size += y - x
+        if size >= MSG_BYTES or len(msg.ops) >= MAX_OPS:
+            yield msg
+            msg, size = pb2.DeltaChunk(), 0
+    yield msg
+
+
+def literal_bytes(ops: list) -> int:
+    return sum(y - x for kind, x, y in ops if kind == 'L')
@@ -0,0 +1,80 @@
+import grpc
+
+from config_python import file_processor_pb2 as pb2
+
+# CRC32C dos chunks e das saídas (usado por cliente.py e batch.py).
+# O cálculo usa o pacote google-crc32c, cuja extensão em C usa as instruções SSE4.2/ARMv8;
+# sem ela os chunks seguem sem CRC e a verificação fica desligada (em Python puro seria lento demais).
+try:
+    import google_crc32c
+    if google_crc32c.implementation != 'c':
+        google_crc32c = None
+except ImportError:
+    google_crc32c = None
+
+
+def crc32c(data: bytes, crc: int = 0):
+    return google_crc32c.extend(crc, data) if google_crc32c else None
+
+
+# Campo crc32c para o construtor da mensagem (vazio quando não há CRC disponível)
+def crc_field(data: bytes) -> dict:
+    crc = crc32c(data)
+    return {} if crc is None else {'crc32c': crc}
+
+
+def file_chunk(data: bytes) -> pb2.FileChunk:
+    return pb2.FileChunk(content=data, **crc_field(data))
+
+
+# Integridade de uma saída recebida: confere o CRC32C de cada chunk, guarda os trechos
+# corrompidos (buscados de novo com FetchOutput, sem refazer a transformação) e o CRC da saída inteira
+class OutputIntegrity:
+    def __init__(self):
+        self.handle = ''
+        self.received = 0
+        self.bad = []       # (offset, tamanho)
+        self.digest = None
+
+    def add(self, resp: pb2.FileResponse):
+        if resp.result_handle:
+            self.handle = resp.result_handle
+        if resp.HasField('output_crc32c'):
+            self.digest = resp.output_crc32c
+        content = resp.file_content.content
+        if not content:
+            return
+        if resp.file_content.HasField('crc32c') and google_crc32c and crc32c(content) != resp.file_content.crc32c:
+            self.bad.append((self.received, len(content)))
+        self.received += len(content)
+
+    # Busca de novo os trechos corrompidos do arquivo já gravado em path e confere o CRC inteiro
+    def verify(self, stub, path: str) -> bool:
+        for offset, length in self.bad:
+            print(f"Chunk corrompido em {offset} ({length} bytes); buscando de novo")
+            if not self.handle or not any(self._refetch(stub, path, offset, length) for _ in range(3)):
+                print("Não foi possível recuperar o trecho corrompido")
+                return False
+        if self.digest is None or not google_crc32c:
+            return True
+        crc = 0
+        with open(path, 'rb') as f:
+            for block in iter(lambda: f.read(1024 * 1024), b''):
+                crc = crc32c(block, crc)
+        if crc != self.digest:
+            print(f"CRC32C da saída não confere: {path}")
+            return False
+        return True
+
+    def _refetch(self, stub, path: str, offset: int, length: int) -> bool:
+        try:
+            with open(path, 'r+b') as f:
+                f.seek(offset)
+                for resp in stub.FetchOutput(pb2.FetchOutputRequest(result_handle=self.handle, offset=offset, length=length)):
+                    content = resp.file_content.content
+                    if not resp.success or (resp.file_content.HasField('crc32c') and crc32c(content) != resp.file_content.crc32c):
+                        return False
+                    f.write(content)
+            return True
+        except grpc.RpcError:
+            return False
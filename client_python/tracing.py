@@ -0,0 +1,120 @@
+import collections
+import contextlib
+import json
+import os
+import secrets
+import threading
+import time
+
+import grpc
+
+# Tracing do cliente (TRACE_DIR): cada opção do menu abre um span raiz e cada RPC um span filho,
+# criado pelo interceptor do canal e propagado ao servidor no metadado traceparent (W3C).
+# Os spans são gravados em TRACE_DIR/client-python.otlp.jsonl, uma ExportTraceServiceRequest
+# em JSON por linha (OTLP-JSON), sem coletor.
+
+_lock = threading.Lock()
+_current = threading.local()
+
+
+def _trace_path() -> str:
+    d = os.environ.get('TRACE_DIR', '')
+    if not d:
+        return ''
+    os.makedirs(d, exist_ok=True)
+    return os.path.join(d, 'client-python.otlp.jsonl')
+
+
+def tracing_enabled() -> bool:
+    return bool(os.environ.get('TRACE_DIR'))
+
+
+class Span:
+    def __init__(self, name: str, parent=None, kind: int = 1):
+        self.trace_id = parent.trace_id if parent else secrets.token_hex(16)
+        self.parent_id = parent.span_id if parent else ''
+        self.span_id = secrets.token_hex(8)
+        self.name = name
+        self.kind = kind                    # 1 interno, 3 cliente (valores do OTLP)
+        self.start = time.time_ns()
+        self.ok = True
+        self.message = ''
+
+    def traceparent(self) -> str:
+        return f"00-{self.trace_id}-{self.span_id}-01"
+
+    def end(self):
+        path = _trace_path()
+        if not path:
+            return
+        span = {'traceId': self.trace_id, 'spanId': self.span_id, 'name': self.name, 'kind': self.kind,
+                'startTimeUnixNano': str(self.start), 'endTimeUnixNano': str(time.time_ns()),
+                'status': {'code': 0 if self.ok else 2, **({'message': self.message} if self.message else {})}}
+        if self.parent_id:
+            span['parentSpanId'] = self.parent_id
+        line = {'resourceSpans': [{
+            'resource': {'attributes': [{'key': 'service.name', 'value': {'stringValue': 'file-processor-client-python'}}]},
+            'scopeSpans': [{'scope': {'name': 'projeto_grpc'}, 'spans': [span]}]}]}
+        with _lock, open(path, 'a') as f:
+            f.write(json.dumps(line, ensure_ascii=False) + '\n')
+
+
+# Span da opção do menu; as RPCs feitas dentro do bloco ficam como filhas
+@contextlib.contextmanager
+def workflow_span(name: str):
+    if not tracing_enabled():
+        yield
+        return
+    span = Span(name)
+    _current.span = span
+    try:
+        yield
+    except Exception as e:
+        span.ok, span.message = False, str(e)
+        raise
+    finally:
+        _current.span = None
+        span.end()
+
+
+class _CallDetails(collections.namedtuple('_CallDetails', ('method', 'timeout', 'metadata', 'credentials',
+                                                           'wait_for_ready', 'compression')),
+                   grpc.ClientCallDetails):
+    pass
+
+
+# Interceptor dos quatro tipos de chamada: injeta o traceparent e termina o span quando a chamada acaba
+class TraceInterceptor(grpc.UnaryUnaryClientInterceptor, grpc.UnaryStreamClientInterceptor,
+                       grpc.StreamUnaryClientInterceptor, grpc.StreamStreamClientInterceptor):
+    def _intercept(self, continuation, details, request):
+        span = Span(details.method.rsplit('/', 1)[-1], getattr(_current, 'span', None), kind=3)
+        metadata = list(details.metadata or ()) + [('traceparent', span.traceparent())]
+        details = _CallDetails(details.method, details.timeout, metadata, details.credentials,
+                               getattr(details, 'wait_for_ready', None), getattr(details, 'compression', None))
+        call = continuation(details, request)
+
+        def done(c):
+            code = c.code()
+            span.ok = code == grpc.StatusCode.OK
+            if not span.ok:
+                span.message = f"{code} - {c.details()}"
+            span.end()
+        call.add_done_callback(done)
+        return call
+
+    def intercept_unary_unary(self, continuation, details, request):
+        return self._intercept(continuation, details, request)
+
+    def intercept_unary_stream(self, continuation, details, request):
+        return self._intercept(continuation, details, request)
+
+    def intercept_stream_unary(self, continuation, details, request_iterator):
+        return self._intercept(continuation, details, request_iterator)
+
+    def intercept_stream_stream(self, continuation, details, request_iterator):
+        return self._intercept(continuation, details, request_iterator)
+
+
+# Canal com tracing quando TRACE_DIR está definido
+def traced_channel(channel):
+    return grpc.intercept_channel(channel, TraceInterceptor()) if tracing_enabled() else channel
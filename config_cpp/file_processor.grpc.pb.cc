@@ -26,6 +26,20 @@ static const char* FileProcessorService_method_names[] = {
   "/file_processor.FileProcessorService/ConvertToTXT",
   "/file_processor.FileProcessorService/ConvertImageFormat",
   "/file_processor.FileProcessorService/ResizeImage",
+  "/file_processor.FileProcessorService/ResizeImageMulti",
+  "/file_processor.FileProcessorService/RunPipeline",
+  "/file_processor.FileProcessorService/ProcessBatch",
+  "/file_processor.FileProcessorService/StartUpload",
+  "/file_processor.FileProcessorService/UploadChunks",
+  "/file_processor.FileProcessorService/QueryUpload",
+  "/file_processor.FileProcessorService/GetSignatures",
+  "/file_processor.FileProcessorService/UploadDelta",
+  "/file_processor.FileProcessorService/FetchOutput",
+  "/file_processor.FileProcessorService/SubmitJob",
+  "/file_processor.FileProcessorService/GetJobStatus",
+  "/file_processor.FileProcessorService/FetchResult",
+  "/file_processor.FileProcessorService/GetLatencyStats",
+  "/file_processor.FileProcessorService/GetServerState",
 };
 
 std::unique_ptr< FileProcessorService::Stub> FileProcessorService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -39,6 +53,20 @@ FileProcessorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface
   , rpcmethod_ConvertToTXT_(FileProcessorService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   , rpcmethod_ConvertImageFormat_(FileProcessorService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   , rpcmethod_ResizeImage_(FileProcessorService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_ResizeImageMulti_(FileProcessorService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_RunPipeline_(FileProcessorService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_ProcessBatch_(FileProcessorService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_StartUpload_(FileProcessorService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_UploadChunks_(FileProcessorService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_QueryUpload_(FileProcessorService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetSignatures_(FileProcessorService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_UploadDelta_(FileProcessorService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_FetchOutput_(FileProcessorService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SubmitJob_(FileProcessorService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetJobStatus_(FileProcessorService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_FetchResult_(FileProcessorService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetLatencyStats_(FileProcessorService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetServerState_(FileProcessorService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::CompressPDFRaw(::grpc::ClientContext* context) {
@@ -105,6 +133,272 @@ void FileProcessorService::Stub::async::ResizeImage(::grpc::ClientContext* conte
   return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_ResizeImage_, context, false, nullptr);
 }
 
+::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::ResizeImageMultiRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), rpcmethod_ResizeImageMulti_, context);
+}
+
+void FileProcessorService::Stub::async::ResizeImageMulti(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::file_processor::FileRequest,::file_processor::FileResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_ResizeImageMulti_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::AsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_ResizeImageMulti_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::PrepareAsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_ResizeImageMulti_, context, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::RunPipelineRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), rpcmethod_RunPipeline_, context);
+}
+
+void FileProcessorService::Stub::async::RunPipeline(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::file_processor::FileRequest,::file_processor::FileResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_RunPipeline_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::AsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_RunPipeline_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* FileProcessorService::Stub::PrepareAsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::FileRequest, ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_RunPipeline_, context, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* FileProcessorService::Stub::ProcessBatchRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::file_processor::BatchRequest, ::file_processor::BatchResponse>::Create(channel_.get(), rpcmethod_ProcessBatch_, context);
+}
+
+void FileProcessorService::Stub::async::ProcessBatch(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::BatchRequest,::file_processor::BatchResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::file_processor::BatchRequest,::file_processor::BatchResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_ProcessBatch_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* FileProcessorService::Stub::AsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::BatchRequest, ::file_processor::BatchResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatch_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* FileProcessorService::Stub::PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::BatchRequest, ::file_processor::BatchResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatch_, context, false, nullptr);
+}
+
+::grpc::Status FileProcessorService::Stub::StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::file_processor::UploadStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::StartUploadRequest, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_StartUpload_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::StartUploadRequest, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartUpload_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StartUpload_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* FileProcessorService::Stub::PrepareAsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::UploadStatus, ::file_processor::StartUploadRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_StartUpload_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* FileProcessorService::Stub::AsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStartUploadRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::UploadChunksRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::file_processor::UploadChunk, ::file_processor::UploadStatus>::Create(channel_.get(), rpcmethod_UploadChunks_, context);
+}
+
+void FileProcessorService::Stub::async::UploadChunks(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::UploadChunk,::file_processor::UploadStatus>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::file_processor::UploadChunk,::file_processor::UploadStatus>::Create(stub_->channel_.get(), stub_->rpcmethod_UploadChunks_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::AsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::UploadChunk, ::file_processor::UploadStatus>::Create(channel_.get(), cq, rpcmethod_UploadChunks_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::PrepareAsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::UploadChunk, ::file_processor::UploadStatus>::Create(channel_.get(), cq, rpcmethod_UploadChunks_, context, false, nullptr);
+}
+
+::grpc::Status FileProcessorService::Stub::QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::file_processor::UploadStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::UploadQuery, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_QueryUpload_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::UploadQuery, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_QueryUpload_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_QueryUpload_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* FileProcessorService::Stub::PrepareAsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::UploadStatus, ::file_processor::UploadQuery, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_QueryUpload_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* FileProcessorService::Stub::AsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncQueryUploadRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::file_processor::SignatureBatch>* FileProcessorService::Stub::GetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::file_processor::SignatureBatch>::Create(channel_.get(), rpcmethod_GetSignatures_, context, request);
+}
+
+void FileProcessorService::Stub::async::GetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest* request, ::grpc::ClientReadReactor< ::file_processor::SignatureBatch>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::file_processor::SignatureBatch>::Create(stub_->channel_.get(), stub_->rpcmethod_GetSignatures_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>* FileProcessorService::Stub::AsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::SignatureBatch>::Create(channel_.get(), cq, rpcmethod_GetSignatures_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>* FileProcessorService::Stub::PrepareAsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::SignatureBatch>::Create(channel_.get(), cq, rpcmethod_GetSignatures_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::UploadDeltaRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>::Create(channel_.get(), rpcmethod_UploadDelta_, context);
+}
+
+void FileProcessorService::Stub::async::UploadDelta(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::DeltaChunk,::file_processor::UploadStatus>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::file_processor::DeltaChunk,::file_processor::UploadStatus>::Create(stub_->channel_.get(), stub_->rpcmethod_UploadDelta_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::AsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>::Create(channel_.get(), cq, rpcmethod_UploadDelta_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* FileProcessorService::Stub::PrepareAsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>::Create(channel_.get(), cq, rpcmethod_UploadDelta_, context, false, nullptr);
+}
+
+::grpc::ClientReader< ::file_processor::FileResponse>* FileProcessorService::Stub::FetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), rpcmethod_FetchOutput_, context, request);
+}
+
+void FileProcessorService::Stub::async::FetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::file_processor::FileResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_FetchOutput_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::FileResponse>* FileProcessorService::Stub::AsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_FetchOutput_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::FileResponse>* FileProcessorService::Stub::PrepareAsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_FetchOutput_, context, request, false, nullptr);
+}
+
+::grpc::Status FileProcessorService::Stub::SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::file_processor::JobStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::FileRequest, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SubmitJob_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::FileRequest, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitJob_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitJob_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* FileProcessorService::Stub::PrepareAsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::JobStatus, ::file_processor::FileRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SubmitJob_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* FileProcessorService::Stub::AsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSubmitJobRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FileProcessorService::Stub::GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::file_processor::JobStatus* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::JobQuery, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetJobStatus_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::JobQuery, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetJobStatus_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetJobStatus_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* FileProcessorService::Stub::PrepareAsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::JobStatus, ::file_processor::JobQuery, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetJobStatus_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* FileProcessorService::Stub::AsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetJobStatusRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::file_processor::FileResponse>* FileProcessorService::Stub::FetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request) {
+  return ::grpc::internal::ClientReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), rpcmethod_FetchResult_, context, request);
+}
+
+void FileProcessorService::Stub::async::FetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::file_processor::FileResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_FetchResult_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::FileResponse>* FileProcessorService::Stub::AsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_FetchResult_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::file_processor::FileResponse>* FileProcessorService::Stub::PrepareAsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::file_processor::FileResponse>::Create(channel_.get(), cq, rpcmethod_FetchResult_, context, request, false, nullptr);
+}
+
+::grpc::Status FileProcessorService::Stub::GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::file_processor::LatencyReport* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::LatencyQuery, ::file_processor::LatencyReport, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetLatencyStats_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::LatencyQuery, ::file_processor::LatencyReport, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetLatencyStats_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetLatencyStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>* FileProcessorService::Stub::PrepareAsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::LatencyReport, ::file_processor::LatencyQuery, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetLatencyStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>* FileProcessorService::Stub::AsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetLatencyStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status FileProcessorService::Stub::GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::file_processor::ServerState* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::file_processor::ServerStateQuery, ::file_processor::ServerState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetServerState_, context, request, response);
+}
+
+void FileProcessorService::Stub::async::GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::file_processor::ServerStateQuery, ::file_processor::ServerState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerState_, context, request, response, std::move(f));
+}
+
+void FileProcessorService::Stub::async::GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetServerState_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>* FileProcessorService::Stub::PrepareAsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::file_processor::ServerState, ::file_processor::ServerStateQuery, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetServerState_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>* FileProcessorService::Stub::AsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetServerStateRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 FileProcessorService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       FileProcessorService_method_names[0],
@@ -146,6 +440,146 @@ FileProcessorService::Service::Service() {
              ::file_processor::FileRequest>* stream) {
                return service->ResizeImage(ctx, stream);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[4],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FileProcessorService::Service, ::file_processor::FileRequest, ::file_processor::FileResponse>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::file_processor::FileResponse,
+             ::file_processor::FileRequest>* stream) {
+               return service->ResizeImageMulti(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[5],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FileProcessorService::Service, ::file_processor::FileRequest, ::file_processor::FileResponse>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::file_processor::FileResponse,
+             ::file_processor::FileRequest>* stream) {
+               return service->RunPipeline(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[6],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FileProcessorService::Service, ::file_processor::BatchRequest, ::file_processor::BatchResponse>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::file_processor::BatchResponse,
+             ::file_processor::BatchRequest>* stream) {
+               return service->ProcessBatch(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::StartUploadRequest, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::StartUploadRequest* req,
+             ::file_processor::UploadStatus* resp) {
+               return service->StartUpload(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[8],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FileProcessorService::Service, ::file_processor::UploadChunk, ::file_processor::UploadStatus>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::file_processor::UploadStatus,
+             ::file_processor::UploadChunk>* stream) {
+               return service->UploadChunks(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::UploadQuery, ::file_processor::UploadStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::UploadQuery* req,
+             ::file_processor::UploadStatus* resp) {
+               return service->QueryUpload(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[10],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FileProcessorService::Service, ::file_processor::SignatureRequest, ::file_processor::SignatureBatch>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::SignatureRequest* req,
+             ::grpc::ServerWriter<::file_processor::SignatureBatch>* writer) {
+               return service->GetSignatures(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[11],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< FileProcessorService::Service, ::file_processor::DeltaChunk, ::file_processor::UploadStatus>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::file_processor::UploadStatus,
+             ::file_processor::DeltaChunk>* stream) {
+               return service->UploadDelta(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[12],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FileProcessorService::Service, ::file_processor::FetchOutputRequest, ::file_processor::FileResponse>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::FetchOutputRequest* req,
+             ::grpc::ServerWriter<::file_processor::FileResponse>* writer) {
+               return service->FetchOutput(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::FileRequest, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::FileRequest* req,
+             ::file_processor::JobStatus* resp) {
+               return service->SubmitJob(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::JobQuery, ::file_processor::JobStatus, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::JobQuery* req,
+             ::file_processor::JobStatus* resp) {
+               return service->GetJobStatus(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[15],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< FileProcessorService::Service, ::file_processor::JobQuery, ::file_processor::FileResponse>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::JobQuery* req,
+             ::grpc::ServerWriter<::file_processor::FileResponse>* writer) {
+               return service->FetchResult(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[16],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::LatencyQuery, ::file_processor::LatencyReport, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::LatencyQuery* req,
+             ::file_processor::LatencyReport* resp) {
+               return service->GetLatencyStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      FileProcessorService_method_names[17],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< FileProcessorService::Service, ::file_processor::ServerStateQuery, ::file_processor::ServerState, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](FileProcessorService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::file_processor::ServerStateQuery* req,
+             ::file_processor::ServerState* resp) {
+               return service->GetServerState(ctx, req, resp);
+             }, this)));
 }
 
 FileProcessorService::Service::~Service() {
@@ -175,6 +609,99 @@ FileProcessorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status FileProcessorService::Service::ResizeImageMulti(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::RunPipeline(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::ProcessBatch(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::StartUpload(::grpc::ServerContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::UploadChunks(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::QueryUpload(::grpc::ServerContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::GetSignatures(::grpc::ServerContext* context, const ::file_processor::SignatureRequest* request, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::UploadDelta(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::FetchOutput(::grpc::ServerContext* context, const ::file_processor::FetchOutputRequest* request, ::grpc::ServerWriter< ::file_processor::FileResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::SubmitJob(::grpc::ServerContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::GetJobStatus(::grpc::ServerContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::FetchResult(::grpc::ServerContext* context, const ::file_processor::JobQuery* request, ::grpc::ServerWriter< ::file_processor::FileResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::GetLatencyStats(::grpc::ServerContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status FileProcessorService::Service::GetServerState(::grpc::ServerContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace file_processor
 
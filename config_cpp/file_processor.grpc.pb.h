@@ -71,6 +71,120 @@ class FileProcessorService final {
     std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncResizeImage(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncResizeImageRaw(context, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> ResizeImageMulti(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(ResizeImageMultiRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> AsyncResizeImageMulti(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(AsyncResizeImageMultiRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncResizeImageMulti(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncResizeImageMultiRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> RunPipeline(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(RunPipelineRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> AsyncRunPipeline(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(AsyncRunPipelineRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncRunPipeline(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncRunPipelineRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> ProcessBatch(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(ProcessBatchRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> AsyncProcessBatch(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(AsyncProcessBatchRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> PrepareAsyncProcessBatch(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(PrepareAsyncProcessBatchRaw(context, cq));
+    }
+    virtual ::grpc::Status StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::file_processor::UploadStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>> AsyncStartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>>(AsyncStartUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>> PrepareAsyncStartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>>(PrepareAsyncStartUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> UploadChunks(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(UploadChunksRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> AsyncUploadChunks(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(AsyncUploadChunksRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> PrepareAsyncUploadChunks(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(PrepareAsyncUploadChunksRaw(context, cq));
+    }
+    virtual ::grpc::Status QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::file_processor::UploadStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>> AsyncQueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>>(AsyncQueryUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>> PrepareAsyncQueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>>(PrepareAsyncQueryUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::SignatureBatch>> GetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::SignatureBatch>>(GetSignaturesRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>> AsyncGetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>>(AsyncGetSignaturesRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>> PrepareAsyncGetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>>(PrepareAsyncGetSignaturesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> UploadDelta(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(UploadDeltaRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> AsyncUploadDelta(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(AsyncUploadDeltaRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> PrepareAsyncUploadDelta(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(PrepareAsyncUploadDeltaRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::FileResponse>> FetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::FileResponse>>(FetchOutputRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>> AsyncFetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>>(AsyncFetchOutputRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>> PrepareAsyncFetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>>(PrepareAsyncFetchOutputRaw(context, request, cq));
+    }
+    virtual ::grpc::Status SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::file_processor::JobStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>> AsyncSubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>>(AsyncSubmitJobRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>> PrepareAsyncSubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>>(PrepareAsyncSubmitJobRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::file_processor::JobStatus* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>> AsyncGetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>>(AsyncGetJobStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>> PrepareAsyncGetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>>(PrepareAsyncGetJobStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::FileResponse>> FetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::file_processor::FileResponse>>(FetchResultRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>> AsyncFetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>>(AsyncFetchResultRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>> PrepareAsyncFetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>>(PrepareAsyncFetchResultRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::file_processor::LatencyReport* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>> AsyncGetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>>(AsyncGetLatencyStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>> PrepareAsyncGetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>>(PrepareAsyncGetLatencyStatsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::file_processor::ServerState* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>> AsyncGetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>>(AsyncGetServerStateRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>> PrepareAsyncGetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>>(PrepareAsyncGetServerStateRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -78,6 +192,26 @@ class FileProcessorService final {
       virtual void ConvertToTXT(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) = 0;
       virtual void ConvertImageFormat(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) = 0;
       virtual void ResizeImage(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) = 0;
+      virtual void ResizeImageMulti(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) = 0;
+      virtual void RunPipeline(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) = 0;
+      virtual void ProcessBatch(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::BatchRequest,::file_processor::BatchResponse>* reactor) = 0;
+      virtual void StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void UploadChunks(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::UploadChunk,::file_processor::UploadStatus>* reactor) = 0;
+      virtual void QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest* request, ::grpc::ClientReadReactor< ::file_processor::SignatureBatch>* reactor) = 0;
+      virtual void UploadDelta(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::DeltaChunk,::file_processor::UploadStatus>* reactor) = 0;
+      virtual void FetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) = 0;
+      virtual void SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void FetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) = 0;
+      virtual void GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -95,6 +229,42 @@ class FileProcessorService final {
     virtual ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImageRaw(::grpc::ClientContext* context) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncResizeImageRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncResizeImageRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImageMultiRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* RunPipelineRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* ProcessBatchRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* AsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>* AsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>* PrepareAsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* UploadChunksRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* AsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* PrepareAsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>* AsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::UploadStatus>* PrepareAsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::file_processor::SignatureBatch>* GetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>* AsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::SignatureBatch>* PrepareAsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* UploadDeltaRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* AsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* PrepareAsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::file_processor::FileResponse>* FetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>* AsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>* PrepareAsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>* AsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>* PrepareAsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>* AsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::JobStatus>* PrepareAsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::file_processor::FileResponse>* FetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>* AsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::file_processor::FileResponse>* PrepareAsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>* AsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::LatencyReport>* PrepareAsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>* AsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::file_processor::ServerState>* PrepareAsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -135,6 +305,120 @@ class FileProcessorService final {
     std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncResizeImage(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncResizeImageRaw(context, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> ResizeImageMulti(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(ResizeImageMultiRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> AsyncResizeImageMulti(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(AsyncResizeImageMultiRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncResizeImageMulti(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncResizeImageMultiRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> RunPipeline(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(RunPipelineRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> AsyncRunPipeline(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(AsyncRunPipelineRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>> PrepareAsyncRunPipeline(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>>(PrepareAsyncRunPipelineRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> ProcessBatch(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(ProcessBatchRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> AsyncProcessBatch(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(AsyncProcessBatchRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>> PrepareAsyncProcessBatch(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>>(PrepareAsyncProcessBatchRaw(context, cq));
+    }
+    ::grpc::Status StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::file_processor::UploadStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>> AsyncStartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>>(AsyncStartUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>> PrepareAsyncStartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>>(PrepareAsyncStartUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> UploadChunks(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(UploadChunksRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> AsyncUploadChunks(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(AsyncUploadChunksRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>> PrepareAsyncUploadChunks(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>>(PrepareAsyncUploadChunksRaw(context, cq));
+    }
+    ::grpc::Status QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::file_processor::UploadStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>> AsyncQueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>>(AsyncQueryUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>> PrepareAsyncQueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>>(PrepareAsyncQueryUploadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::file_processor::SignatureBatch>> GetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::file_processor::SignatureBatch>>(GetSignaturesRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>> AsyncGetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>>(AsyncGetSignaturesRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>> PrepareAsyncGetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>>(PrepareAsyncGetSignaturesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> UploadDelta(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(UploadDeltaRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> AsyncUploadDelta(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(AsyncUploadDeltaRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>> PrepareAsyncUploadDelta(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>>(PrepareAsyncUploadDeltaRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::file_processor::FileResponse>> FetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::file_processor::FileResponse>>(FetchOutputRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>> AsyncFetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>>(AsyncFetchOutputRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>> PrepareAsyncFetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>>(PrepareAsyncFetchOutputRaw(context, request, cq));
+    }
+    ::grpc::Status SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::file_processor::JobStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>> AsyncSubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>>(AsyncSubmitJobRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>> PrepareAsyncSubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>>(PrepareAsyncSubmitJobRaw(context, request, cq));
+    }
+    ::grpc::Status GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::file_processor::JobStatus* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>> AsyncGetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>>(AsyncGetJobStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>> PrepareAsyncGetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>>(PrepareAsyncGetJobStatusRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::file_processor::FileResponse>> FetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::file_processor::FileResponse>>(FetchResultRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>> AsyncFetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>>(AsyncFetchResultRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>> PrepareAsyncFetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::file_processor::FileResponse>>(PrepareAsyncFetchResultRaw(context, request, cq));
+    }
+    ::grpc::Status GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::file_processor::LatencyReport* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>> AsyncGetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>>(AsyncGetLatencyStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>> PrepareAsyncGetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>>(PrepareAsyncGetLatencyStatsRaw(context, request, cq));
+    }
+    ::grpc::Status GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::file_processor::ServerState* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>> AsyncGetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>>(AsyncGetServerStateRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>> PrepareAsyncGetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>>(PrepareAsyncGetServerStateRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -142,6 +426,26 @@ class FileProcessorService final {
       void ConvertToTXT(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) override;
       void ConvertImageFormat(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) override;
       void ResizeImage(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) override;
+      void ResizeImageMulti(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) override;
+      void RunPipeline(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::FileRequest,::file_processor::FileResponse>* reactor) override;
+      void ProcessBatch(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::BatchRequest,::file_processor::BatchResponse>* reactor) override;
+      void StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)>) override;
+      void StartUpload(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void UploadChunks(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::UploadChunk,::file_processor::UploadStatus>* reactor) override;
+      void QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, std::function<void(::grpc::Status)>) override;
+      void QueryUpload(::grpc::ClientContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetSignatures(::grpc::ClientContext* context, const ::file_processor::SignatureRequest* request, ::grpc::ClientReadReactor< ::file_processor::SignatureBatch>* reactor) override;
+      void UploadDelta(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::file_processor::DeltaChunk,::file_processor::UploadStatus>* reactor) override;
+      void FetchOutput(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) override;
+      void SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)>) override;
+      void SubmitJob(::grpc::ClientContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, std::function<void(::grpc::Status)>) override;
+      void GetJobStatus(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void FetchResult(::grpc::ClientContext* context, const ::file_processor::JobQuery* request, ::grpc::ClientReadReactor< ::file_processor::FileResponse>* reactor) override;
+      void GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, std::function<void(::grpc::Status)>) override;
+      void GetLatencyStats(::grpc::ClientContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, std::function<void(::grpc::Status)>) override;
+      void GetServerState(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -165,10 +469,60 @@ class FileProcessorService final {
     ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImageRaw(::grpc::ClientContext* context) override;
     ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncResizeImageRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncResizeImageRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImageMultiRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncResizeImageMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* RunPipelineRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* AsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::FileRequest, ::file_processor::FileResponse>* PrepareAsyncRunPipelineRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* ProcessBatchRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* AsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* AsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* PrepareAsyncStartUploadRaw(::grpc::ClientContext* context, const ::file_processor::StartUploadRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* UploadChunksRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* AsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* PrepareAsyncUploadChunksRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* AsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::UploadStatus>* PrepareAsyncQueryUploadRaw(::grpc::ClientContext* context, const ::file_processor::UploadQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::file_processor::SignatureBatch>* GetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request) override;
+    ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>* AsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::file_processor::SignatureBatch>* PrepareAsyncGetSignaturesRaw(::grpc::ClientContext* context, const ::file_processor::SignatureRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* UploadDeltaRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* AsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* PrepareAsyncUploadDeltaRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::file_processor::FileResponse>* FetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request) override;
+    ::grpc::ClientAsyncReader< ::file_processor::FileResponse>* AsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::file_processor::FileResponse>* PrepareAsyncFetchOutputRaw(::grpc::ClientContext* context, const ::file_processor::FetchOutputRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* AsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* PrepareAsyncSubmitJobRaw(::grpc::ClientContext* context, const ::file_processor::FileRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* AsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::JobStatus>* PrepareAsyncGetJobStatusRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::file_processor::FileResponse>* FetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request) override;
+    ::grpc::ClientAsyncReader< ::file_processor::FileResponse>* AsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::file_processor::FileResponse>* PrepareAsyncFetchResultRaw(::grpc::ClientContext* context, const ::file_processor::JobQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>* AsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::LatencyReport>* PrepareAsyncGetLatencyStatsRaw(::grpc::ClientContext* context, const ::file_processor::LatencyQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>* AsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::file_processor::ServerState>* PrepareAsyncGetServerStateRaw(::grpc::ClientContext* context, const ::file_processor::ServerStateQuery& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_CompressPDF_;
     const ::grpc::internal::RpcMethod rpcmethod_ConvertToTXT_;
     const ::grpc::internal::RpcMethod rpcmethod_ConvertImageFormat_;
     const ::grpc::internal::RpcMethod rpcmethod_ResizeImage_;
+    const ::grpc::internal::RpcMethod rpcmethod_ResizeImageMulti_;
+    const ::grpc::internal::RpcMethod rpcmethod_RunPipeline_;
+    const ::grpc::internal::RpcMethod rpcmethod_ProcessBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_StartUpload_;
+    const ::grpc::internal::RpcMethod rpcmethod_UploadChunks_;
+    const ::grpc::internal::RpcMethod rpcmethod_QueryUpload_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetSignatures_;
+    const ::grpc::internal::RpcMethod rpcmethod_UploadDelta_;
+    const ::grpc::internal::RpcMethod rpcmethod_FetchOutput_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubmitJob_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetJobStatus_;
+    const ::grpc::internal::RpcMethod rpcmethod_FetchResult_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetLatencyStats_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetServerState_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -180,6 +534,20 @@ class FileProcessorService final {
     virtual ::grpc::Status ConvertToTXT(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream);
     virtual ::grpc::Status ConvertImageFormat(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream);
     virtual ::grpc::Status ResizeImage(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream);
+    virtual ::grpc::Status ResizeImageMulti(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream);
+    virtual ::grpc::Status RunPipeline(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream);
+    virtual ::grpc::Status ProcessBatch(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* stream);
+    virtual ::grpc::Status StartUpload(::grpc::ServerContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response);
+    virtual ::grpc::Status UploadChunks(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* stream);
+    virtual ::grpc::Status QueryUpload(::grpc::ServerContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response);
+    virtual ::grpc::Status GetSignatures(::grpc::ServerContext* context, const ::file_processor::SignatureRequest* request, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* writer);
+    virtual ::grpc::Status UploadDelta(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* stream);
+    virtual ::grpc::Status FetchOutput(::grpc::ServerContext* context, const ::file_processor::FetchOutputRequest* request, ::grpc::ServerWriter< ::file_processor::FileResponse>* writer);
+    virtual ::grpc::Status SubmitJob(::grpc::ServerContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response);
+    virtual ::grpc::Status GetJobStatus(::grpc::ServerContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response);
+    virtual ::grpc::Status FetchResult(::grpc::ServerContext* context, const ::file_processor::JobQuery* request, ::grpc::ServerWriter< ::file_processor::FileResponse>* writer);
+    virtual ::grpc::Status GetLatencyStats(::grpc::ServerContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response);
+    virtual ::grpc::Status GetServerState(::grpc::ServerContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_CompressPDF : public BaseClass {
@@ -261,261 +629,299 @@ class FileProcessorService final {
       ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_CompressPDF<WithAsyncMethod_ConvertToTXT<WithAsyncMethod_ConvertImageFormat<WithAsyncMethod_ResizeImage<Service > > > > AsyncService;
   template <class BaseClass>
-  class WithCallbackMethod_CompressPDF : public BaseClass {
+  class WithAsyncMethod_ResizeImageMulti : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_CompressPDF() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->CompressPDF(context); }));
+    WithAsyncMethod_ResizeImageMulti() {
+      ::grpc::Service::MarkMethodAsync(4);
     }
-    ~WithCallbackMethod_CompressPDF() override {
+    ~WithAsyncMethod_ResizeImageMulti() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status ResizeImageMulti(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* CompressPDF(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
+    void RequestResizeImageMulti(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ConvertToTXT : public BaseClass {
+  class WithAsyncMethod_RunPipeline : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ConvertToTXT() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->ConvertToTXT(context); }));
+    WithAsyncMethod_RunPipeline() {
+      ::grpc::Service::MarkMethodAsync(5);
     }
-    ~WithCallbackMethod_ConvertToTXT() override {
+    ~WithAsyncMethod_RunPipeline() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status RunPipeline(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ConvertToTXT(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
+    void RequestRunPipeline(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ConvertImageFormat : public BaseClass {
+  class WithAsyncMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ConvertImageFormat() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->ConvertImageFormat(context); }));
+    WithAsyncMethod_ProcessBatch() {
+      ::grpc::Service::MarkMethodAsync(6);
     }
-    ~WithCallbackMethod_ConvertImageFormat() override {
+    ~WithAsyncMethod_ProcessBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status ProcessBatch(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ConvertImageFormat(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
+    void RequestProcessBatch(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(6, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ResizeImage : public BaseClass {
+  class WithAsyncMethod_StartUpload : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ResizeImage() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context) { return this->ResizeImage(context); }));
+    WithAsyncMethod_StartUpload() {
+      ::grpc::Service::MarkMethodAsync(7);
     }
-    ~WithCallbackMethod_ResizeImage() override {
+    ~WithAsyncMethod_StartUpload() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImage(
-      ::grpc::CallbackServerContext* /*context*/)
-      { return nullptr; }
+    void RequestStartUpload(::grpc::ServerContext* context, ::file_processor::StartUploadRequest* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::UploadStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
-  typedef WithCallbackMethod_CompressPDF<WithCallbackMethod_ConvertToTXT<WithCallbackMethod_ConvertImageFormat<WithCallbackMethod_ResizeImage<Service > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_CompressPDF : public BaseClass {
+  class WithAsyncMethod_UploadChunks : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_CompressPDF() {
-      ::grpc::Service::MarkMethodGeneric(0);
+    WithAsyncMethod_UploadChunks() {
+      ::grpc::Service::MarkMethodAsync(8);
     }
-    ~WithGenericMethod_CompressPDF() override {
+    ~WithAsyncMethod_UploadChunks() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status UploadChunks(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    void RequestUploadChunks(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(8, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithGenericMethod_ConvertToTXT : public BaseClass {
+  class WithAsyncMethod_QueryUpload : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ConvertToTXT() {
-      ::grpc::Service::MarkMethodGeneric(1);
+    WithAsyncMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodAsync(9);
     }
-    ~WithGenericMethod_ConvertToTXT() override {
+    ~WithAsyncMethod_QueryUpload() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    void RequestQueryUpload(::grpc::ServerContext* context, ::file_processor::UploadQuery* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::UploadStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithGenericMethod_ConvertImageFormat : public BaseClass {
+  class WithAsyncMethod_GetSignatures : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ConvertImageFormat() {
-      ::grpc::Service::MarkMethodGeneric(2);
+    WithAsyncMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodAsync(10);
     }
-    ~WithGenericMethod_ConvertImageFormat() override {
+    ~WithAsyncMethod_GetSignatures() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    void RequestGetSignatures(::grpc::ServerContext* context, ::file_processor::SignatureRequest* request, ::grpc::ServerAsyncWriter< ::file_processor::SignatureBatch>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(10, context, request, writer, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithGenericMethod_ResizeImage : public BaseClass {
+  class WithAsyncMethod_UploadDelta : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ResizeImage() {
-      ::grpc::Service::MarkMethodGeneric(3);
+    WithAsyncMethod_UploadDelta() {
+      ::grpc::Service::MarkMethodAsync(11);
     }
-    ~WithGenericMethod_ResizeImage() override {
+    ~WithAsyncMethod_UploadDelta() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status UploadDelta(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    void RequestUploadDelta(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(11, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithRawMethod_CompressPDF : public BaseClass {
+  class WithAsyncMethod_FetchOutput : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_CompressPDF() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithAsyncMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodAsync(12);
     }
-    ~WithRawMethod_CompressPDF() override {
+    ~WithAsyncMethod_FetchOutput() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestCompressPDF(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    void RequestFetchOutput(::grpc::ServerContext* context, ::file_processor::FetchOutputRequest* request, ::grpc::ServerAsyncWriter< ::file_processor::FileResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(12, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ConvertToTXT : public BaseClass {
+  class WithAsyncMethod_SubmitJob : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ConvertToTXT() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithAsyncMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodAsync(13);
     }
-    ~WithRawMethod_ConvertToTXT() override {
+    ~WithAsyncMethod_SubmitJob() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestConvertToTXT(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    void RequestSubmitJob(::grpc::ServerContext* context, ::file_processor::FileRequest* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::JobStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ConvertImageFormat : public BaseClass {
+  class WithAsyncMethod_GetJobStatus : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ConvertImageFormat() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithAsyncMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodAsync(14);
     }
-    ~WithRawMethod_ConvertImageFormat() override {
+    ~WithAsyncMethod_GetJobStatus() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestConvertImageFormat(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(2, context, stream, new_call_cq, notification_cq, tag);
+    void RequestGetJobStatus(::grpc::ServerContext* context, ::file_processor::JobQuery* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::JobStatus>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawMethod_ResizeImage : public BaseClass {
+  class WithAsyncMethod_FetchResult : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ResizeImage() {
-      ::grpc::Service::MarkMethodRaw(3);
+    WithAsyncMethod_FetchResult() {
+      ::grpc::Service::MarkMethodAsync(15);
     }
-    ~WithRawMethod_ResizeImage() override {
+    ~WithAsyncMethod_FetchResult() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestResizeImage(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    void RequestFetchResult(::grpc::ServerContext* context, ::file_processor::JobQuery* request, ::grpc::ServerAsyncWriter< ::file_processor::FileResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(15, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_CompressPDF : public BaseClass {
+  class WithAsyncMethod_GetLatencyStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_CompressPDF() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithAsyncMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetLatencyStats(::grpc::ServerContext* context, ::file_processor::LatencyQuery* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::LatencyReport>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetServerState() {
+      ::grpc::Service::MarkMethodAsync(17);
+    }
+    ~WithAsyncMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerState(::grpc::ServerContext* context, ::file_processor::ServerStateQuery* request, ::grpc::ServerAsyncResponseWriter< ::file_processor::ServerState>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_CompressPDF<WithAsyncMethod_ConvertToTXT<WithAsyncMethod_ConvertImageFormat<WithAsyncMethod_ResizeImage<WithAsyncMethod_ResizeImageMulti<WithAsyncMethod_RunPipeline<WithAsyncMethod_ProcessBatch<WithAsyncMethod_StartUpload<WithAsyncMethod_UploadChunks<WithAsyncMethod_QueryUpload<WithAsyncMethod_GetSignatures<WithAsyncMethod_UploadDelta<WithAsyncMethod_FetchOutput<WithAsyncMethod_SubmitJob<WithAsyncMethod_GetJobStatus<WithAsyncMethod_FetchResult<WithAsyncMethod_GetLatencyStats<WithAsyncMethod_GetServerState<Service > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_CompressPDF : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_CompressPDF() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
             [this](
                    ::grpc::CallbackServerContext* context) { return this->CompressPDF(context); }));
     }
-    ~WithRawCallbackMethod_CompressPDF() override {
+    ~WithCallbackMethod_CompressPDF() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -523,22 +929,22 @@ class FileProcessorService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* CompressPDF(
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* CompressPDF(
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ConvertToTXT : public BaseClass {
+  class WithCallbackMethod_ConvertToTXT : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ConvertToTXT() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithCallbackMethod_ConvertToTXT() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
             [this](
                    ::grpc::CallbackServerContext* context) { return this->ConvertToTXT(context); }));
     }
-    ~WithRawCallbackMethod_ConvertToTXT() override {
+    ~WithCallbackMethod_ConvertToTXT() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -546,22 +952,22 @@ class FileProcessorService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ConvertToTXT(
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ConvertToTXT(
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ConvertImageFormat : public BaseClass {
+  class WithCallbackMethod_ConvertImageFormat : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ConvertImageFormat() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithCallbackMethod_ConvertImageFormat() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
             [this](
                    ::grpc::CallbackServerContext* context) { return this->ConvertImageFormat(context); }));
     }
-    ~WithRawCallbackMethod_ConvertImageFormat() override {
+    ~WithCallbackMethod_ConvertImageFormat() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -569,22 +975,22 @@ class FileProcessorService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ConvertImageFormat(
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ConvertImageFormat(
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ResizeImage : public BaseClass {
+  class WithCallbackMethod_ResizeImage : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ResizeImage() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithCallbackMethod_ResizeImage() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
             [this](
                    ::grpc::CallbackServerContext* context) { return this->ResizeImage(context); }));
     }
-    ~WithRawCallbackMethod_ResizeImage() override {
+    ~WithCallbackMethod_ResizeImage() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -592,13 +998,1672 @@ class FileProcessorService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ResizeImage(
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImage(
       ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
-  typedef Service StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef Service StreamedService;
+  template <class BaseClass>
+  class WithCallbackMethod_ResizeImageMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ResizeImageMulti() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ResizeImageMulti(context); }));
+    }
+    ~WithCallbackMethod_ResizeImageMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImageMulti(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* ResizeImageMulti(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_RunPipeline : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_RunPipeline() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::FileRequest, ::file_processor::FileResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->RunPipeline(context); }));
+    }
+    ~WithCallbackMethod_RunPipeline() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RunPipeline(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::file_processor::FileRequest, ::file_processor::FileResponse>* RunPipeline(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ProcessBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ProcessBatch() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::BatchRequest, ::file_processor::BatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ProcessBatch(context); }));
+    }
+    ~WithCallbackMethod_ProcessBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatch(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::file_processor::BatchRequest, ::file_processor::BatchResponse>* ProcessBatch(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StartUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StartUpload() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::StartUploadRequest, ::file_processor::UploadStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::StartUploadRequest* request, ::file_processor::UploadStatus* response) { return this->StartUpload(context, request, response); }));}
+    void SetMessageAllocatorFor_StartUpload(
+        ::grpc::MessageAllocator< ::file_processor::StartUploadRequest, ::file_processor::UploadStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::StartUploadRequest, ::file_processor::UploadStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_StartUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StartUpload(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_UploadChunks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_UploadChunks() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::UploadChunk, ::file_processor::UploadStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->UploadChunks(context); }));
+    }
+    ~WithCallbackMethod_UploadChunks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadChunks(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::file_processor::UploadChunk, ::file_processor::UploadStatus>* UploadChunks(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_QueryUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::UploadQuery, ::file_processor::UploadStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::UploadQuery* request, ::file_processor::UploadStatus* response) { return this->QueryUpload(context, request, response); }));}
+    void SetMessageAllocatorFor_QueryUpload(
+        ::grpc::MessageAllocator< ::file_processor::UploadQuery, ::file_processor::UploadStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::UploadQuery, ::file_processor::UploadStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_QueryUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* QueryUpload(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetSignatures : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::file_processor::SignatureRequest, ::file_processor::SignatureBatch>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::SignatureRequest* request) { return this->GetSignatures(context, request); }));
+    }
+    ~WithCallbackMethod_GetSignatures() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::file_processor::SignatureBatch>* GetSignatures(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_UploadDelta : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_UploadDelta() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackBidiHandler< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->UploadDelta(context); }));
+    }
+    ~WithCallbackMethod_UploadDelta() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadDelta(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::file_processor::DeltaChunk, ::file_processor::UploadStatus>* UploadDelta(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_FetchOutput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::file_processor::FetchOutputRequest, ::file_processor::FileResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::FetchOutputRequest* request) { return this->FetchOutput(context, request); }));
+    }
+    ~WithCallbackMethod_FetchOutput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::file_processor::FileResponse>* FetchOutput(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SubmitJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::FileRequest, ::file_processor::JobStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::FileRequest* request, ::file_processor::JobStatus* response) { return this->SubmitJob(context, request, response); }));}
+    void SetMessageAllocatorFor_SubmitJob(
+        ::grpc::MessageAllocator< ::file_processor::FileRequest, ::file_processor::JobStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::FileRequest, ::file_processor::JobStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SubmitJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SubmitJob(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetJobStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::JobQuery, ::file_processor::JobStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::JobQuery* request, ::file_processor::JobStatus* response) { return this->GetJobStatus(context, request, response); }));}
+    void SetMessageAllocatorFor_GetJobStatus(
+        ::grpc::MessageAllocator< ::file_processor::JobQuery, ::file_processor::JobStatus>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::JobQuery, ::file_processor::JobStatus>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetJobStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetJobStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_FetchResult : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_FetchResult() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::file_processor::JobQuery, ::file_processor::FileResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::JobQuery* request) { return this->FetchResult(context, request); }));
+    }
+    ~WithCallbackMethod_FetchResult() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::file_processor::FileResponse>* FetchResult(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetLatencyStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::LatencyQuery, ::file_processor::LatencyReport>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::LatencyQuery* request, ::file_processor::LatencyReport* response) { return this->GetLatencyStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetLatencyStats(
+        ::grpc::MessageAllocator< ::file_processor::LatencyQuery, ::file_processor::LatencyReport>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::LatencyQuery, ::file_processor::LatencyReport>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetLatencyStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetServerState() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::file_processor::ServerStateQuery, ::file_processor::ServerState>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::file_processor::ServerStateQuery* request, ::file_processor::ServerState* response) { return this->GetServerState(context, request, response); }));}
+    void SetMessageAllocatorFor_GetServerState(
+        ::grpc::MessageAllocator< ::file_processor::ServerStateQuery, ::file_processor::ServerState>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::file_processor::ServerStateQuery, ::file_processor::ServerState>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerState(
+      ::grpc::CallbackServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_CompressPDF<WithCallbackMethod_ConvertToTXT<WithCallbackMethod_ConvertImageFormat<WithCallbackMethod_ResizeImage<WithCallbackMethod_ResizeImageMulti<WithCallbackMethod_RunPipeline<WithCallbackMethod_ProcessBatch<WithCallbackMethod_StartUpload<WithCallbackMethod_UploadChunks<WithCallbackMethod_QueryUpload<WithCallbackMethod_GetSignatures<WithCallbackMethod_UploadDelta<WithCallbackMethod_FetchOutput<WithCallbackMethod_SubmitJob<WithCallbackMethod_GetJobStatus<WithCallbackMethod_FetchResult<WithCallbackMethod_GetLatencyStats<WithCallbackMethod_GetServerState<Service > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_CompressPDF : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CompressPDF() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_CompressPDF() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ConvertToTXT : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ConvertToTXT() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_ConvertToTXT() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ConvertImageFormat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ConvertImageFormat() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_ConvertImageFormat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ResizeImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ResizeImage() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_ResizeImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ResizeImageMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ResizeImageMulti() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_ResizeImageMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImageMulti(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_RunPipeline : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RunPipeline() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_RunPipeline() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RunPipeline(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ProcessBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ProcessBatch() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_ProcessBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatch(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StartUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StartUpload() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_StartUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_UploadChunks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_UploadChunks() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_UploadChunks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadChunks(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_QueryUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_QueryUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetSignatures : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_GetSignatures() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_UploadDelta : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_UploadDelta() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_UploadDelta() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadDelta(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_FetchOutput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_FetchOutput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubmitJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodGeneric(13);
+    }
+    ~WithGenericMethod_SubmitJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetJobStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_GetJobStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_FetchResult : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_FetchResult() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_FetchResult() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetLatencyStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetServerState() {
+      ::grpc::Service::MarkMethodGeneric(17);
+    }
+    ~WithGenericMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CompressPDF : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CompressPDF() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_CompressPDF() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCompressPDF(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ConvertToTXT : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ConvertToTXT() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_ConvertToTXT() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestConvertToTXT(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ConvertImageFormat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ConvertImageFormat() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_ConvertImageFormat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestConvertImageFormat(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(2, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ResizeImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ResizeImage() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_ResizeImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResizeImage(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ResizeImageMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ResizeImageMulti() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_ResizeImageMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImageMulti(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResizeImageMulti(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RunPipeline : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RunPipeline() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_RunPipeline() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RunPipeline(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRunPipeline(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ProcessBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ProcessBatch() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_ProcessBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatch(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatch(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(6, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StartUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StartUpload() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_StartUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStartUpload(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_UploadChunks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_UploadChunks() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_UploadChunks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadChunks(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUploadChunks(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(8, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_QueryUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_QueryUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestQueryUpload(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetSignatures : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_GetSignatures() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetSignatures(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(10, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_UploadDelta : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_UploadDelta() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_UploadDelta() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadDelta(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUploadDelta(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(11, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_FetchOutput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_FetchOutput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFetchOutput(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(12, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubmitJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_SubmitJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubmitJob(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetJobStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_GetJobStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetJobStatus(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_FetchResult : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_FetchResult() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_FetchResult() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestFetchResult(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(15, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetLatencyStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
+    ~WithRawMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetLatencyStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetServerState() {
+      ::grpc::Service::MarkMethodRaw(17);
+    }
+    ~WithRawMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerState(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_CompressPDF : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_CompressPDF() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->CompressPDF(context); }));
+    }
+    ~WithRawCallbackMethod_CompressPDF() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CompressPDF(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* CompressPDF(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ConvertToTXT : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ConvertToTXT() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ConvertToTXT(context); }));
+    }
+    ~WithRawCallbackMethod_ConvertToTXT() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertToTXT(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ConvertToTXT(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ConvertImageFormat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ConvertImageFormat() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ConvertImageFormat(context); }));
+    }
+    ~WithRawCallbackMethod_ConvertImageFormat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ConvertImageFormat(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ConvertImageFormat(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ResizeImage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ResizeImage() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ResizeImage(context); }));
+    }
+    ~WithRawCallbackMethod_ResizeImage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImage(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ResizeImage(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ResizeImageMulti : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ResizeImageMulti() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ResizeImageMulti(context); }));
+    }
+    ~WithRawCallbackMethod_ResizeImageMulti() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ResizeImageMulti(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ResizeImageMulti(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_RunPipeline : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_RunPipeline() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->RunPipeline(context); }));
+    }
+    ~WithRawCallbackMethod_RunPipeline() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RunPipeline(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::FileResponse, ::file_processor::FileRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* RunPipeline(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ProcessBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ProcessBatch() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ProcessBatch(context); }));
+    }
+    ~WithRawCallbackMethod_ProcessBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatch(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::BatchResponse, ::file_processor::BatchRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ProcessBatch(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StartUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StartUpload() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->StartUpload(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_StartUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StartUpload(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_UploadChunks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_UploadChunks() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->UploadChunks(context); }));
+    }
+    ~WithRawCallbackMethod_UploadChunks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadChunks(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::UploadChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* UploadChunks(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_QueryUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->QueryUpload(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_QueryUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* QueryUpload(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetSignatures : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->GetSignatures(context, request); }));
+    }
+    ~WithRawCallbackMethod_GetSignatures() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* GetSignatures(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_UploadDelta : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_UploadDelta() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->UploadDelta(context); }));
+    }
+    ~WithRawCallbackMethod_UploadDelta() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UploadDelta(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::file_processor::UploadStatus, ::file_processor::DeltaChunk>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* UploadDelta(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_FetchOutput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->FetchOutput(context, request); }));
+    }
+    ~WithRawCallbackMethod_FetchOutput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* FetchOutput(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubmitJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SubmitJob(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SubmitJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SubmitJob(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetJobStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetJobStatus(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetJobStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetJobStatus(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_FetchResult : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_FetchResult() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->FetchResult(context, request); }));
+    }
+    ~WithRawCallbackMethod_FetchResult() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* FetchResult(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetLatencyStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetLatencyStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetLatencyStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetServerState() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetServerState(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerState(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_StartUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_StartUpload() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::StartUploadRequest, ::file_processor::UploadStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::StartUploadRequest, ::file_processor::UploadStatus>* streamer) {
+                       return this->StreamedStartUpload(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_StartUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StartUpload(::grpc::ServerContext* /*context*/, const ::file_processor::StartUploadRequest* /*request*/, ::file_processor::UploadStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedStartUpload(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::StartUploadRequest,::file_processor::UploadStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_QueryUpload : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_QueryUpload() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::UploadQuery, ::file_processor::UploadStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::UploadQuery, ::file_processor::UploadStatus>* streamer) {
+                       return this->StreamedQueryUpload(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_QueryUpload() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status QueryUpload(::grpc::ServerContext* /*context*/, const ::file_processor::UploadQuery* /*request*/, ::file_processor::UploadStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedQueryUpload(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::UploadQuery,::file_processor::UploadStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SubmitJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SubmitJob() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::FileRequest, ::file_processor::JobStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::FileRequest, ::file_processor::JobStatus>* streamer) {
+                       return this->StreamedSubmitJob(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SubmitJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubmitJob(::grpc::ServerContext* /*context*/, const ::file_processor::FileRequest* /*request*/, ::file_processor::JobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSubmitJob(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::FileRequest,::file_processor::JobStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetJobStatus : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetJobStatus() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::JobQuery, ::file_processor::JobStatus>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::JobQuery, ::file_processor::JobStatus>* streamer) {
+                       return this->StreamedGetJobStatus(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetJobStatus() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetJobStatus(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::file_processor::JobStatus* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetJobStatus(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::JobQuery,::file_processor::JobStatus>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetLatencyStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetLatencyStats() {
+      ::grpc::Service::MarkMethodStreamed(16,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::LatencyQuery, ::file_processor::LatencyReport>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::LatencyQuery, ::file_processor::LatencyReport>* streamer) {
+                       return this->StreamedGetLatencyStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetLatencyStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetLatencyStats(::grpc::ServerContext* /*context*/, const ::file_processor::LatencyQuery* /*request*/, ::file_processor::LatencyReport* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetLatencyStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::LatencyQuery,::file_processor::LatencyReport>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetServerState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetServerState() {
+      ::grpc::Service::MarkMethodStreamed(17,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::file_processor::ServerStateQuery, ::file_processor::ServerState>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::file_processor::ServerStateQuery, ::file_processor::ServerState>* streamer) {
+                       return this->StreamedGetServerState(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetServerState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetServerState(::grpc::ServerContext* /*context*/, const ::file_processor::ServerStateQuery* /*request*/, ::file_processor::ServerState* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetServerState(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::file_processor::ServerStateQuery,::file_processor::ServerState>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_StartUpload<WithStreamedUnaryMethod_QueryUpload<WithStreamedUnaryMethod_SubmitJob<WithStreamedUnaryMethod_GetJobStatus<WithStreamedUnaryMethod_GetLatencyStats<WithStreamedUnaryMethod_GetServerState<Service > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_GetSignatures : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_GetSignatures() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::file_processor::SignatureRequest, ::file_processor::SignatureBatch>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::file_processor::SignatureRequest, ::file_processor::SignatureBatch>* streamer) {
+                       return this->StreamedGetSignatures(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_GetSignatures() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetSignatures(::grpc::ServerContext* /*context*/, const ::file_processor::SignatureRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::SignatureBatch>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedGetSignatures(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::file_processor::SignatureRequest,::file_processor::SignatureBatch>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_FetchOutput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_FetchOutput() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::file_processor::FetchOutputRequest, ::file_processor::FileResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::file_processor::FetchOutputRequest, ::file_processor::FileResponse>* streamer) {
+                       return this->StreamedFetchOutput(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_FetchOutput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status FetchOutput(::grpc::ServerContext* /*context*/, const ::file_processor::FetchOutputRequest* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedFetchOutput(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::file_processor::FetchOutputRequest,::file_processor::FileResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_FetchResult : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_FetchResult() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::file_processor::JobQuery, ::file_processor::FileResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::file_processor::JobQuery, ::file_processor::FileResponse>* streamer) {
+                       return this->StreamedFetchResult(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_FetchResult() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status FetchResult(::grpc::ServerContext* /*context*/, const ::file_processor::JobQuery* /*request*/, ::grpc::ServerWriter< ::file_processor::FileResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedFetchResult(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::file_processor::JobQuery,::file_processor::FileResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_GetSignatures<WithSplitStreamingMethod_FetchOutput<WithSplitStreamingMethod_FetchResult<Service > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_StartUpload<WithStreamedUnaryMethod_QueryUpload<WithSplitStreamingMethod_GetSignatures<WithSplitStreamingMethod_FetchOutput<WithStreamedUnaryMethod_SubmitJob<WithStreamedUnaryMethod_GetJobStatus<WithSplitStreamingMethod_FetchResult<WithStreamedUnaryMethod_GetLatencyStats<WithStreamedUnaryMethod_GetServerState<Service > > > > > > > > > StreamedService;
 };
 
 }  // namespace file_processor
@@ -23,8 +23,10 @@ namespace _pbi = _pb::internal;
 namespace file_processor {
 PROTOBUF_CONSTEXPR FileChunk::FileChunk(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.crc32c_)*/0u} {}
 struct FileChunkDefaultTypeInternal {
   PROTOBUF_CONSTEXPR FileChunkDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -37,6 +39,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR FileRequest::FileRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.upload_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.file_content_)*/nullptr
   , /*decltype(_impl_.parameters_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
@@ -99,13 +102,71 @@ struct ResizeImageRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResizeImageRequestDefaultTypeInternal _ResizeImageRequest_default_instance_;
+PROTOBUF_CONSTEXPR ImageSize::ImageSize(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ImageSizeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ImageSizeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ImageSizeDefaultTypeInternal() {}
+  union {
+    ImageSize _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ImageSizeDefaultTypeInternal _ImageSize_default_instance_;
+PROTOBUF_CONSTEXPR ResizeImageMultiRequest::ResizeImageMultiRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sizes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResizeImageMultiRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResizeImageMultiRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResizeImageMultiRequestDefaultTypeInternal() {}
+  union {
+    ResizeImageMultiRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResizeImageMultiRequestDefaultTypeInternal _ResizeImageMultiRequest_default_instance_;
+PROTOBUF_CONSTEXPR PipelineStep::PipelineStep(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct PipelineStepDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PipelineStepDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PipelineStepDefaultTypeInternal() {}
+  union {
+    PipelineStep _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PipelineStepDefaultTypeInternal _PipelineStep_default_instance_;
+PROTOBUF_CONSTEXPR PipelineRequest::PipelineRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.steps_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PipelineRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PipelineRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PipelineRequestDefaultTypeInternal() {}
+  union {
+    PipelineRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PipelineRequestDefaultTypeInternal _PipelineRequest_default_instance_;
 PROTOBUF_CONSTEXPR FileResponse::FileResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_handle_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.file_content_)*/nullptr
   , /*decltype(_impl_.success_)*/false
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+  , /*decltype(_impl_.output_crc32c_)*/0u
+  , /*decltype(_impl_.output_size_)*/uint64_t{0u}} {}
 struct FileResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR FileResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -115,19 +176,386 @@ struct FileResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileResponseDefaultTypeInternal _FileResponse_default_instance_;
+PROTOBUF_CONSTEXPR BatchRequest::BatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.last_chunk_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchRequestDefaultTypeInternal() {}
+  union {
+    BatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchResponse::BatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.done_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchResponseDefaultTypeInternal() {}
+  union {
+    BatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR StartUploadRequest::StartUploadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StartUploadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StartUploadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StartUploadRequestDefaultTypeInternal() {}
+  union {
+    StartUploadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StartUploadRequestDefaultTypeInternal _StartUploadRequest_default_instance_;
+PROTOBUF_CONSTEXPR UploadChunk::UploadChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.upload_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.crc32c_)*/0u} {}
+struct UploadChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadChunkDefaultTypeInternal() {}
+  union {
+    UploadChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadChunkDefaultTypeInternal _UploadChunk_default_instance_;
+PROTOBUF_CONSTEXPR UploadQuery::UploadQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.upload_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadQueryDefaultTypeInternal() {}
+  union {
+    UploadQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadQueryDefaultTypeInternal _UploadQuery_default_instance_;
+PROTOBUF_CONSTEXPR UploadStatus::UploadStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.upload_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sha256_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.committed_offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.complete_)*/false
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadStatusDefaultTypeInternal() {}
+  union {
+    UploadStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadStatusDefaultTypeInternal _UploadStatus_default_instance_;
+PROTOBUF_CONSTEXPR FetchOutputRequest::FetchOutputRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_handle_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.length_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FetchOutputRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FetchOutputRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FetchOutputRequestDefaultTypeInternal() {}
+  union {
+    FetchOutputRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FetchOutputRequestDefaultTypeInternal _FetchOutputRequest_default_instance_;
+PROTOBUF_CONSTEXPR JobOutput::JobOutput(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_handle_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobOutputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobOutputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobOutputDefaultTypeInternal() {}
+  union {
+    JobOutput _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobOutputDefaultTypeInternal _JobOutput_default_instance_;
+PROTOBUF_CONSTEXPR JobQuery::JobQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.job_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobQueryDefaultTypeInternal() {}
+  union {
+    JobQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobQueryDefaultTypeInternal _JobQuery_default_instance_;
+PROTOBUF_CONSTEXPR JobStatus::JobStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.outputs_)*/{}
+  , /*decltype(_impl_.job_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobStatusDefaultTypeInternal() {}
+  union {
+    JobStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobStatusDefaultTypeInternal _JobStatus_default_instance_;
+PROTOBUF_CONSTEXPR SignatureRequest::SignatureRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.basis_sha256_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.block_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SignatureRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SignatureRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SignatureRequestDefaultTypeInternal() {}
+  union {
+    SignatureRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SignatureRequestDefaultTypeInternal _SignatureRequest_default_instance_;
+PROTOBUF_CONSTEXPR BlockSignature::BlockSignature(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.strong_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.weak_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockSignatureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockSignatureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockSignatureDefaultTypeInternal() {}
+  union {
+    BlockSignature _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockSignatureDefaultTypeInternal _BlockSignature_default_instance_;
+PROTOBUF_CONSTEXPR SignatureBatch::SignatureBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.blocks_)*/{}
+  , /*decltype(_impl_.status_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.block_size_)*/0u
+  , /*decltype(_impl_.basis_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.first_block_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SignatureBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SignatureBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SignatureBatchDefaultTypeInternal() {}
+  union {
+    SignatureBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SignatureBatchDefaultTypeInternal _SignatureBatch_default_instance_;
+PROTOBUF_CONSTEXPR BlockRange::BlockRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.first_block_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BlockRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BlockRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BlockRangeDefaultTypeInternal() {}
+  union {
+    BlockRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BlockRangeDefaultTypeInternal _BlockRange_default_instance_;
+PROTOBUF_CONSTEXPR DeltaOp::DeltaOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct DeltaOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeltaOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeltaOpDefaultTypeInternal() {}
+  union {
+    DeltaOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeltaOpDefaultTypeInternal _DeltaOp_default_instance_;
+PROTOBUF_CONSTEXPR DeltaChunk::DeltaChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.basis_sha256_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_sha256_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.block_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeltaChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeltaChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeltaChunkDefaultTypeInternal() {}
+  union {
+    DeltaChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeltaChunkDefaultTypeInternal _DeltaChunk_default_instance_;
+PROTOBUF_CONSTEXPR LatencyQuery::LatencyQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyQueryDefaultTypeInternal() {}
+  union {
+    LatencyQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyQueryDefaultTypeInternal _LatencyQuery_default_instance_;
+PROTOBUF_CONSTEXPR LatencySeries::LatencySeries(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.phase_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.sum_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencySeriesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencySeriesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencySeriesDefaultTypeInternal() {}
+  union {
+    LatencySeries _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencySeriesDefaultTypeInternal _LatencySeries_default_instance_;
+PROTOBUF_CONSTEXPR LatencyReport::LatencyReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.series_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyReportDefaultTypeInternal() {}
+  union {
+    LatencyReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyReportDefaultTypeInternal _LatencyReport_default_instance_;
+PROTOBUF_CONSTEXPR ServerStateQuery::ServerStateQuery(
+    ::_pbi::ConstantInitialized) {}
+struct ServerStateQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStateQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStateQueryDefaultTypeInternal() {}
+  union {
+    ServerStateQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStateQueryDefaultTypeInternal _ServerStateQuery_default_instance_;
+PROTOBUF_CONSTEXPR ActiveRequest::ActiveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rpc_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.phase_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.child_tool_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.peer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.trace_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.elapsed_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.phase_elapsed_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_received_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_sent_)*/uint64_t{0u}
+  , /*decltype(_impl_.child_pid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ActiveRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ActiveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ActiveRequestDefaultTypeInternal() {}
+  union {
+    ActiveRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ActiveRequestDefaultTypeInternal _ActiveRequest_default_instance_;
+PROTOBUF_CONSTEXPR ServerState::ServerState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_.worker_threads_)*/0u
+  , /*decltype(_impl_.worker_active_)*/0u
+  , /*decltype(_impl_.worker_queued_)*/0u
+  , /*decltype(_impl_.jobs_queued_)*/0u
+  , /*decltype(_impl_.ingest_buffer_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.uptime_s_)*/uint64_t{0u}
+  , /*decltype(_impl_.jobs_running_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStateDefaultTypeInternal() {}
+  union {
+    ServerState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStateDefaultTypeInternal _ServerState_default_instance_;
+PROTOBUF_CONSTEXPR JobRecord::JobRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.status_)*/nullptr
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.submitted_at_)*/int64_t{0}
+  , /*decltype(_impl_.input_size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobRecordDefaultTypeInternal() {}
+  union {
+    JobRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobRecordDefaultTypeInternal _JobRecord_default_instance_;
 }  // namespace file_processor
-static ::_pb::Metadata file_level_metadata_file_5fprocessor_2eproto[7];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_file_5fprocessor_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_file_5fprocessor_2eproto[34];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_file_5fprocessor_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_file_5fprocessor_2eproto = nullptr;
 
 const uint32_t TableStruct_file_5fprocessor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileChunk, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::file_processor::FileChunk, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::file_processor::FileChunk, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileChunk, _impl_.crc32c_),
+  ~0u,
+  0,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::file_processor::FileRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -140,6 +568,9 @@ const uint32_t TableStruct_file_5fprocessor_2eproto::offsets[] PROTOBUF_SECTION_
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileRequest, _impl_.upload_id_),
   PROTOBUF_FIELD_OFFSET(::file_processor::FileRequest, _impl_.parameters_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::file_processor::CompressPDFRequest, _internal_metadata_),
@@ -169,6 +600,39 @@ const uint32_t TableStruct_file_5fprocessor_2eproto::offsets[] PROTOBUF_SECTION_
   PROTOBUF_FIELD_OFFSET(::file_processor::ResizeImageRequest, _impl_.width_),
   PROTOBUF_FIELD_OFFSET(::file_processor::ResizeImageRequest, _impl_.height_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ImageSize, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ImageSize, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ImageSize, _impl_.height_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ResizeImageMultiRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ResizeImageMultiRequest, _impl_.sizes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::PipelineStep, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::file_processor::PipelineStep, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::file_processor::PipelineStep, _impl_.operation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::PipelineRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::PipelineRequest, _impl_.steps_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -178,101 +642,526 @@ const uint32_t TableStruct_file_5fprocessor_2eproto::offsets[] PROTOBUF_SECTION_
   PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.file_content_),
   PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.status_message_),
   PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.success_),
-};
-static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::file_processor::FileChunk)},
-  { 7, -1, -1, sizeof(::file_processor::FileRequest)},
-  { 20, -1, -1, sizeof(::file_processor::CompressPDFRequest)},
-  { 26, -1, -1, sizeof(::file_processor::ConvertToTXTRequest)},
-  { 32, -1, -1, sizeof(::file_processor::ConvertImageFormatRequest)},
-  { 39, -1, -1, sizeof(::file_processor::ResizeImageRequest)},
-  { 47, -1, -1, sizeof(::file_processor::FileResponse)},
-};
-
-static const ::_pb::Message* const file_default_instances[] = {
-  &::file_processor::_FileChunk_default_instance_._instance,
-  &::file_processor::_FileRequest_default_instance_._instance,
-  &::file_processor::_CompressPDFRequest_default_instance_._instance,
-  &::file_processor::_ConvertToTXTRequest_default_instance_._instance,
-  &::file_processor::_ConvertImageFormatRequest_default_instance_._instance,
-  &::file_processor::_ResizeImageRequest_default_instance_._instance,
-  &::file_processor::_FileResponse_default_instance_._instance,
-};
-
-const char descriptor_table_protodef_file_5fprocessor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\024file_processor.proto\022\016file_processor\"\034"
-  "\n\tFileChunk\022\017\n\007content\030\001 \001(\014\"\375\002\n\013FileReq"
-  "uest\022\021\n\tfile_name\030\001 \001(\t\022/\n\014file_content\030"
-  "\002 \001(\0132\031.file_processor.FileChunk\022A\n\023comp"
-  "ress_pdf_params\030\003 \001(\0132\".file_processor.C"
-  "ompressPDFRequestH\000\022D\n\025convert_to_txt_pa"
-  "rams\030\004 \001(\0132#.file_processor.ConvertToTXT"
-  "RequestH\000\022P\n\033convert_image_format_params"
-  "\030\005 \001(\0132).file_processor.ConvertImageForm"
-  "atRequestH\000\022A\n\023resize_image_params\030\006 \001(\013"
-  "2\".file_processor.ResizeImageRequestH\000B\014"
-  "\n\nparameters\"\024\n\022CompressPDFRequest\"\025\n\023Co"
-  "nvertToTXTRequest\"2\n\031ConvertImageFormatR"
-  "equest\022\025\n\routput_format\030\001 \001(\t\"3\n\022ResizeI"
-  "mageRequest\022\r\n\005width\030\001 \001(\005\022\016\n\006height\030\002 \001"
-  "(\005\"{\n\014FileResponse\022\021\n\tfile_name\030\001 \001(\t\022/\n"
-  "\014file_content\030\002 \001(\0132\031.file_processor.Fil"
-  "eChunk\022\026\n\016status_message\030\003 \001(\t\022\017\n\007succes"
-  "s\030\004 \001(\0102\326\002\n\024FileProcessorService\022L\n\013Comp"
-  "ressPDF\022\033.file_processor.FileRequest\032\034.f"
-  "ile_processor.FileResponse(\0010\001\022M\n\014Conver"
-  "tToTXT\022\033.file_processor.FileRequest\032\034.fi"
-  "le_processor.FileResponse(\0010\001\022S\n\022Convert"
-  "ImageFormat\022\033.file_processor.FileRequest"
-  "\032\034.file_processor.FileResponse(\0010\001\022L\n\013Re"
-  "sizeImage\022\033.file_processor.FileRequest\032\034"
-  ".file_processor.FileResponse(\0010\001b\006proto3"
-  ;
-static ::_pbi::once_flag descriptor_table_file_5fprocessor_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_file_5fprocessor_2eproto = {
-    false, false, 1080, descriptor_table_protodef_file_5fprocessor_2eproto,
-    "file_processor.proto",
-    &descriptor_table_file_5fprocessor_2eproto_once, nullptr, 0, 7,
-    schemas, file_default_instances, TableStruct_file_5fprocessor_2eproto::offsets,
-    file_level_metadata_file_5fprocessor_2eproto, file_level_enum_descriptors_file_5fprocessor_2eproto,
-    file_level_service_descriptors_file_5fprocessor_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_file_5fprocessor_2eproto_getter() {
-  return &descriptor_table_file_5fprocessor_2eproto;
-}
-
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_file_5fprocessor_2eproto(&descriptor_table_file_5fprocessor_2eproto);
-namespace file_processor {
-
-// ===================================================================
-
-class FileChunk::_Internal {
- public:
-};
-
-FileChunk::FileChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:file_processor.FileChunk)
-}
-FileChunk::FileChunk(const FileChunk& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  FileChunk* const _this = this; (void)_this;
-  new (&_impl_) Impl_{
-      decltype(_impl_.content_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
-
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.content_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.content_.Set("", GetArenaForAllocation());
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.result_handle_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.output_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FileResponse, _impl_.output_crc32c_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchRequest, _impl_.file_id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchRequest, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchRequest, _impl_.last_chunk_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchResponse, _impl_.file_id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchResponse, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BatchResponse, _impl_.done_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::StartUploadRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::StartUploadRequest, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::StartUploadRequest, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _impl_.upload_id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadChunk, _impl_.crc32c_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadQuery, _impl_.upload_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.upload_id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.committed_offset_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.complete_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.status_message_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::UploadStatus, _impl_.sha256_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::FetchOutputRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::FetchOutputRequest, _impl_.result_handle_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FetchOutputRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::FetchOutputRequest, _impl_.length_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobOutput, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobOutput, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobOutput, _impl_.result_handle_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobOutput, _impl_.output_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobQuery, _impl_.job_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobStatus, _impl_.job_id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobStatus, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobStatus, _impl_.status_message_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobStatus, _impl_.outputs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureRequest, _impl_.basis_sha256_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureRequest, _impl_.block_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockSignature, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockSignature, _impl_.weak_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockSignature, _impl_.strong_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.status_message_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.block_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.basis_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.blocks_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::SignatureBatch, _impl_.first_block_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockRange, _impl_.first_block_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::BlockRange, _impl_.count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaOp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaOp, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaOp, _impl_.op_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.basis_sha256_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.block_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.file_sha256_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::DeltaChunk, _impl_.ops_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencyQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencyQuery, _impl_.operation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.sum_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.max_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.p50_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.p90_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.p99_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencySeries, _impl_.p999_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencyReport, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::LatencyReport, _impl_.series_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerStateQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.rpc_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.elapsed_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.phase_elapsed_us_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.bytes_received_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.bytes_sent_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.child_pid_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.child_tool_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.peer_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ActiveRequest, _impl_.trace_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.requests_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.worker_threads_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.worker_active_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.worker_queued_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.jobs_queued_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.jobs_running_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.ingest_buffer_bytes_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::ServerState, _impl_.uptime_s_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobRecord, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobRecord, _impl_.request_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobRecord, _impl_.submitted_at_),
+  PROTOBUF_FIELD_OFFSET(::file_processor::JobRecord, _impl_.input_size_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::file_processor::FileChunk)},
+  { 10, -1, -1, sizeof(::file_processor::FileRequest)},
+  { 26, -1, -1, sizeof(::file_processor::CompressPDFRequest)},
+  { 32, -1, -1, sizeof(::file_processor::ConvertToTXTRequest)},
+  { 38, -1, -1, sizeof(::file_processor::ConvertImageFormatRequest)},
+  { 45, -1, -1, sizeof(::file_processor::ResizeImageRequest)},
+  { 53, -1, -1, sizeof(::file_processor::ImageSize)},
+  { 61, -1, -1, sizeof(::file_processor::ResizeImageMultiRequest)},
+  { 68, -1, -1, sizeof(::file_processor::PipelineStep)},
+  { 79, -1, -1, sizeof(::file_processor::PipelineRequest)},
+  { 86, 99, -1, sizeof(::file_processor::FileResponse)},
+  { 106, -1, -1, sizeof(::file_processor::BatchRequest)},
+  { 115, -1, -1, sizeof(::file_processor::BatchResponse)},
+  { 124, -1, -1, sizeof(::file_processor::StartUploadRequest)},
+  { 132, 142, -1, sizeof(::file_processor::UploadChunk)},
+  { 146, -1, -1, sizeof(::file_processor::UploadQuery)},
+  { 153, -1, -1, sizeof(::file_processor::UploadStatus)},
+  { 166, -1, -1, sizeof(::file_processor::FetchOutputRequest)},
+  { 175, -1, -1, sizeof(::file_processor::JobOutput)},
+  { 184, -1, -1, sizeof(::file_processor::JobQuery)},
+  { 191, -1, -1, sizeof(::file_processor::JobStatus)},
+  { 201, -1, -1, sizeof(::file_processor::SignatureRequest)},
+  { 209, -1, -1, sizeof(::file_processor::BlockSignature)},
+  { 217, -1, -1, sizeof(::file_processor::SignatureBatch)},
+  { 229, -1, -1, sizeof(::file_processor::BlockRange)},
+  { 237, -1, -1, sizeof(::file_processor::DeltaOp)},
+  { 246, -1, -1, sizeof(::file_processor::DeltaChunk)},
+  { 258, -1, -1, sizeof(::file_processor::LatencyQuery)},
+  { 265, -1, -1, sizeof(::file_processor::LatencySeries)},
+  { 281, -1, -1, sizeof(::file_processor::LatencyReport)},
+  { 288, -1, -1, sizeof(::file_processor::ServerStateQuery)},
+  { 294, -1, -1, sizeof(::file_processor::ActiveRequest)},
+  { 313, -1, -1, sizeof(::file_processor::ServerState)},
+  { 327, -1, -1, sizeof(::file_processor::JobRecord)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::file_processor::_FileChunk_default_instance_._instance,
+  &::file_processor::_FileRequest_default_instance_._instance,
+  &::file_processor::_CompressPDFRequest_default_instance_._instance,
+  &::file_processor::_ConvertToTXTRequest_default_instance_._instance,
+  &::file_processor::_ConvertImageFormatRequest_default_instance_._instance,
+  &::file_processor::_ResizeImageRequest_default_instance_._instance,
+  &::file_processor::_ImageSize_default_instance_._instance,
+  &::file_processor::_ResizeImageMultiRequest_default_instance_._instance,
+  &::file_processor::_PipelineStep_default_instance_._instance,
+  &::file_processor::_PipelineRequest_default_instance_._instance,
+  &::file_processor::_FileResponse_default_instance_._instance,
+  &::file_processor::_BatchRequest_default_instance_._instance,
+  &::file_processor::_BatchResponse_default_instance_._instance,
+  &::file_processor::_StartUploadRequest_default_instance_._instance,
+  &::file_processor::_UploadChunk_default_instance_._instance,
+  &::file_processor::_UploadQuery_default_instance_._instance,
+  &::file_processor::_UploadStatus_default_instance_._instance,
+  &::file_processor::_FetchOutputRequest_default_instance_._instance,
+  &::file_processor::_JobOutput_default_instance_._instance,
+  &::file_processor::_JobQuery_default_instance_._instance,
+  &::file_processor::_JobStatus_default_instance_._instance,
+  &::file_processor::_SignatureRequest_default_instance_._instance,
+  &::file_processor::_BlockSignature_default_instance_._instance,
+  &::file_processor::_SignatureBatch_default_instance_._instance,
+  &::file_processor::_BlockRange_default_instance_._instance,
+  &::file_processor::_DeltaOp_default_instance_._instance,
+  &::file_processor::_DeltaChunk_default_instance_._instance,
+  &::file_processor::_LatencyQuery_default_instance_._instance,
+  &::file_processor::_LatencySeries_default_instance_._instance,
+  &::file_processor::_LatencyReport_default_instance_._instance,
+  &::file_processor::_ServerStateQuery_default_instance_._instance,
+  &::file_processor::_ActiveRequest_default_instance_._instance,
+  &::file_processor::_ServerState_default_instance_._instance,
+  &::file_processor::_JobRecord_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_file_5fprocessor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024file_processor.proto\022\016file_processor\"<"
+  "\n\tFileChunk\022\017\n\007content\030\001 \001(\014\022\023\n\006crc32c\030\002"
+  " \001(\007H\000\210\001\001B\t\n\007_crc32c\"\232\004\n\013FileRequest\022\021\n\t"
+  "file_name\030\001 \001(\t\022/\n\014file_content\030\002 \001(\0132\031."
+  "file_processor.FileChunk\022A\n\023compress_pdf"
+  "_params\030\003 \001(\0132\".file_processor.CompressP"
+  "DFRequestH\000\022D\n\025convert_to_txt_params\030\004 \001"
+  "(\0132#.file_processor.ConvertToTXTRequestH"
+  "\000\022P\n\033convert_image_format_params\030\005 \001(\0132)"
+  ".file_processor.ConvertImageFormatReques"
+  "tH\000\022A\n\023resize_image_params\030\006 \001(\0132\".file_"
+  "processor.ResizeImageRequestH\000\022L\n\031resize"
+  "_image_multi_params\030\007 \001(\0132\'.file_process"
+  "or.ResizeImageMultiRequestH\000\022:\n\017pipeline"
+  "_params\030\t \001(\0132\037.file_processor.PipelineR"
+  "equestH\000\022\021\n\tupload_id\030\010 \001(\tB\014\n\nparameter"
+  "s\"\024\n\022CompressPDFRequest\"\025\n\023ConvertToTXTR"
+  "equest\"2\n\031ConvertImageFormatRequest\022\025\n\ro"
+  "utput_format\030\001 \001(\t\"3\n\022ResizeImageRequest"
+  "\022\r\n\005width\030\001 \001(\005\022\016\n\006height\030\002 \001(\005\"*\n\tImage"
+  "Size\022\r\n\005width\030\001 \001(\005\022\016\n\006height\030\002 \001(\005\"C\n\027R"
+  "esizeImageMultiRequest\022(\n\005sizes\030\001 \003(\0132\031."
+  "file_processor.ImageSize\"\235\002\n\014PipelineSte"
+  "p\022:\n\014compress_pdf\030\001 \001(\0132\".file_processor"
+  ".CompressPDFRequestH\000\022=\n\016convert_to_txt\030"
+  "\002 \001(\0132#.file_processor.ConvertToTXTReque"
+  "stH\000\022I\n\024convert_image_format\030\003 \001(\0132).fil"
+  "e_processor.ConvertImageFormatRequestH\000\022"
+  ":\n\014resize_image\030\004 \001(\0132\".file_processor.R"
+  "esizeImageRequestH\000B\013\n\toperation\">\n\017Pipe"
+  "lineRequest\022+\n\005steps\030\001 \003(\0132\034.file_proces"
+  "sor.PipelineStep\"\325\001\n\014FileResponse\022\021\n\tfil"
+  "e_name\030\001 \001(\t\022/\n\014file_content\030\002 \001(\0132\031.fil"
+  "e_processor.FileChunk\022\026\n\016status_message\030"
+  "\003 \001(\t\022\017\n\007success\030\004 \001(\010\022\025\n\rresult_handle\030"
+  "\005 \001(\t\022\023\n\013output_size\030\006 \001(\004\022\032\n\routput_crc"
+  "32c\030\007 \001(\007H\000\210\001\001B\020\n\016_output_crc32c\"a\n\014Batc"
+  "hRequest\022\017\n\007file_id\030\001 \001(\t\022,\n\007request\030\002 \001"
+  "(\0132\033.file_processor.FileRequest\022\022\n\nlast_"
+  "chunk\030\003 \001(\010\"^\n\rBatchResponse\022\017\n\007file_id\030"
+  "\001 \001(\t\022.\n\010response\030\002 \001(\0132\034.file_processor"
+  ".FileResponse\022\014\n\004done\030\003 \001(\010\";\n\022StartUplo"
+  "adRequest\022\021\n\tfile_name\030\001 \001(\t\022\022\n\ntotal_si"
+  "ze\030\002 \001(\004\"a\n\013UploadChunk\022\021\n\tupload_id\030\001 \001"
+  "(\t\022\016\n\006offset\030\002 \001(\004\022\017\n\007content\030\003 \001(\014\022\023\n\006c"
+  "rc32c\030\004 \001(\007H\000\210\001\001B\t\n\007_crc32c\" \n\013UploadQue"
+  "ry\022\021\n\tupload_id\030\001 \001(\t\"\232\001\n\014UploadStatus\022\021"
+  "\n\tupload_id\030\001 \001(\t\022\030\n\020committed_offset\030\002 "
+  "\001(\004\022\022\n\ntotal_size\030\003 \001(\004\022\020\n\010complete\030\004 \001("
+  "\010\022\017\n\007success\030\005 \001(\010\022\026\n\016status_message\030\006 \001"
+  "(\t\022\016\n\006sha256\030\007 \001(\t\"K\n\022FetchOutputRequest"
+  "\022\025\n\rresult_handle\030\001 \001(\t\022\016\n\006offset\030\002 \001(\004\022"
+  "\016\n\006length\030\003 \001(\004\"J\n\tJobOutput\022\021\n\tfile_nam"
+  "e\030\001 \001(\t\022\025\n\rresult_handle\030\002 \001(\t\022\023\n\013output"
+  "_size\030\003 \001(\004\"\032\n\010JobQuery\022\016\n\006job_id\030\001 \001(\t\""
+  "\210\001\n\tJobStatus\022\016\n\006job_id\030\001 \001(\t\022\'\n\005state\030\002"
+  " \001(\0162\030.file_processor.JobState\022\026\n\016status"
+  "_message\030\003 \001(\t\022*\n\007outputs\030\004 \003(\0132\031.file_p"
+  "rocessor.JobOutput\"<\n\020SignatureRequest\022\024"
+  "\n\014basis_sha256\030\001 \001(\t\022\022\n\nblock_size\030\002 \001(\r"
+  "\".\n\016BlockSignature\022\014\n\004weak\030\001 \001(\007\022\016\n\006stro"
+  "ng\030\002 \001(\014\"\246\001\n\016SignatureBatch\022\017\n\007success\030\001"
+  " \001(\010\022\026\n\016status_message\030\002 \001(\t\022\022\n\nblock_si"
+  "ze\030\003 \001(\r\022\022\n\nbasis_size\030\004 \001(\004\022.\n\006blocks\030\005"
+  " \003(\0132\036.file_processor.BlockSignature\022\023\n\013"
+  "first_block\030\006 \001(\004\"0\n\nBlockRange\022\023\n\013first"
+  "_block\030\001 \001(\004\022\r\n\005count\030\002 \001(\r\"N\n\007DeltaOp\022\021"
+  "\n\007literal\030\001 \001(\014H\000\022*\n\004copy\030\002 \001(\0132\032.file_p"
+  "rocessor.BlockRangeH\000B\004\n\002op\"\230\001\n\nDeltaChu"
+  "nk\022\024\n\014basis_sha256\030\001 \001(\t\022\022\n\nblock_size\030\002"
+  " \001(\r\022\021\n\tfile_name\030\003 \001(\t\022\022\n\ntotal_size\030\004 "
+  "\001(\004\022\023\n\013file_sha256\030\005 \001(\t\022$\n\003ops\030\006 \003(\0132\027."
+  "file_processor.DeltaOp\"!\n\014LatencyQuery\022\021"
+  "\n\toperation\030\001 \001(\t\"\262\001\n\rLatencySeries\022\021\n\to"
+  "peration\030\001 \001(\t\022\017\n\007success\030\002 \001(\010\022\r\n\005phase"
+  "\030\003 \001(\t\022\r\n\005count\030\004 \001(\004\022\016\n\006sum_us\030\005 \001(\004\022\016\n"
+  "\006max_us\030\006 \001(\004\022\016\n\006p50_us\030\007 \001(\004\022\016\n\006p90_us\030"
+  "\010 \001(\004\022\016\n\006p99_us\030\t \001(\004\022\017\n\007p999_us\030\n \001(\004\">"
+  "\n\rLatencyReport\022-\n\006series\030\001 \003(\0132\035.file_p"
+  "rocessor.LatencySeries\"\022\n\020ServerStateQue"
+  "ry\"\376\001\n\rActiveRequest\022\n\n\002id\030\001 \001(\004\022\013\n\003rpc\030"
+  "\002 \001(\t\022\021\n\toperation\030\003 \001(\t\022\021\n\tfile_name\030\004 "
+  "\001(\t\022\r\n\005phase\030\005 \001(\t\022\022\n\nelapsed_us\030\006 \001(\004\022\030"
+  "\n\020phase_elapsed_us\030\007 \001(\004\022\026\n\016bytes_receiv"
+  "ed\030\010 \001(\004\022\022\n\nbytes_sent\030\t \001(\004\022\021\n\tchild_pi"
+  "d\030\n \001(\005\022\022\n\nchild_tool\030\013 \001(\t\022\014\n\004peer\030\014 \001("
+  "\t\022\020\n\010trace_id\030\r \001(\t\"\336\001\n\013ServerState\022/\n\010r"
+  "equests\030\001 \003(\0132\035.file_processor.ActiveReq"
+  "uest\022\026\n\016worker_threads\030\002 \001(\r\022\025\n\rworker_a"
+  "ctive\030\003 \001(\r\022\025\n\rworker_queued\030\004 \001(\r\022\023\n\013jo"
+  "bs_queued\030\005 \001(\r\022\024\n\014jobs_running\030\006 \001(\r\022\033\n"
+  "\023ingest_buffer_bytes\030\007 \001(\004\022\020\n\010uptime_s\030\010"
+  " \001(\004\"\216\001\n\tJobRecord\022)\n\006status\030\001 \001(\0132\031.fil"
+  "e_processor.JobStatus\022,\n\007request\030\002 \001(\0132\033"
+  ".file_processor.FileRequest\022\024\n\014submitted"
+  "_at\030\003 \001(\003\022\022\n\ninput_size\030\004 \001(\004*I\n\010JobStat"
+  "e\022\016\n\nJOB_QUEUED\020\000\022\017\n\013JOB_RUNNING\020\001\022\014\n\010JO"
+  "B_DONE\020\002\022\016\n\nJOB_FAILED\020\0032\233\013\n\024FileProcess"
+  "orService\022L\n\013CompressPDF\022\033.file_processo"
+  "r.FileRequest\032\034.file_processor.FileRespo"
+  "nse(\0010\001\022M\n\014ConvertToTXT\022\033.file_processor"
+  ".FileRequest\032\034.file_processor.FileRespon"
+  "se(\0010\001\022S\n\022ConvertImageFormat\022\033.file_proc"
+  "essor.FileRequest\032\034.file_processor.FileR"
+  "esponse(\0010\001\022L\n\013ResizeImage\022\033.file_proces"
+  "sor.FileRequest\032\034.file_processor.FileRes"
+  "ponse(\0010\001\022Q\n\020ResizeImageMulti\022\033.file_pro"
+  "cessor.FileRequest\032\034.file_processor.File"
+  "Response(\0010\001\022L\n\013RunPipeline\022\033.file_proce"
+  "ssor.FileRequest\032\034.file_processor.FileRe"
+  "sponse(\0010\001\022O\n\014ProcessBatch\022\034.file_proces"
+  "sor.BatchRequest\032\035.file_processor.BatchR"
+  "esponse(\0010\001\022O\n\013StartUpload\022\".file_proces"
+  "sor.StartUploadRequest\032\034.file_processor."
+  "UploadStatus\022M\n\014UploadChunks\022\033.file_proc"
+  "essor.UploadChunk\032\034.file_processor.Uploa"
+  "dStatus(\0010\001\022H\n\013QueryUpload\022\033.file_proces"
+  "sor.UploadQuery\032\034.file_processor.UploadS"
+  "tatus\022S\n\rGetSignatures\022 .file_processor."
+  "SignatureRequest\032\036.file_processor.Signat"
+  "ureBatch0\001\022K\n\013UploadDelta\022\032.file_process"
+  "or.DeltaChunk\032\034.file_processor.UploadSta"
+  "tus(\0010\001\022Q\n\013FetchOutput\022\".file_processor."
+  "FetchOutputRequest\032\034.file_processor.File"
+  "Response0\001\022C\n\tSubmitJob\022\033.file_processor"
+  ".FileRequest\032\031.file_processor.JobStatus\022"
+  "C\n\014GetJobStatus\022\030.file_processor.JobQuer"
+  "y\032\031.file_processor.JobStatus\022G\n\013FetchRes"
+  "ult\022\030.file_processor.JobQuery\032\034.file_pro"
+  "cessor.FileResponse0\001\022N\n\017GetLatencyStats"
+  "\022\034.file_processor.LatencyQuery\032\035.file_pr"
+  "ocessor.LatencyReport\022O\n\016GetServerState\022"
+  " .file_processor.ServerStateQuery\032\033.file"
+  "_processor.ServerStateb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_file_5fprocessor_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_file_5fprocessor_2eproto = {
+    false, false, 5350, descriptor_table_protodef_file_5fprocessor_2eproto,
+    "file_processor.proto",
+    &descriptor_table_file_5fprocessor_2eproto_once, nullptr, 0, 34,
+    schemas, file_default_instances, TableStruct_file_5fprocessor_2eproto::offsets,
+    file_level_metadata_file_5fprocessor_2eproto, file_level_enum_descriptors_file_5fprocessor_2eproto,
+    file_level_service_descriptors_file_5fprocessor_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_file_5fprocessor_2eproto_getter() {
+  return &descriptor_table_file_5fprocessor_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_file_5fprocessor_2eproto(&descriptor_table_file_5fprocessor_2eproto);
+namespace file_processor {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* JobState_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_file_5fprocessor_2eproto);
+  return file_level_enum_descriptors_file_5fprocessor_2eproto[0];
+}
+bool JobState_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class FileChunk::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FileChunk>()._impl_._has_bits_);
+  static void set_has_crc32c(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+FileChunk::FileChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.FileChunk)
+}
+FileChunk::FileChunk(const FileChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.crc32c_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
     _this->_impl_.content_.Set(from._internal_content(), 
       _this->GetArenaForAllocation());
   }
+  _this->_impl_.crc32c_ = from._impl_.crc32c_;
   // @@protoc_insertion_point(copy_constructor:file_processor.FileChunk)
 }
 
@@ -281,8 +1170,10 @@ inline void FileChunk::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.content_){}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.crc32c_){0u}
   };
   _impl_.content_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -315,11 +1206,14 @@ void FileChunk::Clear() {
   (void) cached_has_bits;
 
   _impl_.content_.ClearToEmpty();
+  _impl_.crc32c_ = 0u;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* FileChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -333,6 +1227,15 @@ const char* FileChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // optional fixed32 crc32c = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_crc32c(&has_bits);
+          _impl_.crc32c_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -349,6 +1252,7 @@ const char* FileChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -368,6 +1272,12 @@ uint8_t* FileChunk::_InternalSerialize(
         1, this->_internal_content(), target);
   }
 
+  // optional fixed32 crc32c = 2;
+  if (_internal_has_crc32c()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_crc32c(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -391,6 +1301,12 @@ size_t FileChunk::ByteSizeLong() const {
         this->_internal_content());
   }
 
+  // optional fixed32 crc32c = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -412,6 +1328,9 @@ void FileChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (!from._internal_content().empty()) {
     _this->_internal_set_content(from._internal_content());
   }
+  if (from._internal_has_crc32c()) {
+    _this->_internal_set_crc32c(from._internal_crc32c());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -431,10 +1350,12 @@ void FileChunk::InternalSwap(FileChunk* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.content_, lhs_arena,
       &other->_impl_.content_, rhs_arena
   );
+  swap(_impl_.crc32c_, other->_impl_.crc32c_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata FileChunk::GetMetadata() const {
@@ -452,6 +1373,8 @@ class FileRequest::_Internal {
   static const ::file_processor::ConvertToTXTRequest& convert_to_txt_params(const FileRequest* msg);
   static const ::file_processor::ConvertImageFormatRequest& convert_image_format_params(const FileRequest* msg);
   static const ::file_processor::ResizeImageRequest& resize_image_params(const FileRequest* msg);
+  static const ::file_processor::ResizeImageMultiRequest& resize_image_multi_params(const FileRequest* msg);
+  static const ::file_processor::PipelineRequest& pipeline_params(const FileRequest* msg);
 };
 
 const ::file_processor::FileChunk&
@@ -474,6 +1397,14 @@ const ::file_processor::ResizeImageRequest&
 FileRequest::_Internal::resize_image_params(const FileRequest* msg) {
   return *msg->_impl_.parameters_.resize_image_params_;
 }
+const ::file_processor::ResizeImageMultiRequest&
+FileRequest::_Internal::resize_image_multi_params(const FileRequest* msg) {
+  return *msg->_impl_.parameters_.resize_image_multi_params_;
+}
+const ::file_processor::PipelineRequest&
+FileRequest::_Internal::pipeline_params(const FileRequest* msg) {
+  return *msg->_impl_.parameters_.pipeline_params_;
+}
 void FileRequest::set_allocated_compress_pdf_params(::file_processor::CompressPDFRequest* compress_pdf_params) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_parameters();
@@ -534,6 +1465,36 @@ void FileRequest::set_allocated_resize_image_params(::file_processor::ResizeImag
   }
   // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.resize_image_params)
 }
+void FileRequest::set_allocated_resize_image_multi_params(::file_processor::ResizeImageMultiRequest* resize_image_multi_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_parameters();
+  if (resize_image_multi_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(resize_image_multi_params);
+    if (message_arena != submessage_arena) {
+      resize_image_multi_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resize_image_multi_params, submessage_arena);
+    }
+    set_has_resize_image_multi_params();
+    _impl_.parameters_.resize_image_multi_params_ = resize_image_multi_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.resize_image_multi_params)
+}
+void FileRequest::set_allocated_pipeline_params(::file_processor::PipelineRequest* pipeline_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_parameters();
+  if (pipeline_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pipeline_params);
+    if (message_arena != submessage_arena) {
+      pipeline_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pipeline_params, submessage_arena);
+    }
+    set_has_pipeline_params();
+    _impl_.parameters_.pipeline_params_ = pipeline_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.pipeline_params)
+}
 FileRequest::FileRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -545,6 +1506,7 @@ FileRequest::FileRequest(const FileRequest& from)
   FileRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.file_name_){}
+    , decltype(_impl_.upload_id_){}
     , decltype(_impl_.file_content_){nullptr}
     , decltype(_impl_.parameters_){}
     , /*decltype(_impl_._cached_size_)*/{}
@@ -559,6 +1521,14 @@ FileRequest::FileRequest(const FileRequest& from)
     _this->_impl_.file_name_.Set(from._internal_file_name(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_upload_id().empty()) {
+    _this->_impl_.upload_id_.Set(from._internal_upload_id(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_file_content()) {
     _this->_impl_.file_content_ = new ::file_processor::FileChunk(*from._impl_.file_content_);
   }
@@ -584,6 +1554,16 @@ FileRequest::FileRequest(const FileRequest& from)
           from._internal_resize_image_params());
       break;
     }
+    case kResizeImageMultiParams: {
+      _this->_internal_mutable_resize_image_multi_params()->::file_processor::ResizeImageMultiRequest::MergeFrom(
+          from._internal_resize_image_multi_params());
+      break;
+    }
+    case kPipelineParams: {
+      _this->_internal_mutable_pipeline_params()->::file_processor::PipelineRequest::MergeFrom(
+          from._internal_pipeline_params());
+      break;
+    }
     case PARAMETERS_NOT_SET: {
       break;
     }
@@ -597,6 +1577,7 @@ inline void FileRequest::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.file_name_){}
+    , decltype(_impl_.upload_id_){}
     , decltype(_impl_.file_content_){nullptr}
     , decltype(_impl_.parameters_){}
     , /*decltype(_impl_._cached_size_)*/{}
@@ -606,6 +1587,10 @@ inline void FileRequest::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.file_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_parameters();
 }
 
@@ -621,6 +1606,7 @@ FileRequest::~FileRequest() {
 inline void FileRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.file_name_.Destroy();
+  _impl_.upload_id_.Destroy();
   if (this != internal_default_instance()) delete _impl_.file_content_;
   if (has_parameters()) {
     clear_parameters();
@@ -658,6 +1644,18 @@ void FileRequest::clear_parameters() {
       }
       break;
     }
+    case kResizeImageMultiParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.parameters_.resize_image_multi_params_;
+      }
+      break;
+    }
+    case kPipelineParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.parameters_.pipeline_params_;
+      }
+      break;
+    }
     case PARAMETERS_NOT_SET: {
       break;
     }
@@ -673,6 +1671,7 @@ void FileRequest::Clear() {
   (void) cached_has_bits;
 
   _impl_.file_name_.ClearToEmpty();
+  _impl_.upload_id_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
     delete _impl_.file_content_;
   }
@@ -737,6 +1736,32 @@ const char* FileRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
         } else
           goto handle_unusual;
         continue;
+      // .file_processor.ResizeImageMultiRequest resize_image_multi_params = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resize_image_multi_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string upload_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_upload_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileRequest.upload_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.PipelineRequest pipeline_params = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pipeline_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -811,6 +1836,30 @@ uint8_t* FileRequest::_InternalSerialize(
         _Internal::resize_image_params(this).GetCachedSize(), target, stream);
   }
 
+  // .file_processor.ResizeImageMultiRequest resize_image_multi_params = 7;
+  if (_internal_has_resize_image_multi_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::resize_image_multi_params(this),
+        _Internal::resize_image_multi_params(this).GetCachedSize(), target, stream);
+  }
+
+  // string upload_id = 8;
+  if (!this->_internal_upload_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_upload_id().data(), static_cast<int>(this->_internal_upload_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.FileRequest.upload_id");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_upload_id(), target);
+  }
+
+  // .file_processor.PipelineRequest pipeline_params = 9;
+  if (_internal_has_pipeline_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::pipeline_params(this),
+        _Internal::pipeline_params(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -834,6 +1883,13 @@ size_t FileRequest::ByteSizeLong() const {
         this->_internal_file_name());
   }
 
+  // string upload_id = 8;
+  if (!this->_internal_upload_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_upload_id());
+  }
+
   // .file_processor.FileChunk file_content = 2;
   if (this->_internal_has_file_content()) {
     total_size += 1 +
@@ -870,6 +1926,20 @@ size_t FileRequest::ByteSizeLong() const {
           *_impl_.parameters_.resize_image_params_);
       break;
     }
+    // .file_processor.ResizeImageMultiRequest resize_image_multi_params = 7;
+    case kResizeImageMultiParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.parameters_.resize_image_multi_params_);
+      break;
+    }
+    // .file_processor.PipelineRequest pipeline_params = 9;
+    case kPipelineParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.parameters_.pipeline_params_);
+      break;
+    }
     case PARAMETERS_NOT_SET: {
       break;
     }
@@ -895,6 +1965,9 @@ void FileRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   if (!from._internal_file_name().empty()) {
     _this->_internal_set_file_name(from._internal_file_name());
   }
+  if (!from._internal_upload_id().empty()) {
+    _this->_internal_set_upload_id(from._internal_upload_id());
+  }
   if (from._internal_has_file_content()) {
     _this->_internal_mutable_file_content()->::file_processor::FileChunk::MergeFrom(
         from._internal_file_content());
@@ -920,10 +1993,20 @@ void FileRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
           from._internal_resize_image_params());
       break;
     }
-    case PARAMETERS_NOT_SET: {
+    case kResizeImageMultiParams: {
+      _this->_internal_mutable_resize_image_multi_params()->::file_processor::ResizeImageMultiRequest::MergeFrom(
+          from._internal_resize_image_multi_params());
       break;
     }
-  }
+    case kPipelineParams: {
+      _this->_internal_mutable_pipeline_params()->::file_processor::PipelineRequest::MergeFrom(
+          from._internal_pipeline_params());
+      break;
+    }
+    case PARAMETERS_NOT_SET: {
+      break;
+    }
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -947,6 +2030,10 @@ void FileRequest::InternalSwap(FileRequest* other) {
       &_impl_.file_name_, lhs_arena,
       &other->_impl_.file_name_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.upload_id_, lhs_arena,
+      &other->_impl_.upload_id_, rhs_arena
+  );
   swap(_impl_.file_content_, other->_impl_.file_content_);
   swap(_impl_.parameters_, other->_impl_.parameters_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
@@ -1123,7 +2210,7437 @@ const char* ConvertImageFormatRequest::_InternalParse(const char* ptr, ::_pbi::P
           auto str = _internal_mutable_output_format();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ConvertImageFormatRequest.output_format"));
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ConvertImageFormatRequest.output_format"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConvertImageFormatRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ConvertImageFormatRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string output_format = 1;
+  if (!this->_internal_output_format().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_output_format().data(), static_cast<int>(this->_internal_output_format().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ConvertImageFormatRequest.output_format");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_output_format(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ConvertImageFormatRequest)
+  return target;
+}
+
+size_t ConvertImageFormatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ConvertImageFormatRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string output_format = 1;
+  if (!this->_internal_output_format().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_output_format());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConvertImageFormatRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConvertImageFormatRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConvertImageFormatRequest::GetClassData() const { return &_class_data_; }
+
+
+void ConvertImageFormatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConvertImageFormatRequest*>(&to_msg);
+  auto& from = static_cast<const ConvertImageFormatRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ConvertImageFormatRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_output_format().empty()) {
+    _this->_internal_set_output_format(from._internal_output_format());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConvertImageFormatRequest::CopyFrom(const ConvertImageFormatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ConvertImageFormatRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConvertImageFormatRequest::IsInitialized() const {
+  return true;
+}
+
+void ConvertImageFormatRequest::InternalSwap(ConvertImageFormatRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_format_, lhs_arena,
+      &other->_impl_.output_format_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConvertImageFormatRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[4]);
+}
+
+// ===================================================================
+
+class ResizeImageRequest::_Internal {
+ public:
+};
+
+ResizeImageRequest::ResizeImageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.ResizeImageRequest)
+}
+ResizeImageRequest::ResizeImageRequest(const ResizeImageRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResizeImageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.ResizeImageRequest)
+}
+
+inline void ResizeImageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResizeImageRequest::~ResizeImageRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.ResizeImageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResizeImageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ResizeImageRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResizeImageRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.ResizeImageRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.height_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResizeImageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 height = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResizeImageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ResizeImageRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 width = 1;
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_width(), target);
+  }
+
+  // int32 height = 2;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ResizeImageRequest)
+  return target;
+}
+
+size_t ResizeImageRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ResizeImageRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 width = 1;
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+  }
+
+  // int32 height = 2;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResizeImageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResizeImageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResizeImageRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResizeImageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResizeImageRequest*>(&to_msg);
+  auto& from = static_cast<const ResizeImageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ResizeImageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResizeImageRequest::CopyFrom(const ResizeImageRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ResizeImageRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResizeImageRequest::IsInitialized() const {
+  return true;
+}
+
+void ResizeImageRequest::InternalSwap(ResizeImageRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResizeImageRequest, _impl_.height_)
+      + sizeof(ResizeImageRequest::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(ResizeImageRequest, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResizeImageRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[5]);
+}
+
+// ===================================================================
+
+class ImageSize::_Internal {
+ public:
+};
+
+ImageSize::ImageSize(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.ImageSize)
+}
+ImageSize::ImageSize(const ImageSize& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ImageSize* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.ImageSize)
+}
+
+inline void ImageSize::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ImageSize::~ImageSize() {
+  // @@protoc_insertion_point(destructor:file_processor.ImageSize)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ImageSize::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ImageSize::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ImageSize::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.ImageSize)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.height_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ImageSize::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 height = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ImageSize::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ImageSize)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 width = 1;
+  if (this->_internal_width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_width(), target);
+  }
+
+  // int32 height = 2;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ImageSize)
+  return target;
+}
+
+size_t ImageSize::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ImageSize)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 width = 1;
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+  }
+
+  // int32 height = 2;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ImageSize::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ImageSize::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ImageSize::GetClassData() const { return &_class_data_; }
+
+
+void ImageSize::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ImageSize*>(&to_msg);
+  auto& from = static_cast<const ImageSize&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ImageSize)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ImageSize::CopyFrom(const ImageSize& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ImageSize)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ImageSize::IsInitialized() const {
+  return true;
+}
+
+void ImageSize::InternalSwap(ImageSize* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ImageSize, _impl_.height_)
+      + sizeof(ImageSize::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(ImageSize, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ImageSize::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[6]);
+}
+
+// ===================================================================
+
+class ResizeImageMultiRequest::_Internal {
+ public:
+};
+
+ResizeImageMultiRequest::ResizeImageMultiRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.ResizeImageMultiRequest)
+}
+ResizeImageMultiRequest::ResizeImageMultiRequest(const ResizeImageMultiRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResizeImageMultiRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sizes_){from._impl_.sizes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:file_processor.ResizeImageMultiRequest)
+}
+
+inline void ResizeImageMultiRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sizes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResizeImageMultiRequest::~ResizeImageMultiRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.ResizeImageMultiRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResizeImageMultiRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sizes_.~RepeatedPtrField();
+}
+
+void ResizeImageMultiRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResizeImageMultiRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.ResizeImageMultiRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sizes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResizeImageMultiRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .file_processor.ImageSize sizes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sizes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResizeImageMultiRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ResizeImageMultiRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .file_processor.ImageSize sizes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sizes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sizes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ResizeImageMultiRequest)
+  return target;
+}
+
+size_t ResizeImageMultiRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ResizeImageMultiRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.ImageSize sizes = 1;
+  total_size += 1UL * this->_internal_sizes_size();
+  for (const auto& msg : this->_impl_.sizes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResizeImageMultiRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResizeImageMultiRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResizeImageMultiRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResizeImageMultiRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResizeImageMultiRequest*>(&to_msg);
+  auto& from = static_cast<const ResizeImageMultiRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ResizeImageMultiRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sizes_.MergeFrom(from._impl_.sizes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResizeImageMultiRequest::CopyFrom(const ResizeImageMultiRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ResizeImageMultiRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResizeImageMultiRequest::IsInitialized() const {
+  return true;
+}
+
+void ResizeImageMultiRequest::InternalSwap(ResizeImageMultiRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sizes_.InternalSwap(&other->_impl_.sizes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResizeImageMultiRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[7]);
+}
+
+// ===================================================================
+
+class PipelineStep::_Internal {
+ public:
+  static const ::file_processor::CompressPDFRequest& compress_pdf(const PipelineStep* msg);
+  static const ::file_processor::ConvertToTXTRequest& convert_to_txt(const PipelineStep* msg);
+  static const ::file_processor::ConvertImageFormatRequest& convert_image_format(const PipelineStep* msg);
+  static const ::file_processor::ResizeImageRequest& resize_image(const PipelineStep* msg);
+};
+
+const ::file_processor::CompressPDFRequest&
+PipelineStep::_Internal::compress_pdf(const PipelineStep* msg) {
+  return *msg->_impl_.operation_.compress_pdf_;
+}
+const ::file_processor::ConvertToTXTRequest&
+PipelineStep::_Internal::convert_to_txt(const PipelineStep* msg) {
+  return *msg->_impl_.operation_.convert_to_txt_;
+}
+const ::file_processor::ConvertImageFormatRequest&
+PipelineStep::_Internal::convert_image_format(const PipelineStep* msg) {
+  return *msg->_impl_.operation_.convert_image_format_;
+}
+const ::file_processor::ResizeImageRequest&
+PipelineStep::_Internal::resize_image(const PipelineStep* msg) {
+  return *msg->_impl_.operation_.resize_image_;
+}
+void PipelineStep::set_allocated_compress_pdf(::file_processor::CompressPDFRequest* compress_pdf) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_operation();
+  if (compress_pdf) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(compress_pdf);
+    if (message_arena != submessage_arena) {
+      compress_pdf = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, compress_pdf, submessage_arena);
+    }
+    set_has_compress_pdf();
+    _impl_.operation_.compress_pdf_ = compress_pdf;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.PipelineStep.compress_pdf)
+}
+void PipelineStep::set_allocated_convert_to_txt(::file_processor::ConvertToTXTRequest* convert_to_txt) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_operation();
+  if (convert_to_txt) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(convert_to_txt);
+    if (message_arena != submessage_arena) {
+      convert_to_txt = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, convert_to_txt, submessage_arena);
+    }
+    set_has_convert_to_txt();
+    _impl_.operation_.convert_to_txt_ = convert_to_txt;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.PipelineStep.convert_to_txt)
+}
+void PipelineStep::set_allocated_convert_image_format(::file_processor::ConvertImageFormatRequest* convert_image_format) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_operation();
+  if (convert_image_format) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(convert_image_format);
+    if (message_arena != submessage_arena) {
+      convert_image_format = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, convert_image_format, submessage_arena);
+    }
+    set_has_convert_image_format();
+    _impl_.operation_.convert_image_format_ = convert_image_format;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.PipelineStep.convert_image_format)
+}
+void PipelineStep::set_allocated_resize_image(::file_processor::ResizeImageRequest* resize_image) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_operation();
+  if (resize_image) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(resize_image);
+    if (message_arena != submessage_arena) {
+      resize_image = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resize_image, submessage_arena);
+    }
+    set_has_resize_image();
+    _impl_.operation_.resize_image_ = resize_image;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.PipelineStep.resize_image)
+}
+PipelineStep::PipelineStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.PipelineStep)
+}
+PipelineStep::PipelineStep(const PipelineStep& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PipelineStep* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_operation();
+  switch (from.operation_case()) {
+    case kCompressPdf: {
+      _this->_internal_mutable_compress_pdf()->::file_processor::CompressPDFRequest::MergeFrom(
+          from._internal_compress_pdf());
+      break;
+    }
+    case kConvertToTxt: {
+      _this->_internal_mutable_convert_to_txt()->::file_processor::ConvertToTXTRequest::MergeFrom(
+          from._internal_convert_to_txt());
+      break;
+    }
+    case kConvertImageFormat: {
+      _this->_internal_mutable_convert_image_format()->::file_processor::ConvertImageFormatRequest::MergeFrom(
+          from._internal_convert_image_format());
+      break;
+    }
+    case kResizeImage: {
+      _this->_internal_mutable_resize_image()->::file_processor::ResizeImageRequest::MergeFrom(
+          from._internal_resize_image());
+      break;
+    }
+    case OPERATION_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:file_processor.PipelineStep)
+}
+
+inline void PipelineStep::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_operation();
+}
+
+PipelineStep::~PipelineStep() {
+  // @@protoc_insertion_point(destructor:file_processor.PipelineStep)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PipelineStep::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_operation()) {
+    clear_operation();
+  }
+}
+
+void PipelineStep::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PipelineStep::clear_operation() {
+// @@protoc_insertion_point(one_of_clear_start:file_processor.PipelineStep)
+  switch (operation_case()) {
+    case kCompressPdf: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.operation_.compress_pdf_;
+      }
+      break;
+    }
+    case kConvertToTxt: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.operation_.convert_to_txt_;
+      }
+      break;
+    }
+    case kConvertImageFormat: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.operation_.convert_image_format_;
+      }
+      break;
+    }
+    case kResizeImage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.operation_.resize_image_;
+      }
+      break;
+    }
+    case OPERATION_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = OPERATION_NOT_SET;
+}
+
+
+void PipelineStep::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.PipelineStep)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_operation();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PipelineStep::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .file_processor.CompressPDFRequest compress_pdf = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_compress_pdf(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.ConvertToTXTRequest convert_to_txt = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convert_to_txt(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.ConvertImageFormatRequest convert_image_format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convert_image_format(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.ResizeImageRequest resize_image = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resize_image(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PipelineStep::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.PipelineStep)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .file_processor.CompressPDFRequest compress_pdf = 1;
+  if (_internal_has_compress_pdf()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::compress_pdf(this),
+        _Internal::compress_pdf(this).GetCachedSize(), target, stream);
+  }
+
+  // .file_processor.ConvertToTXTRequest convert_to_txt = 2;
+  if (_internal_has_convert_to_txt()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::convert_to_txt(this),
+        _Internal::convert_to_txt(this).GetCachedSize(), target, stream);
+  }
+
+  // .file_processor.ConvertImageFormatRequest convert_image_format = 3;
+  if (_internal_has_convert_image_format()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::convert_image_format(this),
+        _Internal::convert_image_format(this).GetCachedSize(), target, stream);
+  }
+
+  // .file_processor.ResizeImageRequest resize_image = 4;
+  if (_internal_has_resize_image()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::resize_image(this),
+        _Internal::resize_image(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.PipelineStep)
+  return target;
+}
+
+size_t PipelineStep::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.PipelineStep)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (operation_case()) {
+    // .file_processor.CompressPDFRequest compress_pdf = 1;
+    case kCompressPdf: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.operation_.compress_pdf_);
+      break;
+    }
+    // .file_processor.ConvertToTXTRequest convert_to_txt = 2;
+    case kConvertToTxt: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.operation_.convert_to_txt_);
+      break;
+    }
+    // .file_processor.ConvertImageFormatRequest convert_image_format = 3;
+    case kConvertImageFormat: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.operation_.convert_image_format_);
+      break;
+    }
+    // .file_processor.ResizeImageRequest resize_image = 4;
+    case kResizeImage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.operation_.resize_image_);
+      break;
+    }
+    case OPERATION_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PipelineStep::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PipelineStep::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PipelineStep::GetClassData() const { return &_class_data_; }
+
+
+void PipelineStep::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PipelineStep*>(&to_msg);
+  auto& from = static_cast<const PipelineStep&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.PipelineStep)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.operation_case()) {
+    case kCompressPdf: {
+      _this->_internal_mutable_compress_pdf()->::file_processor::CompressPDFRequest::MergeFrom(
+          from._internal_compress_pdf());
+      break;
+    }
+    case kConvertToTxt: {
+      _this->_internal_mutable_convert_to_txt()->::file_processor::ConvertToTXTRequest::MergeFrom(
+          from._internal_convert_to_txt());
+      break;
+    }
+    case kConvertImageFormat: {
+      _this->_internal_mutable_convert_image_format()->::file_processor::ConvertImageFormatRequest::MergeFrom(
+          from._internal_convert_image_format());
+      break;
+    }
+    case kResizeImage: {
+      _this->_internal_mutable_resize_image()->::file_processor::ResizeImageRequest::MergeFrom(
+          from._internal_resize_image());
+      break;
+    }
+    case OPERATION_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PipelineStep::CopyFrom(const PipelineStep& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.PipelineStep)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PipelineStep::IsInitialized() const {
+  return true;
+}
+
+void PipelineStep::InternalSwap(PipelineStep* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.operation_, other->_impl_.operation_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PipelineStep::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[8]);
+}
+
+// ===================================================================
+
+class PipelineRequest::_Internal {
+ public:
+};
+
+PipelineRequest::PipelineRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.PipelineRequest)
+}
+PipelineRequest::PipelineRequest(const PipelineRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PipelineRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.steps_){from._impl_.steps_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:file_processor.PipelineRequest)
+}
+
+inline void PipelineRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.steps_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PipelineRequest::~PipelineRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.PipelineRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PipelineRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.steps_.~RepeatedPtrField();
+}
+
+void PipelineRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PipelineRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.PipelineRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.steps_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PipelineRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .file_processor.PipelineStep steps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_steps(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PipelineRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.PipelineRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .file_processor.PipelineStep steps = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_steps_size()); i < n; i++) {
+    const auto& repfield = this->_internal_steps(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.PipelineRequest)
+  return target;
+}
+
+size_t PipelineRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.PipelineRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.PipelineStep steps = 1;
+  total_size += 1UL * this->_internal_steps_size();
+  for (const auto& msg : this->_impl_.steps_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PipelineRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PipelineRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PipelineRequest::GetClassData() const { return &_class_data_; }
+
+
+void PipelineRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PipelineRequest*>(&to_msg);
+  auto& from = static_cast<const PipelineRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.PipelineRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.steps_.MergeFrom(from._impl_.steps_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PipelineRequest::CopyFrom(const PipelineRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.PipelineRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PipelineRequest::IsInitialized() const {
+  return true;
+}
+
+void PipelineRequest::InternalSwap(PipelineRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.steps_.InternalSwap(&other->_impl_.steps_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PipelineRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[9]);
+}
+
+// ===================================================================
+
+class FileResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FileResponse>()._impl_._has_bits_);
+  static const ::file_processor::FileChunk& file_content(const FileResponse* msg);
+  static void set_has_output_crc32c(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::file_processor::FileChunk&
+FileResponse::_Internal::file_content(const FileResponse* msg) {
+  return *msg->_impl_.file_content_;
+}
+FileResponse::FileResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.FileResponse)
+}
+FileResponse::FileResponse(const FileResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.result_handle_){}
+    , decltype(_impl_.file_content_){nullptr}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.output_crc32c_){}
+    , decltype(_impl_.output_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_status_message().empty()) {
+    _this->_impl_.status_message_.Set(from._internal_status_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result_handle().empty()) {
+    _this->_impl_.result_handle_.Set(from._internal_result_handle(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_file_content()) {
+    _this->_impl_.file_content_ = new ::file_processor::FileChunk(*from._impl_.file_content_);
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.output_size_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.output_size_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.FileResponse)
+}
+
+inline void FileResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.result_handle_){}
+    , decltype(_impl_.file_content_){nullptr}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.output_crc32c_){0u}
+    , decltype(_impl_.output_size_){uint64_t{0u}}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FileResponse::~FileResponse() {
+  // @@protoc_insertion_point(destructor:file_processor.FileResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FileResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.status_message_.Destroy();
+  _impl_.result_handle_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.file_content_;
+}
+
+void FileResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FileResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.FileResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.status_message_.ClearToEmpty();
+  _impl_.result_handle_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
+    delete _impl_.file_content_;
+  }
+  _impl_.file_content_ = nullptr;
+  _impl_.success_ = false;
+  _impl_.output_crc32c_ = 0u;
+  _impl_.output_size_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FileResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileResponse.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.FileChunk file_content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_file_content(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string status_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_status_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileResponse.status_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string result_handle = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_result_handle();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileResponse.result_handle"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 output_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.output_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 output_crc32c = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_output_crc32c(&has_bits);
+          _impl_.output_crc32c_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FileResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.FileResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.FileResponse.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // .file_processor.FileChunk file_content = 2;
+  if (this->_internal_has_file_content()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::file_content(this),
+        _Internal::file_content(this).GetCachedSize(), target, stream);
+  }
+
+  // string status_message = 3;
+  if (!this->_internal_status_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.FileResponse.status_message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_status_message(), target);
+  }
+
+  // bool success = 4;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_success(), target);
+  }
+
+  // string result_handle = 5;
+  if (!this->_internal_result_handle().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_result_handle().data(), static_cast<int>(this->_internal_result_handle().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.FileResponse.result_handle");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_result_handle(), target);
+  }
+
+  // uint64 output_size = 6;
+  if (this->_internal_output_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_output_size(), target);
+  }
+
+  // optional fixed32 output_crc32c = 7;
+  if (_internal_has_output_crc32c()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_output_crc32c(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.FileResponse)
+  return target;
+}
+
+size_t FileResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.FileResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string status_message = 3;
+  if (!this->_internal_status_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_message());
+  }
+
+  // string result_handle = 5;
+  if (!this->_internal_result_handle().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_result_handle());
+  }
+
+  // .file_processor.FileChunk file_content = 2;
+  if (this->_internal_has_file_content()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.file_content_);
+  }
+
+  // bool success = 4;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // optional fixed32 output_crc32c = 7;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 output_size = 6;
+  if (this->_internal_output_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_output_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileResponse::GetClassData() const { return &_class_data_; }
+
+
+void FileResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileResponse*>(&to_msg);
+  auto& from = static_cast<const FileResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.FileResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_status_message().empty()) {
+    _this->_internal_set_status_message(from._internal_status_message());
+  }
+  if (!from._internal_result_handle().empty()) {
+    _this->_internal_set_result_handle(from._internal_result_handle());
+  }
+  if (from._internal_has_file_content()) {
+    _this->_internal_mutable_file_content()->::file_processor::FileChunk::MergeFrom(
+        from._internal_file_content());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_has_output_crc32c()) {
+    _this->_internal_set_output_crc32c(from._internal_output_crc32c());
+  }
+  if (from._internal_output_size() != 0) {
+    _this->_internal_set_output_size(from._internal_output_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FileResponse::CopyFrom(const FileResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.FileResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileResponse::IsInitialized() const {
+  return true;
+}
+
+void FileResponse::InternalSwap(FileResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_message_, lhs_arena,
+      &other->_impl_.status_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_handle_, lhs_arena,
+      &other->_impl_.result_handle_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileResponse, _impl_.output_size_)
+      + sizeof(FileResponse::_impl_.output_size_)
+      - PROTOBUF_FIELD_OFFSET(FileResponse, _impl_.file_content_)>(
+          reinterpret_cast<char*>(&_impl_.file_content_),
+          reinterpret_cast<char*>(&other->_impl_.file_content_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FileResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[10]);
+}
+
+// ===================================================================
+
+class BatchRequest::_Internal {
+ public:
+  static const ::file_processor::FileRequest& request(const BatchRequest* msg);
+};
+
+const ::file_processor::FileRequest&
+BatchRequest::_Internal::request(const BatchRequest* msg) {
+  return *msg->_impl_.request_;
+}
+BatchRequest::BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.BatchRequest)
+}
+BatchRequest::BatchRequest(const BatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_id_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.last_chunk_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_id().empty()) {
+    _this->_impl_.file_id_.Set(from._internal_file_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::file_processor::FileRequest(*from._impl_.request_);
+  }
+  _this->_impl_.last_chunk_ = from._impl_.last_chunk_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.BatchRequest)
+}
+
+inline void BatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_id_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.last_chunk_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchRequest::~BatchRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.BatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void BatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
+  }
+  _impl_.request_ = nullptr;
+  _impl_.last_chunk_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.BatchRequest.file_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.FileRequest request = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last_chunk = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_id = 1;
+  if (!this->_internal_file_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_id().data(), static_cast<int>(this->_internal_file_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.BatchRequest.file_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_id(), target);
+  }
+
+  // .file_processor.FileRequest request = 2;
+  if (this->_internal_has_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  // bool last_chunk = 3;
+  if (this->_internal_last_chunk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_last_chunk(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.BatchRequest)
+  return target;
+}
+
+size_t BatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.BatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_id = 1;
+  if (!this->_internal_file_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_id());
+  }
+
+  // .file_processor.FileRequest request = 2;
+  if (this->_internal_has_request()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
+  }
+
+  // bool last_chunk = 3;
+  if (this->_internal_last_chunk() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void BatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchRequest*>(&to_msg);
+  auto& from = static_cast<const BatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.BatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_id().empty()) {
+    _this->_internal_set_file_id(from._internal_file_id());
+  }
+  if (from._internal_has_request()) {
+    _this->_internal_mutable_request()->::file_processor::FileRequest::MergeFrom(
+        from._internal_request());
+  }
+  if (from._internal_last_chunk() != 0) {
+    _this->_internal_set_last_chunk(from._internal_last_chunk());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchRequest::CopyFrom(const BatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.BatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRequest::IsInitialized() const {
+  return true;
+}
+
+void BatchRequest::InternalSwap(BatchRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_id_, lhs_arena,
+      &other->_impl_.file_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchRequest, _impl_.last_chunk_)
+      + sizeof(BatchRequest::_impl_.last_chunk_)
+      - PROTOBUF_FIELD_OFFSET(BatchRequest, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[11]);
+}
+
+// ===================================================================
+
+class BatchResponse::_Internal {
+ public:
+  static const ::file_processor::FileResponse& response(const BatchResponse* msg);
+};
+
+const ::file_processor::FileResponse&
+BatchResponse::_Internal::response(const BatchResponse* msg) {
+  return *msg->_impl_.response_;
+}
+BatchResponse::BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.BatchResponse)
+}
+BatchResponse::BatchResponse(const BatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_id_){}
+    , decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.done_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_id().empty()) {
+    _this->_impl_.file_id_.Set(from._internal_file_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::file_processor::FileResponse(*from._impl_.response_);
+  }
+  _this->_impl_.done_ = from._impl_.done_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.BatchResponse)
+}
+
+inline void BatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_id_){}
+    , decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.done_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchResponse::~BatchResponse() {
+  // @@protoc_insertion_point(destructor:file_processor.BatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.response_;
+}
+
+void BatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  _impl_.done_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.BatchResponse.file_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.FileResponse response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool done = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_id = 1;
+  if (!this->_internal_file_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_id().data(), static_cast<int>(this->_internal_file_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.BatchResponse.file_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_id(), target);
+  }
+
+  // .file_processor.FileResponse response = 2;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  // bool done = 3;
+  if (this->_internal_done() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_done(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.BatchResponse)
+  return target;
+}
+
+size_t BatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.BatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_id = 1;
+  if (!this->_internal_file_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_id());
+  }
+
+  // .file_processor.FileResponse response = 2;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  // bool done = 3;
+  if (this->_internal_done() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void BatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchResponse*>(&to_msg);
+  auto& from = static_cast<const BatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.BatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_id().empty()) {
+    _this->_internal_set_file_id(from._internal_file_id());
+  }
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::file_processor::FileResponse::MergeFrom(
+        from._internal_response());
+  }
+  if (from._internal_done() != 0) {
+    _this->_internal_set_done(from._internal_done());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchResponse::CopyFrom(const BatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.BatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchResponse::IsInitialized() const {
+  return true;
+}
+
+void BatchResponse::InternalSwap(BatchResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_id_, lhs_arena,
+      &other->_impl_.file_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchResponse, _impl_.done_)
+      + sizeof(BatchResponse::_impl_.done_)
+      - PROTOBUF_FIELD_OFFSET(BatchResponse, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[12]);
+}
+
+// ===================================================================
+
+class StartUploadRequest::_Internal {
+ public:
+};
+
+StartUploadRequest::StartUploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.StartUploadRequest)
+}
+StartUploadRequest::StartUploadRequest(const StartUploadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StartUploadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.total_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.total_size_ = from._impl_.total_size_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.StartUploadRequest)
+}
+
+inline void StartUploadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StartUploadRequest::~StartUploadRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.StartUploadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StartUploadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+}
+
+void StartUploadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StartUploadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.StartUploadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.total_size_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StartUploadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.StartUploadRequest.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StartUploadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.StartUploadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.StartUploadRequest.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // uint64 total_size = 2;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_total_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.StartUploadRequest)
+  return target;
+}
+
+size_t StartUploadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.StartUploadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // uint64 total_size = 2;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StartUploadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StartUploadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StartUploadRequest::GetClassData() const { return &_class_data_; }
+
+
+void StartUploadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StartUploadRequest*>(&to_msg);
+  auto& from = static_cast<const StartUploadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.StartUploadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StartUploadRequest::CopyFrom(const StartUploadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.StartUploadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StartUploadRequest::IsInitialized() const {
+  return true;
+}
+
+void StartUploadRequest::InternalSwap(StartUploadRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  swap(_impl_.total_size_, other->_impl_.total_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StartUploadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[13]);
+}
+
+// ===================================================================
+
+class UploadChunk::_Internal {
+ public:
+  using HasBits = decltype(std::declval<UploadChunk>()._impl_._has_bits_);
+  static void set_has_crc32c(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+UploadChunk::UploadChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.UploadChunk)
+}
+UploadChunk::UploadChunk(const UploadChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.upload_id_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.crc32c_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_upload_id().empty()) {
+    _this->_impl_.upload_id_.Set(from._internal_upload_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.crc32c_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.crc32c_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.UploadChunk)
+}
+
+inline void UploadChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.upload_id_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.crc32c_){0u}
+  };
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UploadChunk::~UploadChunk() {
+  // @@protoc_insertion_point(destructor:file_processor.UploadChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.upload_id_.Destroy();
+  _impl_.content_.Destroy();
+}
+
+void UploadChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.UploadChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.upload_id_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.offset_ = uint64_t{0u};
+  _impl_.crc32c_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string upload_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_upload_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.UploadChunk.upload_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes content = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 crc32c = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_crc32c(&has_bits);
+          _impl_.crc32c_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.UploadChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_upload_id().data(), static_cast<int>(this->_internal_upload_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.UploadChunk.upload_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_upload_id(), target);
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_offset(), target);
+  }
+
+  // bytes content = 3;
+  if (!this->_internal_content().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_content(), target);
+  }
+
+  // optional fixed32 crc32c = 4;
+  if (_internal_has_crc32c()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_crc32c(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.UploadChunk)
+  return target;
+}
+
+size_t UploadChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.UploadChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_upload_id());
+  }
+
+  // bytes content = 3;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_content());
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // optional fixed32 crc32c = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadChunk::GetClassData() const { return &_class_data_; }
+
+
+void UploadChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadChunk*>(&to_msg);
+  auto& from = static_cast<const UploadChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.UploadChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_upload_id().empty()) {
+    _this->_internal_set_upload_id(from._internal_upload_id());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_has_crc32c()) {
+    _this->_internal_set_crc32c(from._internal_crc32c());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadChunk::CopyFrom(const UploadChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.UploadChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadChunk::IsInitialized() const {
+  return true;
+}
+
+void UploadChunk::InternalSwap(UploadChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.upload_id_, lhs_arena,
+      &other->_impl_.upload_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UploadChunk, _impl_.crc32c_)
+      + sizeof(UploadChunk::_impl_.crc32c_)
+      - PROTOBUF_FIELD_OFFSET(UploadChunk, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[14]);
+}
+
+// ===================================================================
+
+class UploadQuery::_Internal {
+ public:
+};
+
+UploadQuery::UploadQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.UploadQuery)
+}
+UploadQuery::UploadQuery(const UploadQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.upload_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_upload_id().empty()) {
+    _this->_impl_.upload_id_.Set(from._internal_upload_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:file_processor.UploadQuery)
+}
+
+inline void UploadQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.upload_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UploadQuery::~UploadQuery() {
+  // @@protoc_insertion_point(destructor:file_processor.UploadQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.upload_id_.Destroy();
+}
+
+void UploadQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.UploadQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.upload_id_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string upload_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_upload_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.UploadQuery.upload_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.UploadQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_upload_id().data(), static_cast<int>(this->_internal_upload_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.UploadQuery.upload_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_upload_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.UploadQuery)
+  return target;
+}
+
+size_t UploadQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.UploadQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_upload_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadQuery::GetClassData() const { return &_class_data_; }
+
+
+void UploadQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadQuery*>(&to_msg);
+  auto& from = static_cast<const UploadQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.UploadQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_upload_id().empty()) {
+    _this->_internal_set_upload_id(from._internal_upload_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadQuery::CopyFrom(const UploadQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.UploadQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadQuery::IsInitialized() const {
+  return true;
+}
+
+void UploadQuery::InternalSwap(UploadQuery* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.upload_id_, lhs_arena,
+      &other->_impl_.upload_id_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[15]);
+}
+
+// ===================================================================
+
+class UploadStatus::_Internal {
+ public:
+};
+
+UploadStatus::UploadStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.UploadStatus)
+}
+UploadStatus::UploadStatus(const UploadStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.upload_id_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.sha256_){}
+    , decltype(_impl_.committed_offset_){}
+    , decltype(_impl_.total_size_){}
+    , decltype(_impl_.complete_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_upload_id().empty()) {
+    _this->_impl_.upload_id_.Set(from._internal_upload_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_status_message().empty()) {
+    _this->_impl_.status_message_.Set(from._internal_status_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sha256().empty()) {
+    _this->_impl_.sha256_.Set(from._internal_sha256(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.committed_offset_, &from._impl_.committed_offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.committed_offset_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.UploadStatus)
+}
+
+inline void UploadStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.upload_id_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.sha256_){}
+    , decltype(_impl_.committed_offset_){uint64_t{0u}}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , decltype(_impl_.complete_){false}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UploadStatus::~UploadStatus() {
+  // @@protoc_insertion_point(destructor:file_processor.UploadStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.upload_id_.Destroy();
+  _impl_.status_message_.Destroy();
+  _impl_.sha256_.Destroy();
+}
+
+void UploadStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.UploadStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.upload_id_.ClearToEmpty();
+  _impl_.status_message_.ClearToEmpty();
+  _impl_.sha256_.ClearToEmpty();
+  ::memset(&_impl_.committed_offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.committed_offset_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string upload_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_upload_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.UploadStatus.upload_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 committed_offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.committed_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool complete = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.complete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string status_message = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_status_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.UploadStatus.status_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string sha256 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_sha256();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.UploadStatus.sha256"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.UploadStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_upload_id().data(), static_cast<int>(this->_internal_upload_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.UploadStatus.upload_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_upload_id(), target);
+  }
+
+  // uint64 committed_offset = 2;
+  if (this->_internal_committed_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_committed_offset(), target);
+  }
+
+  // uint64 total_size = 3;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_total_size(), target);
+  }
+
+  // bool complete = 4;
+  if (this->_internal_complete() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_complete(), target);
+  }
+
+  // bool success = 5;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_success(), target);
+  }
+
+  // string status_message = 6;
+  if (!this->_internal_status_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.UploadStatus.status_message");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_status_message(), target);
+  }
+
+  // string sha256 = 7;
+  if (!this->_internal_sha256().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sha256().data(), static_cast<int>(this->_internal_sha256().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.UploadStatus.sha256");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_sha256(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.UploadStatus)
+  return target;
+}
+
+size_t UploadStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.UploadStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string upload_id = 1;
+  if (!this->_internal_upload_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_upload_id());
+  }
+
+  // string status_message = 6;
+  if (!this->_internal_status_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_message());
+  }
+
+  // string sha256 = 7;
+  if (!this->_internal_sha256().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sha256());
+  }
+
+  // uint64 committed_offset = 2;
+  if (this->_internal_committed_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_committed_offset());
+  }
+
+  // uint64 total_size = 3;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  // bool complete = 4;
+  if (this->_internal_complete() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool success = 5;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadStatus::GetClassData() const { return &_class_data_; }
+
+
+void UploadStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadStatus*>(&to_msg);
+  auto& from = static_cast<const UploadStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.UploadStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_upload_id().empty()) {
+    _this->_internal_set_upload_id(from._internal_upload_id());
+  }
+  if (!from._internal_status_message().empty()) {
+    _this->_internal_set_status_message(from._internal_status_message());
+  }
+  if (!from._internal_sha256().empty()) {
+    _this->_internal_set_sha256(from._internal_sha256());
+  }
+  if (from._internal_committed_offset() != 0) {
+    _this->_internal_set_committed_offset(from._internal_committed_offset());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  if (from._internal_complete() != 0) {
+    _this->_internal_set_complete(from._internal_complete());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadStatus::CopyFrom(const UploadStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.UploadStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadStatus::IsInitialized() const {
+  return true;
+}
+
+void UploadStatus::InternalSwap(UploadStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.upload_id_, lhs_arena,
+      &other->_impl_.upload_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_message_, lhs_arena,
+      &other->_impl_.status_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sha256_, lhs_arena,
+      &other->_impl_.sha256_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UploadStatus, _impl_.success_)
+      + sizeof(UploadStatus::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(UploadStatus, _impl_.committed_offset_)>(
+          reinterpret_cast<char*>(&_impl_.committed_offset_),
+          reinterpret_cast<char*>(&other->_impl_.committed_offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[16]);
+}
+
+// ===================================================================
+
+class FetchOutputRequest::_Internal {
+ public:
+};
+
+FetchOutputRequest::FetchOutputRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.FetchOutputRequest)
+}
+FetchOutputRequest::FetchOutputRequest(const FetchOutputRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FetchOutputRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_handle_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.length_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result_handle().empty()) {
+    _this->_impl_.result_handle_.Set(from._internal_result_handle(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.length_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.length_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.FetchOutputRequest)
+}
+
+inline void FetchOutputRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.result_handle_){}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.length_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FetchOutputRequest::~FetchOutputRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.FetchOutputRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FetchOutputRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.result_handle_.Destroy();
+}
+
+void FetchOutputRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FetchOutputRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.FetchOutputRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.result_handle_.ClearToEmpty();
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.length_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.length_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FetchOutputRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string result_handle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_result_handle();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FetchOutputRequest.result_handle"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 length = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FetchOutputRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.FetchOutputRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string result_handle = 1;
+  if (!this->_internal_result_handle().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_result_handle().data(), static_cast<int>(this->_internal_result_handle().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.FetchOutputRequest.result_handle");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_result_handle(), target);
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_offset(), target);
+  }
+
+  // uint64 length = 3;
+  if (this->_internal_length() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_length(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.FetchOutputRequest)
+  return target;
+}
+
+size_t FetchOutputRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.FetchOutputRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string result_handle = 1;
+  if (!this->_internal_result_handle().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_result_handle());
+  }
+
+  // uint64 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // uint64 length = 3;
+  if (this->_internal_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_length());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FetchOutputRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FetchOutputRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FetchOutputRequest::GetClassData() const { return &_class_data_; }
+
+
+void FetchOutputRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FetchOutputRequest*>(&to_msg);
+  auto& from = static_cast<const FetchOutputRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.FetchOutputRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_result_handle().empty()) {
+    _this->_internal_set_result_handle(from._internal_result_handle());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_length() != 0) {
+    _this->_internal_set_length(from._internal_length());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FetchOutputRequest::CopyFrom(const FetchOutputRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.FetchOutputRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FetchOutputRequest::IsInitialized() const {
+  return true;
+}
+
+void FetchOutputRequest::InternalSwap(FetchOutputRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_handle_, lhs_arena,
+      &other->_impl_.result_handle_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FetchOutputRequest, _impl_.length_)
+      + sizeof(FetchOutputRequest::_impl_.length_)
+      - PROTOBUF_FIELD_OFFSET(FetchOutputRequest, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FetchOutputRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[17]);
+}
+
+// ===================================================================
+
+class JobOutput::_Internal {
+ public:
+};
+
+JobOutput::JobOutput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.JobOutput)
+}
+JobOutput::JobOutput(const JobOutput& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobOutput* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.result_handle_){}
+    , decltype(_impl_.output_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result_handle().empty()) {
+    _this->_impl_.result_handle_.Set(from._internal_result_handle(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.output_size_ = from._impl_.output_size_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.JobOutput)
+}
+
+inline void JobOutput::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.result_handle_){}
+    , decltype(_impl_.output_size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.result_handle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+JobOutput::~JobOutput() {
+  // @@protoc_insertion_point(destructor:file_processor.JobOutput)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JobOutput::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.result_handle_.Destroy();
+}
+
+void JobOutput::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JobOutput::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.JobOutput)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.result_handle_.ClearToEmpty();
+  _impl_.output_size_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JobOutput::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.JobOutput.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string result_handle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_result_handle();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.JobOutput.result_handle"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 output_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.output_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JobOutput::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.JobOutput)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.JobOutput.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // string result_handle = 2;
+  if (!this->_internal_result_handle().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_result_handle().data(), static_cast<int>(this->_internal_result_handle().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.JobOutput.result_handle");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_result_handle(), target);
+  }
+
+  // uint64 output_size = 3;
+  if (this->_internal_output_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_output_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.JobOutput)
+  return target;
+}
+
+size_t JobOutput::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.JobOutput)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string result_handle = 2;
+  if (!this->_internal_result_handle().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_result_handle());
+  }
+
+  // uint64 output_size = 3;
+  if (this->_internal_output_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_output_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobOutput::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobOutput::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobOutput::GetClassData() const { return &_class_data_; }
+
+
+void JobOutput::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobOutput*>(&to_msg);
+  auto& from = static_cast<const JobOutput&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.JobOutput)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_result_handle().empty()) {
+    _this->_internal_set_result_handle(from._internal_result_handle());
+  }
+  if (from._internal_output_size() != 0) {
+    _this->_internal_set_output_size(from._internal_output_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JobOutput::CopyFrom(const JobOutput& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.JobOutput)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JobOutput::IsInitialized() const {
+  return true;
+}
+
+void JobOutput::InternalSwap(JobOutput* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_handle_, lhs_arena,
+      &other->_impl_.result_handle_, rhs_arena
+  );
+  swap(_impl_.output_size_, other->_impl_.output_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JobOutput::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[18]);
+}
+
+// ===================================================================
+
+class JobQuery::_Internal {
+ public:
+};
+
+JobQuery::JobQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.JobQuery)
+}
+JobQuery::JobQuery(const JobQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.job_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_job_id().empty()) {
+    _this->_impl_.job_id_.Set(from._internal_job_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:file_processor.JobQuery)
+}
+
+inline void JobQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.job_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.job_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+JobQuery::~JobQuery() {
+  // @@protoc_insertion_point(destructor:file_processor.JobQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JobQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.job_id_.Destroy();
+}
+
+void JobQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JobQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.JobQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.job_id_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JobQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_job_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.JobQuery.job_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JobQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.JobQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string job_id = 1;
+  if (!this->_internal_job_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_job_id().data(), static_cast<int>(this->_internal_job_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.JobQuery.job_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_job_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.JobQuery)
+  return target;
+}
+
+size_t JobQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.JobQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string job_id = 1;
+  if (!this->_internal_job_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_job_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobQuery::GetClassData() const { return &_class_data_; }
+
+
+void JobQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobQuery*>(&to_msg);
+  auto& from = static_cast<const JobQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.JobQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_job_id().empty()) {
+    _this->_internal_set_job_id(from._internal_job_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JobQuery::CopyFrom(const JobQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.JobQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JobQuery::IsInitialized() const {
+  return true;
+}
+
+void JobQuery::InternalSwap(JobQuery* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.job_id_, lhs_arena,
+      &other->_impl_.job_id_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JobQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[19]);
+}
+
+// ===================================================================
+
+class JobStatus::_Internal {
+ public:
+};
+
+JobStatus::JobStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.JobStatus)
+}
+JobStatus::JobStatus(const JobStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.outputs_){from._impl_.outputs_}
+    , decltype(_impl_.job_id_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.state_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.job_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_job_id().empty()) {
+    _this->_impl_.job_id_.Set(from._internal_job_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_status_message().empty()) {
+    _this->_impl_.status_message_.Set(from._internal_status_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.state_ = from._impl_.state_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.JobStatus)
+}
+
+inline void JobStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.outputs_){arena}
+    , decltype(_impl_.job_id_){}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.state_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.job_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+JobStatus::~JobStatus() {
+  // @@protoc_insertion_point(destructor:file_processor.JobStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JobStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.outputs_.~RepeatedPtrField();
+  _impl_.job_id_.Destroy();
+  _impl_.status_message_.Destroy();
+}
+
+void JobStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JobStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.JobStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.outputs_.Clear();
+  _impl_.job_id_.ClearToEmpty();
+  _impl_.status_message_.ClearToEmpty();
+  _impl_.state_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JobStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_job_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.JobStatus.job_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.JobState state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_state(static_cast<::file_processor::JobState>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string status_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_status_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.JobStatus.status_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .file_processor.JobOutput outputs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_outputs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JobStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.JobStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string job_id = 1;
+  if (!this->_internal_job_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_job_id().data(), static_cast<int>(this->_internal_job_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.JobStatus.job_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_job_id(), target);
+  }
+
+  // .file_processor.JobState state = 2;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_state(), target);
+  }
+
+  // string status_message = 3;
+  if (!this->_internal_status_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.JobStatus.status_message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_status_message(), target);
+  }
+
+  // repeated .file_processor.JobOutput outputs = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_outputs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_outputs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.JobStatus)
+  return target;
+}
+
+size_t JobStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.JobStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.JobOutput outputs = 4;
+  total_size += 1UL * this->_internal_outputs_size();
+  for (const auto& msg : this->_impl_.outputs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string job_id = 1;
+  if (!this->_internal_job_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_job_id());
+  }
+
+  // string status_message = 3;
+  if (!this->_internal_status_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_message());
+  }
+
+  // .file_processor.JobState state = 2;
+  if (this->_internal_state() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobStatus::GetClassData() const { return &_class_data_; }
+
+
+void JobStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobStatus*>(&to_msg);
+  auto& from = static_cast<const JobStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.JobStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.outputs_.MergeFrom(from._impl_.outputs_);
+  if (!from._internal_job_id().empty()) {
+    _this->_internal_set_job_id(from._internal_job_id());
+  }
+  if (!from._internal_status_message().empty()) {
+    _this->_internal_set_status_message(from._internal_status_message());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JobStatus::CopyFrom(const JobStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.JobStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JobStatus::IsInitialized() const {
+  return true;
+}
+
+void JobStatus::InternalSwap(JobStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.outputs_.InternalSwap(&other->_impl_.outputs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.job_id_, lhs_arena,
+      &other->_impl_.job_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_message_, lhs_arena,
+      &other->_impl_.status_message_, rhs_arena
+  );
+  swap(_impl_.state_, other->_impl_.state_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JobStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[20]);
+}
+
+// ===================================================================
+
+class SignatureRequest::_Internal {
+ public:
+};
+
+SignatureRequest::SignatureRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.SignatureRequest)
+}
+SignatureRequest::SignatureRequest(const SignatureRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SignatureRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.basis_sha256_){}
+    , decltype(_impl_.block_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.basis_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_basis_sha256().empty()) {
+    _this->_impl_.basis_sha256_.Set(from._internal_basis_sha256(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.block_size_ = from._impl_.block_size_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.SignatureRequest)
+}
+
+inline void SignatureRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.basis_sha256_){}
+    , decltype(_impl_.block_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.basis_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SignatureRequest::~SignatureRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.SignatureRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SignatureRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.basis_sha256_.Destroy();
+}
+
+void SignatureRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SignatureRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.SignatureRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.basis_sha256_.ClearToEmpty();
+  _impl_.block_size_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SignatureRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string basis_sha256 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_basis_sha256();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.SignatureRequest.basis_sha256"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SignatureRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.SignatureRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string basis_sha256 = 1;
+  if (!this->_internal_basis_sha256().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_basis_sha256().data(), static_cast<int>(this->_internal_basis_sha256().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.SignatureRequest.basis_sha256");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_basis_sha256(), target);
+  }
+
+  // uint32 block_size = 2;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_block_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.SignatureRequest)
+  return target;
+}
+
+size_t SignatureRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.SignatureRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string basis_sha256 = 1;
+  if (!this->_internal_basis_sha256().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_basis_sha256());
+  }
+
+  // uint32 block_size = 2;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SignatureRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SignatureRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SignatureRequest::GetClassData() const { return &_class_data_; }
+
+
+void SignatureRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SignatureRequest*>(&to_msg);
+  auto& from = static_cast<const SignatureRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.SignatureRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_basis_sha256().empty()) {
+    _this->_internal_set_basis_sha256(from._internal_basis_sha256());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SignatureRequest::CopyFrom(const SignatureRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.SignatureRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SignatureRequest::IsInitialized() const {
+  return true;
+}
+
+void SignatureRequest::InternalSwap(SignatureRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.basis_sha256_, lhs_arena,
+      &other->_impl_.basis_sha256_, rhs_arena
+  );
+  swap(_impl_.block_size_, other->_impl_.block_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SignatureRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[21]);
+}
+
+// ===================================================================
+
+class BlockSignature::_Internal {
+ public:
+};
+
+BlockSignature::BlockSignature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.BlockSignature)
+}
+BlockSignature::BlockSignature(const BlockSignature& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockSignature* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.strong_){}
+    , decltype(_impl_.weak_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.strong_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.strong_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_strong().empty()) {
+    _this->_impl_.strong_.Set(from._internal_strong(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.weak_ = from._impl_.weak_;
+  // @@protoc_insertion_point(copy_constructor:file_processor.BlockSignature)
+}
+
+inline void BlockSignature::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.strong_){}
+    , decltype(_impl_.weak_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.strong_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.strong_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlockSignature::~BlockSignature() {
+  // @@protoc_insertion_point(destructor:file_processor.BlockSignature)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlockSignature::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.strong_.Destroy();
+}
+
+void BlockSignature::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlockSignature::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.BlockSignature)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.strong_.ClearToEmpty();
+  _impl_.weak_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlockSignature::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed32 weak = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.weak_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes strong = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_strong();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlockSignature::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.BlockSignature)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed32 weak = 1;
+  if (this->_internal_weak() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_weak(), target);
+  }
+
+  // bytes strong = 2;
+  if (!this->_internal_strong().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_strong(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.BlockSignature)
+  return target;
+}
+
+size_t BlockSignature::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.BlockSignature)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes strong = 2;
+  if (!this->_internal_strong().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_strong());
+  }
+
+  // fixed32 weak = 1;
+  if (this->_internal_weak() != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockSignature::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockSignature::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockSignature::GetClassData() const { return &_class_data_; }
+
+
+void BlockSignature::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockSignature*>(&to_msg);
+  auto& from = static_cast<const BlockSignature&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.BlockSignature)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_strong().empty()) {
+    _this->_internal_set_strong(from._internal_strong());
+  }
+  if (from._internal_weak() != 0) {
+    _this->_internal_set_weak(from._internal_weak());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlockSignature::CopyFrom(const BlockSignature& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.BlockSignature)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockSignature::IsInitialized() const {
+  return true;
+}
+
+void BlockSignature::InternalSwap(BlockSignature* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.strong_, lhs_arena,
+      &other->_impl_.strong_, rhs_arena
+  );
+  swap(_impl_.weak_, other->_impl_.weak_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlockSignature::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[22]);
+}
+
+// ===================================================================
+
+class SignatureBatch::_Internal {
+ public:
+};
+
+SignatureBatch::SignatureBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.SignatureBatch)
+}
+SignatureBatch::SignatureBatch(const SignatureBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SignatureBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blocks_){from._impl_.blocks_}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.block_size_){}
+    , decltype(_impl_.basis_size_){}
+    , decltype(_impl_.first_block_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_status_message().empty()) {
+    _this->_impl_.status_message_.Set(from._internal_status_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.first_block_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.first_block_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.SignatureBatch)
+}
+
+inline void SignatureBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.blocks_){arena}
+    , decltype(_impl_.status_message_){}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.block_size_){0u}
+    , decltype(_impl_.basis_size_){uint64_t{0u}}
+    , decltype(_impl_.first_block_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SignatureBatch::~SignatureBatch() {
+  // @@protoc_insertion_point(destructor:file_processor.SignatureBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SignatureBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.blocks_.~RepeatedPtrField();
+  _impl_.status_message_.Destroy();
+}
+
+void SignatureBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SignatureBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.SignatureBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.blocks_.Clear();
+  _impl_.status_message_.ClearToEmpty();
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.first_block_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.first_block_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SignatureBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string status_message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_status_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.SignatureBatch.status_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 basis_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.basis_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .file_processor.BlockSignature blocks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blocks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 first_block = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.first_block_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SignatureBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.SignatureBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // string status_message = 2;
+  if (!this->_internal_status_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.SignatureBatch.status_message");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_status_message(), target);
+  }
+
+  // uint32 block_size = 3;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_block_size(), target);
+  }
+
+  // uint64 basis_size = 4;
+  if (this->_internal_basis_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_basis_size(), target);
+  }
+
+  // repeated .file_processor.BlockSignature blocks = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blocks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blocks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 first_block = 6;
+  if (this->_internal_first_block() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_first_block(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.SignatureBatch)
+  return target;
+}
+
+size_t SignatureBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.SignatureBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.BlockSignature blocks = 5;
+  total_size += 1UL * this->_internal_blocks_size();
+  for (const auto& msg : this->_impl_.blocks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string status_message = 2;
+  if (!this->_internal_status_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_message());
+  }
+
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 block_size = 3;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  // uint64 basis_size = 4;
+  if (this->_internal_basis_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_basis_size());
+  }
+
+  // uint64 first_block = 6;
+  if (this->_internal_first_block() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_block());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SignatureBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SignatureBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SignatureBatch::GetClassData() const { return &_class_data_; }
+
+
+void SignatureBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SignatureBatch*>(&to_msg);
+  auto& from = static_cast<const SignatureBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.SignatureBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.blocks_.MergeFrom(from._impl_.blocks_);
+  if (!from._internal_status_message().empty()) {
+    _this->_internal_set_status_message(from._internal_status_message());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  if (from._internal_basis_size() != 0) {
+    _this->_internal_set_basis_size(from._internal_basis_size());
+  }
+  if (from._internal_first_block() != 0) {
+    _this->_internal_set_first_block(from._internal_first_block());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SignatureBatch::CopyFrom(const SignatureBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.SignatureBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SignatureBatch::IsInitialized() const {
+  return true;
+}
+
+void SignatureBatch::InternalSwap(SignatureBatch* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.blocks_.InternalSwap(&other->_impl_.blocks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_message_, lhs_arena,
+      &other->_impl_.status_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SignatureBatch, _impl_.first_block_)
+      + sizeof(SignatureBatch::_impl_.first_block_)
+      - PROTOBUF_FIELD_OFFSET(SignatureBatch, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SignatureBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[23]);
+}
+
+// ===================================================================
+
+class BlockRange::_Internal {
+ public:
+};
+
+BlockRange::BlockRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.BlockRange)
+}
+BlockRange::BlockRange(const BlockRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlockRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_block_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.first_block_, &from._impl_.first_block_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.first_block_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.BlockRange)
+}
+
+inline void BlockRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.first_block_){uint64_t{0u}}
+    , decltype(_impl_.count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlockRange::~BlockRange() {
+  // @@protoc_insertion_point(destructor:file_processor.BlockRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlockRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BlockRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlockRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.BlockRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.first_block_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.first_block_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlockRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 first_block = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.first_block_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlockRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.BlockRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 first_block = 1;
+  if (this->_internal_first_block() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_first_block(), target);
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.BlockRange)
+  return target;
+}
+
+size_t BlockRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.BlockRange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 first_block = 1;
+  if (this->_internal_first_block() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_first_block());
+  }
+
+  // uint32 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlockRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlockRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlockRange::GetClassData() const { return &_class_data_; }
+
+
+void BlockRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlockRange*>(&to_msg);
+  auto& from = static_cast<const BlockRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.BlockRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_first_block() != 0) {
+    _this->_internal_set_first_block(from._internal_first_block());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlockRange::CopyFrom(const BlockRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.BlockRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlockRange::IsInitialized() const {
+  return true;
+}
+
+void BlockRange::InternalSwap(BlockRange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BlockRange, _impl_.count_)
+      + sizeof(BlockRange::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(BlockRange, _impl_.first_block_)>(
+          reinterpret_cast<char*>(&_impl_.first_block_),
+          reinterpret_cast<char*>(&other->_impl_.first_block_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlockRange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[24]);
+}
+
+// ===================================================================
+
+class DeltaOp::_Internal {
+ public:
+  static const ::file_processor::BlockRange& copy(const DeltaOp* msg);
+};
+
+const ::file_processor::BlockRange&
+DeltaOp::_Internal::copy(const DeltaOp* msg) {
+  return *msg->_impl_.op_.copy_;
+}
+void DeltaOp::set_allocated_copy(::file_processor::BlockRange* copy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_op();
+  if (copy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(copy);
+    if (message_arena != submessage_arena) {
+      copy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, copy, submessage_arena);
+    }
+    set_has_copy();
+    _impl_.op_.copy_ = copy;
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.DeltaOp.copy)
+}
+DeltaOp::DeltaOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.DeltaOp)
+}
+DeltaOp::DeltaOp(const DeltaOp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeltaOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_op();
+  switch (from.op_case()) {
+    case kLiteral: {
+      _this->_internal_set_literal(from._internal_literal());
+      break;
+    }
+    case kCopy: {
+      _this->_internal_mutable_copy()->::file_processor::BlockRange::MergeFrom(
+          from._internal_copy());
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:file_processor.DeltaOp)
+}
+
+inline void DeltaOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_op();
+}
+
+DeltaOp::~DeltaOp() {
+  // @@protoc_insertion_point(destructor:file_processor.DeltaOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeltaOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_op()) {
+    clear_op();
+  }
+}
+
+void DeltaOp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeltaOp::clear_op() {
+// @@protoc_insertion_point(one_of_clear_start:file_processor.DeltaOp)
+  switch (op_case()) {
+    case kLiteral: {
+      _impl_.op_.literal_.Destroy();
+      break;
+    }
+    case kCopy: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.copy_;
+      }
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = OP_NOT_SET;
+}
+
+
+void DeltaOp::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.DeltaOp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_op();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeltaOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes literal = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_literal();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .file_processor.BlockRange copy = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_copy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeltaOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.DeltaOp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes literal = 1;
+  if (_internal_has_literal()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_literal(), target);
+  }
+
+  // .file_processor.BlockRange copy = 2;
+  if (_internal_has_copy()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::copy(this),
+        _Internal::copy(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.DeltaOp)
+  return target;
+}
+
+size_t DeltaOp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.DeltaOp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (op_case()) {
+    // bytes literal = 1;
+    case kLiteral: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_literal());
+      break;
+    }
+    // .file_processor.BlockRange copy = 2;
+    case kCopy: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.copy_);
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeltaOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeltaOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeltaOp::GetClassData() const { return &_class_data_; }
+
+
+void DeltaOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeltaOp*>(&to_msg);
+  auto& from = static_cast<const DeltaOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.DeltaOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.op_case()) {
+    case kLiteral: {
+      _this->_internal_set_literal(from._internal_literal());
+      break;
+    }
+    case kCopy: {
+      _this->_internal_mutable_copy()->::file_processor::BlockRange::MergeFrom(
+          from._internal_copy());
+      break;
+    }
+    case OP_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeltaOp::CopyFrom(const DeltaOp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.DeltaOp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeltaOp::IsInitialized() const {
+  return true;
+}
+
+void DeltaOp::InternalSwap(DeltaOp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.op_, other->_impl_.op_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeltaOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[25]);
+}
+
+// ===================================================================
+
+class DeltaChunk::_Internal {
+ public:
+};
+
+DeltaChunk::DeltaChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.DeltaChunk)
+}
+DeltaChunk::DeltaChunk(const DeltaChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeltaChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.basis_sha256_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.file_sha256_){}
+    , decltype(_impl_.total_size_){}
+    , decltype(_impl_.block_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.basis_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_basis_sha256().empty()) {
+    _this->_impl_.basis_sha256_.Set(from._internal_basis_sha256(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_sha256().empty()) {
+    _this->_impl_.file_sha256_.Set(from._internal_file_sha256(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.total_size_, &from._impl_.total_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block_size_) -
+    reinterpret_cast<char*>(&_impl_.total_size_)) + sizeof(_impl_.block_size_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.DeltaChunk)
+}
+
+inline void DeltaChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , decltype(_impl_.basis_sha256_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.file_sha256_){}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , decltype(_impl_.block_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.basis_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_sha256_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_sha256_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeltaChunk::~DeltaChunk() {
+  // @@protoc_insertion_point(destructor:file_processor.DeltaChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeltaChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+  _impl_.basis_sha256_.Destroy();
+  _impl_.file_name_.Destroy();
+  _impl_.file_sha256_.Destroy();
+}
+
+void DeltaChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeltaChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.DeltaChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  _impl_.basis_sha256_.ClearToEmpty();
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.file_sha256_.ClearToEmpty();
+  ::memset(&_impl_.total_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.block_size_) -
+      reinterpret_cast<char*>(&_impl_.total_size_)) + sizeof(_impl_.block_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeltaChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string basis_sha256 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_basis_sha256();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.DeltaChunk.basis_sha256"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 block_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string file_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.DeltaChunk.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string file_sha256 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_file_sha256();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.DeltaChunk.file_sha256"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .file_processor.DeltaOp ops = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeltaChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.DeltaChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string basis_sha256 = 1;
+  if (!this->_internal_basis_sha256().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_basis_sha256().data(), static_cast<int>(this->_internal_basis_sha256().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.DeltaChunk.basis_sha256");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_basis_sha256(), target);
+  }
+
+  // uint32 block_size = 2;
+  if (this->_internal_block_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_block_size(), target);
+  }
+
+  // string file_name = 3;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.DeltaChunk.file_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_file_name(), target);
+  }
+
+  // uint64 total_size = 4;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_total_size(), target);
+  }
+
+  // string file_sha256 = 5;
+  if (!this->_internal_file_sha256().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_sha256().data(), static_cast<int>(this->_internal_file_sha256().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.DeltaChunk.file_sha256");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_file_sha256(), target);
+  }
+
+  // repeated .file_processor.DeltaOp ops = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.DeltaChunk)
+  return target;
+}
+
+size_t DeltaChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.DeltaChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.DeltaOp ops = 6;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string basis_sha256 = 1;
+  if (!this->_internal_basis_sha256().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_basis_sha256());
+  }
+
+  // string file_name = 3;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string file_sha256 = 5;
+  if (!this->_internal_file_sha256().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_sha256());
+  }
+
+  // uint64 total_size = 4;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  // uint32 block_size = 2;
+  if (this->_internal_block_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_block_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeltaChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeltaChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeltaChunk::GetClassData() const { return &_class_data_; }
+
+
+void DeltaChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeltaChunk*>(&to_msg);
+  auto& from = static_cast<const DeltaChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.DeltaChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  if (!from._internal_basis_sha256().empty()) {
+    _this->_internal_set_basis_sha256(from._internal_basis_sha256());
+  }
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_file_sha256().empty()) {
+    _this->_internal_set_file_sha256(from._internal_file_sha256());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  if (from._internal_block_size() != 0) {
+    _this->_internal_set_block_size(from._internal_block_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeltaChunk::CopyFrom(const DeltaChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.DeltaChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeltaChunk::IsInitialized() const {
+  return true;
+}
+
+void DeltaChunk::InternalSwap(DeltaChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.basis_sha256_, lhs_arena,
+      &other->_impl_.basis_sha256_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_sha256_, lhs_arena,
+      &other->_impl_.file_sha256_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DeltaChunk, _impl_.block_size_)
+      + sizeof(DeltaChunk::_impl_.block_size_)
+      - PROTOBUF_FIELD_OFFSET(DeltaChunk, _impl_.total_size_)>(
+          reinterpret_cast<char*>(&_impl_.total_size_),
+          reinterpret_cast<char*>(&other->_impl_.total_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeltaChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[26]);
+}
+
+// ===================================================================
+
+class LatencyQuery::_Internal {
+ public:
+};
+
+LatencyQuery::LatencyQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.LatencyQuery)
+}
+LatencyQuery::LatencyQuery(const LatencyQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:file_processor.LatencyQuery)
+}
+
+inline void LatencyQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LatencyQuery::~LatencyQuery() {
+  // @@protoc_insertion_point(destructor:file_processor.LatencyQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operation_.Destroy();
+}
+
+void LatencyQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.LatencyQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.LatencyQuery.operation"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.LatencyQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_operation().data(), static_cast<int>(this->_internal_operation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.LatencyQuery.operation");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_operation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.LatencyQuery)
+  return target;
+}
+
+size_t LatencyQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.LatencyQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_operation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyQuery::GetClassData() const { return &_class_data_; }
+
+
+void LatencyQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyQuery*>(&to_msg);
+  auto& from = static_cast<const LatencyQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.LatencyQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyQuery::CopyFrom(const LatencyQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.LatencyQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyQuery::IsInitialized() const {
+  return true;
+}
+
+void LatencyQuery::InternalSwap(LatencyQuery* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[27]);
+}
+
+// ===================================================================
+
+class LatencySeries::_Internal {
+ public:
+};
+
+LatencySeries::LatencySeries(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.LatencySeries)
+}
+LatencySeries::LatencySeries(const LatencySeries& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencySeries* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_us_){}
+    , decltype(_impl_.max_us_){}
+    , decltype(_impl_.p50_us_){}
+    , decltype(_impl_.p90_us_){}
+    , decltype(_impl_.p99_us_){}
+    , decltype(_impl_.p999_us_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_phase().empty()) {
+    _this->_impl_.phase_.Set(from._internal_phase(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.LatencySeries)
+}
+
+inline void LatencySeries::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.sum_us_){uint64_t{0u}}
+    , decltype(_impl_.max_us_){uint64_t{0u}}
+    , decltype(_impl_.p50_us_){uint64_t{0u}}
+    , decltype(_impl_.p90_us_){uint64_t{0u}}
+    , decltype(_impl_.p99_us_){uint64_t{0u}}
+    , decltype(_impl_.p999_us_){uint64_t{0u}}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LatencySeries::~LatencySeries() {
+  // @@protoc_insertion_point(destructor:file_processor.LatencySeries)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencySeries::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operation_.Destroy();
+  _impl_.phase_.Destroy();
+}
+
+void LatencySeries::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencySeries::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.LatencySeries)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_.ClearToEmpty();
+  _impl_.phase_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.success_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencySeries::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.LatencySeries.operation"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string phase = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_phase();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.LatencySeries.phase"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sum_us = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sum_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p50_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.p90_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99_us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.p99_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999_us = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.p999_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencySeries::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.LatencySeries)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_operation().data(), static_cast<int>(this->_internal_operation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.LatencySeries.operation");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_operation(), target);
+  }
+
+  // bool success = 2;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
+
+  // string phase = 3;
+  if (!this->_internal_phase().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_phase().data(), static_cast<int>(this->_internal_phase().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.LatencySeries.phase");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_phase(), target);
+  }
+
+  // uint64 count = 4;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_count(), target);
+  }
+
+  // uint64 sum_us = 5;
+  if (this->_internal_sum_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_sum_us(), target);
+  }
+
+  // uint64 max_us = 6;
+  if (this->_internal_max_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_max_us(), target);
+  }
+
+  // uint64 p50_us = 7;
+  if (this->_internal_p50_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p50_us(), target);
+  }
+
+  // uint64 p90_us = 8;
+  if (this->_internal_p90_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_p90_us(), target);
+  }
+
+  // uint64 p99_us = 9;
+  if (this->_internal_p99_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_p99_us(), target);
+  }
+
+  // uint64 p999_us = 10;
+  if (this->_internal_p999_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_p999_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.LatencySeries)
+  return target;
+}
+
+size_t LatencySeries::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.LatencySeries)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_operation());
+  }
+
+  // string phase = 3;
+  if (!this->_internal_phase().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phase());
+  }
+
+  // uint64 count = 4;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 sum_us = 5;
+  if (this->_internal_sum_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sum_us());
+  }
+
+  // uint64 max_us = 6;
+  if (this->_internal_max_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_us());
+  }
+
+  // uint64 p50_us = 7;
+  if (this->_internal_p50_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50_us());
+  }
+
+  // uint64 p90_us = 8;
+  if (this->_internal_p90_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90_us());
+  }
+
+  // uint64 p99_us = 9;
+  if (this->_internal_p99_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99_us());
+  }
+
+  // uint64 p999_us = 10;
+  if (this->_internal_p999_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999_us());
+  }
+
+  // bool success = 2;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencySeries::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencySeries::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencySeries::GetClassData() const { return &_class_data_; }
+
+
+void LatencySeries::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencySeries*>(&to_msg);
+  auto& from = static_cast<const LatencySeries&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.LatencySeries)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (!from._internal_phase().empty()) {
+    _this->_internal_set_phase(from._internal_phase());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_sum_us() != 0) {
+    _this->_internal_set_sum_us(from._internal_sum_us());
+  }
+  if (from._internal_max_us() != 0) {
+    _this->_internal_set_max_us(from._internal_max_us());
+  }
+  if (from._internal_p50_us() != 0) {
+    _this->_internal_set_p50_us(from._internal_p50_us());
+  }
+  if (from._internal_p90_us() != 0) {
+    _this->_internal_set_p90_us(from._internal_p90_us());
+  }
+  if (from._internal_p99_us() != 0) {
+    _this->_internal_set_p99_us(from._internal_p99_us());
+  }
+  if (from._internal_p999_us() != 0) {
+    _this->_internal_set_p999_us(from._internal_p999_us());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencySeries::CopyFrom(const LatencySeries& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.LatencySeries)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencySeries::IsInitialized() const {
+  return true;
+}
+
+void LatencySeries::InternalSwap(LatencySeries* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.phase_, lhs_arena,
+      &other->_impl_.phase_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencySeries, _impl_.success_)
+      + sizeof(LatencySeries::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(LatencySeries, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencySeries::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[28]);
+}
+
+// ===================================================================
+
+class LatencyReport::_Internal {
+ public:
+};
+
+LatencyReport::LatencyReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.LatencyReport)
+}
+LatencyReport::LatencyReport(const LatencyReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){from._impl_.series_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:file_processor.LatencyReport)
+}
+
+inline void LatencyReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.series_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyReport::~LatencyReport() {
+  // @@protoc_insertion_point(destructor:file_processor.LatencyReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.series_.~RepeatedPtrField();
+}
+
+void LatencyReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.LatencyReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.series_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .file_processor.LatencySeries series = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_series(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.LatencyReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .file_processor.LatencySeries series = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_series_size()); i < n; i++) {
+    const auto& repfield = this->_internal_series(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.LatencyReport)
+  return target;
+}
+
+size_t LatencyReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.LatencyReport)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .file_processor.LatencySeries series = 1;
+  total_size += 1UL * this->_internal_series_size();
+  for (const auto& msg : this->_impl_.series_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyReport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyReport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyReport::GetClassData() const { return &_class_data_; }
+
+
+void LatencyReport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyReport*>(&to_msg);
+  auto& from = static_cast<const LatencyReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.LatencyReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.series_.MergeFrom(from._impl_.series_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyReport::CopyFrom(const LatencyReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.LatencyReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyReport::IsInitialized() const {
+  return true;
+}
+
+void LatencyReport::InternalSwap(LatencyReport* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.series_.InternalSwap(&other->_impl_.series_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyReport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[29]);
+}
+
+// ===================================================================
+
+class ServerStateQuery::_Internal {
+ public:
+};
+
+ServerStateQuery::ServerStateQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:file_processor.ServerStateQuery)
+}
+ServerStateQuery::ServerStateQuery(const ServerStateQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ServerStateQuery* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:file_processor.ServerStateQuery)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStateQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStateQuery::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStateQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
+      file_level_metadata_file_5fprocessor_2eproto[30]);
+}
+
+// ===================================================================
+
+class ActiveRequest::_Internal {
+ public:
+};
+
+ActiveRequest::ActiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:file_processor.ActiveRequest)
+}
+ActiveRequest::ActiveRequest(const ActiveRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ActiveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rpc_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.child_tool_){}
+    , decltype(_impl_.peer_){}
+    , decltype(_impl_.trace_id_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.elapsed_us_){}
+    , decltype(_impl_.phase_elapsed_us_){}
+    , decltype(_impl_.bytes_received_){}
+    , decltype(_impl_.bytes_sent_){}
+    , decltype(_impl_.child_pid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rpc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rpc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rpc().empty()) {
+    _this->_impl_.rpc_.Set(from._internal_rpc(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_phase().empty()) {
+    _this->_impl_.phase_.Set(from._internal_phase(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.child_tool_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_tool_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_child_tool().empty()) {
+    _this->_impl_.child_tool_.Set(from._internal_child_tool(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_peer().empty()) {
+    _this->_impl_.peer_.Set(from._internal_peer(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.trace_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_trace_id().empty()) {
+    _this->_impl_.trace_id_.Set(from._internal_trace_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.child_pid_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.child_pid_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.ActiveRequest)
+}
+
+inline void ActiveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rpc_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.child_tool_){}
+    , decltype(_impl_.peer_){}
+    , decltype(_impl_.trace_id_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.elapsed_us_){uint64_t{0u}}
+    , decltype(_impl_.phase_elapsed_us_){uint64_t{0u}}
+    , decltype(_impl_.bytes_received_){uint64_t{0u}}
+    , decltype(_impl_.bytes_sent_){uint64_t{0u}}
+    , decltype(_impl_.child_pid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rpc_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rpc_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.child_tool_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_tool_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.trace_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ActiveRequest::~ActiveRequest() {
+  // @@protoc_insertion_point(destructor:file_processor.ActiveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ActiveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rpc_.Destroy();
+  _impl_.operation_.Destroy();
+  _impl_.file_name_.Destroy();
+  _impl_.phase_.Destroy();
+  _impl_.child_tool_.Destroy();
+  _impl_.peer_.Destroy();
+  _impl_.trace_id_.Destroy();
+}
+
+void ActiveRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ActiveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.ActiveRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rpc_.ClearToEmpty();
+  _impl_.operation_.ClearToEmpty();
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.phase_.ClearToEmpty();
+  _impl_.child_tool_.ClearToEmpty();
+  _impl_.peer_.ClearToEmpty();
+  _impl_.trace_id_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.child_pid_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.child_pid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ActiveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string rpc = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_rpc();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.rpc"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string operation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.operation"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string file_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string phase = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_phase();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.phase"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 elapsed_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.elapsed_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 phase_elapsed_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.phase_elapsed_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_received = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.bytes_received_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_sent = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.bytes_sent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 child_pid = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.child_pid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string child_tool = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_child_tool();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.child_tool"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string peer = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_peer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.peer"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string trace_id = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_trace_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "file_processor.ActiveRequest.trace_id"));
         } else
           goto handle_unusual;
         continue;
@@ -1150,137 +9667,383 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ConvertImageFormatRequest::_InternalSerialize(
+uint8_t* ActiveRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ConvertImageFormatRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ActiveRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string output_format = 1;
-  if (!this->_internal_output_format().empty()) {
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // string rpc = 2;
+  if (!this->_internal_rpc().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_output_format().data(), static_cast<int>(this->_internal_output_format().length()),
+      this->_internal_rpc().data(), static_cast<int>(this->_internal_rpc().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "file_processor.ConvertImageFormatRequest.output_format");
+      "file_processor.ActiveRequest.rpc");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_output_format(), target);
+        2, this->_internal_rpc(), target);
+  }
+
+  // string operation = 3;
+  if (!this->_internal_operation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_operation().data(), static_cast<int>(this->_internal_operation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.operation");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_operation(), target);
+  }
+
+  // string file_name = 4;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.file_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_file_name(), target);
+  }
+
+  // string phase = 5;
+  if (!this->_internal_phase().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_phase().data(), static_cast<int>(this->_internal_phase().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.phase");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_phase(), target);
+  }
+
+  // uint64 elapsed_us = 6;
+  if (this->_internal_elapsed_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_elapsed_us(), target);
+  }
+
+  // uint64 phase_elapsed_us = 7;
+  if (this->_internal_phase_elapsed_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_phase_elapsed_us(), target);
+  }
+
+  // uint64 bytes_received = 8;
+  if (this->_internal_bytes_received() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_bytes_received(), target);
+  }
+
+  // uint64 bytes_sent = 9;
+  if (this->_internal_bytes_sent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_bytes_sent(), target);
+  }
+
+  // int32 child_pid = 10;
+  if (this->_internal_child_pid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_child_pid(), target);
+  }
+
+  // string child_tool = 11;
+  if (!this->_internal_child_tool().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_child_tool().data(), static_cast<int>(this->_internal_child_tool().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.child_tool");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_child_tool(), target);
+  }
+
+  // string peer = 12;
+  if (!this->_internal_peer().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_peer().data(), static_cast<int>(this->_internal_peer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.peer");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_peer(), target);
+  }
+
+  // string trace_id = 13;
+  if (!this->_internal_trace_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_trace_id().data(), static_cast<int>(this->_internal_trace_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "file_processor.ActiveRequest.trace_id");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_trace_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ConvertImageFormatRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ActiveRequest)
   return target;
 }
 
-size_t ConvertImageFormatRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:file_processor.ConvertImageFormatRequest)
+size_t ActiveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ActiveRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string output_format = 1;
-  if (!this->_internal_output_format().empty()) {
+  // string rpc = 2;
+  if (!this->_internal_rpc().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_output_format());
+        this->_internal_rpc());
+  }
+
+  // string operation = 3;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_operation());
+  }
+
+  // string file_name = 4;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string phase = 5;
+  if (!this->_internal_phase().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phase());
+  }
+
+  // string child_tool = 11;
+  if (!this->_internal_child_tool().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_child_tool());
+  }
+
+  // string peer = 12;
+  if (!this->_internal_peer().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_peer());
+  }
+
+  // string trace_id = 13;
+  if (!this->_internal_trace_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_trace_id());
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // uint64 elapsed_us = 6;
+  if (this->_internal_elapsed_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_elapsed_us());
+  }
+
+  // uint64 phase_elapsed_us = 7;
+  if (this->_internal_phase_elapsed_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_phase_elapsed_us());
+  }
+
+  // uint64 bytes_received = 8;
+  if (this->_internal_bytes_received() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_received());
+  }
+
+  // uint64 bytes_sent = 9;
+  if (this->_internal_bytes_sent() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_sent());
+  }
+
+  // int32 child_pid = 10;
+  if (this->_internal_child_pid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_child_pid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConvertImageFormatRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActiveRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ConvertImageFormatRequest::MergeImpl
+    ActiveRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConvertImageFormatRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActiveRequest::GetClassData() const { return &_class_data_; }
 
 
-void ConvertImageFormatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ConvertImageFormatRequest*>(&to_msg);
-  auto& from = static_cast<const ConvertImageFormatRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ConvertImageFormatRequest)
+void ActiveRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ActiveRequest*>(&to_msg);
+  auto& from = static_cast<const ActiveRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ActiveRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_output_format().empty()) {
-    _this->_internal_set_output_format(from._internal_output_format());
+  if (!from._internal_rpc().empty()) {
+    _this->_internal_set_rpc(from._internal_rpc());
+  }
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_phase().empty()) {
+    _this->_internal_set_phase(from._internal_phase());
+  }
+  if (!from._internal_child_tool().empty()) {
+    _this->_internal_set_child_tool(from._internal_child_tool());
+  }
+  if (!from._internal_peer().empty()) {
+    _this->_internal_set_peer(from._internal_peer());
+  }
+  if (!from._internal_trace_id().empty()) {
+    _this->_internal_set_trace_id(from._internal_trace_id());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_elapsed_us() != 0) {
+    _this->_internal_set_elapsed_us(from._internal_elapsed_us());
+  }
+  if (from._internal_phase_elapsed_us() != 0) {
+    _this->_internal_set_phase_elapsed_us(from._internal_phase_elapsed_us());
+  }
+  if (from._internal_bytes_received() != 0) {
+    _this->_internal_set_bytes_received(from._internal_bytes_received());
+  }
+  if (from._internal_bytes_sent() != 0) {
+    _this->_internal_set_bytes_sent(from._internal_bytes_sent());
+  }
+  if (from._internal_child_pid() != 0) {
+    _this->_internal_set_child_pid(from._internal_child_pid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ConvertImageFormatRequest::CopyFrom(const ConvertImageFormatRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ConvertImageFormatRequest)
+void ActiveRequest::CopyFrom(const ActiveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ActiveRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConvertImageFormatRequest::IsInitialized() const {
+bool ActiveRequest::IsInitialized() const {
   return true;
 }
 
-void ConvertImageFormatRequest::InternalSwap(ConvertImageFormatRequest* other) {
+void ActiveRequest::InternalSwap(ActiveRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.output_format_, lhs_arena,
-      &other->_impl_.output_format_, rhs_arena
+      &_impl_.rpc_, lhs_arena,
+      &other->_impl_.rpc_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.phase_, lhs_arena,
+      &other->_impl_.phase_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.child_tool_, lhs_arena,
+      &other->_impl_.child_tool_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.peer_, lhs_arena,
+      &other->_impl_.peer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.trace_id_, lhs_arena,
+      &other->_impl_.trace_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ActiveRequest, _impl_.child_pid_)
+      + sizeof(ActiveRequest::_impl_.child_pid_)
+      - PROTOBUF_FIELD_OFFSET(ActiveRequest, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ConvertImageFormatRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ActiveRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
-      file_level_metadata_file_5fprocessor_2eproto[4]);
+      file_level_metadata_file_5fprocessor_2eproto[31]);
 }
 
 // ===================================================================
 
-class ResizeImageRequest::_Internal {
+class ServerState::_Internal {
  public:
 };
 
-ResizeImageRequest::ResizeImageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ServerState::ServerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:file_processor.ResizeImageRequest)
+  // @@protoc_insertion_point(arena_constructor:file_processor.ServerState)
 }
-ResizeImageRequest::ResizeImageRequest(const ResizeImageRequest& from)
+ServerState::ServerState(const ServerState& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ResizeImageRequest* const _this = this; (void)_this;
+  ServerState* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.width_){}
-    , decltype(_impl_.height_){}
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , decltype(_impl_.worker_threads_){}
+    , decltype(_impl_.worker_active_){}
+    , decltype(_impl_.worker_queued_){}
+    , decltype(_impl_.jobs_queued_){}
+    , decltype(_impl_.ingest_buffer_bytes_){}
+    , decltype(_impl_.uptime_s_){}
+    , decltype(_impl_.jobs_running_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.width_, &from._impl_.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
-    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
-  // @@protoc_insertion_point(copy_constructor:file_processor.ResizeImageRequest)
+  ::memcpy(&_impl_.worker_threads_, &from._impl_.worker_threads_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.jobs_running_) -
+    reinterpret_cast<char*>(&_impl_.worker_threads_)) + sizeof(_impl_.jobs_running_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.ServerState)
 }
 
-inline void ResizeImageRequest::SharedCtor(
+inline void ServerState::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.width_){0}
-    , decltype(_impl_.height_){0}
+      decltype(_impl_.requests_){arena}
+    , decltype(_impl_.worker_threads_){0u}
+    , decltype(_impl_.worker_active_){0u}
+    , decltype(_impl_.worker_queued_){0u}
+    , decltype(_impl_.jobs_queued_){0u}
+    , decltype(_impl_.ingest_buffer_bytes_){uint64_t{0u}}
+    , decltype(_impl_.uptime_s_){uint64_t{0u}}
+    , decltype(_impl_.jobs_running_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ResizeImageRequest::~ResizeImageRequest() {
-  // @@protoc_insertion_point(destructor:file_processor.ResizeImageRequest)
+ServerState::~ServerState() {
+  // @@protoc_insertion_point(destructor:file_processor.ServerState)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1288,44 +10051,99 @@ ResizeImageRequest::~ResizeImageRequest() {
   SharedDtor();
 }
 
-inline void ResizeImageRequest::SharedDtor() {
+inline void ServerState::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
 }
 
-void ResizeImageRequest::SetCachedSize(int size) const {
+void ServerState::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ResizeImageRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:file_processor.ResizeImageRequest)
+void ServerState::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.ServerState)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.height_) -
-      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  _impl_.requests_.Clear();
+  ::memset(&_impl_.worker_threads_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.jobs_running_) -
+      reinterpret_cast<char*>(&_impl_.worker_threads_)) + sizeof(_impl_.jobs_running_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ResizeImageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ServerState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 width = 1;
+      // repeated .file_processor.ActiveRequest requests = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // int32 height = 2;
+      // uint32 worker_threads = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.worker_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 worker_active = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.worker_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 worker_queued = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.worker_queued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 jobs_queued = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.jobs_queued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 jobs_running = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.jobs_running_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ingest_buffer_bytes = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.ingest_buffer_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 uptime_s = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.uptime_s_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1353,179 +10171,252 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ResizeImageRequest::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ResizeImageRequest)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+uint8_t* ServerState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.ServerState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .file_processor.ActiveRequest requests = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_requests_size()); i < n; i++) {
+    const auto& repfield = this->_internal_requests(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 worker_threads = 2;
+  if (this->_internal_worker_threads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_worker_threads(), target);
+  }
+
+  // uint32 worker_active = 3;
+  if (this->_internal_worker_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_worker_active(), target);
+  }
 
-  // int32 width = 1;
-  if (this->_internal_width() != 0) {
+  // uint32 worker_queued = 4;
+  if (this->_internal_worker_queued() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_width(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_worker_queued(), target);
   }
 
-  // int32 height = 2;
-  if (this->_internal_height() != 0) {
+  // uint32 jobs_queued = 5;
+  if (this->_internal_jobs_queued() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_height(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_jobs_queued(), target);
+  }
+
+  // uint32 jobs_running = 6;
+  if (this->_internal_jobs_running() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_jobs_running(), target);
+  }
+
+  // uint64 ingest_buffer_bytes = 7;
+  if (this->_internal_ingest_buffer_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_ingest_buffer_bytes(), target);
+  }
+
+  // uint64 uptime_s = 8;
+  if (this->_internal_uptime_s() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_uptime_s(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ResizeImageRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.ServerState)
   return target;
 }
 
-size_t ResizeImageRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:file_processor.ResizeImageRequest)
+size_t ServerState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.ServerState)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 width = 1;
-  if (this->_internal_width() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+  // repeated .file_processor.ActiveRequest requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->_impl_.requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 height = 2;
-  if (this->_internal_height() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
+  // uint32 worker_threads = 2;
+  if (this->_internal_worker_threads() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_worker_threads());
+  }
+
+  // uint32 worker_active = 3;
+  if (this->_internal_worker_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_worker_active());
+  }
+
+  // uint32 worker_queued = 4;
+  if (this->_internal_worker_queued() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_worker_queued());
+  }
+
+  // uint32 jobs_queued = 5;
+  if (this->_internal_jobs_queued() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_jobs_queued());
+  }
+
+  // uint64 ingest_buffer_bytes = 7;
+  if (this->_internal_ingest_buffer_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ingest_buffer_bytes());
+  }
+
+  // uint64 uptime_s = 8;
+  if (this->_internal_uptime_s() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_uptime_s());
+  }
+
+  // uint32 jobs_running = 6;
+  if (this->_internal_jobs_running() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_jobs_running());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResizeImageRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerState::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ResizeImageRequest::MergeImpl
+    ServerState::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResizeImageRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerState::GetClassData() const { return &_class_data_; }
 
 
-void ResizeImageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ResizeImageRequest*>(&to_msg);
-  auto& from = static_cast<const ResizeImageRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ResizeImageRequest)
+void ServerState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerState*>(&to_msg);
+  auto& from = static_cast<const ServerState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.ServerState)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_width() != 0) {
-    _this->_internal_set_width(from._internal_width());
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  if (from._internal_worker_threads() != 0) {
+    _this->_internal_set_worker_threads(from._internal_worker_threads());
   }
-  if (from._internal_height() != 0) {
-    _this->_internal_set_height(from._internal_height());
+  if (from._internal_worker_active() != 0) {
+    _this->_internal_set_worker_active(from._internal_worker_active());
+  }
+  if (from._internal_worker_queued() != 0) {
+    _this->_internal_set_worker_queued(from._internal_worker_queued());
+  }
+  if (from._internal_jobs_queued() != 0) {
+    _this->_internal_set_jobs_queued(from._internal_jobs_queued());
+  }
+  if (from._internal_ingest_buffer_bytes() != 0) {
+    _this->_internal_set_ingest_buffer_bytes(from._internal_ingest_buffer_bytes());
+  }
+  if (from._internal_uptime_s() != 0) {
+    _this->_internal_set_uptime_s(from._internal_uptime_s());
+  }
+  if (from._internal_jobs_running() != 0) {
+    _this->_internal_set_jobs_running(from._internal_jobs_running());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ResizeImageRequest::CopyFrom(const ResizeImageRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ResizeImageRequest)
+void ServerState::CopyFrom(const ServerState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.ServerState)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ResizeImageRequest::IsInitialized() const {
+bool ServerState::IsInitialized() const {
   return true;
 }
 
-void ResizeImageRequest::InternalSwap(ResizeImageRequest* other) {
+void ServerState::InternalSwap(ServerState* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ResizeImageRequest, _impl_.height_)
-      + sizeof(ResizeImageRequest::_impl_.height_)
-      - PROTOBUF_FIELD_OFFSET(ResizeImageRequest, _impl_.width_)>(
-          reinterpret_cast<char*>(&_impl_.width_),
-          reinterpret_cast<char*>(&other->_impl_.width_));
+      PROTOBUF_FIELD_OFFSET(ServerState, _impl_.jobs_running_)
+      + sizeof(ServerState::_impl_.jobs_running_)
+      - PROTOBUF_FIELD_OFFSET(ServerState, _impl_.worker_threads_)>(
+          reinterpret_cast<char*>(&_impl_.worker_threads_),
+          reinterpret_cast<char*>(&other->_impl_.worker_threads_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ResizeImageRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ServerState::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
-      file_level_metadata_file_5fprocessor_2eproto[5]);
+      file_level_metadata_file_5fprocessor_2eproto[32]);
 }
 
 // ===================================================================
 
-class FileResponse::_Internal {
+class JobRecord::_Internal {
  public:
-  static const ::file_processor::FileChunk& file_content(const FileResponse* msg);
+  static const ::file_processor::JobStatus& status(const JobRecord* msg);
+  static const ::file_processor::FileRequest& request(const JobRecord* msg);
 };
 
-const ::file_processor::FileChunk&
-FileResponse::_Internal::file_content(const FileResponse* msg) {
-  return *msg->_impl_.file_content_;
+const ::file_processor::JobStatus&
+JobRecord::_Internal::status(const JobRecord* msg) {
+  return *msg->_impl_.status_;
 }
-FileResponse::FileResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::file_processor::FileRequest&
+JobRecord::_Internal::request(const JobRecord* msg) {
+  return *msg->_impl_.request_;
+}
+JobRecord::JobRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:file_processor.FileResponse)
+  // @@protoc_insertion_point(arena_constructor:file_processor.JobRecord)
 }
-FileResponse::FileResponse(const FileResponse& from)
+JobRecord::JobRecord(const JobRecord& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  FileResponse* const _this = this; (void)_this;
+  JobRecord* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.file_name_){}
-    , decltype(_impl_.status_message_){}
-    , decltype(_impl_.file_content_){nullptr}
-    , decltype(_impl_.success_){}
+      decltype(_impl_.status_){nullptr}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.submitted_at_){}
+    , decltype(_impl_.input_size_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.file_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.file_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_file_name().empty()) {
-    _this->_impl_.file_name_.Set(from._internal_file_name(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.status_message_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.status_message_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_status_message().empty()) {
-    _this->_impl_.status_message_.Set(from._internal_status_message(), 
-      _this->GetArenaForAllocation());
+  if (from._internal_has_status()) {
+    _this->_impl_.status_ = new ::file_processor::JobStatus(*from._impl_.status_);
   }
-  if (from._internal_has_file_content()) {
-    _this->_impl_.file_content_ = new ::file_processor::FileChunk(*from._impl_.file_content_);
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::file_processor::FileRequest(*from._impl_.request_);
   }
-  _this->_impl_.success_ = from._impl_.success_;
-  // @@protoc_insertion_point(copy_constructor:file_processor.FileResponse)
+  ::memcpy(&_impl_.submitted_at_, &from._impl_.submitted_at_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.input_size_) -
+    reinterpret_cast<char*>(&_impl_.submitted_at_)) + sizeof(_impl_.input_size_));
+  // @@protoc_insertion_point(copy_constructor:file_processor.JobRecord)
 }
 
-inline void FileResponse::SharedCtor(
+inline void JobRecord::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.file_name_){}
-    , decltype(_impl_.status_message_){}
-    , decltype(_impl_.file_content_){nullptr}
-    , decltype(_impl_.success_){false}
+      decltype(_impl_.status_){nullptr}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.submitted_at_){int64_t{0}}
+    , decltype(_impl_.input_size_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.file_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.file_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.status_message_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.status_message_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-FileResponse::~FileResponse() {
-  // @@protoc_insertion_point(destructor:file_processor.FileResponse)
+JobRecord::~JobRecord() {
+  // @@protoc_insertion_point(destructor:file_processor.JobRecord)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1533,71 +10424,70 @@ FileResponse::~FileResponse() {
   SharedDtor();
 }
 
-inline void FileResponse::SharedDtor() {
+inline void JobRecord::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.file_name_.Destroy();
-  _impl_.status_message_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.file_content_;
+  if (this != internal_default_instance()) delete _impl_.status_;
+  if (this != internal_default_instance()) delete _impl_.request_;
 }
 
-void FileResponse::SetCachedSize(int size) const {
+void JobRecord::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void FileResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:file_processor.FileResponse)
+void JobRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:file_processor.JobRecord)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.file_name_.ClearToEmpty();
-  _impl_.status_message_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
-    delete _impl_.file_content_;
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
   }
-  _impl_.file_content_ = nullptr;
-  _impl_.success_ = false;
+  _impl_.status_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
+  }
+  _impl_.request_ = nullptr;
+  ::memset(&_impl_.submitted_at_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.input_size_) -
+      reinterpret_cast<char*>(&_impl_.submitted_at_)) + sizeof(_impl_.input_size_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FileResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* JobRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string file_name = 1;
+      // .file_processor.JobStatus status = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_file_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_status(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileResponse.file_name"));
         } else
           goto handle_unusual;
         continue;
-      // .file_processor.FileChunk file_content = 2;
+      // .file_processor.FileRequest request = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_file_content(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string status_message = 3;
+      // int64 submitted_at = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_status_message();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.submitted_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "file_processor.FileResponse.status_message"));
         } else
           goto handle_unusual;
         continue;
-      // bool success = 4;
+      // uint64 input_size = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.input_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1625,157 +10515,139 @@ failure:
 #undef CHK_
 }
 
-uint8_t* FileResponse::_InternalSerialize(
+uint8_t* JobRecord::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:file_processor.FileResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:file_processor.JobRecord)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (!this->_internal_file_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "file_processor.FileResponse.file_name");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_file_name(), target);
+  // .file_processor.JobStatus status = 1;
+  if (this->_internal_has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::status(this),
+        _Internal::status(this).GetCachedSize(), target, stream);
   }
 
-  // .file_processor.FileChunk file_content = 2;
-  if (this->_internal_has_file_content()) {
+  // .file_processor.FileRequest request = 2;
+  if (this->_internal_has_request()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::file_content(this),
-        _Internal::file_content(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(2, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
   }
 
-  // string status_message = 3;
-  if (!this->_internal_status_message().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "file_processor.FileResponse.status_message");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_status_message(), target);
+  // int64 submitted_at = 3;
+  if (this->_internal_submitted_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_submitted_at(), target);
   }
 
-  // bool success = 4;
-  if (this->_internal_success() != 0) {
+  // uint64 input_size = 4;
+  if (this->_internal_input_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_success(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_input_size(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:file_processor.FileResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:file_processor.JobRecord)
   return target;
 }
 
-size_t FileResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:file_processor.FileResponse)
+size_t JobRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:file_processor.JobRecord)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (!this->_internal_file_name().empty()) {
+  // .file_processor.JobStatus status = 1;
+  if (this->_internal_has_status()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_file_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.status_);
   }
 
-  // string status_message = 3;
-  if (!this->_internal_status_message().empty()) {
+  // .file_processor.FileRequest request = 2;
+  if (this->_internal_has_request()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_status_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.request_);
   }
 
-  // .file_processor.FileChunk file_content = 2;
-  if (this->_internal_has_file_content()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.file_content_);
+  // int64 submitted_at = 3;
+  if (this->_internal_submitted_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_submitted_at());
   }
 
-  // bool success = 4;
-  if (this->_internal_success() != 0) {
-    total_size += 1 + 1;
+  // uint64 input_size = 4;
+  if (this->_internal_input_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_input_size());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobRecord::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    FileResponse::MergeImpl
+    JobRecord::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobRecord::GetClassData() const { return &_class_data_; }
 
 
-void FileResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<FileResponse*>(&to_msg);
-  auto& from = static_cast<const FileResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.FileResponse)
+void JobRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobRecord*>(&to_msg);
+  auto& from = static_cast<const JobRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:file_processor.JobRecord)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_file_name().empty()) {
-    _this->_internal_set_file_name(from._internal_file_name());
+  if (from._internal_has_status()) {
+    _this->_internal_mutable_status()->::file_processor::JobStatus::MergeFrom(
+        from._internal_status());
   }
-  if (!from._internal_status_message().empty()) {
-    _this->_internal_set_status_message(from._internal_status_message());
+  if (from._internal_has_request()) {
+    _this->_internal_mutable_request()->::file_processor::FileRequest::MergeFrom(
+        from._internal_request());
   }
-  if (from._internal_has_file_content()) {
-    _this->_internal_mutable_file_content()->::file_processor::FileChunk::MergeFrom(
-        from._internal_file_content());
+  if (from._internal_submitted_at() != 0) {
+    _this->_internal_set_submitted_at(from._internal_submitted_at());
   }
-  if (from._internal_success() != 0) {
-    _this->_internal_set_success(from._internal_success());
+  if (from._internal_input_size() != 0) {
+    _this->_internal_set_input_size(from._internal_input_size());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void FileResponse::CopyFrom(const FileResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.FileResponse)
+void JobRecord::CopyFrom(const JobRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:file_processor.JobRecord)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FileResponse::IsInitialized() const {
+bool JobRecord::IsInitialized() const {
   return true;
 }
 
-void FileResponse::InternalSwap(FileResponse* other) {
+void JobRecord::InternalSwap(JobRecord* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.file_name_, lhs_arena,
-      &other->_impl_.file_name_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.status_message_, lhs_arena,
-      &other->_impl_.status_message_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(FileResponse, _impl_.success_)
-      + sizeof(FileResponse::_impl_.success_)
-      - PROTOBUF_FIELD_OFFSET(FileResponse, _impl_.file_content_)>(
-          reinterpret_cast<char*>(&_impl_.file_content_),
-          reinterpret_cast<char*>(&other->_impl_.file_content_));
+      PROTOBUF_FIELD_OFFSET(JobRecord, _impl_.input_size_)
+      + sizeof(JobRecord::_impl_.input_size_)
+      - PROTOBUF_FIELD_OFFSET(JobRecord, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FileResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata JobRecord::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_file_5fprocessor_2eproto_getter, &descriptor_table_file_5fprocessor_2eproto_once,
-      file_level_metadata_file_5fprocessor_2eproto[6]);
+      file_level_metadata_file_5fprocessor_2eproto[33]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1805,10 +10677,118 @@ template<> PROTOBUF_NOINLINE ::file_processor::ResizeImageRequest*
 Arena::CreateMaybeMessage< ::file_processor::ResizeImageRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::file_processor::ResizeImageRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::file_processor::ImageSize*
+Arena::CreateMaybeMessage< ::file_processor::ImageSize >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::ImageSize >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::ResizeImageMultiRequest*
+Arena::CreateMaybeMessage< ::file_processor::ResizeImageMultiRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::ResizeImageMultiRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::PipelineStep*
+Arena::CreateMaybeMessage< ::file_processor::PipelineStep >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::PipelineStep >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::PipelineRequest*
+Arena::CreateMaybeMessage< ::file_processor::PipelineRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::PipelineRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::file_processor::FileResponse*
 Arena::CreateMaybeMessage< ::file_processor::FileResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::file_processor::FileResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::file_processor::BatchRequest*
+Arena::CreateMaybeMessage< ::file_processor::BatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::BatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::BatchResponse*
+Arena::CreateMaybeMessage< ::file_processor::BatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::BatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::StartUploadRequest*
+Arena::CreateMaybeMessage< ::file_processor::StartUploadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::StartUploadRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::UploadChunk*
+Arena::CreateMaybeMessage< ::file_processor::UploadChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::UploadChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::UploadQuery*
+Arena::CreateMaybeMessage< ::file_processor::UploadQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::UploadQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::UploadStatus*
+Arena::CreateMaybeMessage< ::file_processor::UploadStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::UploadStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::FetchOutputRequest*
+Arena::CreateMaybeMessage< ::file_processor::FetchOutputRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::FetchOutputRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::JobOutput*
+Arena::CreateMaybeMessage< ::file_processor::JobOutput >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::JobOutput >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::JobQuery*
+Arena::CreateMaybeMessage< ::file_processor::JobQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::JobQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::JobStatus*
+Arena::CreateMaybeMessage< ::file_processor::JobStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::JobStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::SignatureRequest*
+Arena::CreateMaybeMessage< ::file_processor::SignatureRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::SignatureRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::BlockSignature*
+Arena::CreateMaybeMessage< ::file_processor::BlockSignature >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::BlockSignature >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::SignatureBatch*
+Arena::CreateMaybeMessage< ::file_processor::SignatureBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::SignatureBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::BlockRange*
+Arena::CreateMaybeMessage< ::file_processor::BlockRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::BlockRange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::DeltaOp*
+Arena::CreateMaybeMessage< ::file_processor::DeltaOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::DeltaOp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::DeltaChunk*
+Arena::CreateMaybeMessage< ::file_processor::DeltaChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::DeltaChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::LatencyQuery*
+Arena::CreateMaybeMessage< ::file_processor::LatencyQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::LatencyQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::LatencySeries*
+Arena::CreateMaybeMessage< ::file_processor::LatencySeries >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::LatencySeries >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::LatencyReport*
+Arena::CreateMaybeMessage< ::file_processor::LatencyReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::LatencyReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::ServerStateQuery*
+Arena::CreateMaybeMessage< ::file_processor::ServerStateQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::ServerStateQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::ActiveRequest*
+Arena::CreateMaybeMessage< ::file_processor::ActiveRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::ActiveRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::ServerState*
+Arena::CreateMaybeMessage< ::file_processor::ServerState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::ServerState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::file_processor::JobRecord*
+Arena::CreateMaybeMessage< ::file_processor::JobRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::file_processor::JobRecord >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
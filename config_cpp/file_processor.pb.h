@@ -30,6 +30,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -46,6 +47,21 @@ struct TableStruct_file_5fprocessor_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_file_5fprocessor_2eproto;
 namespace file_processor {
+class ActiveRequest;
+struct ActiveRequestDefaultTypeInternal;
+extern ActiveRequestDefaultTypeInternal _ActiveRequest_default_instance_;
+class BatchRequest;
+struct BatchRequestDefaultTypeInternal;
+extern BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+class BatchResponse;
+struct BatchResponseDefaultTypeInternal;
+extern BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+class BlockRange;
+struct BlockRangeDefaultTypeInternal;
+extern BlockRangeDefaultTypeInternal _BlockRange_default_instance_;
+class BlockSignature;
+struct BlockSignatureDefaultTypeInternal;
+extern BlockSignatureDefaultTypeInternal _BlockSignature_default_instance_;
 class CompressPDFRequest;
 struct CompressPDFRequestDefaultTypeInternal;
 extern CompressPDFRequestDefaultTypeInternal _CompressPDFRequest_default_instance_;
@@ -55,6 +71,15 @@ extern ConvertImageFormatRequestDefaultTypeInternal _ConvertImageFormatRequest_d
 class ConvertToTXTRequest;
 struct ConvertToTXTRequestDefaultTypeInternal;
 extern ConvertToTXTRequestDefaultTypeInternal _ConvertToTXTRequest_default_instance_;
+class DeltaChunk;
+struct DeltaChunkDefaultTypeInternal;
+extern DeltaChunkDefaultTypeInternal _DeltaChunk_default_instance_;
+class DeltaOp;
+struct DeltaOpDefaultTypeInternal;
+extern DeltaOpDefaultTypeInternal _DeltaOp_default_instance_;
+class FetchOutputRequest;
+struct FetchOutputRequestDefaultTypeInternal;
+extern FetchOutputRequestDefaultTypeInternal _FetchOutputRequest_default_instance_;
 class FileChunk;
 struct FileChunkDefaultTypeInternal;
 extern FileChunkDefaultTypeInternal _FileChunk_default_instance_;
@@ -64,21 +89,132 @@ extern FileRequestDefaultTypeInternal _FileRequest_default_instance_;
 class FileResponse;
 struct FileResponseDefaultTypeInternal;
 extern FileResponseDefaultTypeInternal _FileResponse_default_instance_;
+class ImageSize;
+struct ImageSizeDefaultTypeInternal;
+extern ImageSizeDefaultTypeInternal _ImageSize_default_instance_;
+class JobOutput;
+struct JobOutputDefaultTypeInternal;
+extern JobOutputDefaultTypeInternal _JobOutput_default_instance_;
+class JobQuery;
+struct JobQueryDefaultTypeInternal;
+extern JobQueryDefaultTypeInternal _JobQuery_default_instance_;
+class JobRecord;
+struct JobRecordDefaultTypeInternal;
+extern JobRecordDefaultTypeInternal _JobRecord_default_instance_;
+class JobStatus;
+struct JobStatusDefaultTypeInternal;
+extern JobStatusDefaultTypeInternal _JobStatus_default_instance_;
+class LatencyQuery;
+struct LatencyQueryDefaultTypeInternal;
+extern LatencyQueryDefaultTypeInternal _LatencyQuery_default_instance_;
+class LatencyReport;
+struct LatencyReportDefaultTypeInternal;
+extern LatencyReportDefaultTypeInternal _LatencyReport_default_instance_;
+class LatencySeries;
+struct LatencySeriesDefaultTypeInternal;
+extern LatencySeriesDefaultTypeInternal _LatencySeries_default_instance_;
+class PipelineRequest;
+struct PipelineRequestDefaultTypeInternal;
+extern PipelineRequestDefaultTypeInternal _PipelineRequest_default_instance_;
+class PipelineStep;
+struct PipelineStepDefaultTypeInternal;
+extern PipelineStepDefaultTypeInternal _PipelineStep_default_instance_;
+class ResizeImageMultiRequest;
+struct ResizeImageMultiRequestDefaultTypeInternal;
+extern ResizeImageMultiRequestDefaultTypeInternal _ResizeImageMultiRequest_default_instance_;
 class ResizeImageRequest;
 struct ResizeImageRequestDefaultTypeInternal;
 extern ResizeImageRequestDefaultTypeInternal _ResizeImageRequest_default_instance_;
+class ServerState;
+struct ServerStateDefaultTypeInternal;
+extern ServerStateDefaultTypeInternal _ServerState_default_instance_;
+class ServerStateQuery;
+struct ServerStateQueryDefaultTypeInternal;
+extern ServerStateQueryDefaultTypeInternal _ServerStateQuery_default_instance_;
+class SignatureBatch;
+struct SignatureBatchDefaultTypeInternal;
+extern SignatureBatchDefaultTypeInternal _SignatureBatch_default_instance_;
+class SignatureRequest;
+struct SignatureRequestDefaultTypeInternal;
+extern SignatureRequestDefaultTypeInternal _SignatureRequest_default_instance_;
+class StartUploadRequest;
+struct StartUploadRequestDefaultTypeInternal;
+extern StartUploadRequestDefaultTypeInternal _StartUploadRequest_default_instance_;
+class UploadChunk;
+struct UploadChunkDefaultTypeInternal;
+extern UploadChunkDefaultTypeInternal _UploadChunk_default_instance_;
+class UploadQuery;
+struct UploadQueryDefaultTypeInternal;
+extern UploadQueryDefaultTypeInternal _UploadQuery_default_instance_;
+class UploadStatus;
+struct UploadStatusDefaultTypeInternal;
+extern UploadStatusDefaultTypeInternal _UploadStatus_default_instance_;
 }  // namespace file_processor
 PROTOBUF_NAMESPACE_OPEN
+template<> ::file_processor::ActiveRequest* Arena::CreateMaybeMessage<::file_processor::ActiveRequest>(Arena*);
+template<> ::file_processor::BatchRequest* Arena::CreateMaybeMessage<::file_processor::BatchRequest>(Arena*);
+template<> ::file_processor::BatchResponse* Arena::CreateMaybeMessage<::file_processor::BatchResponse>(Arena*);
+template<> ::file_processor::BlockRange* Arena::CreateMaybeMessage<::file_processor::BlockRange>(Arena*);
+template<> ::file_processor::BlockSignature* Arena::CreateMaybeMessage<::file_processor::BlockSignature>(Arena*);
 template<> ::file_processor::CompressPDFRequest* Arena::CreateMaybeMessage<::file_processor::CompressPDFRequest>(Arena*);
 template<> ::file_processor::ConvertImageFormatRequest* Arena::CreateMaybeMessage<::file_processor::ConvertImageFormatRequest>(Arena*);
 template<> ::file_processor::ConvertToTXTRequest* Arena::CreateMaybeMessage<::file_processor::ConvertToTXTRequest>(Arena*);
+template<> ::file_processor::DeltaChunk* Arena::CreateMaybeMessage<::file_processor::DeltaChunk>(Arena*);
+template<> ::file_processor::DeltaOp* Arena::CreateMaybeMessage<::file_processor::DeltaOp>(Arena*);
+template<> ::file_processor::FetchOutputRequest* Arena::CreateMaybeMessage<::file_processor::FetchOutputRequest>(Arena*);
 template<> ::file_processor::FileChunk* Arena::CreateMaybeMessage<::file_processor::FileChunk>(Arena*);
 template<> ::file_processor::FileRequest* Arena::CreateMaybeMessage<::file_processor::FileRequest>(Arena*);
 template<> ::file_processor::FileResponse* Arena::CreateMaybeMessage<::file_processor::FileResponse>(Arena*);
+template<> ::file_processor::ImageSize* Arena::CreateMaybeMessage<::file_processor::ImageSize>(Arena*);
+template<> ::file_processor::JobOutput* Arena::CreateMaybeMessage<::file_processor::JobOutput>(Arena*);
+template<> ::file_processor::JobQuery* Arena::CreateMaybeMessage<::file_processor::JobQuery>(Arena*);
+template<> ::file_processor::JobRecord* Arena::CreateMaybeMessage<::file_processor::JobRecord>(Arena*);
+template<> ::file_processor::JobStatus* Arena::CreateMaybeMessage<::file_processor::JobStatus>(Arena*);
+template<> ::file_processor::LatencyQuery* Arena::CreateMaybeMessage<::file_processor::LatencyQuery>(Arena*);
+template<> ::file_processor::LatencyReport* Arena::CreateMaybeMessage<::file_processor::LatencyReport>(Arena*);
+template<> ::file_processor::LatencySeries* Arena::CreateMaybeMessage<::file_processor::LatencySeries>(Arena*);
+template<> ::file_processor::PipelineRequest* Arena::CreateMaybeMessage<::file_processor::PipelineRequest>(Arena*);
+template<> ::file_processor::PipelineStep* Arena::CreateMaybeMessage<::file_processor::PipelineStep>(Arena*);
+template<> ::file_processor::ResizeImageMultiRequest* Arena::CreateMaybeMessage<::file_processor::ResizeImageMultiRequest>(Arena*);
 template<> ::file_processor::ResizeImageRequest* Arena::CreateMaybeMessage<::file_processor::ResizeImageRequest>(Arena*);
+template<> ::file_processor::ServerState* Arena::CreateMaybeMessage<::file_processor::ServerState>(Arena*);
+template<> ::file_processor::ServerStateQuery* Arena::CreateMaybeMessage<::file_processor::ServerStateQuery>(Arena*);
+template<> ::file_processor::SignatureBatch* Arena::CreateMaybeMessage<::file_processor::SignatureBatch>(Arena*);
+template<> ::file_processor::SignatureRequest* Arena::CreateMaybeMessage<::file_processor::SignatureRequest>(Arena*);
+template<> ::file_processor::StartUploadRequest* Arena::CreateMaybeMessage<::file_processor::StartUploadRequest>(Arena*);
+template<> ::file_processor::UploadChunk* Arena::CreateMaybeMessage<::file_processor::UploadChunk>(Arena*);
+template<> ::file_processor::UploadQuery* Arena::CreateMaybeMessage<::file_processor::UploadQuery>(Arena*);
+template<> ::file_processor::UploadStatus* Arena::CreateMaybeMessage<::file_processor::UploadStatus>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace file_processor {
 
+enum JobState : int {
+  JOB_QUEUED = 0,
+  JOB_RUNNING = 1,
+  JOB_DONE = 2,
+  JOB_FAILED = 3,
+  JobState_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  JobState_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool JobState_IsValid(int value);
+constexpr JobState JobState_MIN = JOB_QUEUED;
+constexpr JobState JobState_MAX = JOB_FAILED;
+constexpr int JobState_ARRAYSIZE = JobState_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* JobState_descriptor();
+template<typename T>
+inline const std::string& JobState_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, JobState>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function JobState_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    JobState_descriptor(), enum_t_value);
+}
+inline bool JobState_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, JobState* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<JobState>(
+    JobState_descriptor(), name, value);
+}
 // ===================================================================
 
 class FileChunk final :
@@ -203,6 +339,7 @@ class FileChunk final :
 
   enum : int {
     kContentFieldNumber = 1,
+    kCrc32CFieldNumber = 2,
   };
   // bytes content = 1;
   void clear_content();
@@ -218,6 +355,19 @@ class FileChunk final :
   std::string* _internal_mutable_content();
   public:
 
+  // optional fixed32 crc32c = 2;
+  bool has_crc32c() const;
+  private:
+  bool _internal_has_crc32c() const;
+  public:
+  void clear_crc32c();
+  uint32_t crc32c() const;
+  void set_crc32c(uint32_t value);
+  private:
+  uint32_t _internal_crc32c() const;
+  void _internal_set_crc32c(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:file_processor.FileChunk)
  private:
   class _Internal;
@@ -226,8 +376,10 @@ class FileChunk final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    uint32_t crc32c_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_file_5fprocessor_2eproto;
@@ -282,6 +434,8 @@ class FileRequest final :
     kConvertToTxtParams = 4,
     kConvertImageFormatParams = 5,
     kResizeImageParams = 6,
+    kResizeImageMultiParams = 7,
+    kPipelineParams = 9,
     PARAMETERS_NOT_SET = 0,
   };
 
@@ -364,11 +518,14 @@ class FileRequest final :
 
   enum : int {
     kFileNameFieldNumber = 1,
+    kUploadIdFieldNumber = 8,
     kFileContentFieldNumber = 2,
     kCompressPdfParamsFieldNumber = 3,
     kConvertToTxtParamsFieldNumber = 4,
     kConvertImageFormatParamsFieldNumber = 5,
     kResizeImageParamsFieldNumber = 6,
+    kResizeImageMultiParamsFieldNumber = 7,
+    kPipelineParamsFieldNumber = 9,
   };
   // string file_name = 1;
   void clear_file_name();
@@ -384,6 +541,20 @@ class FileRequest final :
   std::string* _internal_mutable_file_name();
   public:
 
+  // string upload_id = 8;
+  void clear_upload_id();
+  const std::string& upload_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_upload_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_upload_id();
+  PROTOBUF_NODISCARD std::string* release_upload_id();
+  void set_allocated_upload_id(std::string* upload_id);
+  private:
+  const std::string& _internal_upload_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_upload_id(const std::string& value);
+  std::string* _internal_mutable_upload_id();
+  public:
+
   // .file_processor.FileChunk file_content = 2;
   bool has_file_content() const;
   private:
@@ -474,6 +645,42 @@ class FileRequest final :
       ::file_processor::ResizeImageRequest* resize_image_params);
   ::file_processor::ResizeImageRequest* unsafe_arena_release_resize_image_params();
 
+  // .file_processor.ResizeImageMultiRequest resize_image_multi_params = 7;
+  bool has_resize_image_multi_params() const;
+  private:
+  bool _internal_has_resize_image_multi_params() const;
+  public:
+  void clear_resize_image_multi_params();
+  const ::file_processor::ResizeImageMultiRequest& resize_image_multi_params() const;
+  PROTOBUF_NODISCARD ::file_processor::ResizeImageMultiRequest* release_resize_image_multi_params();
+  ::file_processor::ResizeImageMultiRequest* mutable_resize_image_multi_params();
+  void set_allocated_resize_image_multi_params(::file_processor::ResizeImageMultiRequest* resize_image_multi_params);
+  private:
+  const ::file_processor::ResizeImageMultiRequest& _internal_resize_image_multi_params() const;
+  ::file_processor::ResizeImageMultiRequest* _internal_mutable_resize_image_multi_params();
+  public:
+  void unsafe_arena_set_allocated_resize_image_multi_params(
+      ::file_processor::ResizeImageMultiRequest* resize_image_multi_params);
+  ::file_processor::ResizeImageMultiRequest* unsafe_arena_release_resize_image_multi_params();
+
+  // .file_processor.PipelineRequest pipeline_params = 9;
+  bool has_pipeline_params() const;
+  private:
+  bool _internal_has_pipeline_params() const;
+  public:
+  void clear_pipeline_params();
+  const ::file_processor::PipelineRequest& pipeline_params() const;
+  PROTOBUF_NODISCARD ::file_processor::PipelineRequest* release_pipeline_params();
+  ::file_processor::PipelineRequest* mutable_pipeline_params();
+  void set_allocated_pipeline_params(::file_processor::PipelineRequest* pipeline_params);
+  private:
+  const ::file_processor::PipelineRequest& _internal_pipeline_params() const;
+  ::file_processor::PipelineRequest* _internal_mutable_pipeline_params();
+  public:
+  void unsafe_arena_set_allocated_pipeline_params(
+      ::file_processor::PipelineRequest* pipeline_params);
+  ::file_processor::PipelineRequest* unsafe_arena_release_pipeline_params();
+
   void clear_parameters();
   ParametersCase parameters_case() const;
   // @@protoc_insertion_point(class_scope:file_processor.FileRequest)
@@ -483,6 +690,8 @@ class FileRequest final :
   void set_has_convert_to_txt_params();
   void set_has_convert_image_format_params();
   void set_has_resize_image_params();
+  void set_has_resize_image_multi_params();
+  void set_has_pipeline_params();
 
   inline bool has_parameters() const;
   inline void clear_has_parameters();
@@ -492,6 +701,7 @@ class FileRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
     ::file_processor::FileChunk* file_content_;
     union ParametersUnion {
       constexpr ParametersUnion() : _constinit_{} {}
@@ -500,6 +710,8 @@ class FileRequest final :
       ::file_processor::ConvertToTXTRequest* convert_to_txt_params_;
       ::file_processor::ConvertImageFormatRequest* convert_image_format_params_;
       ::file_processor::ResizeImageRequest* resize_image_params_;
+      ::file_processor::ResizeImageMultiRequest* resize_image_multi_params_;
+      ::file_processor::PipelineRequest* pipeline_params_;
     } parameters_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -1058,24 +1270,24 @@ class ResizeImageRequest final :
 };
 // -------------------------------------------------------------------
 
-class FileResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.FileResponse) */ {
+class ImageSize final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.ImageSize) */ {
  public:
-  inline FileResponse() : FileResponse(nullptr) {}
-  ~FileResponse() override;
-  explicit PROTOBUF_CONSTEXPR FileResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ImageSize() : ImageSize(nullptr) {}
+  ~ImageSize() override;
+  explicit PROTOBUF_CONSTEXPR ImageSize(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  FileResponse(const FileResponse& from);
-  FileResponse(FileResponse&& from) noexcept
-    : FileResponse() {
+  ImageSize(const ImageSize& from);
+  ImageSize(ImageSize&& from) noexcept
+    : ImageSize() {
     *this = ::std::move(from);
   }
 
-  inline FileResponse& operator=(const FileResponse& from) {
+  inline ImageSize& operator=(const ImageSize& from) {
     CopyFrom(from);
     return *this;
   }
-  inline FileResponse& operator=(FileResponse&& from) noexcept {
+  inline ImageSize& operator=(ImageSize&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1098,20 +1310,20 @@ class FileResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const FileResponse& default_instance() {
+  static const ImageSize& default_instance() {
     return *internal_default_instance();
   }
-  static inline const FileResponse* internal_default_instance() {
-    return reinterpret_cast<const FileResponse*>(
-               &_FileResponse_default_instance_);
+  static inline const ImageSize* internal_default_instance() {
+    return reinterpret_cast<const ImageSize*>(
+               &_ImageSize_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(FileResponse& a, FileResponse& b) {
+  friend void swap(ImageSize& a, ImageSize& b) {
     a.Swap(&b);
   }
-  inline void Swap(FileResponse* other) {
+  inline void Swap(ImageSize* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1124,7 +1336,7 @@ class FileResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(FileResponse* other) {
+  void UnsafeArenaSwap(ImageSize* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1132,14 +1344,14 @@ class FileResponse final :
 
   // implements Message ----------------------------------------------
 
-  FileResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<FileResponse>(arena);
+  ImageSize* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ImageSize>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const FileResponse& from);
+  void CopyFrom(const ImageSize& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const FileResponse& from) {
-    FileResponse::MergeImpl(*this, from);
+  void MergeFrom( const ImageSize& from) {
+    ImageSize::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1157,15 +1369,15 @@ class FileResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(FileResponse* other);
+  void InternalSwap(ImageSize* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "file_processor.FileResponse";
+    return "file_processor.ImageSize";
   }
   protected:
-  explicit FileResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ImageSize(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1179,67 +1391,186 @@ class FileResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFileNameFieldNumber = 1,
-    kStatusMessageFieldNumber = 3,
-    kFileContentFieldNumber = 2,
-    kSuccessFieldNumber = 4,
+    kWidthFieldNumber = 1,
+    kHeightFieldNumber = 2,
   };
-  // string file_name = 1;
-  void clear_file_name();
-  const std::string& file_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_file_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_file_name();
-  PROTOBUF_NODISCARD std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
+  // int32 width = 1;
+  void clear_width();
+  int32_t width() const;
+  void set_width(int32_t value);
   private:
-  const std::string& _internal_file_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
-  std::string* _internal_mutable_file_name();
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
   public:
 
-  // string status_message = 3;
-  void clear_status_message();
-  const std::string& status_message() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_status_message(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_status_message();
-  PROTOBUF_NODISCARD std::string* release_status_message();
-  void set_allocated_status_message(std::string* status_message);
+  // int32 height = 2;
+  void clear_height();
+  int32_t height() const;
+  void set_height(int32_t value);
   private:
-  const std::string& _internal_status_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
-  std::string* _internal_mutable_status_message();
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
   public:
 
-  // .file_processor.FileChunk file_content = 2;
-  bool has_file_content() const;
+  // @@protoc_insertion_point(class_scope:file_processor.ImageSize)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t width_;
+    int32_t height_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResizeImageMultiRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.ResizeImageMultiRequest) */ {
+ public:
+  inline ResizeImageMultiRequest() : ResizeImageMultiRequest(nullptr) {}
+  ~ResizeImageMultiRequest() override;
+  explicit PROTOBUF_CONSTEXPR ResizeImageMultiRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResizeImageMultiRequest(const ResizeImageMultiRequest& from);
+  ResizeImageMultiRequest(ResizeImageMultiRequest&& from) noexcept
+    : ResizeImageMultiRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ResizeImageMultiRequest& operator=(const ResizeImageMultiRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResizeImageMultiRequest& operator=(ResizeImageMultiRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResizeImageMultiRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResizeImageMultiRequest* internal_default_instance() {
+    return reinterpret_cast<const ResizeImageMultiRequest*>(
+               &_ResizeImageMultiRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ResizeImageMultiRequest& a, ResizeImageMultiRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResizeImageMultiRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResizeImageMultiRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResizeImageMultiRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResizeImageMultiRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResizeImageMultiRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResizeImageMultiRequest& from) {
+    ResizeImageMultiRequest::MergeImpl(*this, from);
+  }
   private:
-  bool _internal_has_file_content() const;
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  void clear_file_content();
-  const ::file_processor::FileChunk& file_content() const;
-  PROTOBUF_NODISCARD ::file_processor::FileChunk* release_file_content();
-  ::file_processor::FileChunk* mutable_file_content();
-  void set_allocated_file_content(::file_processor::FileChunk* file_content);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  const ::file_processor::FileChunk& _internal_file_content() const;
-  ::file_processor::FileChunk* _internal_mutable_file_content();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResizeImageMultiRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.ResizeImageMultiRequest";
+  }
+  protected:
+  explicit ResizeImageMultiRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  void unsafe_arena_set_allocated_file_content(
-      ::file_processor::FileChunk* file_content);
-  ::file_processor::FileChunk* unsafe_arena_release_file_content();
 
-  // bool success = 4;
-  void clear_success();
-  bool success() const;
-  void set_success(bool value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSizesFieldNumber = 1,
+  };
+  // repeated .file_processor.ImageSize sizes = 1;
+  int sizes_size() const;
   private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
+  int _internal_sizes_size() const;
+  public:
+  void clear_sizes();
+  ::file_processor::ImageSize* mutable_sizes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ImageSize >*
+      mutable_sizes();
+  private:
+  const ::file_processor::ImageSize& _internal_sizes(int index) const;
+  ::file_processor::ImageSize* _internal_add_sizes();
   public:
+  const ::file_processor::ImageSize& sizes(int index) const;
+  ::file_processor::ImageSize* add_sizes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ImageSize >&
+      sizes() const;
 
-  // @@protoc_insertion_point(class_scope:file_processor.FileResponse)
+  // @@protoc_insertion_point(class_scope:file_processor.ResizeImageMultiRequest)
  private:
   class _Internal;
 
@@ -1247,116 +1578,9193 @@ class FileResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
-    ::file_processor::FileChunk* file_content_;
-    bool success_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ImageSize > sizes_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_file_5fprocessor_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PipelineStep final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.PipelineStep) */ {
+ public:
+  inline PipelineStep() : PipelineStep(nullptr) {}
+  ~PipelineStep() override;
+  explicit PROTOBUF_CONSTEXPR PipelineStep(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PipelineStep(const PipelineStep& from);
+  PipelineStep(PipelineStep&& from) noexcept
+    : PipelineStep() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// FileChunk
+  inline PipelineStep& operator=(const PipelineStep& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PipelineStep& operator=(PipelineStep&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// bytes content = 1;
-inline void FileChunk::clear_content() {
-  _impl_.content_.ClearToEmpty();
-}
-inline const std::string& FileChunk::content() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileChunk.content)
-  return _internal_content();
-}
-template <typename ArgT0, typename... ArgT>
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PipelineStep& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OperationCase {
+    kCompressPdf = 1,
+    kConvertToTxt = 2,
+    kConvertImageFormat = 3,
+    kResizeImage = 4,
+    OPERATION_NOT_SET = 0,
+  };
+
+  static inline const PipelineStep* internal_default_instance() {
+    return reinterpret_cast<const PipelineStep*>(
+               &_PipelineStep_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(PipelineStep& a, PipelineStep& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PipelineStep* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PipelineStep* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PipelineStep* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PipelineStep>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PipelineStep& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PipelineStep& from) {
+    PipelineStep::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PipelineStep* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.PipelineStep";
+  }
+  protected:
+  explicit PipelineStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCompressPdfFieldNumber = 1,
+    kConvertToTxtFieldNumber = 2,
+    kConvertImageFormatFieldNumber = 3,
+    kResizeImageFieldNumber = 4,
+  };
+  // .file_processor.CompressPDFRequest compress_pdf = 1;
+  bool has_compress_pdf() const;
+  private:
+  bool _internal_has_compress_pdf() const;
+  public:
+  void clear_compress_pdf();
+  const ::file_processor::CompressPDFRequest& compress_pdf() const;
+  PROTOBUF_NODISCARD ::file_processor::CompressPDFRequest* release_compress_pdf();
+  ::file_processor::CompressPDFRequest* mutable_compress_pdf();
+  void set_allocated_compress_pdf(::file_processor::CompressPDFRequest* compress_pdf);
+  private:
+  const ::file_processor::CompressPDFRequest& _internal_compress_pdf() const;
+  ::file_processor::CompressPDFRequest* _internal_mutable_compress_pdf();
+  public:
+  void unsafe_arena_set_allocated_compress_pdf(
+      ::file_processor::CompressPDFRequest* compress_pdf);
+  ::file_processor::CompressPDFRequest* unsafe_arena_release_compress_pdf();
+
+  // .file_processor.ConvertToTXTRequest convert_to_txt = 2;
+  bool has_convert_to_txt() const;
+  private:
+  bool _internal_has_convert_to_txt() const;
+  public:
+  void clear_convert_to_txt();
+  const ::file_processor::ConvertToTXTRequest& convert_to_txt() const;
+  PROTOBUF_NODISCARD ::file_processor::ConvertToTXTRequest* release_convert_to_txt();
+  ::file_processor::ConvertToTXTRequest* mutable_convert_to_txt();
+  void set_allocated_convert_to_txt(::file_processor::ConvertToTXTRequest* convert_to_txt);
+  private:
+  const ::file_processor::ConvertToTXTRequest& _internal_convert_to_txt() const;
+  ::file_processor::ConvertToTXTRequest* _internal_mutable_convert_to_txt();
+  public:
+  void unsafe_arena_set_allocated_convert_to_txt(
+      ::file_processor::ConvertToTXTRequest* convert_to_txt);
+  ::file_processor::ConvertToTXTRequest* unsafe_arena_release_convert_to_txt();
+
+  // .file_processor.ConvertImageFormatRequest convert_image_format = 3;
+  bool has_convert_image_format() const;
+  private:
+  bool _internal_has_convert_image_format() const;
+  public:
+  void clear_convert_image_format();
+  const ::file_processor::ConvertImageFormatRequest& convert_image_format() const;
+  PROTOBUF_NODISCARD ::file_processor::ConvertImageFormatRequest* release_convert_image_format();
+  ::file_processor::ConvertImageFormatRequest* mutable_convert_image_format();
+  void set_allocated_convert_image_format(::file_processor::ConvertImageFormatRequest* convert_image_format);
+  private:
+  const ::file_processor::ConvertImageFormatRequest& _internal_convert_image_format() const;
+  ::file_processor::ConvertImageFormatRequest* _internal_mutable_convert_image_format();
+  public:
+  void unsafe_arena_set_allocated_convert_image_format(
+      ::file_processor::ConvertImageFormatRequest* convert_image_format);
+  ::file_processor::ConvertImageFormatRequest* unsafe_arena_release_convert_image_format();
+
+  // .file_processor.ResizeImageRequest resize_image = 4;
+  bool has_resize_image() const;
+  private:
+  bool _internal_has_resize_image() const;
+  public:
+  void clear_resize_image();
+  const ::file_processor::ResizeImageRequest& resize_image() const;
+  PROTOBUF_NODISCARD ::file_processor::ResizeImageRequest* release_resize_image();
+  ::file_processor::ResizeImageRequest* mutable_resize_image();
+  void set_allocated_resize_image(::file_processor::ResizeImageRequest* resize_image);
+  private:
+  const ::file_processor::ResizeImageRequest& _internal_resize_image() const;
+  ::file_processor::ResizeImageRequest* _internal_mutable_resize_image();
+  public:
+  void unsafe_arena_set_allocated_resize_image(
+      ::file_processor::ResizeImageRequest* resize_image);
+  ::file_processor::ResizeImageRequest* unsafe_arena_release_resize_image();
+
+  void clear_operation();
+  OperationCase operation_case() const;
+  // @@protoc_insertion_point(class_scope:file_processor.PipelineStep)
+ private:
+  class _Internal;
+  void set_has_compress_pdf();
+  void set_has_convert_to_txt();
+  void set_has_convert_image_format();
+  void set_has_resize_image();
+
+  inline bool has_operation() const;
+  inline void clear_has_operation();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union OperationUnion {
+      constexpr OperationUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::file_processor::CompressPDFRequest* compress_pdf_;
+      ::file_processor::ConvertToTXTRequest* convert_to_txt_;
+      ::file_processor::ConvertImageFormatRequest* convert_image_format_;
+      ::file_processor::ResizeImageRequest* resize_image_;
+    } operation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PipelineRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.PipelineRequest) */ {
+ public:
+  inline PipelineRequest() : PipelineRequest(nullptr) {}
+  ~PipelineRequest() override;
+  explicit PROTOBUF_CONSTEXPR PipelineRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PipelineRequest(const PipelineRequest& from);
+  PipelineRequest(PipelineRequest&& from) noexcept
+    : PipelineRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PipelineRequest& operator=(const PipelineRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PipelineRequest& operator=(PipelineRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PipelineRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PipelineRequest* internal_default_instance() {
+    return reinterpret_cast<const PipelineRequest*>(
+               &_PipelineRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PipelineRequest& a, PipelineRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PipelineRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PipelineRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PipelineRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PipelineRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PipelineRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PipelineRequest& from) {
+    PipelineRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PipelineRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.PipelineRequest";
+  }
+  protected:
+  explicit PipelineRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStepsFieldNumber = 1,
+  };
+  // repeated .file_processor.PipelineStep steps = 1;
+  int steps_size() const;
+  private:
+  int _internal_steps_size() const;
+  public:
+  void clear_steps();
+  ::file_processor::PipelineStep* mutable_steps(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::PipelineStep >*
+      mutable_steps();
+  private:
+  const ::file_processor::PipelineStep& _internal_steps(int index) const;
+  ::file_processor::PipelineStep* _internal_add_steps();
+  public:
+  const ::file_processor::PipelineStep& steps(int index) const;
+  ::file_processor::PipelineStep* add_steps();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::PipelineStep >&
+      steps() const;
+
+  // @@protoc_insertion_point(class_scope:file_processor.PipelineRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::PipelineStep > steps_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.FileResponse) */ {
+ public:
+  inline FileResponse() : FileResponse(nullptr) {}
+  ~FileResponse() override;
+  explicit PROTOBUF_CONSTEXPR FileResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileResponse(const FileResponse& from);
+  FileResponse(FileResponse&& from) noexcept
+    : FileResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline FileResponse& operator=(const FileResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileResponse& operator=(FileResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileResponse* internal_default_instance() {
+    return reinterpret_cast<const FileResponse*>(
+               &_FileResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(FileResponse& a, FileResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileResponse& from) {
+    FileResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.FileResponse";
+  }
+  protected:
+  explicit FileResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kStatusMessageFieldNumber = 3,
+    kResultHandleFieldNumber = 5,
+    kFileContentFieldNumber = 2,
+    kSuccessFieldNumber = 4,
+    kOutputCrc32CFieldNumber = 7,
+    kOutputSizeFieldNumber = 6,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string status_message = 3;
+  void clear_status_message();
+  const std::string& status_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_message();
+  PROTOBUF_NODISCARD std::string* release_status_message();
+  void set_allocated_status_message(std::string* status_message);
+  private:
+  const std::string& _internal_status_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
+  std::string* _internal_mutable_status_message();
+  public:
+
+  // string result_handle = 5;
+  void clear_result_handle();
+  const std::string& result_handle() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result_handle(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result_handle();
+  PROTOBUF_NODISCARD std::string* release_result_handle();
+  void set_allocated_result_handle(std::string* result_handle);
+  private:
+  const std::string& _internal_result_handle() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_handle(const std::string& value);
+  std::string* _internal_mutable_result_handle();
+  public:
+
+  // .file_processor.FileChunk file_content = 2;
+  bool has_file_content() const;
+  private:
+  bool _internal_has_file_content() const;
+  public:
+  void clear_file_content();
+  const ::file_processor::FileChunk& file_content() const;
+  PROTOBUF_NODISCARD ::file_processor::FileChunk* release_file_content();
+  ::file_processor::FileChunk* mutable_file_content();
+  void set_allocated_file_content(::file_processor::FileChunk* file_content);
+  private:
+  const ::file_processor::FileChunk& _internal_file_content() const;
+  ::file_processor::FileChunk* _internal_mutable_file_content();
+  public:
+  void unsafe_arena_set_allocated_file_content(
+      ::file_processor::FileChunk* file_content);
+  ::file_processor::FileChunk* unsafe_arena_release_file_content();
+
+  // bool success = 4;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // optional fixed32 output_crc32c = 7;
+  bool has_output_crc32c() const;
+  private:
+  bool _internal_has_output_crc32c() const;
+  public:
+  void clear_output_crc32c();
+  uint32_t output_crc32c() const;
+  void set_output_crc32c(uint32_t value);
+  private:
+  uint32_t _internal_output_crc32c() const;
+  void _internal_set_output_crc32c(uint32_t value);
+  public:
+
+  // uint64 output_size = 6;
+  void clear_output_size();
+  uint64_t output_size() const;
+  void set_output_size(uint64_t value);
+  private:
+  uint64_t _internal_output_size() const;
+  void _internal_set_output_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.FileResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_handle_;
+    ::file_processor::FileChunk* file_content_;
+    bool success_;
+    uint32_t output_crc32c_;
+    uint64_t output_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.BatchRequest) */ {
+ public:
+  inline BatchRequest() : BatchRequest(nullptr) {}
+  ~BatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchRequest(const BatchRequest& from);
+  BatchRequest(BatchRequest&& from) noexcept
+    : BatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRequest& operator=(const BatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchRequest& operator=(BatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchRequest*>(
+               &_BatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(BatchRequest& a, BatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchRequest& from) {
+    BatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.BatchRequest";
+  }
+  protected:
+  explicit BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileIdFieldNumber = 1,
+    kRequestFieldNumber = 2,
+    kLastChunkFieldNumber = 3,
+  };
+  // string file_id = 1;
+  void clear_file_id();
+  const std::string& file_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_id();
+  PROTOBUF_NODISCARD std::string* release_file_id();
+  void set_allocated_file_id(std::string* file_id);
+  private:
+  const std::string& _internal_file_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_id(const std::string& value);
+  std::string* _internal_mutable_file_id();
+  public:
+
+  // .file_processor.FileRequest request = 2;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::file_processor::FileRequest& request() const;
+  PROTOBUF_NODISCARD ::file_processor::FileRequest* release_request();
+  ::file_processor::FileRequest* mutable_request();
+  void set_allocated_request(::file_processor::FileRequest* request);
+  private:
+  const ::file_processor::FileRequest& _internal_request() const;
+  ::file_processor::FileRequest* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::file_processor::FileRequest* request);
+  ::file_processor::FileRequest* unsafe_arena_release_request();
+
+  // bool last_chunk = 3;
+  void clear_last_chunk();
+  bool last_chunk() const;
+  void set_last_chunk(bool value);
+  private:
+  bool _internal_last_chunk() const;
+  void _internal_set_last_chunk(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.BatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_id_;
+    ::file_processor::FileRequest* request_;
+    bool last_chunk_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.BatchResponse) */ {
+ public:
+  inline BatchResponse() : BatchResponse(nullptr) {}
+  ~BatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchResponse(const BatchResponse& from);
+  BatchResponse(BatchResponse&& from) noexcept
+    : BatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchResponse& operator=(const BatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchResponse& operator=(BatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchResponse*>(
+               &_BatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(BatchResponse& a, BatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchResponse& from) {
+    BatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.BatchResponse";
+  }
+  protected:
+  explicit BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileIdFieldNumber = 1,
+    kResponseFieldNumber = 2,
+    kDoneFieldNumber = 3,
+  };
+  // string file_id = 1;
+  void clear_file_id();
+  const std::string& file_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_id();
+  PROTOBUF_NODISCARD std::string* release_file_id();
+  void set_allocated_file_id(std::string* file_id);
+  private:
+  const std::string& _internal_file_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_id(const std::string& value);
+  std::string* _internal_mutable_file_id();
+  public:
+
+  // .file_processor.FileResponse response = 2;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::file_processor::FileResponse& response() const;
+  PROTOBUF_NODISCARD ::file_processor::FileResponse* release_response();
+  ::file_processor::FileResponse* mutable_response();
+  void set_allocated_response(::file_processor::FileResponse* response);
+  private:
+  const ::file_processor::FileResponse& _internal_response() const;
+  ::file_processor::FileResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::file_processor::FileResponse* response);
+  ::file_processor::FileResponse* unsafe_arena_release_response();
+
+  // bool done = 3;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.BatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_id_;
+    ::file_processor::FileResponse* response_;
+    bool done_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StartUploadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.StartUploadRequest) */ {
+ public:
+  inline StartUploadRequest() : StartUploadRequest(nullptr) {}
+  ~StartUploadRequest() override;
+  explicit PROTOBUF_CONSTEXPR StartUploadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StartUploadRequest(const StartUploadRequest& from);
+  StartUploadRequest(StartUploadRequest&& from) noexcept
+    : StartUploadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StartUploadRequest& operator=(const StartUploadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StartUploadRequest& operator=(StartUploadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StartUploadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StartUploadRequest* internal_default_instance() {
+    return reinterpret_cast<const StartUploadRequest*>(
+               &_StartUploadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(StartUploadRequest& a, StartUploadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StartUploadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StartUploadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StartUploadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StartUploadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StartUploadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StartUploadRequest& from) {
+    StartUploadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StartUploadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.StartUploadRequest";
+  }
+  protected:
+  explicit StartUploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kTotalSizeFieldNumber = 2,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // uint64 total_size = 2;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.StartUploadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    uint64_t total_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.UploadChunk) */ {
+ public:
+  inline UploadChunk() : UploadChunk(nullptr) {}
+  ~UploadChunk() override;
+  explicit PROTOBUF_CONSTEXPR UploadChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadChunk(const UploadChunk& from);
+  UploadChunk(UploadChunk&& from) noexcept
+    : UploadChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadChunk& operator=(const UploadChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadChunk& operator=(UploadChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadChunk* internal_default_instance() {
+    return reinterpret_cast<const UploadChunk*>(
+               &_UploadChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(UploadChunk& a, UploadChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadChunk& from) {
+    UploadChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.UploadChunk";
+  }
+  protected:
+  explicit UploadChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUploadIdFieldNumber = 1,
+    kContentFieldNumber = 3,
+    kOffsetFieldNumber = 2,
+    kCrc32CFieldNumber = 4,
+  };
+  // string upload_id = 1;
+  void clear_upload_id();
+  const std::string& upload_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_upload_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_upload_id();
+  PROTOBUF_NODISCARD std::string* release_upload_id();
+  void set_allocated_upload_id(std::string* upload_id);
+  private:
+  const std::string& _internal_upload_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_upload_id(const std::string& value);
+  std::string* _internal_mutable_upload_id();
+  public:
+
+  // bytes content = 3;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // optional fixed32 crc32c = 4;
+  bool has_crc32c() const;
+  private:
+  bool _internal_has_crc32c() const;
+  public:
+  void clear_crc32c();
+  uint32_t crc32c() const;
+  void set_crc32c(uint32_t value);
+  private:
+  uint32_t _internal_crc32c() const;
+  void _internal_set_crc32c(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.UploadChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    uint64_t offset_;
+    uint32_t crc32c_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.UploadQuery) */ {
+ public:
+  inline UploadQuery() : UploadQuery(nullptr) {}
+  ~UploadQuery() override;
+  explicit PROTOBUF_CONSTEXPR UploadQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadQuery(const UploadQuery& from);
+  UploadQuery(UploadQuery&& from) noexcept
+    : UploadQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadQuery& operator=(const UploadQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadQuery& operator=(UploadQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadQuery* internal_default_instance() {
+    return reinterpret_cast<const UploadQuery*>(
+               &_UploadQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(UploadQuery& a, UploadQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadQuery& from) {
+    UploadQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.UploadQuery";
+  }
+  protected:
+  explicit UploadQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUploadIdFieldNumber = 1,
+  };
+  // string upload_id = 1;
+  void clear_upload_id();
+  const std::string& upload_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_upload_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_upload_id();
+  PROTOBUF_NODISCARD std::string* release_upload_id();
+  void set_allocated_upload_id(std::string* upload_id);
+  private:
+  const std::string& _internal_upload_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_upload_id(const std::string& value);
+  std::string* _internal_mutable_upload_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.UploadQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.UploadStatus) */ {
+ public:
+  inline UploadStatus() : UploadStatus(nullptr) {}
+  ~UploadStatus() override;
+  explicit PROTOBUF_CONSTEXPR UploadStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadStatus(const UploadStatus& from);
+  UploadStatus(UploadStatus&& from) noexcept
+    : UploadStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadStatus& operator=(const UploadStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadStatus& operator=(UploadStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadStatus* internal_default_instance() {
+    return reinterpret_cast<const UploadStatus*>(
+               &_UploadStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(UploadStatus& a, UploadStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadStatus& from) {
+    UploadStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.UploadStatus";
+  }
+  protected:
+  explicit UploadStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUploadIdFieldNumber = 1,
+    kStatusMessageFieldNumber = 6,
+    kSha256FieldNumber = 7,
+    kCommittedOffsetFieldNumber = 2,
+    kTotalSizeFieldNumber = 3,
+    kCompleteFieldNumber = 4,
+    kSuccessFieldNumber = 5,
+  };
+  // string upload_id = 1;
+  void clear_upload_id();
+  const std::string& upload_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_upload_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_upload_id();
+  PROTOBUF_NODISCARD std::string* release_upload_id();
+  void set_allocated_upload_id(std::string* upload_id);
+  private:
+  const std::string& _internal_upload_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_upload_id(const std::string& value);
+  std::string* _internal_mutable_upload_id();
+  public:
+
+  // string status_message = 6;
+  void clear_status_message();
+  const std::string& status_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_message();
+  PROTOBUF_NODISCARD std::string* release_status_message();
+  void set_allocated_status_message(std::string* status_message);
+  private:
+  const std::string& _internal_status_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
+  std::string* _internal_mutable_status_message();
+  public:
+
+  // string sha256 = 7;
+  void clear_sha256();
+  const std::string& sha256() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sha256(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sha256();
+  PROTOBUF_NODISCARD std::string* release_sha256();
+  void set_allocated_sha256(std::string* sha256);
+  private:
+  const std::string& _internal_sha256() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sha256(const std::string& value);
+  std::string* _internal_mutable_sha256();
+  public:
+
+  // uint64 committed_offset = 2;
+  void clear_committed_offset();
+  uint64_t committed_offset() const;
+  void set_committed_offset(uint64_t value);
+  private:
+  uint64_t _internal_committed_offset() const;
+  void _internal_set_committed_offset(uint64_t value);
+  public:
+
+  // uint64 total_size = 3;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
+
+  // bool complete = 4;
+  void clear_complete();
+  bool complete() const;
+  void set_complete(bool value);
+  private:
+  bool _internal_complete() const;
+  void _internal_set_complete(bool value);
+  public:
+
+  // bool success = 5;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.UploadStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sha256_;
+    uint64_t committed_offset_;
+    uint64_t total_size_;
+    bool complete_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FetchOutputRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.FetchOutputRequest) */ {
+ public:
+  inline FetchOutputRequest() : FetchOutputRequest(nullptr) {}
+  ~FetchOutputRequest() override;
+  explicit PROTOBUF_CONSTEXPR FetchOutputRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FetchOutputRequest(const FetchOutputRequest& from);
+  FetchOutputRequest(FetchOutputRequest&& from) noexcept
+    : FetchOutputRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FetchOutputRequest& operator=(const FetchOutputRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FetchOutputRequest& operator=(FetchOutputRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FetchOutputRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FetchOutputRequest* internal_default_instance() {
+    return reinterpret_cast<const FetchOutputRequest*>(
+               &_FetchOutputRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(FetchOutputRequest& a, FetchOutputRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FetchOutputRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FetchOutputRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FetchOutputRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FetchOutputRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FetchOutputRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FetchOutputRequest& from) {
+    FetchOutputRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FetchOutputRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.FetchOutputRequest";
+  }
+  protected:
+  explicit FetchOutputRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultHandleFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+    kLengthFieldNumber = 3,
+  };
+  // string result_handle = 1;
+  void clear_result_handle();
+  const std::string& result_handle() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result_handle(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result_handle();
+  PROTOBUF_NODISCARD std::string* release_result_handle();
+  void set_allocated_result_handle(std::string* result_handle);
+  private:
+  const std::string& _internal_result_handle() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_handle(const std::string& value);
+  std::string* _internal_mutable_result_handle();
+  public:
+
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // uint64 length = 3;
+  void clear_length();
+  uint64_t length() const;
+  void set_length(uint64_t value);
+  private:
+  uint64_t _internal_length() const;
+  void _internal_set_length(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.FetchOutputRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_handle_;
+    uint64_t offset_;
+    uint64_t length_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JobOutput final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.JobOutput) */ {
+ public:
+  inline JobOutput() : JobOutput(nullptr) {}
+  ~JobOutput() override;
+  explicit PROTOBUF_CONSTEXPR JobOutput(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JobOutput(const JobOutput& from);
+  JobOutput(JobOutput&& from) noexcept
+    : JobOutput() {
+    *this = ::std::move(from);
+  }
+
+  inline JobOutput& operator=(const JobOutput& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JobOutput& operator=(JobOutput&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobOutput& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JobOutput* internal_default_instance() {
+    return reinterpret_cast<const JobOutput*>(
+               &_JobOutput_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(JobOutput& a, JobOutput& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JobOutput* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobOutput* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JobOutput* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobOutput>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobOutput& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobOutput& from) {
+    JobOutput::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JobOutput* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.JobOutput";
+  }
+  protected:
+  explicit JobOutput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kResultHandleFieldNumber = 2,
+    kOutputSizeFieldNumber = 3,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string result_handle = 2;
+  void clear_result_handle();
+  const std::string& result_handle() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result_handle(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result_handle();
+  PROTOBUF_NODISCARD std::string* release_result_handle();
+  void set_allocated_result_handle(std::string* result_handle);
+  private:
+  const std::string& _internal_result_handle() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_handle(const std::string& value);
+  std::string* _internal_mutable_result_handle();
+  public:
+
+  // uint64 output_size = 3;
+  void clear_output_size();
+  uint64_t output_size() const;
+  void set_output_size(uint64_t value);
+  private:
+  uint64_t _internal_output_size() const;
+  void _internal_set_output_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.JobOutput)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_handle_;
+    uint64_t output_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JobQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.JobQuery) */ {
+ public:
+  inline JobQuery() : JobQuery(nullptr) {}
+  ~JobQuery() override;
+  explicit PROTOBUF_CONSTEXPR JobQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JobQuery(const JobQuery& from);
+  JobQuery(JobQuery&& from) noexcept
+    : JobQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline JobQuery& operator=(const JobQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JobQuery& operator=(JobQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JobQuery* internal_default_instance() {
+    return reinterpret_cast<const JobQuery*>(
+               &_JobQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(JobQuery& a, JobQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JobQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JobQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobQuery& from) {
+    JobQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JobQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.JobQuery";
+  }
+  protected:
+  explicit JobQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+  };
+  // string job_id = 1;
+  void clear_job_id();
+  const std::string& job_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_job_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_job_id();
+  PROTOBUF_NODISCARD std::string* release_job_id();
+  void set_allocated_job_id(std::string* job_id);
+  private:
+  const std::string& _internal_job_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_job_id(const std::string& value);
+  std::string* _internal_mutable_job_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.JobQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr job_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JobStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.JobStatus) */ {
+ public:
+  inline JobStatus() : JobStatus(nullptr) {}
+  ~JobStatus() override;
+  explicit PROTOBUF_CONSTEXPR JobStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JobStatus(const JobStatus& from);
+  JobStatus(JobStatus&& from) noexcept
+    : JobStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline JobStatus& operator=(const JobStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JobStatus& operator=(JobStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JobStatus* internal_default_instance() {
+    return reinterpret_cast<const JobStatus*>(
+               &_JobStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(JobStatus& a, JobStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JobStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JobStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobStatus& from) {
+    JobStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JobStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.JobStatus";
+  }
+  protected:
+  explicit JobStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOutputsFieldNumber = 4,
+    kJobIdFieldNumber = 1,
+    kStatusMessageFieldNumber = 3,
+    kStateFieldNumber = 2,
+  };
+  // repeated .file_processor.JobOutput outputs = 4;
+  int outputs_size() const;
+  private:
+  int _internal_outputs_size() const;
+  public:
+  void clear_outputs();
+  ::file_processor::JobOutput* mutable_outputs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::JobOutput >*
+      mutable_outputs();
+  private:
+  const ::file_processor::JobOutput& _internal_outputs(int index) const;
+  ::file_processor::JobOutput* _internal_add_outputs();
+  public:
+  const ::file_processor::JobOutput& outputs(int index) const;
+  ::file_processor::JobOutput* add_outputs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::JobOutput >&
+      outputs() const;
+
+  // string job_id = 1;
+  void clear_job_id();
+  const std::string& job_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_job_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_job_id();
+  PROTOBUF_NODISCARD std::string* release_job_id();
+  void set_allocated_job_id(std::string* job_id);
+  private:
+  const std::string& _internal_job_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_job_id(const std::string& value);
+  std::string* _internal_mutable_job_id();
+  public:
+
+  // string status_message = 3;
+  void clear_status_message();
+  const std::string& status_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_message();
+  PROTOBUF_NODISCARD std::string* release_status_message();
+  void set_allocated_status_message(std::string* status_message);
+  private:
+  const std::string& _internal_status_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
+  std::string* _internal_mutable_status_message();
+  public:
+
+  // .file_processor.JobState state = 2;
+  void clear_state();
+  ::file_processor::JobState state() const;
+  void set_state(::file_processor::JobState value);
+  private:
+  ::file_processor::JobState _internal_state() const;
+  void _internal_set_state(::file_processor::JobState value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.JobStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::JobOutput > outputs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr job_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
+    int state_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SignatureRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.SignatureRequest) */ {
+ public:
+  inline SignatureRequest() : SignatureRequest(nullptr) {}
+  ~SignatureRequest() override;
+  explicit PROTOBUF_CONSTEXPR SignatureRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SignatureRequest(const SignatureRequest& from);
+  SignatureRequest(SignatureRequest&& from) noexcept
+    : SignatureRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SignatureRequest& operator=(const SignatureRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SignatureRequest& operator=(SignatureRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SignatureRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SignatureRequest* internal_default_instance() {
+    return reinterpret_cast<const SignatureRequest*>(
+               &_SignatureRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(SignatureRequest& a, SignatureRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SignatureRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SignatureRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SignatureRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SignatureRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SignatureRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SignatureRequest& from) {
+    SignatureRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SignatureRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.SignatureRequest";
+  }
+  protected:
+  explicit SignatureRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBasisSha256FieldNumber = 1,
+    kBlockSizeFieldNumber = 2,
+  };
+  // string basis_sha256 = 1;
+  void clear_basis_sha256();
+  const std::string& basis_sha256() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_basis_sha256(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_basis_sha256();
+  PROTOBUF_NODISCARD std::string* release_basis_sha256();
+  void set_allocated_basis_sha256(std::string* basis_sha256);
+  private:
+  const std::string& _internal_basis_sha256() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_basis_sha256(const std::string& value);
+  std::string* _internal_mutable_basis_sha256();
+  public:
+
+  // uint32 block_size = 2;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
+  private:
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.SignatureRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr basis_sha256_;
+    uint32_t block_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BlockSignature final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.BlockSignature) */ {
+ public:
+  inline BlockSignature() : BlockSignature(nullptr) {}
+  ~BlockSignature() override;
+  explicit PROTOBUF_CONSTEXPR BlockSignature(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BlockSignature(const BlockSignature& from);
+  BlockSignature(BlockSignature&& from) noexcept
+    : BlockSignature() {
+    *this = ::std::move(from);
+  }
+
+  inline BlockSignature& operator=(const BlockSignature& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BlockSignature& operator=(BlockSignature&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BlockSignature& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockSignature* internal_default_instance() {
+    return reinterpret_cast<const BlockSignature*>(
+               &_BlockSignature_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(BlockSignature& a, BlockSignature& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BlockSignature* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockSignature* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BlockSignature* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockSignature>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockSignature& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockSignature& from) {
+    BlockSignature::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BlockSignature* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.BlockSignature";
+  }
+  protected:
+  explicit BlockSignature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStrongFieldNumber = 2,
+    kWeakFieldNumber = 1,
+  };
+  // bytes strong = 2;
+  void clear_strong();
+  const std::string& strong() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_strong(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_strong();
+  PROTOBUF_NODISCARD std::string* release_strong();
+  void set_allocated_strong(std::string* strong);
+  private:
+  const std::string& _internal_strong() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_strong(const std::string& value);
+  std::string* _internal_mutable_strong();
+  public:
+
+  // fixed32 weak = 1;
+  void clear_weak();
+  uint32_t weak() const;
+  void set_weak(uint32_t value);
+  private:
+  uint32_t _internal_weak() const;
+  void _internal_set_weak(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.BlockSignature)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr strong_;
+    uint32_t weak_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SignatureBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.SignatureBatch) */ {
+ public:
+  inline SignatureBatch() : SignatureBatch(nullptr) {}
+  ~SignatureBatch() override;
+  explicit PROTOBUF_CONSTEXPR SignatureBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SignatureBatch(const SignatureBatch& from);
+  SignatureBatch(SignatureBatch&& from) noexcept
+    : SignatureBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline SignatureBatch& operator=(const SignatureBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SignatureBatch& operator=(SignatureBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SignatureBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SignatureBatch* internal_default_instance() {
+    return reinterpret_cast<const SignatureBatch*>(
+               &_SignatureBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(SignatureBatch& a, SignatureBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SignatureBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SignatureBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SignatureBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SignatureBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SignatureBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SignatureBatch& from) {
+    SignatureBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SignatureBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.SignatureBatch";
+  }
+  protected:
+  explicit SignatureBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlocksFieldNumber = 5,
+    kStatusMessageFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kBlockSizeFieldNumber = 3,
+    kBasisSizeFieldNumber = 4,
+    kFirstBlockFieldNumber = 6,
+  };
+  // repeated .file_processor.BlockSignature blocks = 5;
+  int blocks_size() const;
+  private:
+  int _internal_blocks_size() const;
+  public:
+  void clear_blocks();
+  ::file_processor::BlockSignature* mutable_blocks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::BlockSignature >*
+      mutable_blocks();
+  private:
+  const ::file_processor::BlockSignature& _internal_blocks(int index) const;
+  ::file_processor::BlockSignature* _internal_add_blocks();
+  public:
+  const ::file_processor::BlockSignature& blocks(int index) const;
+  ::file_processor::BlockSignature* add_blocks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::BlockSignature >&
+      blocks() const;
+
+  // string status_message = 2;
+  void clear_status_message();
+  const std::string& status_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_message();
+  PROTOBUF_NODISCARD std::string* release_status_message();
+  void set_allocated_status_message(std::string* status_message);
+  private:
+  const std::string& _internal_status_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
+  std::string* _internal_mutable_status_message();
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // uint32 block_size = 3;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
+  private:
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
+  public:
+
+  // uint64 basis_size = 4;
+  void clear_basis_size();
+  uint64_t basis_size() const;
+  void set_basis_size(uint64_t value);
+  private:
+  uint64_t _internal_basis_size() const;
+  void _internal_set_basis_size(uint64_t value);
+  public:
+
+  // uint64 first_block = 6;
+  void clear_first_block();
+  uint64_t first_block() const;
+  void set_first_block(uint64_t value);
+  private:
+  uint64_t _internal_first_block() const;
+  void _internal_set_first_block(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.SignatureBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::BlockSignature > blocks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
+    bool success_;
+    uint32_t block_size_;
+    uint64_t basis_size_;
+    uint64_t first_block_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BlockRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.BlockRange) */ {
+ public:
+  inline BlockRange() : BlockRange(nullptr) {}
+  ~BlockRange() override;
+  explicit PROTOBUF_CONSTEXPR BlockRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BlockRange(const BlockRange& from);
+  BlockRange(BlockRange&& from) noexcept
+    : BlockRange() {
+    *this = ::std::move(from);
+  }
+
+  inline BlockRange& operator=(const BlockRange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BlockRange& operator=(BlockRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BlockRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BlockRange* internal_default_instance() {
+    return reinterpret_cast<const BlockRange*>(
+               &_BlockRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(BlockRange& a, BlockRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BlockRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BlockRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BlockRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlockRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlockRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlockRange& from) {
+    BlockRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BlockRange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.BlockRange";
+  }
+  protected:
+  explicit BlockRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstBlockFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // uint64 first_block = 1;
+  void clear_first_block();
+  uint64_t first_block() const;
+  void set_first_block(uint64_t value);
+  private:
+  uint64_t _internal_first_block() const;
+  void _internal_set_first_block(uint64_t value);
+  public:
+
+  // uint32 count = 2;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.BlockRange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t first_block_;
+    uint32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeltaOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.DeltaOp) */ {
+ public:
+  inline DeltaOp() : DeltaOp(nullptr) {}
+  ~DeltaOp() override;
+  explicit PROTOBUF_CONSTEXPR DeltaOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeltaOp(const DeltaOp& from);
+  DeltaOp(DeltaOp&& from) noexcept
+    : DeltaOp() {
+    *this = ::std::move(from);
+  }
+
+  inline DeltaOp& operator=(const DeltaOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeltaOp& operator=(DeltaOp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeltaOp& default_instance() {
+    return *internal_default_instance();
+  }
+  enum OpCase {
+    kLiteral = 1,
+    kCopy = 2,
+    OP_NOT_SET = 0,
+  };
+
+  static inline const DeltaOp* internal_default_instance() {
+    return reinterpret_cast<const DeltaOp*>(
+               &_DeltaOp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(DeltaOp& a, DeltaOp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeltaOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeltaOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeltaOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeltaOp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeltaOp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeltaOp& from) {
+    DeltaOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeltaOp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.DeltaOp";
+  }
+  protected:
+  explicit DeltaOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLiteralFieldNumber = 1,
+    kCopyFieldNumber = 2,
+  };
+  // bytes literal = 1;
+  bool has_literal() const;
+  private:
+  bool _internal_has_literal() const;
+  public:
+  void clear_literal();
+  const std::string& literal() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_literal(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_literal();
+  PROTOBUF_NODISCARD std::string* release_literal();
+  void set_allocated_literal(std::string* literal);
+  private:
+  const std::string& _internal_literal() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_literal(const std::string& value);
+  std::string* _internal_mutable_literal();
+  public:
+
+  // .file_processor.BlockRange copy = 2;
+  bool has_copy() const;
+  private:
+  bool _internal_has_copy() const;
+  public:
+  void clear_copy();
+  const ::file_processor::BlockRange& copy() const;
+  PROTOBUF_NODISCARD ::file_processor::BlockRange* release_copy();
+  ::file_processor::BlockRange* mutable_copy();
+  void set_allocated_copy(::file_processor::BlockRange* copy);
+  private:
+  const ::file_processor::BlockRange& _internal_copy() const;
+  ::file_processor::BlockRange* _internal_mutable_copy();
+  public:
+  void unsafe_arena_set_allocated_copy(
+      ::file_processor::BlockRange* copy);
+  ::file_processor::BlockRange* unsafe_arena_release_copy();
+
+  void clear_op();
+  OpCase op_case() const;
+  // @@protoc_insertion_point(class_scope:file_processor.DeltaOp)
+ private:
+  class _Internal;
+  void set_has_literal();
+  void set_has_copy();
+
+  inline bool has_op() const;
+  inline void clear_has_op();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union OpUnion {
+      constexpr OpUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr literal_;
+      ::file_processor::BlockRange* copy_;
+    } op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeltaChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.DeltaChunk) */ {
+ public:
+  inline DeltaChunk() : DeltaChunk(nullptr) {}
+  ~DeltaChunk() override;
+  explicit PROTOBUF_CONSTEXPR DeltaChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeltaChunk(const DeltaChunk& from);
+  DeltaChunk(DeltaChunk&& from) noexcept
+    : DeltaChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline DeltaChunk& operator=(const DeltaChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeltaChunk& operator=(DeltaChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeltaChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeltaChunk* internal_default_instance() {
+    return reinterpret_cast<const DeltaChunk*>(
+               &_DeltaChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(DeltaChunk& a, DeltaChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeltaChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeltaChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeltaChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeltaChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeltaChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeltaChunk& from) {
+    DeltaChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeltaChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.DeltaChunk";
+  }
+  protected:
+  explicit DeltaChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpsFieldNumber = 6,
+    kBasisSha256FieldNumber = 1,
+    kFileNameFieldNumber = 3,
+    kFileSha256FieldNumber = 5,
+    kTotalSizeFieldNumber = 4,
+    kBlockSizeFieldNumber = 2,
+  };
+  // repeated .file_processor.DeltaOp ops = 6;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::file_processor::DeltaOp* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::DeltaOp >*
+      mutable_ops();
+  private:
+  const ::file_processor::DeltaOp& _internal_ops(int index) const;
+  ::file_processor::DeltaOp* _internal_add_ops();
+  public:
+  const ::file_processor::DeltaOp& ops(int index) const;
+  ::file_processor::DeltaOp* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::DeltaOp >&
+      ops() const;
+
+  // string basis_sha256 = 1;
+  void clear_basis_sha256();
+  const std::string& basis_sha256() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_basis_sha256(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_basis_sha256();
+  PROTOBUF_NODISCARD std::string* release_basis_sha256();
+  void set_allocated_basis_sha256(std::string* basis_sha256);
+  private:
+  const std::string& _internal_basis_sha256() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_basis_sha256(const std::string& value);
+  std::string* _internal_mutable_basis_sha256();
+  public:
+
+  // string file_name = 3;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string file_sha256 = 5;
+  void clear_file_sha256();
+  const std::string& file_sha256() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_sha256(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_sha256();
+  PROTOBUF_NODISCARD std::string* release_file_sha256();
+  void set_allocated_file_sha256(std::string* file_sha256);
+  private:
+  const std::string& _internal_file_sha256() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_sha256(const std::string& value);
+  std::string* _internal_mutable_file_sha256();
+  public:
+
+  // uint64 total_size = 4;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
+
+  // uint32 block_size = 2;
+  void clear_block_size();
+  uint32_t block_size() const;
+  void set_block_size(uint32_t value);
+  private:
+  uint32_t _internal_block_size() const;
+  void _internal_set_block_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.DeltaChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::DeltaOp > ops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr basis_sha256_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_sha256_;
+    uint64_t total_size_;
+    uint32_t block_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.LatencyQuery) */ {
+ public:
+  inline LatencyQuery() : LatencyQuery(nullptr) {}
+  ~LatencyQuery() override;
+  explicit PROTOBUF_CONSTEXPR LatencyQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyQuery(const LatencyQuery& from);
+  LatencyQuery(LatencyQuery&& from) noexcept
+    : LatencyQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyQuery& operator=(const LatencyQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyQuery& operator=(LatencyQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyQuery* internal_default_instance() {
+    return reinterpret_cast<const LatencyQuery*>(
+               &_LatencyQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(LatencyQuery& a, LatencyQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyQuery& from) {
+    LatencyQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.LatencyQuery";
+  }
+  protected:
+  explicit LatencyQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+  };
+  // string operation = 1;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.LatencyQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencySeries final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.LatencySeries) */ {
+ public:
+  inline LatencySeries() : LatencySeries(nullptr) {}
+  ~LatencySeries() override;
+  explicit PROTOBUF_CONSTEXPR LatencySeries(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencySeries(const LatencySeries& from);
+  LatencySeries(LatencySeries&& from) noexcept
+    : LatencySeries() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencySeries& operator=(const LatencySeries& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencySeries& operator=(LatencySeries&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencySeries& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencySeries* internal_default_instance() {
+    return reinterpret_cast<const LatencySeries*>(
+               &_LatencySeries_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(LatencySeries& a, LatencySeries& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencySeries* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencySeries* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencySeries* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencySeries>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencySeries& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencySeries& from) {
+    LatencySeries::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencySeries* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.LatencySeries";
+  }
+  protected:
+  explicit LatencySeries(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+    kPhaseFieldNumber = 3,
+    kCountFieldNumber = 4,
+    kSumUsFieldNumber = 5,
+    kMaxUsFieldNumber = 6,
+    kP50UsFieldNumber = 7,
+    kP90UsFieldNumber = 8,
+    kP99UsFieldNumber = 9,
+    kP999UsFieldNumber = 10,
+    kSuccessFieldNumber = 2,
+  };
+  // string operation = 1;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // string phase = 3;
+  void clear_phase();
+  const std::string& phase() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phase(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phase();
+  PROTOBUF_NODISCARD std::string* release_phase();
+  void set_allocated_phase(std::string* phase);
+  private:
+  const std::string& _internal_phase() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phase(const std::string& value);
+  std::string* _internal_mutable_phase();
+  public:
+
+  // uint64 count = 4;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 sum_us = 5;
+  void clear_sum_us();
+  uint64_t sum_us() const;
+  void set_sum_us(uint64_t value);
+  private:
+  uint64_t _internal_sum_us() const;
+  void _internal_set_sum_us(uint64_t value);
+  public:
+
+  // uint64 max_us = 6;
+  void clear_max_us();
+  uint64_t max_us() const;
+  void set_max_us(uint64_t value);
+  private:
+  uint64_t _internal_max_us() const;
+  void _internal_set_max_us(uint64_t value);
+  public:
+
+  // uint64 p50_us = 7;
+  void clear_p50_us();
+  uint64_t p50_us() const;
+  void set_p50_us(uint64_t value);
+  private:
+  uint64_t _internal_p50_us() const;
+  void _internal_set_p50_us(uint64_t value);
+  public:
+
+  // uint64 p90_us = 8;
+  void clear_p90_us();
+  uint64_t p90_us() const;
+  void set_p90_us(uint64_t value);
+  private:
+  uint64_t _internal_p90_us() const;
+  void _internal_set_p90_us(uint64_t value);
+  public:
+
+  // uint64 p99_us = 9;
+  void clear_p99_us();
+  uint64_t p99_us() const;
+  void set_p99_us(uint64_t value);
+  private:
+  uint64_t _internal_p99_us() const;
+  void _internal_set_p99_us(uint64_t value);
+  public:
+
+  // uint64 p999_us = 10;
+  void clear_p999_us();
+  uint64_t p999_us() const;
+  void set_p999_us(uint64_t value);
+  private:
+  uint64_t _internal_p999_us() const;
+  void _internal_set_p999_us(uint64_t value);
+  public:
+
+  // bool success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.LatencySeries)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phase_;
+    uint64_t count_;
+    uint64_t sum_us_;
+    uint64_t max_us_;
+    uint64_t p50_us_;
+    uint64_t p90_us_;
+    uint64_t p99_us_;
+    uint64_t p999_us_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyReport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.LatencyReport) */ {
+ public:
+  inline LatencyReport() : LatencyReport(nullptr) {}
+  ~LatencyReport() override;
+  explicit PROTOBUF_CONSTEXPR LatencyReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyReport(const LatencyReport& from);
+  LatencyReport(LatencyReport&& from) noexcept
+    : LatencyReport() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyReport& operator=(const LatencyReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyReport& operator=(LatencyReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyReport* internal_default_instance() {
+    return reinterpret_cast<const LatencyReport*>(
+               &_LatencyReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(LatencyReport& a, LatencyReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyReport>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyReport& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyReport& from) {
+    LatencyReport::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.LatencyReport";
+  }
+  protected:
+  explicit LatencyReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeriesFieldNumber = 1,
+  };
+  // repeated .file_processor.LatencySeries series = 1;
+  int series_size() const;
+  private:
+  int _internal_series_size() const;
+  public:
+  void clear_series();
+  ::file_processor::LatencySeries* mutable_series(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::LatencySeries >*
+      mutable_series();
+  private:
+  const ::file_processor::LatencySeries& _internal_series(int index) const;
+  ::file_processor::LatencySeries* _internal_add_series();
+  public:
+  const ::file_processor::LatencySeries& series(int index) const;
+  ::file_processor::LatencySeries* add_series();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::LatencySeries >&
+      series() const;
+
+  // @@protoc_insertion_point(class_scope:file_processor.LatencyReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::LatencySeries > series_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStateQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:file_processor.ServerStateQuery) */ {
+ public:
+  inline ServerStateQuery() : ServerStateQuery(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ServerStateQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStateQuery(const ServerStateQuery& from);
+  ServerStateQuery(ServerStateQuery&& from) noexcept
+    : ServerStateQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStateQuery& operator=(const ServerStateQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStateQuery& operator=(ServerStateQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStateQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStateQuery* internal_default_instance() {
+    return reinterpret_cast<const ServerStateQuery*>(
+               &_ServerStateQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(ServerStateQuery& a, ServerStateQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStateQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStateQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStateQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStateQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ServerStateQuery& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ServerStateQuery& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.ServerStateQuery";
+  }
+  protected:
+  explicit ServerStateQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:file_processor.ServerStateQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ActiveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.ActiveRequest) */ {
+ public:
+  inline ActiveRequest() : ActiveRequest(nullptr) {}
+  ~ActiveRequest() override;
+  explicit PROTOBUF_CONSTEXPR ActiveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ActiveRequest(const ActiveRequest& from);
+  ActiveRequest(ActiveRequest&& from) noexcept
+    : ActiveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ActiveRequest& operator=(const ActiveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ActiveRequest& operator=(ActiveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ActiveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ActiveRequest* internal_default_instance() {
+    return reinterpret_cast<const ActiveRequest*>(
+               &_ActiveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(ActiveRequest& a, ActiveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ActiveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ActiveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ActiveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ActiveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ActiveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ActiveRequest& from) {
+    ActiveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ActiveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.ActiveRequest";
+  }
+  protected:
+  explicit ActiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRpcFieldNumber = 2,
+    kOperationFieldNumber = 3,
+    kFileNameFieldNumber = 4,
+    kPhaseFieldNumber = 5,
+    kChildToolFieldNumber = 11,
+    kPeerFieldNumber = 12,
+    kTraceIdFieldNumber = 13,
+    kIdFieldNumber = 1,
+    kElapsedUsFieldNumber = 6,
+    kPhaseElapsedUsFieldNumber = 7,
+    kBytesReceivedFieldNumber = 8,
+    kBytesSentFieldNumber = 9,
+    kChildPidFieldNumber = 10,
+  };
+  // string rpc = 2;
+  void clear_rpc();
+  const std::string& rpc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rpc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rpc();
+  PROTOBUF_NODISCARD std::string* release_rpc();
+  void set_allocated_rpc(std::string* rpc);
+  private:
+  const std::string& _internal_rpc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rpc(const std::string& value);
+  std::string* _internal_mutable_rpc();
+  public:
+
+  // string operation = 3;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // string file_name = 4;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string phase = 5;
+  void clear_phase();
+  const std::string& phase() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phase(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phase();
+  PROTOBUF_NODISCARD std::string* release_phase();
+  void set_allocated_phase(std::string* phase);
+  private:
+  const std::string& _internal_phase() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phase(const std::string& value);
+  std::string* _internal_mutable_phase();
+  public:
+
+  // string child_tool = 11;
+  void clear_child_tool();
+  const std::string& child_tool() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_child_tool(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_child_tool();
+  PROTOBUF_NODISCARD std::string* release_child_tool();
+  void set_allocated_child_tool(std::string* child_tool);
+  private:
+  const std::string& _internal_child_tool() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_child_tool(const std::string& value);
+  std::string* _internal_mutable_child_tool();
+  public:
+
+  // string peer = 12;
+  void clear_peer();
+  const std::string& peer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_peer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_peer();
+  PROTOBUF_NODISCARD std::string* release_peer();
+  void set_allocated_peer(std::string* peer);
+  private:
+  const std::string& _internal_peer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer(const std::string& value);
+  std::string* _internal_mutable_peer();
+  public:
+
+  // string trace_id = 13;
+  void clear_trace_id();
+  const std::string& trace_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_trace_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_trace_id();
+  PROTOBUF_NODISCARD std::string* release_trace_id();
+  void set_allocated_trace_id(std::string* trace_id);
+  private:
+  const std::string& _internal_trace_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_trace_id(const std::string& value);
+  std::string* _internal_mutable_trace_id();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 elapsed_us = 6;
+  void clear_elapsed_us();
+  uint64_t elapsed_us() const;
+  void set_elapsed_us(uint64_t value);
+  private:
+  uint64_t _internal_elapsed_us() const;
+  void _internal_set_elapsed_us(uint64_t value);
+  public:
+
+  // uint64 phase_elapsed_us = 7;
+  void clear_phase_elapsed_us();
+  uint64_t phase_elapsed_us() const;
+  void set_phase_elapsed_us(uint64_t value);
+  private:
+  uint64_t _internal_phase_elapsed_us() const;
+  void _internal_set_phase_elapsed_us(uint64_t value);
+  public:
+
+  // uint64 bytes_received = 8;
+  void clear_bytes_received();
+  uint64_t bytes_received() const;
+  void set_bytes_received(uint64_t value);
+  private:
+  uint64_t _internal_bytes_received() const;
+  void _internal_set_bytes_received(uint64_t value);
+  public:
+
+  // uint64 bytes_sent = 9;
+  void clear_bytes_sent();
+  uint64_t bytes_sent() const;
+  void set_bytes_sent(uint64_t value);
+  private:
+  uint64_t _internal_bytes_sent() const;
+  void _internal_set_bytes_sent(uint64_t value);
+  public:
+
+  // int32 child_pid = 10;
+  void clear_child_pid();
+  int32_t child_pid() const;
+  void set_child_pid(int32_t value);
+  private:
+  int32_t _internal_child_pid() const;
+  void _internal_set_child_pid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.ActiveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rpc_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phase_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr child_tool_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr trace_id_;
+    uint64_t id_;
+    uint64_t elapsed_us_;
+    uint64_t phase_elapsed_us_;
+    uint64_t bytes_received_;
+    uint64_t bytes_sent_;
+    int32_t child_pid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.ServerState) */ {
+ public:
+  inline ServerState() : ServerState(nullptr) {}
+  ~ServerState() override;
+  explicit PROTOBUF_CONSTEXPR ServerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerState(const ServerState& from);
+  ServerState(ServerState&& from) noexcept
+    : ServerState() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerState& operator=(const ServerState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerState& operator=(ServerState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerState* internal_default_instance() {
+    return reinterpret_cast<const ServerState*>(
+               &_ServerState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(ServerState& a, ServerState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerState& from) {
+    ServerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.ServerState";
+  }
+  protected:
+  explicit ServerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+    kWorkerThreadsFieldNumber = 2,
+    kWorkerActiveFieldNumber = 3,
+    kWorkerQueuedFieldNumber = 4,
+    kJobsQueuedFieldNumber = 5,
+    kIngestBufferBytesFieldNumber = 7,
+    kUptimeSFieldNumber = 8,
+    kJobsRunningFieldNumber = 6,
+  };
+  // repeated .file_processor.ActiveRequest requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::file_processor::ActiveRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ActiveRequest >*
+      mutable_requests();
+  private:
+  const ::file_processor::ActiveRequest& _internal_requests(int index) const;
+  ::file_processor::ActiveRequest* _internal_add_requests();
+  public:
+  const ::file_processor::ActiveRequest& requests(int index) const;
+  ::file_processor::ActiveRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ActiveRequest >&
+      requests() const;
+
+  // uint32 worker_threads = 2;
+  void clear_worker_threads();
+  uint32_t worker_threads() const;
+  void set_worker_threads(uint32_t value);
+  private:
+  uint32_t _internal_worker_threads() const;
+  void _internal_set_worker_threads(uint32_t value);
+  public:
+
+  // uint32 worker_active = 3;
+  void clear_worker_active();
+  uint32_t worker_active() const;
+  void set_worker_active(uint32_t value);
+  private:
+  uint32_t _internal_worker_active() const;
+  void _internal_set_worker_active(uint32_t value);
+  public:
+
+  // uint32 worker_queued = 4;
+  void clear_worker_queued();
+  uint32_t worker_queued() const;
+  void set_worker_queued(uint32_t value);
+  private:
+  uint32_t _internal_worker_queued() const;
+  void _internal_set_worker_queued(uint32_t value);
+  public:
+
+  // uint32 jobs_queued = 5;
+  void clear_jobs_queued();
+  uint32_t jobs_queued() const;
+  void set_jobs_queued(uint32_t value);
+  private:
+  uint32_t _internal_jobs_queued() const;
+  void _internal_set_jobs_queued(uint32_t value);
+  public:
+
+  // uint64 ingest_buffer_bytes = 7;
+  void clear_ingest_buffer_bytes();
+  uint64_t ingest_buffer_bytes() const;
+  void set_ingest_buffer_bytes(uint64_t value);
+  private:
+  uint64_t _internal_ingest_buffer_bytes() const;
+  void _internal_set_ingest_buffer_bytes(uint64_t value);
+  public:
+
+  // uint64 uptime_s = 8;
+  void clear_uptime_s();
+  uint64_t uptime_s() const;
+  void set_uptime_s(uint64_t value);
+  private:
+  uint64_t _internal_uptime_s() const;
+  void _internal_set_uptime_s(uint64_t value);
+  public:
+
+  // uint32 jobs_running = 6;
+  void clear_jobs_running();
+  uint32_t jobs_running() const;
+  void set_jobs_running(uint32_t value);
+  private:
+  uint32_t _internal_jobs_running() const;
+  void _internal_set_jobs_running(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.ServerState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ActiveRequest > requests_;
+    uint32_t worker_threads_;
+    uint32_t worker_active_;
+    uint32_t worker_queued_;
+    uint32_t jobs_queued_;
+    uint64_t ingest_buffer_bytes_;
+    uint64_t uptime_s_;
+    uint32_t jobs_running_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JobRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:file_processor.JobRecord) */ {
+ public:
+  inline JobRecord() : JobRecord(nullptr) {}
+  ~JobRecord() override;
+  explicit PROTOBUF_CONSTEXPR JobRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JobRecord(const JobRecord& from);
+  JobRecord(JobRecord&& from) noexcept
+    : JobRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline JobRecord& operator=(const JobRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JobRecord& operator=(JobRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JobRecord* internal_default_instance() {
+    return reinterpret_cast<const JobRecord*>(
+               &_JobRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(JobRecord& a, JobRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JobRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JobRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobRecord& from) {
+    JobRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JobRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "file_processor.JobRecord";
+  }
+  protected:
+  explicit JobRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusFieldNumber = 1,
+    kRequestFieldNumber = 2,
+    kSubmittedAtFieldNumber = 3,
+    kInputSizeFieldNumber = 4,
+  };
+  // .file_processor.JobStatus status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const ::file_processor::JobStatus& status() const;
+  PROTOBUF_NODISCARD ::file_processor::JobStatus* release_status();
+  ::file_processor::JobStatus* mutable_status();
+  void set_allocated_status(::file_processor::JobStatus* status);
+  private:
+  const ::file_processor::JobStatus& _internal_status() const;
+  ::file_processor::JobStatus* _internal_mutable_status();
+  public:
+  void unsafe_arena_set_allocated_status(
+      ::file_processor::JobStatus* status);
+  ::file_processor::JobStatus* unsafe_arena_release_status();
+
+  // .file_processor.FileRequest request = 2;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::file_processor::FileRequest& request() const;
+  PROTOBUF_NODISCARD ::file_processor::FileRequest* release_request();
+  ::file_processor::FileRequest* mutable_request();
+  void set_allocated_request(::file_processor::FileRequest* request);
+  private:
+  const ::file_processor::FileRequest& _internal_request() const;
+  ::file_processor::FileRequest* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::file_processor::FileRequest* request);
+  ::file_processor::FileRequest* unsafe_arena_release_request();
+
+  // int64 submitted_at = 3;
+  void clear_submitted_at();
+  int64_t submitted_at() const;
+  void set_submitted_at(int64_t value);
+  private:
+  int64_t _internal_submitted_at() const;
+  void _internal_set_submitted_at(int64_t value);
+  public:
+
+  // uint64 input_size = 4;
+  void clear_input_size();
+  uint64_t input_size() const;
+  void set_input_size(uint64_t value);
+  private:
+  uint64_t _internal_input_size() const;
+  void _internal_set_input_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:file_processor.JobRecord)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::file_processor::JobStatus* status_;
+    ::file_processor::FileRequest* request_;
+    int64_t submitted_at_;
+    uint64_t input_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_file_5fprocessor_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// FileChunk
+
+// bytes content = 1;
+inline void FileChunk::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& FileChunk::content() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileChunk.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileChunk::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileChunk.content)
+}
+inline std::string* FileChunk::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileChunk.content)
+  return _s;
+}
+inline const std::string& FileChunk::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void FileChunk::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileChunk::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileChunk::release_content() {
+  // @@protoc_insertion_point(field_release:file_processor.FileChunk.content)
+  return _impl_.content_.Release();
+}
+inline void FileChunk::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileChunk.content)
+}
+
+// optional fixed32 crc32c = 2;
+inline bool FileChunk::_internal_has_crc32c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FileChunk::has_crc32c() const {
+  return _internal_has_crc32c();
+}
+inline void FileChunk::clear_crc32c() {
+  _impl_.crc32c_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t FileChunk::_internal_crc32c() const {
+  return _impl_.crc32c_;
+}
+inline uint32_t FileChunk::crc32c() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileChunk.crc32c)
+  return _internal_crc32c();
+}
+inline void FileChunk::_internal_set_crc32c(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.crc32c_ = value;
+}
+inline void FileChunk::set_crc32c(uint32_t value) {
+  _internal_set_crc32c(value);
+  // @@protoc_insertion_point(field_set:file_processor.FileChunk.crc32c)
+}
+
+// -------------------------------------------------------------------
+
+// FileRequest
+
+// string file_name = 1;
+inline void FileRequest::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& FileRequest::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileRequest::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileRequest.file_name)
+}
+inline std::string* FileRequest::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.file_name)
+  return _s;
+}
+inline const std::string& FileRequest::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void FileRequest::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileRequest::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileRequest::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void FileRequest::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.file_name)
+}
+
+// .file_processor.FileChunk file_content = 2;
+inline bool FileRequest::_internal_has_file_content() const {
+  return this != internal_default_instance() && _impl_.file_content_ != nullptr;
+}
+inline bool FileRequest::has_file_content() const {
+  return _internal_has_file_content();
+}
+inline void FileRequest::clear_file_content() {
+  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
+    delete _impl_.file_content_;
+  }
+  _impl_.file_content_ = nullptr;
+}
+inline const ::file_processor::FileChunk& FileRequest::_internal_file_content() const {
+  const ::file_processor::FileChunk* p = _impl_.file_content_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileChunk&>(
+      ::file_processor::_FileChunk_default_instance_);
+}
+inline const ::file_processor::FileChunk& FileRequest::file_content() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.file_content)
+  return _internal_file_content();
+}
+inline void FileRequest::unsafe_arena_set_allocated_file_content(
+    ::file_processor::FileChunk* file_content) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_content_);
+  }
+  _impl_.file_content_ = file_content;
+  if (file_content) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.file_content)
+}
+inline ::file_processor::FileChunk* FileRequest::release_file_content() {
+  
+  ::file_processor::FileChunk* temp = _impl_.file_content_;
+  _impl_.file_content_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::file_processor::FileChunk* FileRequest::unsafe_arena_release_file_content() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.file_content)
+  
+  ::file_processor::FileChunk* temp = _impl_.file_content_;
+  _impl_.file_content_ = nullptr;
+  return temp;
+}
+inline ::file_processor::FileChunk* FileRequest::_internal_mutable_file_content() {
+  
+  if (_impl_.file_content_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::FileChunk>(GetArenaForAllocation());
+    _impl_.file_content_ = p;
+  }
+  return _impl_.file_content_;
+}
+inline ::file_processor::FileChunk* FileRequest::mutable_file_content() {
+  ::file_processor::FileChunk* _msg = _internal_mutable_file_content();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.file_content)
+  return _msg;
+}
+inline void FileRequest::set_allocated_file_content(::file_processor::FileChunk* file_content) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.file_content_;
+  }
+  if (file_content) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_content);
+    if (message_arena != submessage_arena) {
+      file_content = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, file_content, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.file_content_ = file_content;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.file_content)
+}
+
+// .file_processor.CompressPDFRequest compress_pdf_params = 3;
+inline bool FileRequest::_internal_has_compress_pdf_params() const {
+  return parameters_case() == kCompressPdfParams;
+}
+inline bool FileRequest::has_compress_pdf_params() const {
+  return _internal_has_compress_pdf_params();
+}
+inline void FileRequest::set_has_compress_pdf_params() {
+  _impl_._oneof_case_[0] = kCompressPdfParams;
+}
+inline void FileRequest::clear_compress_pdf_params() {
+  if (_internal_has_compress_pdf_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.compress_pdf_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::CompressPDFRequest* FileRequest::release_compress_pdf_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.compress_pdf_params)
+  if (_internal_has_compress_pdf_params()) {
+    clear_has_parameters();
+    ::file_processor::CompressPDFRequest* temp = _impl_.parameters_.compress_pdf_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.compress_pdf_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::CompressPDFRequest& FileRequest::_internal_compress_pdf_params() const {
+  return _internal_has_compress_pdf_params()
+      ? *_impl_.parameters_.compress_pdf_params_
+      : reinterpret_cast< ::file_processor::CompressPDFRequest&>(::file_processor::_CompressPDFRequest_default_instance_);
+}
+inline const ::file_processor::CompressPDFRequest& FileRequest::compress_pdf_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.compress_pdf_params)
+  return _internal_compress_pdf_params();
+}
+inline ::file_processor::CompressPDFRequest* FileRequest::unsafe_arena_release_compress_pdf_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.compress_pdf_params)
+  if (_internal_has_compress_pdf_params()) {
+    clear_has_parameters();
+    ::file_processor::CompressPDFRequest* temp = _impl_.parameters_.compress_pdf_params_;
+    _impl_.parameters_.compress_pdf_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_compress_pdf_params(::file_processor::CompressPDFRequest* compress_pdf_params) {
+  clear_parameters();
+  if (compress_pdf_params) {
+    set_has_compress_pdf_params();
+    _impl_.parameters_.compress_pdf_params_ = compress_pdf_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.compress_pdf_params)
+}
+inline ::file_processor::CompressPDFRequest* FileRequest::_internal_mutable_compress_pdf_params() {
+  if (!_internal_has_compress_pdf_params()) {
+    clear_parameters();
+    set_has_compress_pdf_params();
+    _impl_.parameters_.compress_pdf_params_ = CreateMaybeMessage< ::file_processor::CompressPDFRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.compress_pdf_params_;
+}
+inline ::file_processor::CompressPDFRequest* FileRequest::mutable_compress_pdf_params() {
+  ::file_processor::CompressPDFRequest* _msg = _internal_mutable_compress_pdf_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.compress_pdf_params)
+  return _msg;
+}
+
+// .file_processor.ConvertToTXTRequest convert_to_txt_params = 4;
+inline bool FileRequest::_internal_has_convert_to_txt_params() const {
+  return parameters_case() == kConvertToTxtParams;
+}
+inline bool FileRequest::has_convert_to_txt_params() const {
+  return _internal_has_convert_to_txt_params();
+}
+inline void FileRequest::set_has_convert_to_txt_params() {
+  _impl_._oneof_case_[0] = kConvertToTxtParams;
+}
+inline void FileRequest::clear_convert_to_txt_params() {
+  if (_internal_has_convert_to_txt_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.convert_to_txt_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::ConvertToTXTRequest* FileRequest::release_convert_to_txt_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.convert_to_txt_params)
+  if (_internal_has_convert_to_txt_params()) {
+    clear_has_parameters();
+    ::file_processor::ConvertToTXTRequest* temp = _impl_.parameters_.convert_to_txt_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.convert_to_txt_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ConvertToTXTRequest& FileRequest::_internal_convert_to_txt_params() const {
+  return _internal_has_convert_to_txt_params()
+      ? *_impl_.parameters_.convert_to_txt_params_
+      : reinterpret_cast< ::file_processor::ConvertToTXTRequest&>(::file_processor::_ConvertToTXTRequest_default_instance_);
+}
+inline const ::file_processor::ConvertToTXTRequest& FileRequest::convert_to_txt_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.convert_to_txt_params)
+  return _internal_convert_to_txt_params();
+}
+inline ::file_processor::ConvertToTXTRequest* FileRequest::unsafe_arena_release_convert_to_txt_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.convert_to_txt_params)
+  if (_internal_has_convert_to_txt_params()) {
+    clear_has_parameters();
+    ::file_processor::ConvertToTXTRequest* temp = _impl_.parameters_.convert_to_txt_params_;
+    _impl_.parameters_.convert_to_txt_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_convert_to_txt_params(::file_processor::ConvertToTXTRequest* convert_to_txt_params) {
+  clear_parameters();
+  if (convert_to_txt_params) {
+    set_has_convert_to_txt_params();
+    _impl_.parameters_.convert_to_txt_params_ = convert_to_txt_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.convert_to_txt_params)
+}
+inline ::file_processor::ConvertToTXTRequest* FileRequest::_internal_mutable_convert_to_txt_params() {
+  if (!_internal_has_convert_to_txt_params()) {
+    clear_parameters();
+    set_has_convert_to_txt_params();
+    _impl_.parameters_.convert_to_txt_params_ = CreateMaybeMessage< ::file_processor::ConvertToTXTRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.convert_to_txt_params_;
+}
+inline ::file_processor::ConvertToTXTRequest* FileRequest::mutable_convert_to_txt_params() {
+  ::file_processor::ConvertToTXTRequest* _msg = _internal_mutable_convert_to_txt_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.convert_to_txt_params)
+  return _msg;
+}
+
+// .file_processor.ConvertImageFormatRequest convert_image_format_params = 5;
+inline bool FileRequest::_internal_has_convert_image_format_params() const {
+  return parameters_case() == kConvertImageFormatParams;
+}
+inline bool FileRequest::has_convert_image_format_params() const {
+  return _internal_has_convert_image_format_params();
+}
+inline void FileRequest::set_has_convert_image_format_params() {
+  _impl_._oneof_case_[0] = kConvertImageFormatParams;
+}
+inline void FileRequest::clear_convert_image_format_params() {
+  if (_internal_has_convert_image_format_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.convert_image_format_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::ConvertImageFormatRequest* FileRequest::release_convert_image_format_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.convert_image_format_params)
+  if (_internal_has_convert_image_format_params()) {
+    clear_has_parameters();
+    ::file_processor::ConvertImageFormatRequest* temp = _impl_.parameters_.convert_image_format_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.convert_image_format_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ConvertImageFormatRequest& FileRequest::_internal_convert_image_format_params() const {
+  return _internal_has_convert_image_format_params()
+      ? *_impl_.parameters_.convert_image_format_params_
+      : reinterpret_cast< ::file_processor::ConvertImageFormatRequest&>(::file_processor::_ConvertImageFormatRequest_default_instance_);
+}
+inline const ::file_processor::ConvertImageFormatRequest& FileRequest::convert_image_format_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.convert_image_format_params)
+  return _internal_convert_image_format_params();
+}
+inline ::file_processor::ConvertImageFormatRequest* FileRequest::unsafe_arena_release_convert_image_format_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.convert_image_format_params)
+  if (_internal_has_convert_image_format_params()) {
+    clear_has_parameters();
+    ::file_processor::ConvertImageFormatRequest* temp = _impl_.parameters_.convert_image_format_params_;
+    _impl_.parameters_.convert_image_format_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_convert_image_format_params(::file_processor::ConvertImageFormatRequest* convert_image_format_params) {
+  clear_parameters();
+  if (convert_image_format_params) {
+    set_has_convert_image_format_params();
+    _impl_.parameters_.convert_image_format_params_ = convert_image_format_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.convert_image_format_params)
+}
+inline ::file_processor::ConvertImageFormatRequest* FileRequest::_internal_mutable_convert_image_format_params() {
+  if (!_internal_has_convert_image_format_params()) {
+    clear_parameters();
+    set_has_convert_image_format_params();
+    _impl_.parameters_.convert_image_format_params_ = CreateMaybeMessage< ::file_processor::ConvertImageFormatRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.convert_image_format_params_;
+}
+inline ::file_processor::ConvertImageFormatRequest* FileRequest::mutable_convert_image_format_params() {
+  ::file_processor::ConvertImageFormatRequest* _msg = _internal_mutable_convert_image_format_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.convert_image_format_params)
+  return _msg;
+}
+
+// .file_processor.ResizeImageRequest resize_image_params = 6;
+inline bool FileRequest::_internal_has_resize_image_params() const {
+  return parameters_case() == kResizeImageParams;
+}
+inline bool FileRequest::has_resize_image_params() const {
+  return _internal_has_resize_image_params();
+}
+inline void FileRequest::set_has_resize_image_params() {
+  _impl_._oneof_case_[0] = kResizeImageParams;
+}
+inline void FileRequest::clear_resize_image_params() {
+  if (_internal_has_resize_image_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.resize_image_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::ResizeImageRequest* FileRequest::release_resize_image_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.resize_image_params)
+  if (_internal_has_resize_image_params()) {
+    clear_has_parameters();
+    ::file_processor::ResizeImageRequest* temp = _impl_.parameters_.resize_image_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.resize_image_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ResizeImageRequest& FileRequest::_internal_resize_image_params() const {
+  return _internal_has_resize_image_params()
+      ? *_impl_.parameters_.resize_image_params_
+      : reinterpret_cast< ::file_processor::ResizeImageRequest&>(::file_processor::_ResizeImageRequest_default_instance_);
+}
+inline const ::file_processor::ResizeImageRequest& FileRequest::resize_image_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.resize_image_params)
+  return _internal_resize_image_params();
+}
+inline ::file_processor::ResizeImageRequest* FileRequest::unsafe_arena_release_resize_image_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.resize_image_params)
+  if (_internal_has_resize_image_params()) {
+    clear_has_parameters();
+    ::file_processor::ResizeImageRequest* temp = _impl_.parameters_.resize_image_params_;
+    _impl_.parameters_.resize_image_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_resize_image_params(::file_processor::ResizeImageRequest* resize_image_params) {
+  clear_parameters();
+  if (resize_image_params) {
+    set_has_resize_image_params();
+    _impl_.parameters_.resize_image_params_ = resize_image_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.resize_image_params)
+}
+inline ::file_processor::ResizeImageRequest* FileRequest::_internal_mutable_resize_image_params() {
+  if (!_internal_has_resize_image_params()) {
+    clear_parameters();
+    set_has_resize_image_params();
+    _impl_.parameters_.resize_image_params_ = CreateMaybeMessage< ::file_processor::ResizeImageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.resize_image_params_;
+}
+inline ::file_processor::ResizeImageRequest* FileRequest::mutable_resize_image_params() {
+  ::file_processor::ResizeImageRequest* _msg = _internal_mutable_resize_image_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.resize_image_params)
+  return _msg;
+}
+
+// .file_processor.ResizeImageMultiRequest resize_image_multi_params = 7;
+inline bool FileRequest::_internal_has_resize_image_multi_params() const {
+  return parameters_case() == kResizeImageMultiParams;
+}
+inline bool FileRequest::has_resize_image_multi_params() const {
+  return _internal_has_resize_image_multi_params();
+}
+inline void FileRequest::set_has_resize_image_multi_params() {
+  _impl_._oneof_case_[0] = kResizeImageMultiParams;
+}
+inline void FileRequest::clear_resize_image_multi_params() {
+  if (_internal_has_resize_image_multi_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.resize_image_multi_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::ResizeImageMultiRequest* FileRequest::release_resize_image_multi_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.resize_image_multi_params)
+  if (_internal_has_resize_image_multi_params()) {
+    clear_has_parameters();
+    ::file_processor::ResizeImageMultiRequest* temp = _impl_.parameters_.resize_image_multi_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.resize_image_multi_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ResizeImageMultiRequest& FileRequest::_internal_resize_image_multi_params() const {
+  return _internal_has_resize_image_multi_params()
+      ? *_impl_.parameters_.resize_image_multi_params_
+      : reinterpret_cast< ::file_processor::ResizeImageMultiRequest&>(::file_processor::_ResizeImageMultiRequest_default_instance_);
+}
+inline const ::file_processor::ResizeImageMultiRequest& FileRequest::resize_image_multi_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.resize_image_multi_params)
+  return _internal_resize_image_multi_params();
+}
+inline ::file_processor::ResizeImageMultiRequest* FileRequest::unsafe_arena_release_resize_image_multi_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.resize_image_multi_params)
+  if (_internal_has_resize_image_multi_params()) {
+    clear_has_parameters();
+    ::file_processor::ResizeImageMultiRequest* temp = _impl_.parameters_.resize_image_multi_params_;
+    _impl_.parameters_.resize_image_multi_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_resize_image_multi_params(::file_processor::ResizeImageMultiRequest* resize_image_multi_params) {
+  clear_parameters();
+  if (resize_image_multi_params) {
+    set_has_resize_image_multi_params();
+    _impl_.parameters_.resize_image_multi_params_ = resize_image_multi_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.resize_image_multi_params)
+}
+inline ::file_processor::ResizeImageMultiRequest* FileRequest::_internal_mutable_resize_image_multi_params() {
+  if (!_internal_has_resize_image_multi_params()) {
+    clear_parameters();
+    set_has_resize_image_multi_params();
+    _impl_.parameters_.resize_image_multi_params_ = CreateMaybeMessage< ::file_processor::ResizeImageMultiRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.resize_image_multi_params_;
+}
+inline ::file_processor::ResizeImageMultiRequest* FileRequest::mutable_resize_image_multi_params() {
+  ::file_processor::ResizeImageMultiRequest* _msg = _internal_mutable_resize_image_multi_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.resize_image_multi_params)
+  return _msg;
+}
+
+// .file_processor.PipelineRequest pipeline_params = 9;
+inline bool FileRequest::_internal_has_pipeline_params() const {
+  return parameters_case() == kPipelineParams;
+}
+inline bool FileRequest::has_pipeline_params() const {
+  return _internal_has_pipeline_params();
+}
+inline void FileRequest::set_has_pipeline_params() {
+  _impl_._oneof_case_[0] = kPipelineParams;
+}
+inline void FileRequest::clear_pipeline_params() {
+  if (_internal_has_pipeline_params()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.parameters_.pipeline_params_;
+    }
+    clear_has_parameters();
+  }
+}
+inline ::file_processor::PipelineRequest* FileRequest::release_pipeline_params() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.pipeline_params)
+  if (_internal_has_pipeline_params()) {
+    clear_has_parameters();
+    ::file_processor::PipelineRequest* temp = _impl_.parameters_.pipeline_params_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.parameters_.pipeline_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::PipelineRequest& FileRequest::_internal_pipeline_params() const {
+  return _internal_has_pipeline_params()
+      ? *_impl_.parameters_.pipeline_params_
+      : reinterpret_cast< ::file_processor::PipelineRequest&>(::file_processor::_PipelineRequest_default_instance_);
+}
+inline const ::file_processor::PipelineRequest& FileRequest::pipeline_params() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.pipeline_params)
+  return _internal_pipeline_params();
+}
+inline ::file_processor::PipelineRequest* FileRequest::unsafe_arena_release_pipeline_params() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.pipeline_params)
+  if (_internal_has_pipeline_params()) {
+    clear_has_parameters();
+    ::file_processor::PipelineRequest* temp = _impl_.parameters_.pipeline_params_;
+    _impl_.parameters_.pipeline_params_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void FileRequest::unsafe_arena_set_allocated_pipeline_params(::file_processor::PipelineRequest* pipeline_params) {
+  clear_parameters();
+  if (pipeline_params) {
+    set_has_pipeline_params();
+    _impl_.parameters_.pipeline_params_ = pipeline_params;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.pipeline_params)
+}
+inline ::file_processor::PipelineRequest* FileRequest::_internal_mutable_pipeline_params() {
+  if (!_internal_has_pipeline_params()) {
+    clear_parameters();
+    set_has_pipeline_params();
+    _impl_.parameters_.pipeline_params_ = CreateMaybeMessage< ::file_processor::PipelineRequest >(GetArenaForAllocation());
+  }
+  return _impl_.parameters_.pipeline_params_;
+}
+inline ::file_processor::PipelineRequest* FileRequest::mutable_pipeline_params() {
+  ::file_processor::PipelineRequest* _msg = _internal_mutable_pipeline_params();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.pipeline_params)
+  return _msg;
+}
+
+// string upload_id = 8;
+inline void FileRequest::clear_upload_id() {
+  _impl_.upload_id_.ClearToEmpty();
+}
+inline const std::string& FileRequest::upload_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileRequest.upload_id)
+  return _internal_upload_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileRequest::set_upload_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.upload_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileRequest.upload_id)
+}
+inline std::string* FileRequest::mutable_upload_id() {
+  std::string* _s = _internal_mutable_upload_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.upload_id)
+  return _s;
+}
+inline const std::string& FileRequest::_internal_upload_id() const {
+  return _impl_.upload_id_.Get();
+}
+inline void FileRequest::_internal_set_upload_id(const std::string& value) {
+  
+  _impl_.upload_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileRequest::_internal_mutable_upload_id() {
+  
+  return _impl_.upload_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileRequest::release_upload_id() {
+  // @@protoc_insertion_point(field_release:file_processor.FileRequest.upload_id)
+  return _impl_.upload_id_.Release();
+}
+inline void FileRequest::set_allocated_upload_id(std::string* upload_id) {
+  if (upload_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.upload_id_.SetAllocated(upload_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.upload_id_.IsDefault()) {
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.upload_id)
+}
+
+inline bool FileRequest::has_parameters() const {
+  return parameters_case() != PARAMETERS_NOT_SET;
+}
+inline void FileRequest::clear_has_parameters() {
+  _impl_._oneof_case_[0] = PARAMETERS_NOT_SET;
+}
+inline FileRequest::ParametersCase FileRequest::parameters_case() const {
+  return FileRequest::ParametersCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// CompressPDFRequest
+
+// -------------------------------------------------------------------
+
+// ConvertToTXTRequest
+
+// -------------------------------------------------------------------
+
+// ConvertImageFormatRequest
+
+// string output_format = 1;
+inline void ConvertImageFormatRequest::clear_output_format() {
+  _impl_.output_format_.ClearToEmpty();
+}
+inline const std::string& ConvertImageFormatRequest::output_format() const {
+  // @@protoc_insertion_point(field_get:file_processor.ConvertImageFormatRequest.output_format)
+  return _internal_output_format();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConvertImageFormatRequest::set_output_format(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.output_format_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ConvertImageFormatRequest.output_format)
+}
+inline std::string* ConvertImageFormatRequest::mutable_output_format() {
+  std::string* _s = _internal_mutable_output_format();
+  // @@protoc_insertion_point(field_mutable:file_processor.ConvertImageFormatRequest.output_format)
+  return _s;
+}
+inline const std::string& ConvertImageFormatRequest::_internal_output_format() const {
+  return _impl_.output_format_.Get();
+}
+inline void ConvertImageFormatRequest::_internal_set_output_format(const std::string& value) {
+  
+  _impl_.output_format_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConvertImageFormatRequest::_internal_mutable_output_format() {
+  
+  return _impl_.output_format_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConvertImageFormatRequest::release_output_format() {
+  // @@protoc_insertion_point(field_release:file_processor.ConvertImageFormatRequest.output_format)
+  return _impl_.output_format_.Release();
+}
+inline void ConvertImageFormatRequest::set_allocated_output_format(std::string* output_format) {
+  if (output_format != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.output_format_.SetAllocated(output_format, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.output_format_.IsDefault()) {
+    _impl_.output_format_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ConvertImageFormatRequest.output_format)
+}
+
+// -------------------------------------------------------------------
+
+// ResizeImageRequest
+
+// int32 width = 1;
+inline void ResizeImageRequest::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t ResizeImageRequest::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t ResizeImageRequest::width() const {
+  // @@protoc_insertion_point(field_get:file_processor.ResizeImageRequest.width)
+  return _internal_width();
+}
+inline void ResizeImageRequest::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void ResizeImageRequest::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:file_processor.ResizeImageRequest.width)
+}
+
+// int32 height = 2;
+inline void ResizeImageRequest::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t ResizeImageRequest::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t ResizeImageRequest::height() const {
+  // @@protoc_insertion_point(field_get:file_processor.ResizeImageRequest.height)
+  return _internal_height();
+}
+inline void ResizeImageRequest::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void ResizeImageRequest::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:file_processor.ResizeImageRequest.height)
+}
+
+// -------------------------------------------------------------------
+
+// ImageSize
+
+// int32 width = 1;
+inline void ImageSize::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t ImageSize::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t ImageSize::width() const {
+  // @@protoc_insertion_point(field_get:file_processor.ImageSize.width)
+  return _internal_width();
+}
+inline void ImageSize::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void ImageSize::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:file_processor.ImageSize.width)
+}
+
+// int32 height = 2;
+inline void ImageSize::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t ImageSize::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t ImageSize::height() const {
+  // @@protoc_insertion_point(field_get:file_processor.ImageSize.height)
+  return _internal_height();
+}
+inline void ImageSize::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void ImageSize::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:file_processor.ImageSize.height)
+}
+
+// -------------------------------------------------------------------
+
+// ResizeImageMultiRequest
+
+// repeated .file_processor.ImageSize sizes = 1;
+inline int ResizeImageMultiRequest::_internal_sizes_size() const {
+  return _impl_.sizes_.size();
+}
+inline int ResizeImageMultiRequest::sizes_size() const {
+  return _internal_sizes_size();
+}
+inline void ResizeImageMultiRequest::clear_sizes() {
+  _impl_.sizes_.Clear();
+}
+inline ::file_processor::ImageSize* ResizeImageMultiRequest::mutable_sizes(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.ResizeImageMultiRequest.sizes)
+  return _impl_.sizes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ImageSize >*
+ResizeImageMultiRequest::mutable_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.ResizeImageMultiRequest.sizes)
+  return &_impl_.sizes_;
+}
+inline const ::file_processor::ImageSize& ResizeImageMultiRequest::_internal_sizes(int index) const {
+  return _impl_.sizes_.Get(index);
+}
+inline const ::file_processor::ImageSize& ResizeImageMultiRequest::sizes(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.ResizeImageMultiRequest.sizes)
+  return _internal_sizes(index);
+}
+inline ::file_processor::ImageSize* ResizeImageMultiRequest::_internal_add_sizes() {
+  return _impl_.sizes_.Add();
+}
+inline ::file_processor::ImageSize* ResizeImageMultiRequest::add_sizes() {
+  ::file_processor::ImageSize* _add = _internal_add_sizes();
+  // @@protoc_insertion_point(field_add:file_processor.ResizeImageMultiRequest.sizes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ImageSize >&
+ResizeImageMultiRequest::sizes() const {
+  // @@protoc_insertion_point(field_list:file_processor.ResizeImageMultiRequest.sizes)
+  return _impl_.sizes_;
+}
+
+// -------------------------------------------------------------------
+
+// PipelineStep
+
+// .file_processor.CompressPDFRequest compress_pdf = 1;
+inline bool PipelineStep::_internal_has_compress_pdf() const {
+  return operation_case() == kCompressPdf;
+}
+inline bool PipelineStep::has_compress_pdf() const {
+  return _internal_has_compress_pdf();
+}
+inline void PipelineStep::set_has_compress_pdf() {
+  _impl_._oneof_case_[0] = kCompressPdf;
+}
+inline void PipelineStep::clear_compress_pdf() {
+  if (_internal_has_compress_pdf()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.operation_.compress_pdf_;
+    }
+    clear_has_operation();
+  }
+}
+inline ::file_processor::CompressPDFRequest* PipelineStep::release_compress_pdf() {
+  // @@protoc_insertion_point(field_release:file_processor.PipelineStep.compress_pdf)
+  if (_internal_has_compress_pdf()) {
+    clear_has_operation();
+    ::file_processor::CompressPDFRequest* temp = _impl_.operation_.compress_pdf_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.operation_.compress_pdf_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::CompressPDFRequest& PipelineStep::_internal_compress_pdf() const {
+  return _internal_has_compress_pdf()
+      ? *_impl_.operation_.compress_pdf_
+      : reinterpret_cast< ::file_processor::CompressPDFRequest&>(::file_processor::_CompressPDFRequest_default_instance_);
+}
+inline const ::file_processor::CompressPDFRequest& PipelineStep::compress_pdf() const {
+  // @@protoc_insertion_point(field_get:file_processor.PipelineStep.compress_pdf)
+  return _internal_compress_pdf();
+}
+inline ::file_processor::CompressPDFRequest* PipelineStep::unsafe_arena_release_compress_pdf() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.PipelineStep.compress_pdf)
+  if (_internal_has_compress_pdf()) {
+    clear_has_operation();
+    ::file_processor::CompressPDFRequest* temp = _impl_.operation_.compress_pdf_;
+    _impl_.operation_.compress_pdf_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PipelineStep::unsafe_arena_set_allocated_compress_pdf(::file_processor::CompressPDFRequest* compress_pdf) {
+  clear_operation();
+  if (compress_pdf) {
+    set_has_compress_pdf();
+    _impl_.operation_.compress_pdf_ = compress_pdf;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.PipelineStep.compress_pdf)
+}
+inline ::file_processor::CompressPDFRequest* PipelineStep::_internal_mutable_compress_pdf() {
+  if (!_internal_has_compress_pdf()) {
+    clear_operation();
+    set_has_compress_pdf();
+    _impl_.operation_.compress_pdf_ = CreateMaybeMessage< ::file_processor::CompressPDFRequest >(GetArenaForAllocation());
+  }
+  return _impl_.operation_.compress_pdf_;
+}
+inline ::file_processor::CompressPDFRequest* PipelineStep::mutable_compress_pdf() {
+  ::file_processor::CompressPDFRequest* _msg = _internal_mutable_compress_pdf();
+  // @@protoc_insertion_point(field_mutable:file_processor.PipelineStep.compress_pdf)
+  return _msg;
+}
+
+// .file_processor.ConvertToTXTRequest convert_to_txt = 2;
+inline bool PipelineStep::_internal_has_convert_to_txt() const {
+  return operation_case() == kConvertToTxt;
+}
+inline bool PipelineStep::has_convert_to_txt() const {
+  return _internal_has_convert_to_txt();
+}
+inline void PipelineStep::set_has_convert_to_txt() {
+  _impl_._oneof_case_[0] = kConvertToTxt;
+}
+inline void PipelineStep::clear_convert_to_txt() {
+  if (_internal_has_convert_to_txt()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.operation_.convert_to_txt_;
+    }
+    clear_has_operation();
+  }
+}
+inline ::file_processor::ConvertToTXTRequest* PipelineStep::release_convert_to_txt() {
+  // @@protoc_insertion_point(field_release:file_processor.PipelineStep.convert_to_txt)
+  if (_internal_has_convert_to_txt()) {
+    clear_has_operation();
+    ::file_processor::ConvertToTXTRequest* temp = _impl_.operation_.convert_to_txt_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.operation_.convert_to_txt_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ConvertToTXTRequest& PipelineStep::_internal_convert_to_txt() const {
+  return _internal_has_convert_to_txt()
+      ? *_impl_.operation_.convert_to_txt_
+      : reinterpret_cast< ::file_processor::ConvertToTXTRequest&>(::file_processor::_ConvertToTXTRequest_default_instance_);
+}
+inline const ::file_processor::ConvertToTXTRequest& PipelineStep::convert_to_txt() const {
+  // @@protoc_insertion_point(field_get:file_processor.PipelineStep.convert_to_txt)
+  return _internal_convert_to_txt();
+}
+inline ::file_processor::ConvertToTXTRequest* PipelineStep::unsafe_arena_release_convert_to_txt() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.PipelineStep.convert_to_txt)
+  if (_internal_has_convert_to_txt()) {
+    clear_has_operation();
+    ::file_processor::ConvertToTXTRequest* temp = _impl_.operation_.convert_to_txt_;
+    _impl_.operation_.convert_to_txt_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PipelineStep::unsafe_arena_set_allocated_convert_to_txt(::file_processor::ConvertToTXTRequest* convert_to_txt) {
+  clear_operation();
+  if (convert_to_txt) {
+    set_has_convert_to_txt();
+    _impl_.operation_.convert_to_txt_ = convert_to_txt;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.PipelineStep.convert_to_txt)
+}
+inline ::file_processor::ConvertToTXTRequest* PipelineStep::_internal_mutable_convert_to_txt() {
+  if (!_internal_has_convert_to_txt()) {
+    clear_operation();
+    set_has_convert_to_txt();
+    _impl_.operation_.convert_to_txt_ = CreateMaybeMessage< ::file_processor::ConvertToTXTRequest >(GetArenaForAllocation());
+  }
+  return _impl_.operation_.convert_to_txt_;
+}
+inline ::file_processor::ConvertToTXTRequest* PipelineStep::mutable_convert_to_txt() {
+  ::file_processor::ConvertToTXTRequest* _msg = _internal_mutable_convert_to_txt();
+  // @@protoc_insertion_point(field_mutable:file_processor.PipelineStep.convert_to_txt)
+  return _msg;
+}
+
+// .file_processor.ConvertImageFormatRequest convert_image_format = 3;
+inline bool PipelineStep::_internal_has_convert_image_format() const {
+  return operation_case() == kConvertImageFormat;
+}
+inline bool PipelineStep::has_convert_image_format() const {
+  return _internal_has_convert_image_format();
+}
+inline void PipelineStep::set_has_convert_image_format() {
+  _impl_._oneof_case_[0] = kConvertImageFormat;
+}
+inline void PipelineStep::clear_convert_image_format() {
+  if (_internal_has_convert_image_format()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.operation_.convert_image_format_;
+    }
+    clear_has_operation();
+  }
+}
+inline ::file_processor::ConvertImageFormatRequest* PipelineStep::release_convert_image_format() {
+  // @@protoc_insertion_point(field_release:file_processor.PipelineStep.convert_image_format)
+  if (_internal_has_convert_image_format()) {
+    clear_has_operation();
+    ::file_processor::ConvertImageFormatRequest* temp = _impl_.operation_.convert_image_format_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.operation_.convert_image_format_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ConvertImageFormatRequest& PipelineStep::_internal_convert_image_format() const {
+  return _internal_has_convert_image_format()
+      ? *_impl_.operation_.convert_image_format_
+      : reinterpret_cast< ::file_processor::ConvertImageFormatRequest&>(::file_processor::_ConvertImageFormatRequest_default_instance_);
+}
+inline const ::file_processor::ConvertImageFormatRequest& PipelineStep::convert_image_format() const {
+  // @@protoc_insertion_point(field_get:file_processor.PipelineStep.convert_image_format)
+  return _internal_convert_image_format();
+}
+inline ::file_processor::ConvertImageFormatRequest* PipelineStep::unsafe_arena_release_convert_image_format() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.PipelineStep.convert_image_format)
+  if (_internal_has_convert_image_format()) {
+    clear_has_operation();
+    ::file_processor::ConvertImageFormatRequest* temp = _impl_.operation_.convert_image_format_;
+    _impl_.operation_.convert_image_format_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PipelineStep::unsafe_arena_set_allocated_convert_image_format(::file_processor::ConvertImageFormatRequest* convert_image_format) {
+  clear_operation();
+  if (convert_image_format) {
+    set_has_convert_image_format();
+    _impl_.operation_.convert_image_format_ = convert_image_format;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.PipelineStep.convert_image_format)
+}
+inline ::file_processor::ConvertImageFormatRequest* PipelineStep::_internal_mutable_convert_image_format() {
+  if (!_internal_has_convert_image_format()) {
+    clear_operation();
+    set_has_convert_image_format();
+    _impl_.operation_.convert_image_format_ = CreateMaybeMessage< ::file_processor::ConvertImageFormatRequest >(GetArenaForAllocation());
+  }
+  return _impl_.operation_.convert_image_format_;
+}
+inline ::file_processor::ConvertImageFormatRequest* PipelineStep::mutable_convert_image_format() {
+  ::file_processor::ConvertImageFormatRequest* _msg = _internal_mutable_convert_image_format();
+  // @@protoc_insertion_point(field_mutable:file_processor.PipelineStep.convert_image_format)
+  return _msg;
+}
+
+// .file_processor.ResizeImageRequest resize_image = 4;
+inline bool PipelineStep::_internal_has_resize_image() const {
+  return operation_case() == kResizeImage;
+}
+inline bool PipelineStep::has_resize_image() const {
+  return _internal_has_resize_image();
+}
+inline void PipelineStep::set_has_resize_image() {
+  _impl_._oneof_case_[0] = kResizeImage;
+}
+inline void PipelineStep::clear_resize_image() {
+  if (_internal_has_resize_image()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.operation_.resize_image_;
+    }
+    clear_has_operation();
+  }
+}
+inline ::file_processor::ResizeImageRequest* PipelineStep::release_resize_image() {
+  // @@protoc_insertion_point(field_release:file_processor.PipelineStep.resize_image)
+  if (_internal_has_resize_image()) {
+    clear_has_operation();
+    ::file_processor::ResizeImageRequest* temp = _impl_.operation_.resize_image_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.operation_.resize_image_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::ResizeImageRequest& PipelineStep::_internal_resize_image() const {
+  return _internal_has_resize_image()
+      ? *_impl_.operation_.resize_image_
+      : reinterpret_cast< ::file_processor::ResizeImageRequest&>(::file_processor::_ResizeImageRequest_default_instance_);
+}
+inline const ::file_processor::ResizeImageRequest& PipelineStep::resize_image() const {
+  // @@protoc_insertion_point(field_get:file_processor.PipelineStep.resize_image)
+  return _internal_resize_image();
+}
+inline ::file_processor::ResizeImageRequest* PipelineStep::unsafe_arena_release_resize_image() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.PipelineStep.resize_image)
+  if (_internal_has_resize_image()) {
+    clear_has_operation();
+    ::file_processor::ResizeImageRequest* temp = _impl_.operation_.resize_image_;
+    _impl_.operation_.resize_image_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PipelineStep::unsafe_arena_set_allocated_resize_image(::file_processor::ResizeImageRequest* resize_image) {
+  clear_operation();
+  if (resize_image) {
+    set_has_resize_image();
+    _impl_.operation_.resize_image_ = resize_image;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.PipelineStep.resize_image)
+}
+inline ::file_processor::ResizeImageRequest* PipelineStep::_internal_mutable_resize_image() {
+  if (!_internal_has_resize_image()) {
+    clear_operation();
+    set_has_resize_image();
+    _impl_.operation_.resize_image_ = CreateMaybeMessage< ::file_processor::ResizeImageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.operation_.resize_image_;
+}
+inline ::file_processor::ResizeImageRequest* PipelineStep::mutable_resize_image() {
+  ::file_processor::ResizeImageRequest* _msg = _internal_mutable_resize_image();
+  // @@protoc_insertion_point(field_mutable:file_processor.PipelineStep.resize_image)
+  return _msg;
+}
+
+inline bool PipelineStep::has_operation() const {
+  return operation_case() != OPERATION_NOT_SET;
+}
+inline void PipelineStep::clear_has_operation() {
+  _impl_._oneof_case_[0] = OPERATION_NOT_SET;
+}
+inline PipelineStep::OperationCase PipelineStep::operation_case() const {
+  return PipelineStep::OperationCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// PipelineRequest
+
+// repeated .file_processor.PipelineStep steps = 1;
+inline int PipelineRequest::_internal_steps_size() const {
+  return _impl_.steps_.size();
+}
+inline int PipelineRequest::steps_size() const {
+  return _internal_steps_size();
+}
+inline void PipelineRequest::clear_steps() {
+  _impl_.steps_.Clear();
+}
+inline ::file_processor::PipelineStep* PipelineRequest::mutable_steps(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.PipelineRequest.steps)
+  return _impl_.steps_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::PipelineStep >*
+PipelineRequest::mutable_steps() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.PipelineRequest.steps)
+  return &_impl_.steps_;
+}
+inline const ::file_processor::PipelineStep& PipelineRequest::_internal_steps(int index) const {
+  return _impl_.steps_.Get(index);
+}
+inline const ::file_processor::PipelineStep& PipelineRequest::steps(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.PipelineRequest.steps)
+  return _internal_steps(index);
+}
+inline ::file_processor::PipelineStep* PipelineRequest::_internal_add_steps() {
+  return _impl_.steps_.Add();
+}
+inline ::file_processor::PipelineStep* PipelineRequest::add_steps() {
+  ::file_processor::PipelineStep* _add = _internal_add_steps();
+  // @@protoc_insertion_point(field_add:file_processor.PipelineRequest.steps)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::PipelineStep >&
+PipelineRequest::steps() const {
+  // @@protoc_insertion_point(field_list:file_processor.PipelineRequest.steps)
+  return _impl_.steps_;
+}
+
+// -------------------------------------------------------------------
+
+// FileResponse
+
+// string file_name = 1;
+inline void FileResponse::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& FileResponse::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileResponse::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.file_name)
+}
+inline std::string* FileResponse::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.file_name)
+  return _s;
+}
+inline const std::string& FileResponse::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void FileResponse::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileResponse::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileResponse::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.FileResponse.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void FileResponse::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.file_name)
+}
+
+// .file_processor.FileChunk file_content = 2;
+inline bool FileResponse::_internal_has_file_content() const {
+  return this != internal_default_instance() && _impl_.file_content_ != nullptr;
+}
+inline bool FileResponse::has_file_content() const {
+  return _internal_has_file_content();
+}
+inline void FileResponse::clear_file_content() {
+  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
+    delete _impl_.file_content_;
+  }
+  _impl_.file_content_ = nullptr;
+}
+inline const ::file_processor::FileChunk& FileResponse::_internal_file_content() const {
+  const ::file_processor::FileChunk* p = _impl_.file_content_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileChunk&>(
+      ::file_processor::_FileChunk_default_instance_);
+}
+inline const ::file_processor::FileChunk& FileResponse::file_content() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.file_content)
+  return _internal_file_content();
+}
+inline void FileResponse::unsafe_arena_set_allocated_file_content(
+    ::file_processor::FileChunk* file_content) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_content_);
+  }
+  _impl_.file_content_ = file_content;
+  if (file_content) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileResponse.file_content)
+}
+inline ::file_processor::FileChunk* FileResponse::release_file_content() {
+  
+  ::file_processor::FileChunk* temp = _impl_.file_content_;
+  _impl_.file_content_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::file_processor::FileChunk* FileResponse::unsafe_arena_release_file_content() {
+  // @@protoc_insertion_point(field_release:file_processor.FileResponse.file_content)
+  
+  ::file_processor::FileChunk* temp = _impl_.file_content_;
+  _impl_.file_content_ = nullptr;
+  return temp;
+}
+inline ::file_processor::FileChunk* FileResponse::_internal_mutable_file_content() {
+  
+  if (_impl_.file_content_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::FileChunk>(GetArenaForAllocation());
+    _impl_.file_content_ = p;
+  }
+  return _impl_.file_content_;
+}
+inline ::file_processor::FileChunk* FileResponse::mutable_file_content() {
+  ::file_processor::FileChunk* _msg = _internal_mutable_file_content();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.file_content)
+  return _msg;
+}
+inline void FileResponse::set_allocated_file_content(::file_processor::FileChunk* file_content) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.file_content_;
+  }
+  if (file_content) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_content);
+    if (message_arena != submessage_arena) {
+      file_content = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, file_content, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.file_content_ = file_content;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.file_content)
+}
+
+// string status_message = 3;
+inline void FileResponse::clear_status_message() {
+  _impl_.status_message_.ClearToEmpty();
+}
+inline const std::string& FileResponse::status_message() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.status_message)
+  return _internal_status_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileResponse::set_status_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.status_message)
+}
+inline std::string* FileResponse::mutable_status_message() {
+  std::string* _s = _internal_mutable_status_message();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.status_message)
+  return _s;
+}
+inline const std::string& FileResponse::_internal_status_message() const {
+  return _impl_.status_message_.Get();
+}
+inline void FileResponse::_internal_set_status_message(const std::string& value) {
+  
+  _impl_.status_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileResponse::_internal_mutable_status_message() {
+  
+  return _impl_.status_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileResponse::release_status_message() {
+  // @@protoc_insertion_point(field_release:file_processor.FileResponse.status_message)
+  return _impl_.status_message_.Release();
+}
+inline void FileResponse::set_allocated_status_message(std::string* status_message) {
+  if (status_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_message_.IsDefault()) {
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.status_message)
+}
+
+// bool success = 4;
+inline void FileResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool FileResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool FileResponse::success() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.success)
+  return _internal_success();
+}
+inline void FileResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void FileResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.success)
+}
+
+// string result_handle = 5;
+inline void FileResponse::clear_result_handle() {
+  _impl_.result_handle_.ClearToEmpty();
+}
+inline const std::string& FileResponse::result_handle() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.result_handle)
+  return _internal_result_handle();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileResponse::set_result_handle(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_handle_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.result_handle)
+}
+inline std::string* FileResponse::mutable_result_handle() {
+  std::string* _s = _internal_mutable_result_handle();
+  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.result_handle)
+  return _s;
+}
+inline const std::string& FileResponse::_internal_result_handle() const {
+  return _impl_.result_handle_.Get();
+}
+inline void FileResponse::_internal_set_result_handle(const std::string& value) {
+  
+  _impl_.result_handle_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileResponse::_internal_mutable_result_handle() {
+  
+  return _impl_.result_handle_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileResponse::release_result_handle() {
+  // @@protoc_insertion_point(field_release:file_processor.FileResponse.result_handle)
+  return _impl_.result_handle_.Release();
+}
+inline void FileResponse::set_allocated_result_handle(std::string* result_handle) {
+  if (result_handle != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_handle_.SetAllocated(result_handle, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_handle_.IsDefault()) {
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.result_handle)
+}
+
+// uint64 output_size = 6;
+inline void FileResponse::clear_output_size() {
+  _impl_.output_size_ = uint64_t{0u};
+}
+inline uint64_t FileResponse::_internal_output_size() const {
+  return _impl_.output_size_;
+}
+inline uint64_t FileResponse::output_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.output_size)
+  return _internal_output_size();
+}
+inline void FileResponse::_internal_set_output_size(uint64_t value) {
+  
+  _impl_.output_size_ = value;
+}
+inline void FileResponse::set_output_size(uint64_t value) {
+  _internal_set_output_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.output_size)
+}
+
+// optional fixed32 output_crc32c = 7;
+inline bool FileResponse::_internal_has_output_crc32c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FileResponse::has_output_crc32c() const {
+  return _internal_has_output_crc32c();
+}
+inline void FileResponse::clear_output_crc32c() {
+  _impl_.output_crc32c_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t FileResponse::_internal_output_crc32c() const {
+  return _impl_.output_crc32c_;
+}
+inline uint32_t FileResponse::output_crc32c() const {
+  // @@protoc_insertion_point(field_get:file_processor.FileResponse.output_crc32c)
+  return _internal_output_crc32c();
+}
+inline void FileResponse::_internal_set_output_crc32c(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.output_crc32c_ = value;
+}
+inline void FileResponse::set_output_crc32c(uint32_t value) {
+  _internal_set_output_crc32c(value);
+  // @@protoc_insertion_point(field_set:file_processor.FileResponse.output_crc32c)
+}
+
+// -------------------------------------------------------------------
+
+// BatchRequest
+
+// string file_id = 1;
+inline void BatchRequest::clear_file_id() {
+  _impl_.file_id_.ClearToEmpty();
+}
+inline const std::string& BatchRequest::file_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchRequest.file_id)
+  return _internal_file_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchRequest::set_file_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.BatchRequest.file_id)
+}
+inline std::string* BatchRequest::mutable_file_id() {
+  std::string* _s = _internal_mutable_file_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.BatchRequest.file_id)
+  return _s;
+}
+inline const std::string& BatchRequest::_internal_file_id() const {
+  return _impl_.file_id_.Get();
+}
+inline void BatchRequest::_internal_set_file_id(const std::string& value) {
+  
+  _impl_.file_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchRequest::_internal_mutable_file_id() {
+  
+  return _impl_.file_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchRequest::release_file_id() {
+  // @@protoc_insertion_point(field_release:file_processor.BatchRequest.file_id)
+  return _impl_.file_id_.Release();
+}
+inline void BatchRequest::set_allocated_file_id(std::string* file_id) {
+  if (file_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_id_.SetAllocated(file_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_id_.IsDefault()) {
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.BatchRequest.file_id)
+}
+
+// .file_processor.FileRequest request = 2;
+inline bool BatchRequest::_internal_has_request() const {
+  return this != internal_default_instance() && _impl_.request_ != nullptr;
+}
+inline bool BatchRequest::has_request() const {
+  return _internal_has_request();
+}
+inline void BatchRequest::clear_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
+  }
+  _impl_.request_ = nullptr;
+}
+inline const ::file_processor::FileRequest& BatchRequest::_internal_request() const {
+  const ::file_processor::FileRequest* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileRequest&>(
+      ::file_processor::_FileRequest_default_instance_);
+}
+inline const ::file_processor::FileRequest& BatchRequest::request() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchRequest.request)
+  return _internal_request();
+}
+inline void BatchRequest::unsafe_arena_set_allocated_request(
+    ::file_processor::FileRequest* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
+  }
+  _impl_.request_ = request;
+  if (request) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.BatchRequest.request)
+}
+inline ::file_processor::FileRequest* BatchRequest::release_request() {
+  
+  ::file_processor::FileRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::file_processor::FileRequest* BatchRequest::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:file_processor.BatchRequest.request)
+  
+  ::file_processor::FileRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::file_processor::FileRequest* BatchRequest::_internal_mutable_request() {
+  
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::FileRequest>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::file_processor::FileRequest* BatchRequest::mutable_request() {
+  ::file_processor::FileRequest* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:file_processor.BatchRequest.request)
+  return _msg;
+}
+inline void BatchRequest::set_allocated_request(::file_processor::FileRequest* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.BatchRequest.request)
+}
+
+// bool last_chunk = 3;
+inline void BatchRequest::clear_last_chunk() {
+  _impl_.last_chunk_ = false;
+}
+inline bool BatchRequest::_internal_last_chunk() const {
+  return _impl_.last_chunk_;
+}
+inline bool BatchRequest::last_chunk() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchRequest.last_chunk)
+  return _internal_last_chunk();
+}
+inline void BatchRequest::_internal_set_last_chunk(bool value) {
+  
+  _impl_.last_chunk_ = value;
+}
+inline void BatchRequest::set_last_chunk(bool value) {
+  _internal_set_last_chunk(value);
+  // @@protoc_insertion_point(field_set:file_processor.BatchRequest.last_chunk)
+}
+
+// -------------------------------------------------------------------
+
+// BatchResponse
+
+// string file_id = 1;
+inline void BatchResponse::clear_file_id() {
+  _impl_.file_id_.ClearToEmpty();
+}
+inline const std::string& BatchResponse::file_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchResponse.file_id)
+  return _internal_file_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchResponse::set_file_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.BatchResponse.file_id)
+}
+inline std::string* BatchResponse::mutable_file_id() {
+  std::string* _s = _internal_mutable_file_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.BatchResponse.file_id)
+  return _s;
+}
+inline const std::string& BatchResponse::_internal_file_id() const {
+  return _impl_.file_id_.Get();
+}
+inline void BatchResponse::_internal_set_file_id(const std::string& value) {
+  
+  _impl_.file_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchResponse::_internal_mutable_file_id() {
+  
+  return _impl_.file_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchResponse::release_file_id() {
+  // @@protoc_insertion_point(field_release:file_processor.BatchResponse.file_id)
+  return _impl_.file_id_.Release();
+}
+inline void BatchResponse::set_allocated_file_id(std::string* file_id) {
+  if (file_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_id_.SetAllocated(file_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_id_.IsDefault()) {
+    _impl_.file_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.BatchResponse.file_id)
+}
+
+// .file_processor.FileResponse response = 2;
+inline bool BatchResponse::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
+}
+inline bool BatchResponse::has_response() const {
+  return _internal_has_response();
+}
+inline void BatchResponse::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+}
+inline const ::file_processor::FileResponse& BatchResponse::_internal_response() const {
+  const ::file_processor::FileResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileResponse&>(
+      ::file_processor::_FileResponse_default_instance_);
+}
+inline const ::file_processor::FileResponse& BatchResponse::response() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchResponse.response)
+  return _internal_response();
+}
+inline void BatchResponse::unsafe_arena_set_allocated_response(
+    ::file_processor::FileResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.BatchResponse.response)
+}
+inline ::file_processor::FileResponse* BatchResponse::release_response() {
+  
+  ::file_processor::FileResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::file_processor::FileResponse* BatchResponse::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:file_processor.BatchResponse.response)
+  
+  ::file_processor::FileResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::file_processor::FileResponse* BatchResponse::_internal_mutable_response() {
+  
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::FileResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::file_processor::FileResponse* BatchResponse::mutable_response() {
+  ::file_processor::FileResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:file_processor.BatchResponse.response)
+  return _msg;
+}
+inline void BatchResponse::set_allocated_response(::file_processor::FileResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.BatchResponse.response)
+}
+
+// bool done = 3;
+inline void BatchResponse::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool BatchResponse::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool BatchResponse::done() const {
+  // @@protoc_insertion_point(field_get:file_processor.BatchResponse.done)
+  return _internal_done();
+}
+inline void BatchResponse::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void BatchResponse::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:file_processor.BatchResponse.done)
+}
+
+// -------------------------------------------------------------------
+
+// StartUploadRequest
+
+// string file_name = 1;
+inline void StartUploadRequest::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& StartUploadRequest::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.StartUploadRequest.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StartUploadRequest::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.StartUploadRequest.file_name)
+}
+inline std::string* StartUploadRequest::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:file_processor.StartUploadRequest.file_name)
+  return _s;
+}
+inline const std::string& StartUploadRequest::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void StartUploadRequest::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StartUploadRequest::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StartUploadRequest::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.StartUploadRequest.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void StartUploadRequest::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.StartUploadRequest.file_name)
+}
+
+// uint64 total_size = 2;
+inline void StartUploadRequest::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
+}
+inline uint64_t StartUploadRequest::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline uint64_t StartUploadRequest::total_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.StartUploadRequest.total_size)
+  return _internal_total_size();
+}
+inline void StartUploadRequest::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void StartUploadRequest::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.StartUploadRequest.total_size)
+}
+
+// -------------------------------------------------------------------
+
+// UploadChunk
+
+// string upload_id = 1;
+inline void UploadChunk::clear_upload_id() {
+  _impl_.upload_id_.ClearToEmpty();
+}
+inline const std::string& UploadChunk::upload_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadChunk.upload_id)
+  return _internal_upload_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadChunk::set_upload_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.upload_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadChunk.upload_id)
+}
+inline std::string* UploadChunk::mutable_upload_id() {
+  std::string* _s = _internal_mutable_upload_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadChunk.upload_id)
+  return _s;
+}
+inline const std::string& UploadChunk::_internal_upload_id() const {
+  return _impl_.upload_id_.Get();
+}
+inline void UploadChunk::_internal_set_upload_id(const std::string& value) {
+  
+  _impl_.upload_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadChunk::_internal_mutable_upload_id() {
+  
+  return _impl_.upload_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadChunk::release_upload_id() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadChunk.upload_id)
+  return _impl_.upload_id_.Release();
+}
+inline void UploadChunk::set_allocated_upload_id(std::string* upload_id) {
+  if (upload_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.upload_id_.SetAllocated(upload_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.upload_id_.IsDefault()) {
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadChunk.upload_id)
+}
+
+// uint64 offset = 2;
+inline void UploadChunk::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t UploadChunk::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t UploadChunk::offset() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadChunk.offset)
+  return _internal_offset();
+}
+inline void UploadChunk::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void UploadChunk::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadChunk.offset)
+}
+
+// bytes content = 3;
+inline void UploadChunk::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& UploadChunk::content() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadChunk.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadChunk::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadChunk.content)
+}
+inline std::string* UploadChunk::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadChunk.content)
+  return _s;
+}
+inline const std::string& UploadChunk::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void UploadChunk::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadChunk::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadChunk::release_content() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadChunk.content)
+  return _impl_.content_.Release();
+}
+inline void UploadChunk::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadChunk.content)
+}
+
+// optional fixed32 crc32c = 4;
+inline bool UploadChunk::_internal_has_crc32c() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool UploadChunk::has_crc32c() const {
+  return _internal_has_crc32c();
+}
+inline void UploadChunk::clear_crc32c() {
+  _impl_.crc32c_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t UploadChunk::_internal_crc32c() const {
+  return _impl_.crc32c_;
+}
+inline uint32_t UploadChunk::crc32c() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadChunk.crc32c)
+  return _internal_crc32c();
+}
+inline void UploadChunk::_internal_set_crc32c(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.crc32c_ = value;
+}
+inline void UploadChunk::set_crc32c(uint32_t value) {
+  _internal_set_crc32c(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadChunk.crc32c)
+}
+
+// -------------------------------------------------------------------
+
+// UploadQuery
+
+// string upload_id = 1;
+inline void UploadQuery::clear_upload_id() {
+  _impl_.upload_id_.ClearToEmpty();
+}
+inline const std::string& UploadQuery::upload_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadQuery.upload_id)
+  return _internal_upload_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadQuery::set_upload_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.upload_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadQuery.upload_id)
+}
+inline std::string* UploadQuery::mutable_upload_id() {
+  std::string* _s = _internal_mutable_upload_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadQuery.upload_id)
+  return _s;
+}
+inline const std::string& UploadQuery::_internal_upload_id() const {
+  return _impl_.upload_id_.Get();
+}
+inline void UploadQuery::_internal_set_upload_id(const std::string& value) {
+  
+  _impl_.upload_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadQuery::_internal_mutable_upload_id() {
+  
+  return _impl_.upload_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadQuery::release_upload_id() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadQuery.upload_id)
+  return _impl_.upload_id_.Release();
+}
+inline void UploadQuery::set_allocated_upload_id(std::string* upload_id) {
+  if (upload_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.upload_id_.SetAllocated(upload_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.upload_id_.IsDefault()) {
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadQuery.upload_id)
+}
+
+// -------------------------------------------------------------------
+
+// UploadStatus
+
+// string upload_id = 1;
+inline void UploadStatus::clear_upload_id() {
+  _impl_.upload_id_.ClearToEmpty();
+}
+inline const std::string& UploadStatus::upload_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.upload_id)
+  return _internal_upload_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadStatus::set_upload_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.upload_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.upload_id)
+}
+inline std::string* UploadStatus::mutable_upload_id() {
+  std::string* _s = _internal_mutable_upload_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadStatus.upload_id)
+  return _s;
+}
+inline const std::string& UploadStatus::_internal_upload_id() const {
+  return _impl_.upload_id_.Get();
+}
+inline void UploadStatus::_internal_set_upload_id(const std::string& value) {
+  
+  _impl_.upload_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadStatus::_internal_mutable_upload_id() {
+  
+  return _impl_.upload_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadStatus::release_upload_id() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadStatus.upload_id)
+  return _impl_.upload_id_.Release();
+}
+inline void UploadStatus::set_allocated_upload_id(std::string* upload_id) {
+  if (upload_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.upload_id_.SetAllocated(upload_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.upload_id_.IsDefault()) {
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadStatus.upload_id)
+}
+
+// uint64 committed_offset = 2;
+inline void UploadStatus::clear_committed_offset() {
+  _impl_.committed_offset_ = uint64_t{0u};
+}
+inline uint64_t UploadStatus::_internal_committed_offset() const {
+  return _impl_.committed_offset_;
+}
+inline uint64_t UploadStatus::committed_offset() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.committed_offset)
+  return _internal_committed_offset();
+}
+inline void UploadStatus::_internal_set_committed_offset(uint64_t value) {
+  
+  _impl_.committed_offset_ = value;
+}
+inline void UploadStatus::set_committed_offset(uint64_t value) {
+  _internal_set_committed_offset(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.committed_offset)
+}
+
+// uint64 total_size = 3;
+inline void UploadStatus::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
+}
+inline uint64_t UploadStatus::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline uint64_t UploadStatus::total_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.total_size)
+  return _internal_total_size();
+}
+inline void UploadStatus::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void UploadStatus::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.total_size)
+}
+
+// bool complete = 4;
+inline void UploadStatus::clear_complete() {
+  _impl_.complete_ = false;
+}
+inline bool UploadStatus::_internal_complete() const {
+  return _impl_.complete_;
+}
+inline bool UploadStatus::complete() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.complete)
+  return _internal_complete();
+}
+inline void UploadStatus::_internal_set_complete(bool value) {
+  
+  _impl_.complete_ = value;
+}
+inline void UploadStatus::set_complete(bool value) {
+  _internal_set_complete(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.complete)
+}
+
+// bool success = 5;
+inline void UploadStatus::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool UploadStatus::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool UploadStatus::success() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.success)
+  return _internal_success();
+}
+inline void UploadStatus::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void UploadStatus::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.success)
+}
+
+// string status_message = 6;
+inline void UploadStatus::clear_status_message() {
+  _impl_.status_message_.ClearToEmpty();
+}
+inline const std::string& UploadStatus::status_message() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.status_message)
+  return _internal_status_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadStatus::set_status_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.status_message)
+}
+inline std::string* UploadStatus::mutable_status_message() {
+  std::string* _s = _internal_mutable_status_message();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadStatus.status_message)
+  return _s;
+}
+inline const std::string& UploadStatus::_internal_status_message() const {
+  return _impl_.status_message_.Get();
+}
+inline void UploadStatus::_internal_set_status_message(const std::string& value) {
+  
+  _impl_.status_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadStatus::_internal_mutable_status_message() {
+  
+  return _impl_.status_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadStatus::release_status_message() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadStatus.status_message)
+  return _impl_.status_message_.Release();
+}
+inline void UploadStatus::set_allocated_status_message(std::string* status_message) {
+  if (status_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_message_.IsDefault()) {
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadStatus.status_message)
+}
+
+// string sha256 = 7;
+inline void UploadStatus::clear_sha256() {
+  _impl_.sha256_.ClearToEmpty();
+}
+inline const std::string& UploadStatus::sha256() const {
+  // @@protoc_insertion_point(field_get:file_processor.UploadStatus.sha256)
+  return _internal_sha256();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadStatus::set_sha256(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sha256_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.UploadStatus.sha256)
+}
+inline std::string* UploadStatus::mutable_sha256() {
+  std::string* _s = _internal_mutable_sha256();
+  // @@protoc_insertion_point(field_mutable:file_processor.UploadStatus.sha256)
+  return _s;
+}
+inline const std::string& UploadStatus::_internal_sha256() const {
+  return _impl_.sha256_.Get();
+}
+inline void UploadStatus::_internal_set_sha256(const std::string& value) {
+  
+  _impl_.sha256_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadStatus::_internal_mutable_sha256() {
+  
+  return _impl_.sha256_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadStatus::release_sha256() {
+  // @@protoc_insertion_point(field_release:file_processor.UploadStatus.sha256)
+  return _impl_.sha256_.Release();
+}
+inline void UploadStatus::set_allocated_sha256(std::string* sha256) {
+  if (sha256 != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sha256_.SetAllocated(sha256, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sha256_.IsDefault()) {
+    _impl_.sha256_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.UploadStatus.sha256)
+}
+
+// -------------------------------------------------------------------
+
+// FetchOutputRequest
+
+// string result_handle = 1;
+inline void FetchOutputRequest::clear_result_handle() {
+  _impl_.result_handle_.ClearToEmpty();
+}
+inline const std::string& FetchOutputRequest::result_handle() const {
+  // @@protoc_insertion_point(field_get:file_processor.FetchOutputRequest.result_handle)
+  return _internal_result_handle();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FetchOutputRequest::set_result_handle(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_handle_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.FetchOutputRequest.result_handle)
+}
+inline std::string* FetchOutputRequest::mutable_result_handle() {
+  std::string* _s = _internal_mutable_result_handle();
+  // @@protoc_insertion_point(field_mutable:file_processor.FetchOutputRequest.result_handle)
+  return _s;
+}
+inline const std::string& FetchOutputRequest::_internal_result_handle() const {
+  return _impl_.result_handle_.Get();
+}
+inline void FetchOutputRequest::_internal_set_result_handle(const std::string& value) {
+  
+  _impl_.result_handle_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FetchOutputRequest::_internal_mutable_result_handle() {
+  
+  return _impl_.result_handle_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FetchOutputRequest::release_result_handle() {
+  // @@protoc_insertion_point(field_release:file_processor.FetchOutputRequest.result_handle)
+  return _impl_.result_handle_.Release();
+}
+inline void FetchOutputRequest::set_allocated_result_handle(std::string* result_handle) {
+  if (result_handle != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_handle_.SetAllocated(result_handle, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_handle_.IsDefault()) {
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.FetchOutputRequest.result_handle)
+}
+
+// uint64 offset = 2;
+inline void FetchOutputRequest::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t FetchOutputRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t FetchOutputRequest::offset() const {
+  // @@protoc_insertion_point(field_get:file_processor.FetchOutputRequest.offset)
+  return _internal_offset();
+}
+inline void FetchOutputRequest::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void FetchOutputRequest::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:file_processor.FetchOutputRequest.offset)
+}
+
+// uint64 length = 3;
+inline void FetchOutputRequest::clear_length() {
+  _impl_.length_ = uint64_t{0u};
+}
+inline uint64_t FetchOutputRequest::_internal_length() const {
+  return _impl_.length_;
+}
+inline uint64_t FetchOutputRequest::length() const {
+  // @@protoc_insertion_point(field_get:file_processor.FetchOutputRequest.length)
+  return _internal_length();
+}
+inline void FetchOutputRequest::_internal_set_length(uint64_t value) {
+  
+  _impl_.length_ = value;
+}
+inline void FetchOutputRequest::set_length(uint64_t value) {
+  _internal_set_length(value);
+  // @@protoc_insertion_point(field_set:file_processor.FetchOutputRequest.length)
+}
+
+// -------------------------------------------------------------------
+
+// JobOutput
+
+// string file_name = 1;
+inline void JobOutput::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& JobOutput::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobOutput.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobOutput::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.JobOutput.file_name)
+}
+inline std::string* JobOutput::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobOutput.file_name)
+  return _s;
+}
+inline const std::string& JobOutput::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void JobOutput::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobOutput::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobOutput::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.JobOutput.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void JobOutput::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobOutput.file_name)
+}
+
+// string result_handle = 2;
+inline void JobOutput::clear_result_handle() {
+  _impl_.result_handle_.ClearToEmpty();
+}
+inline const std::string& JobOutput::result_handle() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobOutput.result_handle)
+  return _internal_result_handle();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobOutput::set_result_handle(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_handle_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.JobOutput.result_handle)
+}
+inline std::string* JobOutput::mutable_result_handle() {
+  std::string* _s = _internal_mutable_result_handle();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobOutput.result_handle)
+  return _s;
+}
+inline const std::string& JobOutput::_internal_result_handle() const {
+  return _impl_.result_handle_.Get();
+}
+inline void JobOutput::_internal_set_result_handle(const std::string& value) {
+  
+  _impl_.result_handle_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobOutput::_internal_mutable_result_handle() {
+  
+  return _impl_.result_handle_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobOutput::release_result_handle() {
+  // @@protoc_insertion_point(field_release:file_processor.JobOutput.result_handle)
+  return _impl_.result_handle_.Release();
+}
+inline void JobOutput::set_allocated_result_handle(std::string* result_handle) {
+  if (result_handle != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_handle_.SetAllocated(result_handle, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_handle_.IsDefault()) {
+    _impl_.result_handle_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobOutput.result_handle)
+}
+
+// uint64 output_size = 3;
+inline void JobOutput::clear_output_size() {
+  _impl_.output_size_ = uint64_t{0u};
+}
+inline uint64_t JobOutput::_internal_output_size() const {
+  return _impl_.output_size_;
+}
+inline uint64_t JobOutput::output_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobOutput.output_size)
+  return _internal_output_size();
+}
+inline void JobOutput::_internal_set_output_size(uint64_t value) {
+  
+  _impl_.output_size_ = value;
+}
+inline void JobOutput::set_output_size(uint64_t value) {
+  _internal_set_output_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.JobOutput.output_size)
+}
+
+// -------------------------------------------------------------------
+
+// JobQuery
+
+// string job_id = 1;
+inline void JobQuery::clear_job_id() {
+  _impl_.job_id_.ClearToEmpty();
+}
+inline const std::string& JobQuery::job_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobQuery.job_id)
+  return _internal_job_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobQuery::set_job_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.job_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.JobQuery.job_id)
+}
+inline std::string* JobQuery::mutable_job_id() {
+  std::string* _s = _internal_mutable_job_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobQuery.job_id)
+  return _s;
+}
+inline const std::string& JobQuery::_internal_job_id() const {
+  return _impl_.job_id_.Get();
+}
+inline void JobQuery::_internal_set_job_id(const std::string& value) {
+  
+  _impl_.job_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobQuery::_internal_mutable_job_id() {
+  
+  return _impl_.job_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobQuery::release_job_id() {
+  // @@protoc_insertion_point(field_release:file_processor.JobQuery.job_id)
+  return _impl_.job_id_.Release();
+}
+inline void JobQuery::set_allocated_job_id(std::string* job_id) {
+  if (job_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.job_id_.SetAllocated(job_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.job_id_.IsDefault()) {
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobQuery.job_id)
+}
+
+// -------------------------------------------------------------------
+
+// JobStatus
+
+// string job_id = 1;
+inline void JobStatus::clear_job_id() {
+  _impl_.job_id_.ClearToEmpty();
+}
+inline const std::string& JobStatus::job_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobStatus.job_id)
+  return _internal_job_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobStatus::set_job_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.job_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.JobStatus.job_id)
+}
+inline std::string* JobStatus::mutable_job_id() {
+  std::string* _s = _internal_mutable_job_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobStatus.job_id)
+  return _s;
+}
+inline const std::string& JobStatus::_internal_job_id() const {
+  return _impl_.job_id_.Get();
+}
+inline void JobStatus::_internal_set_job_id(const std::string& value) {
+  
+  _impl_.job_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobStatus::_internal_mutable_job_id() {
+  
+  return _impl_.job_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobStatus::release_job_id() {
+  // @@protoc_insertion_point(field_release:file_processor.JobStatus.job_id)
+  return _impl_.job_id_.Release();
+}
+inline void JobStatus::set_allocated_job_id(std::string* job_id) {
+  if (job_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.job_id_.SetAllocated(job_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.job_id_.IsDefault()) {
+    _impl_.job_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobStatus.job_id)
+}
+
+// .file_processor.JobState state = 2;
+inline void JobStatus::clear_state() {
+  _impl_.state_ = 0;
+}
+inline ::file_processor::JobState JobStatus::_internal_state() const {
+  return static_cast< ::file_processor::JobState >(_impl_.state_);
+}
+inline ::file_processor::JobState JobStatus::state() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobStatus.state)
+  return _internal_state();
+}
+inline void JobStatus::_internal_set_state(::file_processor::JobState value) {
+  
+  _impl_.state_ = value;
+}
+inline void JobStatus::set_state(::file_processor::JobState value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:file_processor.JobStatus.state)
+}
+
+// string status_message = 3;
+inline void JobStatus::clear_status_message() {
+  _impl_.status_message_.ClearToEmpty();
+}
+inline const std::string& JobStatus::status_message() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobStatus.status_message)
+  return _internal_status_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobStatus::set_status_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.JobStatus.status_message)
+}
+inline std::string* JobStatus::mutable_status_message() {
+  std::string* _s = _internal_mutable_status_message();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobStatus.status_message)
+  return _s;
+}
+inline const std::string& JobStatus::_internal_status_message() const {
+  return _impl_.status_message_.Get();
+}
+inline void JobStatus::_internal_set_status_message(const std::string& value) {
+  
+  _impl_.status_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobStatus::_internal_mutable_status_message() {
+  
+  return _impl_.status_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobStatus::release_status_message() {
+  // @@protoc_insertion_point(field_release:file_processor.JobStatus.status_message)
+  return _impl_.status_message_.Release();
+}
+inline void JobStatus::set_allocated_status_message(std::string* status_message) {
+  if (status_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_message_.IsDefault()) {
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobStatus.status_message)
+}
+
+// repeated .file_processor.JobOutput outputs = 4;
+inline int JobStatus::_internal_outputs_size() const {
+  return _impl_.outputs_.size();
+}
+inline int JobStatus::outputs_size() const {
+  return _internal_outputs_size();
+}
+inline void JobStatus::clear_outputs() {
+  _impl_.outputs_.Clear();
+}
+inline ::file_processor::JobOutput* JobStatus::mutable_outputs(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.JobStatus.outputs)
+  return _impl_.outputs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::JobOutput >*
+JobStatus::mutable_outputs() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.JobStatus.outputs)
+  return &_impl_.outputs_;
+}
+inline const ::file_processor::JobOutput& JobStatus::_internal_outputs(int index) const {
+  return _impl_.outputs_.Get(index);
+}
+inline const ::file_processor::JobOutput& JobStatus::outputs(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.JobStatus.outputs)
+  return _internal_outputs(index);
+}
+inline ::file_processor::JobOutput* JobStatus::_internal_add_outputs() {
+  return _impl_.outputs_.Add();
+}
+inline ::file_processor::JobOutput* JobStatus::add_outputs() {
+  ::file_processor::JobOutput* _add = _internal_add_outputs();
+  // @@protoc_insertion_point(field_add:file_processor.JobStatus.outputs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::JobOutput >&
+JobStatus::outputs() const {
+  // @@protoc_insertion_point(field_list:file_processor.JobStatus.outputs)
+  return _impl_.outputs_;
+}
+
+// -------------------------------------------------------------------
+
+// SignatureRequest
+
+// string basis_sha256 = 1;
+inline void SignatureRequest::clear_basis_sha256() {
+  _impl_.basis_sha256_.ClearToEmpty();
+}
+inline const std::string& SignatureRequest::basis_sha256() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureRequest.basis_sha256)
+  return _internal_basis_sha256();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignatureRequest::set_basis_sha256(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.basis_sha256_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.SignatureRequest.basis_sha256)
+}
+inline std::string* SignatureRequest::mutable_basis_sha256() {
+  std::string* _s = _internal_mutable_basis_sha256();
+  // @@protoc_insertion_point(field_mutable:file_processor.SignatureRequest.basis_sha256)
+  return _s;
+}
+inline const std::string& SignatureRequest::_internal_basis_sha256() const {
+  return _impl_.basis_sha256_.Get();
+}
+inline void SignatureRequest::_internal_set_basis_sha256(const std::string& value) {
+  
+  _impl_.basis_sha256_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignatureRequest::_internal_mutable_basis_sha256() {
+  
+  return _impl_.basis_sha256_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignatureRequest::release_basis_sha256() {
+  // @@protoc_insertion_point(field_release:file_processor.SignatureRequest.basis_sha256)
+  return _impl_.basis_sha256_.Release();
+}
+inline void SignatureRequest::set_allocated_basis_sha256(std::string* basis_sha256) {
+  if (basis_sha256 != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.basis_sha256_.SetAllocated(basis_sha256, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.basis_sha256_.IsDefault()) {
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.SignatureRequest.basis_sha256)
+}
+
+// uint32 block_size = 2;
+inline void SignatureRequest::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t SignatureRequest::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t SignatureRequest::block_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureRequest.block_size)
+  return _internal_block_size();
+}
+inline void SignatureRequest::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void SignatureRequest::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.SignatureRequest.block_size)
+}
+
+// -------------------------------------------------------------------
+
+// BlockSignature
+
+// fixed32 weak = 1;
+inline void BlockSignature::clear_weak() {
+  _impl_.weak_ = 0u;
+}
+inline uint32_t BlockSignature::_internal_weak() const {
+  return _impl_.weak_;
+}
+inline uint32_t BlockSignature::weak() const {
+  // @@protoc_insertion_point(field_get:file_processor.BlockSignature.weak)
+  return _internal_weak();
+}
+inline void BlockSignature::_internal_set_weak(uint32_t value) {
+  
+  _impl_.weak_ = value;
+}
+inline void BlockSignature::set_weak(uint32_t value) {
+  _internal_set_weak(value);
+  // @@protoc_insertion_point(field_set:file_processor.BlockSignature.weak)
+}
+
+// bytes strong = 2;
+inline void BlockSignature::clear_strong() {
+  _impl_.strong_.ClearToEmpty();
+}
+inline const std::string& BlockSignature::strong() const {
+  // @@protoc_insertion_point(field_get:file_processor.BlockSignature.strong)
+  return _internal_strong();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BlockSignature::set_strong(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.strong_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.BlockSignature.strong)
+}
+inline std::string* BlockSignature::mutable_strong() {
+  std::string* _s = _internal_mutable_strong();
+  // @@protoc_insertion_point(field_mutable:file_processor.BlockSignature.strong)
+  return _s;
+}
+inline const std::string& BlockSignature::_internal_strong() const {
+  return _impl_.strong_.Get();
+}
+inline void BlockSignature::_internal_set_strong(const std::string& value) {
+  
+  _impl_.strong_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BlockSignature::_internal_mutable_strong() {
+  
+  return _impl_.strong_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BlockSignature::release_strong() {
+  // @@protoc_insertion_point(field_release:file_processor.BlockSignature.strong)
+  return _impl_.strong_.Release();
+}
+inline void BlockSignature::set_allocated_strong(std::string* strong) {
+  if (strong != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.strong_.SetAllocated(strong, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.strong_.IsDefault()) {
+    _impl_.strong_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.BlockSignature.strong)
+}
+
+// -------------------------------------------------------------------
+
+// SignatureBatch
+
+// bool success = 1;
+inline void SignatureBatch::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool SignatureBatch::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool SignatureBatch::success() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.success)
+  return _internal_success();
+}
+inline void SignatureBatch::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void SignatureBatch::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:file_processor.SignatureBatch.success)
+}
+
+// string status_message = 2;
+inline void SignatureBatch::clear_status_message() {
+  _impl_.status_message_.ClearToEmpty();
+}
+inline const std::string& SignatureBatch::status_message() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.status_message)
+  return _internal_status_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SignatureBatch::set_status_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.SignatureBatch.status_message)
+}
+inline std::string* SignatureBatch::mutable_status_message() {
+  std::string* _s = _internal_mutable_status_message();
+  // @@protoc_insertion_point(field_mutable:file_processor.SignatureBatch.status_message)
+  return _s;
+}
+inline const std::string& SignatureBatch::_internal_status_message() const {
+  return _impl_.status_message_.Get();
+}
+inline void SignatureBatch::_internal_set_status_message(const std::string& value) {
+  
+  _impl_.status_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SignatureBatch::_internal_mutable_status_message() {
+  
+  return _impl_.status_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SignatureBatch::release_status_message() {
+  // @@protoc_insertion_point(field_release:file_processor.SignatureBatch.status_message)
+  return _impl_.status_message_.Release();
+}
+inline void SignatureBatch::set_allocated_status_message(std::string* status_message) {
+  if (status_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_message_.IsDefault()) {
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.SignatureBatch.status_message)
+}
+
+// uint32 block_size = 3;
+inline void SignatureBatch::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t SignatureBatch::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t SignatureBatch::block_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.block_size)
+  return _internal_block_size();
+}
+inline void SignatureBatch::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void SignatureBatch::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.SignatureBatch.block_size)
+}
+
+// uint64 basis_size = 4;
+inline void SignatureBatch::clear_basis_size() {
+  _impl_.basis_size_ = uint64_t{0u};
+}
+inline uint64_t SignatureBatch::_internal_basis_size() const {
+  return _impl_.basis_size_;
+}
+inline uint64_t SignatureBatch::basis_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.basis_size)
+  return _internal_basis_size();
+}
+inline void SignatureBatch::_internal_set_basis_size(uint64_t value) {
+  
+  _impl_.basis_size_ = value;
+}
+inline void SignatureBatch::set_basis_size(uint64_t value) {
+  _internal_set_basis_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.SignatureBatch.basis_size)
+}
+
+// repeated .file_processor.BlockSignature blocks = 5;
+inline int SignatureBatch::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int SignatureBatch::blocks_size() const {
+  return _internal_blocks_size();
+}
+inline void SignatureBatch::clear_blocks() {
+  _impl_.blocks_.Clear();
+}
+inline ::file_processor::BlockSignature* SignatureBatch::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.SignatureBatch.blocks)
+  return _impl_.blocks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::BlockSignature >*
+SignatureBatch::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.SignatureBatch.blocks)
+  return &_impl_.blocks_;
+}
+inline const ::file_processor::BlockSignature& SignatureBatch::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
+}
+inline const ::file_processor::BlockSignature& SignatureBatch::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.blocks)
+  return _internal_blocks(index);
+}
+inline ::file_processor::BlockSignature* SignatureBatch::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline ::file_processor::BlockSignature* SignatureBatch::add_blocks() {
+  ::file_processor::BlockSignature* _add = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add:file_processor.SignatureBatch.blocks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::BlockSignature >&
+SignatureBatch::blocks() const {
+  // @@protoc_insertion_point(field_list:file_processor.SignatureBatch.blocks)
+  return _impl_.blocks_;
+}
+
+// uint64 first_block = 6;
+inline void SignatureBatch::clear_first_block() {
+  _impl_.first_block_ = uint64_t{0u};
+}
+inline uint64_t SignatureBatch::_internal_first_block() const {
+  return _impl_.first_block_;
+}
+inline uint64_t SignatureBatch::first_block() const {
+  // @@protoc_insertion_point(field_get:file_processor.SignatureBatch.first_block)
+  return _internal_first_block();
+}
+inline void SignatureBatch::_internal_set_first_block(uint64_t value) {
+  
+  _impl_.first_block_ = value;
+}
+inline void SignatureBatch::set_first_block(uint64_t value) {
+  _internal_set_first_block(value);
+  // @@protoc_insertion_point(field_set:file_processor.SignatureBatch.first_block)
+}
+
+// -------------------------------------------------------------------
+
+// BlockRange
+
+// uint64 first_block = 1;
+inline void BlockRange::clear_first_block() {
+  _impl_.first_block_ = uint64_t{0u};
+}
+inline uint64_t BlockRange::_internal_first_block() const {
+  return _impl_.first_block_;
+}
+inline uint64_t BlockRange::first_block() const {
+  // @@protoc_insertion_point(field_get:file_processor.BlockRange.first_block)
+  return _internal_first_block();
+}
+inline void BlockRange::_internal_set_first_block(uint64_t value) {
+  
+  _impl_.first_block_ = value;
+}
+inline void BlockRange::set_first_block(uint64_t value) {
+  _internal_set_first_block(value);
+  // @@protoc_insertion_point(field_set:file_processor.BlockRange.first_block)
+}
+
+// uint32 count = 2;
+inline void BlockRange::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t BlockRange::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t BlockRange::count() const {
+  // @@protoc_insertion_point(field_get:file_processor.BlockRange.count)
+  return _internal_count();
+}
+inline void BlockRange::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void BlockRange::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:file_processor.BlockRange.count)
+}
+
+// -------------------------------------------------------------------
+
+// DeltaOp
+
+// bytes literal = 1;
+inline bool DeltaOp::_internal_has_literal() const {
+  return op_case() == kLiteral;
+}
+inline bool DeltaOp::has_literal() const {
+  return _internal_has_literal();
+}
+inline void DeltaOp::set_has_literal() {
+  _impl_._oneof_case_[0] = kLiteral;
+}
+inline void DeltaOp::clear_literal() {
+  if (_internal_has_literal()) {
+    _impl_.op_.literal_.Destroy();
+    clear_has_op();
+  }
+}
+inline const std::string& DeltaOp::literal() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaOp.literal)
+  return _internal_literal();
+}
+template <typename ArgT0, typename... ArgT>
+inline void DeltaOp::set_literal(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_literal()) {
+    clear_op();
+    set_has_literal();
+    _impl_.op_.literal_.InitDefault();
+  }
+  _impl_.op_.literal_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.DeltaOp.literal)
+}
+inline std::string* DeltaOp::mutable_literal() {
+  std::string* _s = _internal_mutable_literal();
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaOp.literal)
+  return _s;
+}
+inline const std::string& DeltaOp::_internal_literal() const {
+  if (_internal_has_literal()) {
+    return _impl_.op_.literal_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void DeltaOp::_internal_set_literal(const std::string& value) {
+  if (!_internal_has_literal()) {
+    clear_op();
+    set_has_literal();
+    _impl_.op_.literal_.InitDefault();
+  }
+  _impl_.op_.literal_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeltaOp::_internal_mutable_literal() {
+  if (!_internal_has_literal()) {
+    clear_op();
+    set_has_literal();
+    _impl_.op_.literal_.InitDefault();
+  }
+  return _impl_.op_.literal_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* DeltaOp::release_literal() {
+  // @@protoc_insertion_point(field_release:file_processor.DeltaOp.literal)
+  if (_internal_has_literal()) {
+    clear_has_op();
+    return _impl_.op_.literal_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void DeltaOp::set_allocated_literal(std::string* literal) {
+  if (has_op()) {
+    clear_op();
+  }
+  if (literal != nullptr) {
+    set_has_literal();
+    _impl_.op_.literal_.InitAllocated(literal, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:file_processor.DeltaOp.literal)
+}
+
+// .file_processor.BlockRange copy = 2;
+inline bool DeltaOp::_internal_has_copy() const {
+  return op_case() == kCopy;
+}
+inline bool DeltaOp::has_copy() const {
+  return _internal_has_copy();
+}
+inline void DeltaOp::set_has_copy() {
+  _impl_._oneof_case_[0] = kCopy;
+}
+inline void DeltaOp::clear_copy() {
+  if (_internal_has_copy()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.copy_;
+    }
+    clear_has_op();
+  }
+}
+inline ::file_processor::BlockRange* DeltaOp::release_copy() {
+  // @@protoc_insertion_point(field_release:file_processor.DeltaOp.copy)
+  if (_internal_has_copy()) {
+    clear_has_op();
+    ::file_processor::BlockRange* temp = _impl_.op_.copy_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.copy_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::file_processor::BlockRange& DeltaOp::_internal_copy() const {
+  return _internal_has_copy()
+      ? *_impl_.op_.copy_
+      : reinterpret_cast< ::file_processor::BlockRange&>(::file_processor::_BlockRange_default_instance_);
+}
+inline const ::file_processor::BlockRange& DeltaOp::copy() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaOp.copy)
+  return _internal_copy();
+}
+inline ::file_processor::BlockRange* DeltaOp::unsafe_arena_release_copy() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.DeltaOp.copy)
+  if (_internal_has_copy()) {
+    clear_has_op();
+    ::file_processor::BlockRange* temp = _impl_.op_.copy_;
+    _impl_.op_.copy_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void DeltaOp::unsafe_arena_set_allocated_copy(::file_processor::BlockRange* copy) {
+  clear_op();
+  if (copy) {
+    set_has_copy();
+    _impl_.op_.copy_ = copy;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.DeltaOp.copy)
+}
+inline ::file_processor::BlockRange* DeltaOp::_internal_mutable_copy() {
+  if (!_internal_has_copy()) {
+    clear_op();
+    set_has_copy();
+    _impl_.op_.copy_ = CreateMaybeMessage< ::file_processor::BlockRange >(GetArenaForAllocation());
+  }
+  return _impl_.op_.copy_;
+}
+inline ::file_processor::BlockRange* DeltaOp::mutable_copy() {
+  ::file_processor::BlockRange* _msg = _internal_mutable_copy();
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaOp.copy)
+  return _msg;
+}
+
+inline bool DeltaOp::has_op() const {
+  return op_case() != OP_NOT_SET;
+}
+inline void DeltaOp::clear_has_op() {
+  _impl_._oneof_case_[0] = OP_NOT_SET;
+}
+inline DeltaOp::OpCase DeltaOp::op_case() const {
+  return DeltaOp::OpCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// DeltaChunk
+
+// string basis_sha256 = 1;
+inline void DeltaChunk::clear_basis_sha256() {
+  _impl_.basis_sha256_.ClearToEmpty();
+}
+inline const std::string& DeltaChunk::basis_sha256() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.basis_sha256)
+  return _internal_basis_sha256();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeltaChunk::set_basis_sha256(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.basis_sha256_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.DeltaChunk.basis_sha256)
+}
+inline std::string* DeltaChunk::mutable_basis_sha256() {
+  std::string* _s = _internal_mutable_basis_sha256();
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaChunk.basis_sha256)
+  return _s;
+}
+inline const std::string& DeltaChunk::_internal_basis_sha256() const {
+  return _impl_.basis_sha256_.Get();
+}
+inline void DeltaChunk::_internal_set_basis_sha256(const std::string& value) {
+  
+  _impl_.basis_sha256_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::_internal_mutable_basis_sha256() {
+  
+  return _impl_.basis_sha256_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::release_basis_sha256() {
+  // @@protoc_insertion_point(field_release:file_processor.DeltaChunk.basis_sha256)
+  return _impl_.basis_sha256_.Release();
+}
+inline void DeltaChunk::set_allocated_basis_sha256(std::string* basis_sha256) {
+  if (basis_sha256 != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.basis_sha256_.SetAllocated(basis_sha256, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.basis_sha256_.IsDefault()) {
+    _impl_.basis_sha256_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.DeltaChunk.basis_sha256)
+}
+
+// uint32 block_size = 2;
+inline void DeltaChunk::clear_block_size() {
+  _impl_.block_size_ = 0u;
+}
+inline uint32_t DeltaChunk::_internal_block_size() const {
+  return _impl_.block_size_;
+}
+inline uint32_t DeltaChunk::block_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.block_size)
+  return _internal_block_size();
+}
+inline void DeltaChunk::_internal_set_block_size(uint32_t value) {
+  
+  _impl_.block_size_ = value;
+}
+inline void DeltaChunk::set_block_size(uint32_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.DeltaChunk.block_size)
+}
+
+// string file_name = 3;
+inline void DeltaChunk::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& DeltaChunk::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeltaChunk::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.DeltaChunk.file_name)
+}
+inline std::string* DeltaChunk::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaChunk.file_name)
+  return _s;
+}
+inline const std::string& DeltaChunk::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void DeltaChunk::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.DeltaChunk.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void DeltaChunk::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.DeltaChunk.file_name)
+}
+
+// uint64 total_size = 4;
+inline void DeltaChunk::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
+}
+inline uint64_t DeltaChunk::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline uint64_t DeltaChunk::total_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.total_size)
+  return _internal_total_size();
+}
+inline void DeltaChunk::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void DeltaChunk::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.DeltaChunk.total_size)
+}
+
+// string file_sha256 = 5;
+inline void DeltaChunk::clear_file_sha256() {
+  _impl_.file_sha256_.ClearToEmpty();
+}
+inline const std::string& DeltaChunk::file_sha256() const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.file_sha256)
+  return _internal_file_sha256();
+}
+template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FileChunk::set_content(ArgT0&& arg0, ArgT... args) {
+void DeltaChunk::set_file_sha256(ArgT0&& arg0, ArgT... args) {
  
- _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:file_processor.FileChunk.content)
+ _impl_.file_sha256_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.DeltaChunk.file_sha256)
 }
-inline std::string* FileChunk::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileChunk.content)
+inline std::string* DeltaChunk::mutable_file_sha256() {
+  std::string* _s = _internal_mutable_file_sha256();
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaChunk.file_sha256)
+  return _s;
+}
+inline const std::string& DeltaChunk::_internal_file_sha256() const {
+  return _impl_.file_sha256_.Get();
+}
+inline void DeltaChunk::_internal_set_file_sha256(const std::string& value) {
+  
+  _impl_.file_sha256_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::_internal_mutable_file_sha256() {
+  
+  return _impl_.file_sha256_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeltaChunk::release_file_sha256() {
+  // @@protoc_insertion_point(field_release:file_processor.DeltaChunk.file_sha256)
+  return _impl_.file_sha256_.Release();
+}
+inline void DeltaChunk::set_allocated_file_sha256(std::string* file_sha256) {
+  if (file_sha256 != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_sha256_.SetAllocated(file_sha256, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_sha256_.IsDefault()) {
+    _impl_.file_sha256_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.DeltaChunk.file_sha256)
+}
+
+// repeated .file_processor.DeltaOp ops = 6;
+inline int DeltaChunk::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int DeltaChunk::ops_size() const {
+  return _internal_ops_size();
+}
+inline void DeltaChunk::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::file_processor::DeltaOp* DeltaChunk::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.DeltaChunk.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::DeltaOp >*
+DeltaChunk::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.DeltaChunk.ops)
+  return &_impl_.ops_;
+}
+inline const ::file_processor::DeltaOp& DeltaChunk::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::file_processor::DeltaOp& DeltaChunk::ops(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.DeltaChunk.ops)
+  return _internal_ops(index);
+}
+inline ::file_processor::DeltaOp* DeltaChunk::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::file_processor::DeltaOp* DeltaChunk::add_ops() {
+  ::file_processor::DeltaOp* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:file_processor.DeltaChunk.ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::DeltaOp >&
+DeltaChunk::ops() const {
+  // @@protoc_insertion_point(field_list:file_processor.DeltaChunk.ops)
+  return _impl_.ops_;
+}
+
+// -------------------------------------------------------------------
+
+// LatencyQuery
+
+// string operation = 1;
+inline void LatencyQuery::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& LatencyQuery::operation() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencyQuery.operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LatencyQuery::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.LatencyQuery.operation)
+}
+inline std::string* LatencyQuery::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:file_processor.LatencyQuery.operation)
+  return _s;
+}
+inline const std::string& LatencyQuery::_internal_operation() const {
+  return _impl_.operation_.Get();
+}
+inline void LatencyQuery::_internal_set_operation(const std::string& value) {
+  
+  _impl_.operation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LatencyQuery::_internal_mutable_operation() {
+  
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LatencyQuery::release_operation() {
+  // @@protoc_insertion_point(field_release:file_processor.LatencyQuery.operation)
+  return _impl_.operation_.Release();
+}
+inline void LatencyQuery::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.LatencyQuery.operation)
+}
+
+// -------------------------------------------------------------------
+
+// LatencySeries
+
+// string operation = 1;
+inline void LatencySeries::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& LatencySeries::operation() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LatencySeries::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.operation)
+}
+inline std::string* LatencySeries::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:file_processor.LatencySeries.operation)
+  return _s;
+}
+inline const std::string& LatencySeries::_internal_operation() const {
+  return _impl_.operation_.Get();
+}
+inline void LatencySeries::_internal_set_operation(const std::string& value) {
+  
+  _impl_.operation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LatencySeries::_internal_mutable_operation() {
+  
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LatencySeries::release_operation() {
+  // @@protoc_insertion_point(field_release:file_processor.LatencySeries.operation)
+  return _impl_.operation_.Release();
+}
+inline void LatencySeries::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.LatencySeries.operation)
+}
+
+// bool success = 2;
+inline void LatencySeries::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool LatencySeries::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool LatencySeries::success() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.success)
+  return _internal_success();
+}
+inline void LatencySeries::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void LatencySeries::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.success)
+}
+
+// string phase = 3;
+inline void LatencySeries::clear_phase() {
+  _impl_.phase_.ClearToEmpty();
+}
+inline const std::string& LatencySeries::phase() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.phase)
+  return _internal_phase();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LatencySeries::set_phase(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.phase_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.phase)
+}
+inline std::string* LatencySeries::mutable_phase() {
+  std::string* _s = _internal_mutable_phase();
+  // @@protoc_insertion_point(field_mutable:file_processor.LatencySeries.phase)
+  return _s;
+}
+inline const std::string& LatencySeries::_internal_phase() const {
+  return _impl_.phase_.Get();
+}
+inline void LatencySeries::_internal_set_phase(const std::string& value) {
+  
+  _impl_.phase_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LatencySeries::_internal_mutable_phase() {
+  
+  return _impl_.phase_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LatencySeries::release_phase() {
+  // @@protoc_insertion_point(field_release:file_processor.LatencySeries.phase)
+  return _impl_.phase_.Release();
+}
+inline void LatencySeries::set_allocated_phase(std::string* phase) {
+  if (phase != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.phase_.SetAllocated(phase, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phase_.IsDefault()) {
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.LatencySeries.phase)
+}
+
+// uint64 count = 4;
+inline void LatencySeries::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencySeries::count() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.count)
+  return _internal_count();
+}
+inline void LatencySeries::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencySeries::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.count)
+}
+
+// uint64 sum_us = 5;
+inline void LatencySeries::clear_sum_us() {
+  _impl_.sum_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_sum_us() const {
+  return _impl_.sum_us_;
+}
+inline uint64_t LatencySeries::sum_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.sum_us)
+  return _internal_sum_us();
+}
+inline void LatencySeries::_internal_set_sum_us(uint64_t value) {
+  
+  _impl_.sum_us_ = value;
+}
+inline void LatencySeries::set_sum_us(uint64_t value) {
+  _internal_set_sum_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.sum_us)
+}
+
+// uint64 max_us = 6;
+inline void LatencySeries::clear_max_us() {
+  _impl_.max_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_max_us() const {
+  return _impl_.max_us_;
+}
+inline uint64_t LatencySeries::max_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.max_us)
+  return _internal_max_us();
+}
+inline void LatencySeries::_internal_set_max_us(uint64_t value) {
+  
+  _impl_.max_us_ = value;
+}
+inline void LatencySeries::set_max_us(uint64_t value) {
+  _internal_set_max_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.max_us)
+}
+
+// uint64 p50_us = 7;
+inline void LatencySeries::clear_p50_us() {
+  _impl_.p50_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_p50_us() const {
+  return _impl_.p50_us_;
+}
+inline uint64_t LatencySeries::p50_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.p50_us)
+  return _internal_p50_us();
+}
+inline void LatencySeries::_internal_set_p50_us(uint64_t value) {
+  
+  _impl_.p50_us_ = value;
+}
+inline void LatencySeries::set_p50_us(uint64_t value) {
+  _internal_set_p50_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.p50_us)
+}
+
+// uint64 p90_us = 8;
+inline void LatencySeries::clear_p90_us() {
+  _impl_.p90_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_p90_us() const {
+  return _impl_.p90_us_;
+}
+inline uint64_t LatencySeries::p90_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.p90_us)
+  return _internal_p90_us();
+}
+inline void LatencySeries::_internal_set_p90_us(uint64_t value) {
+  
+  _impl_.p90_us_ = value;
+}
+inline void LatencySeries::set_p90_us(uint64_t value) {
+  _internal_set_p90_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.p90_us)
+}
+
+// uint64 p99_us = 9;
+inline void LatencySeries::clear_p99_us() {
+  _impl_.p99_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_p99_us() const {
+  return _impl_.p99_us_;
+}
+inline uint64_t LatencySeries::p99_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.p99_us)
+  return _internal_p99_us();
+}
+inline void LatencySeries::_internal_set_p99_us(uint64_t value) {
+  
+  _impl_.p99_us_ = value;
+}
+inline void LatencySeries::set_p99_us(uint64_t value) {
+  _internal_set_p99_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.p99_us)
+}
+
+// uint64 p999_us = 10;
+inline void LatencySeries::clear_p999_us() {
+  _impl_.p999_us_ = uint64_t{0u};
+}
+inline uint64_t LatencySeries::_internal_p999_us() const {
+  return _impl_.p999_us_;
+}
+inline uint64_t LatencySeries::p999_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencySeries.p999_us)
+  return _internal_p999_us();
+}
+inline void LatencySeries::_internal_set_p999_us(uint64_t value) {
+  
+  _impl_.p999_us_ = value;
+}
+inline void LatencySeries::set_p999_us(uint64_t value) {
+  _internal_set_p999_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.LatencySeries.p999_us)
+}
+
+// -------------------------------------------------------------------
+
+// LatencyReport
+
+// repeated .file_processor.LatencySeries series = 1;
+inline int LatencyReport::_internal_series_size() const {
+  return _impl_.series_.size();
+}
+inline int LatencyReport::series_size() const {
+  return _internal_series_size();
+}
+inline void LatencyReport::clear_series() {
+  _impl_.series_.Clear();
+}
+inline ::file_processor::LatencySeries* LatencyReport::mutable_series(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.LatencyReport.series)
+  return _impl_.series_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::LatencySeries >*
+LatencyReport::mutable_series() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.LatencyReport.series)
+  return &_impl_.series_;
+}
+inline const ::file_processor::LatencySeries& LatencyReport::_internal_series(int index) const {
+  return _impl_.series_.Get(index);
+}
+inline const ::file_processor::LatencySeries& LatencyReport::series(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.LatencyReport.series)
+  return _internal_series(index);
+}
+inline ::file_processor::LatencySeries* LatencyReport::_internal_add_series() {
+  return _impl_.series_.Add();
+}
+inline ::file_processor::LatencySeries* LatencyReport::add_series() {
+  ::file_processor::LatencySeries* _add = _internal_add_series();
+  // @@protoc_insertion_point(field_add:file_processor.LatencyReport.series)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::LatencySeries >&
+LatencyReport::series() const {
+  // @@protoc_insertion_point(field_list:file_processor.LatencyReport.series)
+  return _impl_.series_;
+}
+
+// -------------------------------------------------------------------
+
+// ServerStateQuery
+
+// -------------------------------------------------------------------
+
+// ActiveRequest
+
+// uint64 id = 1;
+inline void ActiveRequest::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t ActiveRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t ActiveRequest::id() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.id)
+  return _internal_id();
+}
+inline void ActiveRequest::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void ActiveRequest::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.id)
+}
+
+// string rpc = 2;
+inline void ActiveRequest::clear_rpc() {
+  _impl_.rpc_.ClearToEmpty();
+}
+inline const std::string& ActiveRequest::rpc() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.rpc)
+  return _internal_rpc();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ActiveRequest::set_rpc(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rpc_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.rpc)
+}
+inline std::string* ActiveRequest::mutable_rpc() {
+  std::string* _s = _internal_mutable_rpc();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.rpc)
+  return _s;
+}
+inline const std::string& ActiveRequest::_internal_rpc() const {
+  return _impl_.rpc_.Get();
+}
+inline void ActiveRequest::_internal_set_rpc(const std::string& value) {
+  
+  _impl_.rpc_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ActiveRequest::_internal_mutable_rpc() {
+  
+  return _impl_.rpc_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ActiveRequest::release_rpc() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.rpc)
+  return _impl_.rpc_.Release();
+}
+inline void ActiveRequest::set_allocated_rpc(std::string* rpc) {
+  if (rpc != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rpc_.SetAllocated(rpc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rpc_.IsDefault()) {
+    _impl_.rpc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.rpc)
+}
+
+// string operation = 3;
+inline void ActiveRequest::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& ActiveRequest::operation() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ActiveRequest::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.operation)
+}
+inline std::string* ActiveRequest::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.operation)
   return _s;
 }
-inline const std::string& FileChunk::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& ActiveRequest::_internal_operation() const {
+  return _impl_.operation_.Get();
 }
-inline void FileChunk::_internal_set_content(const std::string& value) {
+inline void ActiveRequest::_internal_set_operation(const std::string& value) {
   
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.operation_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FileChunk::_internal_mutable_content() {
+inline std::string* ActiveRequest::_internal_mutable_operation() {
   
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FileChunk::release_content() {
-  // @@protoc_insertion_point(field_release:file_processor.FileChunk.content)
-  return _impl_.content_.Release();
+inline std::string* ActiveRequest::release_operation() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.operation)
+  return _impl_.operation_.Release();
 }
-inline void FileChunk::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void ActiveRequest::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
     
   } else {
     
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileChunk.content)
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.operation)
 }
 
-// -------------------------------------------------------------------
-
-// FileRequest
-
-// string file_name = 1;
-inline void FileRequest::clear_file_name() {
+// string file_name = 4;
+inline void ActiveRequest::clear_file_name() {
   _impl_.file_name_.ClearToEmpty();
 }
-inline const std::string& FileRequest::file_name() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.file_name)
+inline const std::string& ActiveRequest::file_name() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.file_name)
   return _internal_file_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void FileRequest::set_file_name(ArgT0&& arg0, ArgT... args) {
+void ActiveRequest::set_file_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:file_processor.FileRequest.file_name)
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.file_name)
 }
-inline std::string* FileRequest::mutable_file_name() {
+inline std::string* ActiveRequest::mutable_file_name() {
   std::string* _s = _internal_mutable_file_name();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.file_name)
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.file_name)
   return _s;
 }
-inline const std::string& FileRequest::_internal_file_name() const {
+inline const std::string& ActiveRequest::_internal_file_name() const {
   return _impl_.file_name_.Get();
 }
-inline void FileRequest::_internal_set_file_name(const std::string& value) {
+inline void ActiveRequest::_internal_set_file_name(const std::string& value) {
   
   _impl_.file_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* FileRequest::_internal_mutable_file_name() {
+inline std::string* ActiveRequest::_internal_mutable_file_name() {
   
   return _impl_.file_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* FileRequest::release_file_name() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.file_name)
+inline std::string* ActiveRequest::release_file_name() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.file_name)
   return _impl_.file_name_.Release();
 }
-inline void FileRequest::set_allocated_file_name(std::string* file_name) {
+inline void ActiveRequest::set_allocated_file_name(std::string* file_name) {
   if (file_name != nullptr) {
     
   } else {
@@ -1368,603 +10776,626 @@ inline void FileRequest::set_allocated_file_name(std::string* file_name) {
     _impl_.file_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.file_name)
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.file_name)
 }
 
-// .file_processor.FileChunk file_content = 2;
-inline bool FileRequest::_internal_has_file_content() const {
-  return this != internal_default_instance() && _impl_.file_content_ != nullptr;
-}
-inline bool FileRequest::has_file_content() const {
-  return _internal_has_file_content();
-}
-inline void FileRequest::clear_file_content() {
-  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
-    delete _impl_.file_content_;
-  }
-  _impl_.file_content_ = nullptr;
+// string phase = 5;
+inline void ActiveRequest::clear_phase() {
+  _impl_.phase_.ClearToEmpty();
 }
-inline const ::file_processor::FileChunk& FileRequest::_internal_file_content() const {
-  const ::file_processor::FileChunk* p = _impl_.file_content_;
-  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileChunk&>(
-      ::file_processor::_FileChunk_default_instance_);
+inline const std::string& ActiveRequest::phase() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.phase)
+  return _internal_phase();
 }
-inline const ::file_processor::FileChunk& FileRequest::file_content() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.file_content)
-  return _internal_file_content();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ActiveRequest::set_phase(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.phase_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.phase)
 }
-inline void FileRequest::unsafe_arena_set_allocated_file_content(
-    ::file_processor::FileChunk* file_content) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_content_);
-  }
-  _impl_.file_content_ = file_content;
-  if (file_content) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.file_content)
+inline std::string* ActiveRequest::mutable_phase() {
+  std::string* _s = _internal_mutable_phase();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.phase)
+  return _s;
 }
-inline ::file_processor::FileChunk* FileRequest::release_file_content() {
-  
-  ::file_processor::FileChunk* temp = _impl_.file_content_;
-  _impl_.file_content_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& ActiveRequest::_internal_phase() const {
+  return _impl_.phase_.Get();
 }
-inline ::file_processor::FileChunk* FileRequest::unsafe_arena_release_file_content() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.file_content)
+inline void ActiveRequest::_internal_set_phase(const std::string& value) {
   
-  ::file_processor::FileChunk* temp = _impl_.file_content_;
-  _impl_.file_content_ = nullptr;
-  return temp;
+  _impl_.phase_.Set(value, GetArenaForAllocation());
 }
-inline ::file_processor::FileChunk* FileRequest::_internal_mutable_file_content() {
+inline std::string* ActiveRequest::_internal_mutable_phase() {
   
-  if (_impl_.file_content_ == nullptr) {
-    auto* p = CreateMaybeMessage<::file_processor::FileChunk>(GetArenaForAllocation());
-    _impl_.file_content_ = p;
-  }
-  return _impl_.file_content_;
+  return _impl_.phase_.Mutable(GetArenaForAllocation());
 }
-inline ::file_processor::FileChunk* FileRequest::mutable_file_content() {
-  ::file_processor::FileChunk* _msg = _internal_mutable_file_content();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.file_content)
-  return _msg;
+inline std::string* ActiveRequest::release_phase() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.phase)
+  return _impl_.phase_.Release();
 }
-inline void FileRequest::set_allocated_file_content(::file_processor::FileChunk* file_content) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.file_content_;
-  }
-  if (file_content) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_content);
-    if (message_arena != submessage_arena) {
-      file_content = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, file_content, submessage_arena);
-    }
+inline void ActiveRequest::set_allocated_phase(std::string* phase) {
+  if (phase != nullptr) {
     
   } else {
     
   }
-  _impl_.file_content_ = file_content;
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileRequest.file_content)
-}
-
-// .file_processor.CompressPDFRequest compress_pdf_params = 3;
-inline bool FileRequest::_internal_has_compress_pdf_params() const {
-  return parameters_case() == kCompressPdfParams;
-}
-inline bool FileRequest::has_compress_pdf_params() const {
-  return _internal_has_compress_pdf_params();
-}
-inline void FileRequest::set_has_compress_pdf_params() {
-  _impl_._oneof_case_[0] = kCompressPdfParams;
-}
-inline void FileRequest::clear_compress_pdf_params() {
-  if (_internal_has_compress_pdf_params()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.parameters_.compress_pdf_params_;
-    }
-    clear_has_parameters();
-  }
-}
-inline ::file_processor::CompressPDFRequest* FileRequest::release_compress_pdf_params() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.compress_pdf_params)
-  if (_internal_has_compress_pdf_params()) {
-    clear_has_parameters();
-    ::file_processor::CompressPDFRequest* temp = _impl_.parameters_.compress_pdf_params_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.parameters_.compress_pdf_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
-}
-inline const ::file_processor::CompressPDFRequest& FileRequest::_internal_compress_pdf_params() const {
-  return _internal_has_compress_pdf_params()
-      ? *_impl_.parameters_.compress_pdf_params_
-      : reinterpret_cast< ::file_processor::CompressPDFRequest&>(::file_processor::_CompressPDFRequest_default_instance_);
-}
-inline const ::file_processor::CompressPDFRequest& FileRequest::compress_pdf_params() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.compress_pdf_params)
-  return _internal_compress_pdf_params();
-}
-inline ::file_processor::CompressPDFRequest* FileRequest::unsafe_arena_release_compress_pdf_params() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.compress_pdf_params)
-  if (_internal_has_compress_pdf_params()) {
-    clear_has_parameters();
-    ::file_processor::CompressPDFRequest* temp = _impl_.parameters_.compress_pdf_params_;
-    _impl_.parameters_.compress_pdf_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
-}
-inline void FileRequest::unsafe_arena_set_allocated_compress_pdf_params(::file_processor::CompressPDFRequest* compress_pdf_params) {
-  clear_parameters();
-  if (compress_pdf_params) {
-    set_has_compress_pdf_params();
-    _impl_.parameters_.compress_pdf_params_ = compress_pdf_params;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.compress_pdf_params)
-}
-inline ::file_processor::CompressPDFRequest* FileRequest::_internal_mutable_compress_pdf_params() {
-  if (!_internal_has_compress_pdf_params()) {
-    clear_parameters();
-    set_has_compress_pdf_params();
-    _impl_.parameters_.compress_pdf_params_ = CreateMaybeMessage< ::file_processor::CompressPDFRequest >(GetArenaForAllocation());
+  _impl_.phase_.SetAllocated(phase, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phase_.IsDefault()) {
+    _impl_.phase_.Set("", GetArenaForAllocation());
   }
-  return _impl_.parameters_.compress_pdf_params_;
-}
-inline ::file_processor::CompressPDFRequest* FileRequest::mutable_compress_pdf_params() {
-  ::file_processor::CompressPDFRequest* _msg = _internal_mutable_compress_pdf_params();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.compress_pdf_params)
-  return _msg;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.phase)
 }
 
-// .file_processor.ConvertToTXTRequest convert_to_txt_params = 4;
-inline bool FileRequest::_internal_has_convert_to_txt_params() const {
-  return parameters_case() == kConvertToTxtParams;
+// uint64 elapsed_us = 6;
+inline void ActiveRequest::clear_elapsed_us() {
+  _impl_.elapsed_us_ = uint64_t{0u};
 }
-inline bool FileRequest::has_convert_to_txt_params() const {
-  return _internal_has_convert_to_txt_params();
-}
-inline void FileRequest::set_has_convert_to_txt_params() {
-  _impl_._oneof_case_[0] = kConvertToTxtParams;
-}
-inline void FileRequest::clear_convert_to_txt_params() {
-  if (_internal_has_convert_to_txt_params()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.parameters_.convert_to_txt_params_;
-    }
-    clear_has_parameters();
-  }
-}
-inline ::file_processor::ConvertToTXTRequest* FileRequest::release_convert_to_txt_params() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.convert_to_txt_params)
-  if (_internal_has_convert_to_txt_params()) {
-    clear_has_parameters();
-    ::file_processor::ConvertToTXTRequest* temp = _impl_.parameters_.convert_to_txt_params_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.parameters_.convert_to_txt_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline uint64_t ActiveRequest::_internal_elapsed_us() const {
+  return _impl_.elapsed_us_;
 }
-inline const ::file_processor::ConvertToTXTRequest& FileRequest::_internal_convert_to_txt_params() const {
-  return _internal_has_convert_to_txt_params()
-      ? *_impl_.parameters_.convert_to_txt_params_
-      : reinterpret_cast< ::file_processor::ConvertToTXTRequest&>(::file_processor::_ConvertToTXTRequest_default_instance_);
+inline uint64_t ActiveRequest::elapsed_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.elapsed_us)
+  return _internal_elapsed_us();
 }
-inline const ::file_processor::ConvertToTXTRequest& FileRequest::convert_to_txt_params() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.convert_to_txt_params)
-  return _internal_convert_to_txt_params();
+inline void ActiveRequest::_internal_set_elapsed_us(uint64_t value) {
+  
+  _impl_.elapsed_us_ = value;
 }
-inline ::file_processor::ConvertToTXTRequest* FileRequest::unsafe_arena_release_convert_to_txt_params() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.convert_to_txt_params)
-  if (_internal_has_convert_to_txt_params()) {
-    clear_has_parameters();
-    ::file_processor::ConvertToTXTRequest* temp = _impl_.parameters_.convert_to_txt_params_;
-    _impl_.parameters_.convert_to_txt_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void ActiveRequest::set_elapsed_us(uint64_t value) {
+  _internal_set_elapsed_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.elapsed_us)
 }
-inline void FileRequest::unsafe_arena_set_allocated_convert_to_txt_params(::file_processor::ConvertToTXTRequest* convert_to_txt_params) {
-  clear_parameters();
-  if (convert_to_txt_params) {
-    set_has_convert_to_txt_params();
-    _impl_.parameters_.convert_to_txt_params_ = convert_to_txt_params;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.convert_to_txt_params)
+
+// uint64 phase_elapsed_us = 7;
+inline void ActiveRequest::clear_phase_elapsed_us() {
+  _impl_.phase_elapsed_us_ = uint64_t{0u};
 }
-inline ::file_processor::ConvertToTXTRequest* FileRequest::_internal_mutable_convert_to_txt_params() {
-  if (!_internal_has_convert_to_txt_params()) {
-    clear_parameters();
-    set_has_convert_to_txt_params();
-    _impl_.parameters_.convert_to_txt_params_ = CreateMaybeMessage< ::file_processor::ConvertToTXTRequest >(GetArenaForAllocation());
-  }
-  return _impl_.parameters_.convert_to_txt_params_;
+inline uint64_t ActiveRequest::_internal_phase_elapsed_us() const {
+  return _impl_.phase_elapsed_us_;
 }
-inline ::file_processor::ConvertToTXTRequest* FileRequest::mutable_convert_to_txt_params() {
-  ::file_processor::ConvertToTXTRequest* _msg = _internal_mutable_convert_to_txt_params();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.convert_to_txt_params)
-  return _msg;
+inline uint64_t ActiveRequest::phase_elapsed_us() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.phase_elapsed_us)
+  return _internal_phase_elapsed_us();
+}
+inline void ActiveRequest::_internal_set_phase_elapsed_us(uint64_t value) {
+  
+  _impl_.phase_elapsed_us_ = value;
+}
+inline void ActiveRequest::set_phase_elapsed_us(uint64_t value) {
+  _internal_set_phase_elapsed_us(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.phase_elapsed_us)
 }
 
-// .file_processor.ConvertImageFormatRequest convert_image_format_params = 5;
-inline bool FileRequest::_internal_has_convert_image_format_params() const {
-  return parameters_case() == kConvertImageFormatParams;
+// uint64 bytes_received = 8;
+inline void ActiveRequest::clear_bytes_received() {
+  _impl_.bytes_received_ = uint64_t{0u};
 }
-inline bool FileRequest::has_convert_image_format_params() const {
-  return _internal_has_convert_image_format_params();
+inline uint64_t ActiveRequest::_internal_bytes_received() const {
+  return _impl_.bytes_received_;
 }
-inline void FileRequest::set_has_convert_image_format_params() {
-  _impl_._oneof_case_[0] = kConvertImageFormatParams;
+inline uint64_t ActiveRequest::bytes_received() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.bytes_received)
+  return _internal_bytes_received();
 }
-inline void FileRequest::clear_convert_image_format_params() {
-  if (_internal_has_convert_image_format_params()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.parameters_.convert_image_format_params_;
-    }
-    clear_has_parameters();
-  }
+inline void ActiveRequest::_internal_set_bytes_received(uint64_t value) {
+  
+  _impl_.bytes_received_ = value;
 }
-inline ::file_processor::ConvertImageFormatRequest* FileRequest::release_convert_image_format_params() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.convert_image_format_params)
-  if (_internal_has_convert_image_format_params()) {
-    clear_has_parameters();
-    ::file_processor::ConvertImageFormatRequest* temp = _impl_.parameters_.convert_image_format_params_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.parameters_.convert_image_format_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void ActiveRequest::set_bytes_received(uint64_t value) {
+  _internal_set_bytes_received(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.bytes_received)
 }
-inline const ::file_processor::ConvertImageFormatRequest& FileRequest::_internal_convert_image_format_params() const {
-  return _internal_has_convert_image_format_params()
-      ? *_impl_.parameters_.convert_image_format_params_
-      : reinterpret_cast< ::file_processor::ConvertImageFormatRequest&>(::file_processor::_ConvertImageFormatRequest_default_instance_);
+
+// uint64 bytes_sent = 9;
+inline void ActiveRequest::clear_bytes_sent() {
+  _impl_.bytes_sent_ = uint64_t{0u};
 }
-inline const ::file_processor::ConvertImageFormatRequest& FileRequest::convert_image_format_params() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.convert_image_format_params)
-  return _internal_convert_image_format_params();
+inline uint64_t ActiveRequest::_internal_bytes_sent() const {
+  return _impl_.bytes_sent_;
 }
-inline ::file_processor::ConvertImageFormatRequest* FileRequest::unsafe_arena_release_convert_image_format_params() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.convert_image_format_params)
-  if (_internal_has_convert_image_format_params()) {
-    clear_has_parameters();
-    ::file_processor::ConvertImageFormatRequest* temp = _impl_.parameters_.convert_image_format_params_;
-    _impl_.parameters_.convert_image_format_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline uint64_t ActiveRequest::bytes_sent() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.bytes_sent)
+  return _internal_bytes_sent();
 }
-inline void FileRequest::unsafe_arena_set_allocated_convert_image_format_params(::file_processor::ConvertImageFormatRequest* convert_image_format_params) {
-  clear_parameters();
-  if (convert_image_format_params) {
-    set_has_convert_image_format_params();
-    _impl_.parameters_.convert_image_format_params_ = convert_image_format_params;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.convert_image_format_params)
+inline void ActiveRequest::_internal_set_bytes_sent(uint64_t value) {
+  
+  _impl_.bytes_sent_ = value;
 }
-inline ::file_processor::ConvertImageFormatRequest* FileRequest::_internal_mutable_convert_image_format_params() {
-  if (!_internal_has_convert_image_format_params()) {
-    clear_parameters();
-    set_has_convert_image_format_params();
-    _impl_.parameters_.convert_image_format_params_ = CreateMaybeMessage< ::file_processor::ConvertImageFormatRequest >(GetArenaForAllocation());
-  }
-  return _impl_.parameters_.convert_image_format_params_;
+inline void ActiveRequest::set_bytes_sent(uint64_t value) {
+  _internal_set_bytes_sent(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.bytes_sent)
 }
-inline ::file_processor::ConvertImageFormatRequest* FileRequest::mutable_convert_image_format_params() {
-  ::file_processor::ConvertImageFormatRequest* _msg = _internal_mutable_convert_image_format_params();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.convert_image_format_params)
-  return _msg;
+
+// int32 child_pid = 10;
+inline void ActiveRequest::clear_child_pid() {
+  _impl_.child_pid_ = 0;
+}
+inline int32_t ActiveRequest::_internal_child_pid() const {
+  return _impl_.child_pid_;
+}
+inline int32_t ActiveRequest::child_pid() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.child_pid)
+  return _internal_child_pid();
+}
+inline void ActiveRequest::_internal_set_child_pid(int32_t value) {
+  
+  _impl_.child_pid_ = value;
+}
+inline void ActiveRequest::set_child_pid(int32_t value) {
+  _internal_set_child_pid(value);
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.child_pid)
 }
 
-// .file_processor.ResizeImageRequest resize_image_params = 6;
-inline bool FileRequest::_internal_has_resize_image_params() const {
-  return parameters_case() == kResizeImageParams;
+// string child_tool = 11;
+inline void ActiveRequest::clear_child_tool() {
+  _impl_.child_tool_.ClearToEmpty();
 }
-inline bool FileRequest::has_resize_image_params() const {
-  return _internal_has_resize_image_params();
+inline const std::string& ActiveRequest::child_tool() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.child_tool)
+  return _internal_child_tool();
 }
-inline void FileRequest::set_has_resize_image_params() {
-  _impl_._oneof_case_[0] = kResizeImageParams;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ActiveRequest::set_child_tool(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.child_tool_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.child_tool)
 }
-inline void FileRequest::clear_resize_image_params() {
-  if (_internal_has_resize_image_params()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete _impl_.parameters_.resize_image_params_;
-    }
-    clear_has_parameters();
-  }
+inline std::string* ActiveRequest::mutable_child_tool() {
+  std::string* _s = _internal_mutable_child_tool();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.child_tool)
+  return _s;
 }
-inline ::file_processor::ResizeImageRequest* FileRequest::release_resize_image_params() {
-  // @@protoc_insertion_point(field_release:file_processor.FileRequest.resize_image_params)
-  if (_internal_has_resize_image_params()) {
-    clear_has_parameters();
-    ::file_processor::ResizeImageRequest* temp = _impl_.parameters_.resize_image_params_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    _impl_.parameters_.resize_image_params_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline const std::string& ActiveRequest::_internal_child_tool() const {
+  return _impl_.child_tool_.Get();
 }
-inline const ::file_processor::ResizeImageRequest& FileRequest::_internal_resize_image_params() const {
-  return _internal_has_resize_image_params()
-      ? *_impl_.parameters_.resize_image_params_
-      : reinterpret_cast< ::file_processor::ResizeImageRequest&>(::file_processor::_ResizeImageRequest_default_instance_);
+inline void ActiveRequest::_internal_set_child_tool(const std::string& value) {
+  
+  _impl_.child_tool_.Set(value, GetArenaForAllocation());
 }
-inline const ::file_processor::ResizeImageRequest& FileRequest::resize_image_params() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileRequest.resize_image_params)
-  return _internal_resize_image_params();
+inline std::string* ActiveRequest::_internal_mutable_child_tool() {
+  
+  return _impl_.child_tool_.Mutable(GetArenaForAllocation());
 }
-inline ::file_processor::ResizeImageRequest* FileRequest::unsafe_arena_release_resize_image_params() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:file_processor.FileRequest.resize_image_params)
-  if (_internal_has_resize_image_params()) {
-    clear_has_parameters();
-    ::file_processor::ResizeImageRequest* temp = _impl_.parameters_.resize_image_params_;
-    _impl_.parameters_.resize_image_params_ = nullptr;
-    return temp;
+inline std::string* ActiveRequest::release_child_tool() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.child_tool)
+  return _impl_.child_tool_.Release();
+}
+inline void ActiveRequest::set_allocated_child_tool(std::string* child_tool) {
+  if (child_tool != nullptr) {
+    
   } else {
-    return nullptr;
+    
   }
-}
-inline void FileRequest::unsafe_arena_set_allocated_resize_image_params(::file_processor::ResizeImageRequest* resize_image_params) {
-  clear_parameters();
-  if (resize_image_params) {
-    set_has_resize_image_params();
-    _impl_.parameters_.resize_image_params_ = resize_image_params;
+  _impl_.child_tool_.SetAllocated(child_tool, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.child_tool_.IsDefault()) {
+    _impl_.child_tool_.Set("", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileRequest.resize_image_params)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.child_tool)
 }
-inline ::file_processor::ResizeImageRequest* FileRequest::_internal_mutable_resize_image_params() {
-  if (!_internal_has_resize_image_params()) {
-    clear_parameters();
-    set_has_resize_image_params();
-    _impl_.parameters_.resize_image_params_ = CreateMaybeMessage< ::file_processor::ResizeImageRequest >(GetArenaForAllocation());
-  }
-  return _impl_.parameters_.resize_image_params_;
+
+// string peer = 12;
+inline void ActiveRequest::clear_peer() {
+  _impl_.peer_.ClearToEmpty();
 }
-inline ::file_processor::ResizeImageRequest* FileRequest::mutable_resize_image_params() {
-  ::file_processor::ResizeImageRequest* _msg = _internal_mutable_resize_image_params();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileRequest.resize_image_params)
-  return _msg;
+inline const std::string& ActiveRequest::peer() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.peer)
+  return _internal_peer();
 }
-
-inline bool FileRequest::has_parameters() const {
-  return parameters_case() != PARAMETERS_NOT_SET;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ActiveRequest::set_peer(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.peer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.peer)
 }
-inline void FileRequest::clear_has_parameters() {
-  _impl_._oneof_case_[0] = PARAMETERS_NOT_SET;
+inline std::string* ActiveRequest::mutable_peer() {
+  std::string* _s = _internal_mutable_peer();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.peer)
+  return _s;
 }
-inline FileRequest::ParametersCase FileRequest::parameters_case() const {
-  return FileRequest::ParametersCase(_impl_._oneof_case_[0]);
+inline const std::string& ActiveRequest::_internal_peer() const {
+  return _impl_.peer_.Get();
+}
+inline void ActiveRequest::_internal_set_peer(const std::string& value) {
+  
+  _impl_.peer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ActiveRequest::_internal_mutable_peer() {
+  
+  return _impl_.peer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ActiveRequest::release_peer() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.peer)
+  return _impl_.peer_.Release();
+}
+inline void ActiveRequest::set_allocated_peer(std::string* peer) {
+  if (peer != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.peer_.SetAllocated(peer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.peer_.IsDefault()) {
+    _impl_.peer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.peer)
 }
-// -------------------------------------------------------------------
-
-// CompressPDFRequest
-
-// -------------------------------------------------------------------
-
-// ConvertToTXTRequest
-
-// -------------------------------------------------------------------
-
-// ConvertImageFormatRequest
 
-// string output_format = 1;
-inline void ConvertImageFormatRequest::clear_output_format() {
-  _impl_.output_format_.ClearToEmpty();
+// string trace_id = 13;
+inline void ActiveRequest::clear_trace_id() {
+  _impl_.trace_id_.ClearToEmpty();
 }
-inline const std::string& ConvertImageFormatRequest::output_format() const {
-  // @@protoc_insertion_point(field_get:file_processor.ConvertImageFormatRequest.output_format)
-  return _internal_output_format();
+inline const std::string& ActiveRequest::trace_id() const {
+  // @@protoc_insertion_point(field_get:file_processor.ActiveRequest.trace_id)
+  return _internal_trace_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ConvertImageFormatRequest::set_output_format(ArgT0&& arg0, ArgT... args) {
+void ActiveRequest::set_trace_id(ArgT0&& arg0, ArgT... args) {
  
- _impl_.output_format_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:file_processor.ConvertImageFormatRequest.output_format)
+ _impl_.trace_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:file_processor.ActiveRequest.trace_id)
 }
-inline std::string* ConvertImageFormatRequest::mutable_output_format() {
-  std::string* _s = _internal_mutable_output_format();
-  // @@protoc_insertion_point(field_mutable:file_processor.ConvertImageFormatRequest.output_format)
+inline std::string* ActiveRequest::mutable_trace_id() {
+  std::string* _s = _internal_mutable_trace_id();
+  // @@protoc_insertion_point(field_mutable:file_processor.ActiveRequest.trace_id)
   return _s;
 }
-inline const std::string& ConvertImageFormatRequest::_internal_output_format() const {
-  return _impl_.output_format_.Get();
+inline const std::string& ActiveRequest::_internal_trace_id() const {
+  return _impl_.trace_id_.Get();
 }
-inline void ConvertImageFormatRequest::_internal_set_output_format(const std::string& value) {
+inline void ActiveRequest::_internal_set_trace_id(const std::string& value) {
   
-  _impl_.output_format_.Set(value, GetArenaForAllocation());
+  _impl_.trace_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ConvertImageFormatRequest::_internal_mutable_output_format() {
+inline std::string* ActiveRequest::_internal_mutable_trace_id() {
   
-  return _impl_.output_format_.Mutable(GetArenaForAllocation());
+  return _impl_.trace_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ConvertImageFormatRequest::release_output_format() {
-  // @@protoc_insertion_point(field_release:file_processor.ConvertImageFormatRequest.output_format)
-  return _impl_.output_format_.Release();
+inline std::string* ActiveRequest::release_trace_id() {
+  // @@protoc_insertion_point(field_release:file_processor.ActiveRequest.trace_id)
+  return _impl_.trace_id_.Release();
 }
-inline void ConvertImageFormatRequest::set_allocated_output_format(std::string* output_format) {
-  if (output_format != nullptr) {
+inline void ActiveRequest::set_allocated_trace_id(std::string* trace_id) {
+  if (trace_id != nullptr) {
     
   } else {
     
   }
-  _impl_.output_format_.SetAllocated(output_format, GetArenaForAllocation());
+  _impl_.trace_id_.SetAllocated(trace_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.output_format_.IsDefault()) {
-    _impl_.output_format_.Set("", GetArenaForAllocation());
+  if (_impl_.trace_id_.IsDefault()) {
+    _impl_.trace_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:file_processor.ConvertImageFormatRequest.output_format)
+  // @@protoc_insertion_point(field_set_allocated:file_processor.ActiveRequest.trace_id)
+}
+
+// -------------------------------------------------------------------
+
+// ServerState
+
+// repeated .file_processor.ActiveRequest requests = 1;
+inline int ServerState::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int ServerState::requests_size() const {
+  return _internal_requests_size();
+}
+inline void ServerState::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline ::file_processor::ActiveRequest* ServerState::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:file_processor.ServerState.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ActiveRequest >*
+ServerState::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:file_processor.ServerState.requests)
+  return &_impl_.requests_;
+}
+inline const ::file_processor::ActiveRequest& ServerState::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::file_processor::ActiveRequest& ServerState::requests(int index) const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.requests)
+  return _internal_requests(index);
+}
+inline ::file_processor::ActiveRequest* ServerState::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::file_processor::ActiveRequest* ServerState::add_requests() {
+  ::file_processor::ActiveRequest* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:file_processor.ServerState.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::file_processor::ActiveRequest >&
+ServerState::requests() const {
+  // @@protoc_insertion_point(field_list:file_processor.ServerState.requests)
+  return _impl_.requests_;
+}
+
+// uint32 worker_threads = 2;
+inline void ServerState::clear_worker_threads() {
+  _impl_.worker_threads_ = 0u;
+}
+inline uint32_t ServerState::_internal_worker_threads() const {
+  return _impl_.worker_threads_;
+}
+inline uint32_t ServerState::worker_threads() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.worker_threads)
+  return _internal_worker_threads();
+}
+inline void ServerState::_internal_set_worker_threads(uint32_t value) {
+  
+  _impl_.worker_threads_ = value;
+}
+inline void ServerState::set_worker_threads(uint32_t value) {
+  _internal_set_worker_threads(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.worker_threads)
+}
+
+// uint32 worker_active = 3;
+inline void ServerState::clear_worker_active() {
+  _impl_.worker_active_ = 0u;
+}
+inline uint32_t ServerState::_internal_worker_active() const {
+  return _impl_.worker_active_;
+}
+inline uint32_t ServerState::worker_active() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.worker_active)
+  return _internal_worker_active();
+}
+inline void ServerState::_internal_set_worker_active(uint32_t value) {
+  
+  _impl_.worker_active_ = value;
+}
+inline void ServerState::set_worker_active(uint32_t value) {
+  _internal_set_worker_active(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.worker_active)
+}
+
+// uint32 worker_queued = 4;
+inline void ServerState::clear_worker_queued() {
+  _impl_.worker_queued_ = 0u;
+}
+inline uint32_t ServerState::_internal_worker_queued() const {
+  return _impl_.worker_queued_;
+}
+inline uint32_t ServerState::worker_queued() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.worker_queued)
+  return _internal_worker_queued();
+}
+inline void ServerState::_internal_set_worker_queued(uint32_t value) {
+  
+  _impl_.worker_queued_ = value;
+}
+inline void ServerState::set_worker_queued(uint32_t value) {
+  _internal_set_worker_queued(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.worker_queued)
+}
+
+// uint32 jobs_queued = 5;
+inline void ServerState::clear_jobs_queued() {
+  _impl_.jobs_queued_ = 0u;
+}
+inline uint32_t ServerState::_internal_jobs_queued() const {
+  return _impl_.jobs_queued_;
+}
+inline uint32_t ServerState::jobs_queued() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.jobs_queued)
+  return _internal_jobs_queued();
+}
+inline void ServerState::_internal_set_jobs_queued(uint32_t value) {
+  
+  _impl_.jobs_queued_ = value;
+}
+inline void ServerState::set_jobs_queued(uint32_t value) {
+  _internal_set_jobs_queued(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.jobs_queued)
+}
+
+// uint32 jobs_running = 6;
+inline void ServerState::clear_jobs_running() {
+  _impl_.jobs_running_ = 0u;
+}
+inline uint32_t ServerState::_internal_jobs_running() const {
+  return _impl_.jobs_running_;
+}
+inline uint32_t ServerState::jobs_running() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.jobs_running)
+  return _internal_jobs_running();
+}
+inline void ServerState::_internal_set_jobs_running(uint32_t value) {
+  
+  _impl_.jobs_running_ = value;
+}
+inline void ServerState::set_jobs_running(uint32_t value) {
+  _internal_set_jobs_running(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.jobs_running)
 }
 
-// -------------------------------------------------------------------
-
-// ResizeImageRequest
-
-// int32 width = 1;
-inline void ResizeImageRequest::clear_width() {
-  _impl_.width_ = 0;
+// uint64 ingest_buffer_bytes = 7;
+inline void ServerState::clear_ingest_buffer_bytes() {
+  _impl_.ingest_buffer_bytes_ = uint64_t{0u};
 }
-inline int32_t ResizeImageRequest::_internal_width() const {
-  return _impl_.width_;
+inline uint64_t ServerState::_internal_ingest_buffer_bytes() const {
+  return _impl_.ingest_buffer_bytes_;
 }
-inline int32_t ResizeImageRequest::width() const {
-  // @@protoc_insertion_point(field_get:file_processor.ResizeImageRequest.width)
-  return _internal_width();
+inline uint64_t ServerState::ingest_buffer_bytes() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.ingest_buffer_bytes)
+  return _internal_ingest_buffer_bytes();
 }
-inline void ResizeImageRequest::_internal_set_width(int32_t value) {
+inline void ServerState::_internal_set_ingest_buffer_bytes(uint64_t value) {
   
-  _impl_.width_ = value;
+  _impl_.ingest_buffer_bytes_ = value;
 }
-inline void ResizeImageRequest::set_width(int32_t value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:file_processor.ResizeImageRequest.width)
+inline void ServerState::set_ingest_buffer_bytes(uint64_t value) {
+  _internal_set_ingest_buffer_bytes(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.ingest_buffer_bytes)
 }
 
-// int32 height = 2;
-inline void ResizeImageRequest::clear_height() {
-  _impl_.height_ = 0;
+// uint64 uptime_s = 8;
+inline void ServerState::clear_uptime_s() {
+  _impl_.uptime_s_ = uint64_t{0u};
 }
-inline int32_t ResizeImageRequest::_internal_height() const {
-  return _impl_.height_;
+inline uint64_t ServerState::_internal_uptime_s() const {
+  return _impl_.uptime_s_;
 }
-inline int32_t ResizeImageRequest::height() const {
-  // @@protoc_insertion_point(field_get:file_processor.ResizeImageRequest.height)
-  return _internal_height();
+inline uint64_t ServerState::uptime_s() const {
+  // @@protoc_insertion_point(field_get:file_processor.ServerState.uptime_s)
+  return _internal_uptime_s();
 }
-inline void ResizeImageRequest::_internal_set_height(int32_t value) {
+inline void ServerState::_internal_set_uptime_s(uint64_t value) {
   
-  _impl_.height_ = value;
+  _impl_.uptime_s_ = value;
 }
-inline void ResizeImageRequest::set_height(int32_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:file_processor.ResizeImageRequest.height)
+inline void ServerState::set_uptime_s(uint64_t value) {
+  _internal_set_uptime_s(value);
+  // @@protoc_insertion_point(field_set:file_processor.ServerState.uptime_s)
 }
 
 // -------------------------------------------------------------------
 
-// FileResponse
+// JobRecord
 
-// string file_name = 1;
-inline void FileResponse::clear_file_name() {
-  _impl_.file_name_.ClearToEmpty();
+// .file_processor.JobStatus status = 1;
+inline bool JobRecord::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
 }
-inline const std::string& FileResponse::file_name() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileResponse.file_name)
-  return _internal_file_name();
+inline bool JobRecord::has_status() const {
+  return _internal_has_status();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void FileResponse::set_file_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:file_processor.FileResponse.file_name)
+inline void JobRecord::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
 }
-inline std::string* FileResponse::mutable_file_name() {
-  std::string* _s = _internal_mutable_file_name();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.file_name)
-  return _s;
+inline const ::file_processor::JobStatus& JobRecord::_internal_status() const {
+  const ::file_processor::JobStatus* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::JobStatus&>(
+      ::file_processor::_JobStatus_default_instance_);
 }
-inline const std::string& FileResponse::_internal_file_name() const {
-  return _impl_.file_name_.Get();
+inline const ::file_processor::JobStatus& JobRecord::status() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobRecord.status)
+  return _internal_status();
 }
-inline void FileResponse::_internal_set_file_name(const std::string& value) {
+inline void JobRecord::unsafe_arena_set_allocated_status(
+    ::file_processor::JobStatus* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.JobRecord.status)
+}
+inline ::file_processor::JobStatus* JobRecord::release_status() {
   
-  _impl_.file_name_.Set(value, GetArenaForAllocation());
+  ::file_processor::JobStatus* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* FileResponse::_internal_mutable_file_name() {
+inline ::file_processor::JobStatus* JobRecord::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:file_processor.JobRecord.status)
   
-  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+  ::file_processor::JobStatus* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
 }
-inline std::string* FileResponse::release_file_name() {
-  // @@protoc_insertion_point(field_release:file_processor.FileResponse.file_name)
-  return _impl_.file_name_.Release();
+inline ::file_processor::JobStatus* JobRecord::_internal_mutable_status() {
+  
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::JobStatus>(GetArenaForAllocation());
+    _impl_.status_ = p;
+  }
+  return _impl_.status_;
 }
-inline void FileResponse::set_allocated_file_name(std::string* file_name) {
-  if (file_name != nullptr) {
+inline ::file_processor::JobStatus* JobRecord::mutable_status() {
+  ::file_processor::JobStatus* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobRecord.status)
+  return _msg;
+}
+inline void JobRecord::set_allocated_status(::file_processor::JobStatus* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.status_;
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(status);
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.file_name_.IsDefault()) {
-    _impl_.file_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.file_name)
+  _impl_.status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobRecord.status)
 }
 
-// .file_processor.FileChunk file_content = 2;
-inline bool FileResponse::_internal_has_file_content() const {
-  return this != internal_default_instance() && _impl_.file_content_ != nullptr;
+// .file_processor.FileRequest request = 2;
+inline bool JobRecord::_internal_has_request() const {
+  return this != internal_default_instance() && _impl_.request_ != nullptr;
 }
-inline bool FileResponse::has_file_content() const {
-  return _internal_has_file_content();
+inline bool JobRecord::has_request() const {
+  return _internal_has_request();
 }
-inline void FileResponse::clear_file_content() {
-  if (GetArenaForAllocation() == nullptr && _impl_.file_content_ != nullptr) {
-    delete _impl_.file_content_;
+inline void JobRecord::clear_request() {
+  if (GetArenaForAllocation() == nullptr && _impl_.request_ != nullptr) {
+    delete _impl_.request_;
   }
-  _impl_.file_content_ = nullptr;
+  _impl_.request_ = nullptr;
 }
-inline const ::file_processor::FileChunk& FileResponse::_internal_file_content() const {
-  const ::file_processor::FileChunk* p = _impl_.file_content_;
-  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileChunk&>(
-      ::file_processor::_FileChunk_default_instance_);
+inline const ::file_processor::FileRequest& JobRecord::_internal_request() const {
+  const ::file_processor::FileRequest* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::file_processor::FileRequest&>(
+      ::file_processor::_FileRequest_default_instance_);
 }
-inline const ::file_processor::FileChunk& FileResponse::file_content() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileResponse.file_content)
-  return _internal_file_content();
+inline const ::file_processor::FileRequest& JobRecord::request() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobRecord.request)
+  return _internal_request();
 }
-inline void FileResponse::unsafe_arena_set_allocated_file_content(
-    ::file_processor::FileChunk* file_content) {
+inline void JobRecord::unsafe_arena_set_allocated_request(
+    ::file_processor::FileRequest* request) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.file_content_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
   }
-  _impl_.file_content_ = file_content;
-  if (file_content) {
+  _impl_.request_ = request;
+  if (request) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.FileResponse.file_content)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:file_processor.JobRecord.request)
 }
-inline ::file_processor::FileChunk* FileResponse::release_file_content() {
+inline ::file_processor::FileRequest* JobRecord::release_request() {
   
-  ::file_processor::FileChunk* temp = _impl_.file_content_;
-  _impl_.file_content_ = nullptr;
+  ::file_processor::FileRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1976,114 +11407,84 @@ inline ::file_processor::FileChunk* FileResponse::release_file_content() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::file_processor::FileChunk* FileResponse::unsafe_arena_release_file_content() {
-  // @@protoc_insertion_point(field_release:file_processor.FileResponse.file_content)
+inline ::file_processor::FileRequest* JobRecord::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:file_processor.JobRecord.request)
   
-  ::file_processor::FileChunk* temp = _impl_.file_content_;
-  _impl_.file_content_ = nullptr;
+  ::file_processor::FileRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
   return temp;
 }
-inline ::file_processor::FileChunk* FileResponse::_internal_mutable_file_content() {
+inline ::file_processor::FileRequest* JobRecord::_internal_mutable_request() {
   
-  if (_impl_.file_content_ == nullptr) {
-    auto* p = CreateMaybeMessage<::file_processor::FileChunk>(GetArenaForAllocation());
-    _impl_.file_content_ = p;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::file_processor::FileRequest>(GetArenaForAllocation());
+    _impl_.request_ = p;
   }
-  return _impl_.file_content_;
+  return _impl_.request_;
 }
-inline ::file_processor::FileChunk* FileResponse::mutable_file_content() {
-  ::file_processor::FileChunk* _msg = _internal_mutable_file_content();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.file_content)
+inline ::file_processor::FileRequest* JobRecord::mutable_request() {
+  ::file_processor::FileRequest* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:file_processor.JobRecord.request)
   return _msg;
 }
-inline void FileResponse::set_allocated_file_content(::file_processor::FileChunk* file_content) {
+inline void JobRecord::set_allocated_request(::file_processor::FileRequest* request) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.file_content_;
+    delete _impl_.request_;
   }
-  if (file_content) {
+  if (request) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_content);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
     if (message_arena != submessage_arena) {
-      file_content = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, file_content, submessage_arena);
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.file_content_ = file_content;
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.file_content)
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:file_processor.JobRecord.request)
 }
 
-// string status_message = 3;
-inline void FileResponse::clear_status_message() {
-  _impl_.status_message_.ClearToEmpty();
-}
-inline const std::string& FileResponse::status_message() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileResponse.status_message)
-  return _internal_status_message();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void FileResponse::set_status_message(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:file_processor.FileResponse.status_message)
-}
-inline std::string* FileResponse::mutable_status_message() {
-  std::string* _s = _internal_mutable_status_message();
-  // @@protoc_insertion_point(field_mutable:file_processor.FileResponse.status_message)
-  return _s;
+// int64 submitted_at = 3;
+inline void JobRecord::clear_submitted_at() {
+  _impl_.submitted_at_ = int64_t{0};
 }
-inline const std::string& FileResponse::_internal_status_message() const {
-  return _impl_.status_message_.Get();
+inline int64_t JobRecord::_internal_submitted_at() const {
+  return _impl_.submitted_at_;
 }
-inline void FileResponse::_internal_set_status_message(const std::string& value) {
-  
-  _impl_.status_message_.Set(value, GetArenaForAllocation());
+inline int64_t JobRecord::submitted_at() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobRecord.submitted_at)
+  return _internal_submitted_at();
 }
-inline std::string* FileResponse::_internal_mutable_status_message() {
+inline void JobRecord::_internal_set_submitted_at(int64_t value) {
   
-  return _impl_.status_message_.Mutable(GetArenaForAllocation());
-}
-inline std::string* FileResponse::release_status_message() {
-  // @@protoc_insertion_point(field_release:file_processor.FileResponse.status_message)
-  return _impl_.status_message_.Release();
+  _impl_.submitted_at_ = value;
 }
-inline void FileResponse::set_allocated_status_message(std::string* status_message) {
-  if (status_message != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.status_message_.IsDefault()) {
-    _impl_.status_message_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:file_processor.FileResponse.status_message)
+inline void JobRecord::set_submitted_at(int64_t value) {
+  _internal_set_submitted_at(value);
+  // @@protoc_insertion_point(field_set:file_processor.JobRecord.submitted_at)
 }
 
-// bool success = 4;
-inline void FileResponse::clear_success() {
-  _impl_.success_ = false;
+// uint64 input_size = 4;
+inline void JobRecord::clear_input_size() {
+  _impl_.input_size_ = uint64_t{0u};
 }
-inline bool FileResponse::_internal_success() const {
-  return _impl_.success_;
+inline uint64_t JobRecord::_internal_input_size() const {
+  return _impl_.input_size_;
 }
-inline bool FileResponse::success() const {
-  // @@protoc_insertion_point(field_get:file_processor.FileResponse.success)
-  return _internal_success();
+inline uint64_t JobRecord::input_size() const {
+  // @@protoc_insertion_point(field_get:file_processor.JobRecord.input_size)
+  return _internal_input_size();
 }
-inline void FileResponse::_internal_set_success(bool value) {
+inline void JobRecord::_internal_set_input_size(uint64_t value) {
   
-  _impl_.success_ = value;
+  _impl_.input_size_ = value;
 }
-inline void FileResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:file_processor.FileResponse.success)
+inline void JobRecord::set_input_size(uint64_t value) {
+  _internal_set_input_size(value);
+  // @@protoc_insertion_point(field_set:file_processor.JobRecord.input_size)
 }
 
 #ifdef __GNUC__
@@ -2101,11 +11502,75 @@ inline void FileResponse::set_success(bool value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace file_processor
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::file_processor::JobState> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::file_processor::JobState>() {
+  return ::file_processor::JobState_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
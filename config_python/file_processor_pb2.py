@@ -24,27 +24,83 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x1aproto/file_processor.proto\x12\x0e\x66ile_processor\"\x1c\n\tFileChunk\x12\x0f\n\x07\x63ontent\x18\x01 \x01(\x0c\"\xfd\x02\n\x0b\x46ileRequest\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12/\n\x0c\x66ile_content\x18\x02 \x01(\x0b\x32\x19.file_processor.FileChunk\x12\x41\n\x13\x63ompress_pdf_params\x18\x03 \x01(\x0b\x32\".file_processor.CompressPDFRequestH\x00\x12\x44\n\x15\x63onvert_to_txt_params\x18\x04 \x01(\x0b\x32#.file_processor.ConvertToTXTRequestH\x00\x12P\n\x1b\x63onvert_image_format_params\x18\x05 \x01(\x0b\x32).file_processor.ConvertImageFormatRequestH\x00\x12\x41\n\x13resize_image_params\x18\x06 \x01(\x0b\x32\".file_processor.ResizeImageRequestH\x00\x42\x0c\n\nparameters\"\x14\n\x12\x43ompressPDFRequest\"\x15\n\x13\x43onvertToTXTRequest\"2\n\x19\x43onvertImageFormatRequest\x12\x15\n\routput_format\x18\x01 \x01(\t\"3\n\x12ResizeImageRequest\x12\r\n\x05width\x18\x01 \x01(\x05\x12\x0e\n\x06height\x18\x02 \x01(\x05\"{\n\x0c\x46ileResponse\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12/\n\x0c\x66ile_content\x18\x02 \x01(\x0b\x32\x19.file_processor.FileChunk\x12\x16\n\x0estatus_message\x18\x03 \x01(\t\x12\x0f\n\x07success\x18\x04 \x01(\x08\x32\xd6\x02\n\x14\x46ileProcessorService\x12L\n\x0b\x43ompressPDF\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12M\n\x0c\x43onvertToTXT\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12S\n\x12\x43onvertImageFormat\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12L\n\x0bResizeImage\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x1aproto/file_processor.proto\x12\x0e\x66ile_processor\"<\n\tFileChunk\x12\x0f\n\x07\x63ontent\x18\x01 \x01(\x0c\x12\x13\n\x06\x63rc32c\x18\x02 \x01(\x07H\x00\x88\x01\x01\x42\t\n\x07_crc32c\"\x9a\x04\n\x0b\x46ileRequest\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12/\n\x0c\x66ile_content\x18\x02 \x01(\x0b\x32\x19.file_processor.FileChunk\x12\x41\n\x13\x63ompress_pdf_params\x18\x03 \x01(\x0b\x32\".file_processor.CompressPDFRequestH\x00\x12\x44\n\x15\x63onvert_to_txt_params\x18\x04 \x01(\x0b\x32#.file_processor.ConvertToTXTRequestH\x00\x12P\n\x1b\x63onvert_image_format_params\x18\x05 \x01(\x0b\x32).file_processor.ConvertImageFormatRequestH\x00\x12\x41\n\x13resize_image_params\x18\x06 \x01(\x0b\x32\".file_processor.ResizeImageRequestH\x00\x12L\n\x19resize_image_multi_params\x18\x07 \x01(\x0b\x32\'.file_processor.ResizeImageMultiRequestH\x00\x12:\n\x0fpipeline_params\x18\t \x01(\x0b\x32\x1f.file_processor.PipelineRequestH\x00\x12\x11\n\tupload_id\x18\x08 \x01(\tB\x0c\n\nparameters\"\x14\n\x12\x43ompressPDFRequest\"\x15\n\x13\x43onvertToTXTRequest\"2\n\x19\x43onvertImageFormatRequest\x12\x15\n\routput_format\x18\x01 \x01(\t\"3\n\x12ResizeImageRequest\x12\r\n\x05width\x18\x01 \x01(\x05\x12\x0e\n\x06height\x18\x02 \x01(\x05\"*\n\tImageSize\x12\r\n\x05width\x18\x01 \x01(\x05\x12\x0e\n\x06height\x18\x02 \x01(\x05\"C\n\x17ResizeImageMultiRequest\x12(\n\x05sizes\x18\x01 \x03(\x0b\x32\x19.file_processor.ImageSize\"\x9d\x02\n\x0cPipelineStep\x12:\n\x0c\x63ompress_pdf\x18\x01 \x01(\x0b\x32\".file_processor.CompressPDFRequestH\x00\x12=\n\x0e\x63onvert_to_txt\x18\x02 \x01(\x0b\x32#.file_processor.ConvertToTXTRequestH\x00\x12I\n\x14\x63onvert_image_format\x18\x03 \x01(\x0b\x32).file_processor.ConvertImageFormatRequestH\x00\x12:\n\x0cresize_image\x18\x04 \x01(\x0b\x32\".file_processor.ResizeImageRequestH\x00\x42\x0b\n\toperation\">\n\x0fPipelineRequest\x12+\n\x05steps\x18\x01 \x03(\x0b\x32\x1c.file_processor.PipelineStep\"\xd5\x01\n\x0c\x46ileResponse\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12/\n\x0c\x66ile_content\x18\x02 \x01(\x0b\x32\x19.file_processor.FileChunk\x12\x16\n\x0estatus_message\x18\x03 \x01(\t\x12\x0f\n\x07success\x18\x04 \x01(\x08\x12\x15\n\rresult_handle\x18\x05 \x01(\t\x12\x13\n\x0boutput_size\x18\x06 \x01(\x04\x12\x1a\n\routput_crc32c\x18\x07 \x01(\x07H\x00\x88\x01\x01\x42\x10\n\x0e_output_crc32c\"a\n\x0c\x42\x61tchRequest\x12\x0f\n\x07\x66ile_id\x18\x01 \x01(\t\x12,\n\x07request\x18\x02 \x01(\x0b\x32\x1b.file_processor.FileRequest\x12\x12\n\nlast_chunk\x18\x03 \x01(\x08\"^\n\rBatchResponse\x12\x0f\n\x07\x66ile_id\x18\x01 \x01(\t\x12.\n\x08response\x18\x02 \x01(\x0b\x32\x1c.file_processor.FileResponse\x12\x0c\n\x04\x64one\x18\x03 \x01(\x08\";\n\x12StartUploadRequest\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12\x12\n\ntotal_size\x18\x02 \x01(\x04\"a\n\x0bUploadChunk\x12\x11\n\tupload_id\x18\x01 \x01(\t\x12\x0e\n\x06offset\x18\x02 \x01(\x04\x12\x0f\n\x07\x63ontent\x18\x03 \x01(\x0c\x12\x13\n\x06\x63rc32c\x18\x04 \x01(\x07H\x00\x88\x01\x01\x42\t\n\x07_crc32c\" \n\x0bUploadQuery\x12\x11\n\tupload_id\x18\x01 \x01(\t\"\x9a\x01\n\x0cUploadStatus\x12\x11\n\tupload_id\x18\x01 \x01(\t\x12\x18\n\x10\x63ommitted_offset\x18\x02 \x01(\x04\x12\x12\n\ntotal_size\x18\x03 \x01(\x04\x12\x10\n\x08\x63omplete\x18\x04 \x01(\x08\x12\x0f\n\x07success\x18\x05 \x01(\x08\x12\x16\n\x0estatus_message\x18\x06 \x01(\t\x12\x0e\n\x06sha256\x18\x07 \x01(\t\"K\n\x12\x46\x65tchOutputRequest\x12\x15\n\rresult_handle\x18\x01 \x01(\t\x12\x0e\n\x06offset\x18\x02 \x01(\x04\x12\x0e\n\x06length\x18\x03 \x01(\x04\"J\n\tJobOutput\x12\x11\n\tfile_name\x18\x01 \x01(\t\x12\x15\n\rresult_handle\x18\x02 \x01(\t\x12\x13\n\x0boutput_size\x18\x03 \x01(\x04\"\x1a\n\x08JobQuery\x12\x0e\n\x06job_id\x18\x01 \x01(\t\"\x88\x01\n\tJobStatus\x12\x0e\n\x06job_id\x18\x01 \x01(\t\x12\'\n\x05state\x18\x02 \x01(\x0e\x32\x18.file_processor.JobState\x12\x16\n\x0estatus_message\x18\x03 \x01(\t\x12*\n\x07outputs\x18\x04 \x03(\x0b\x32\x19.file_processor.JobOutput\"<\n\x10SignatureRequest\x12\x14\n\x0c\x62\x61sis_sha256\x18\x01 \x01(\t\x12\x12\n\nblock_size\x18\x02 \x01(\r\".\n\x0e\x42lockSignature\x12\x0c\n\x04weak\x18\x01 \x01(\x07\x12\x0e\n\x06strong\x18\x02 \x01(\x0c\"\xa6\x01\n\x0eSignatureBatch\x12\x0f\n\x07success\x18\x01 \x01(\x08\x12\x16\n\x0estatus_message\x18\x02 \x01(\t\x12\x12\n\nblock_size\x18\x03 \x01(\r\x12\x12\n\nbasis_size\x18\x04 \x01(\x04\x12.\n\x06\x62locks\x18\x05 \x03(\x0b\x32\x1e.file_processor.BlockSignature\x12\x13\n\x0b\x66irst_block\x18\x06 \x01(\x04\"0\n\nBlockRange\x12\x13\n\x0b\x66irst_block\x18\x01 \x01(\x04\x12\r\n\x05\x63ount\x18\x02 \x01(\r\"N\n\x07\x44\x65ltaOp\x12\x11\n\x07literal\x18\x01 \x01(\x0cH\x00\x12*\n\x04\x63opy\x18\x02 \x01(\x0b\x32\x1a.file_processor.BlockRangeH\x00\x42\x04\n\x02op\"\x98\x01\n\nDeltaChunk\x12\x14\n\x0c\x62\x61sis_sha256\x18\x01 \x01(\t\x12\x12\n\nblock_size\x18\x02 \x01(\r\x12\x11\n\tfile_name\x18\x03 \x01(\t\x12\x12\n\ntotal_size\x18\x04 \x01(\x04\x12\x13\n\x0b\x66ile_sha256\x18\x05 \x01(\t\x12$\n\x03ops\x18\x06 \x03(\x0b\x32\x17.file_processor.DeltaOp\"!\n\x0cLatencyQuery\x12\x11\n\toperation\x18\x01 \x01(\t\"\xb2\x01\n\rLatencySeries\x12\x11\n\toperation\x18\x01 \x01(\t\x12\x0f\n\x07success\x18\x02 \x01(\x08\x12\r\n\x05phase\x18\x03 \x01(\t\x12\r\n\x05\x63ount\x18\x04 \x01(\x04\x12\x0e\n\x06sum_us\x18\x05 \x01(\x04\x12\x0e\n\x06max_us\x18\x06 \x01(\x04\x12\x0e\n\x06p50_us\x18\x07 \x01(\x04\x12\x0e\n\x06p90_us\x18\x08 \x01(\x04\x12\x0e\n\x06p99_us\x18\t \x01(\x04\x12\x0f\n\x07p999_us\x18\n \x01(\x04\">\n\rLatencyReport\x12-\n\x06series\x18\x01 \x03(\x0b\x32\x1d.file_processor.LatencySeries\"\x12\n\x10ServerStateQuery\"\xfe\x01\n\rActiveRequest\x12\n\n\x02id\x18\x01 \x01(\x04\x12\x0b\n\x03rpc\x18\x02 \x01(\t\x12\x11\n\toperation\x18\x03 \x01(\t\x12\x11\n\tfile_name\x18\x04 \x01(\t\x12\r\n\x05phase\x18\x05 \x01(\t\x12\x12\n\nelapsed_us\x18\x06 \x01(\x04\x12\x18\n\x10phase_elapsed_us\x18\x07 \x01(\x04\x12\x16\n\x0e\x62ytes_received\x18\x08 \x01(\x04\x12\x12\n\nbytes_sent\x18\t \x01(\x04\x12\x11\n\tchild_pid\x18\n \x01(\x05\x12\x12\n\nchild_tool\x18\x0b \x01(\t\x12\x0c\n\x04peer\x18\x0c \x01(\t\x12\x10\n\x08trace_id\x18\r \x01(\t\"\xde\x01\n\x0bServerState\x12/\n\x08requests\x18\x01 \x03(\x0b\x32\x1d.file_processor.ActiveRequest\x12\x16\n\x0eworker_threads\x18\x02 \x01(\r\x12\x15\n\rworker_active\x18\x03 \x01(\r\x12\x15\n\rworker_queued\x18\x04 \x01(\r\x12\x13\n\x0bjobs_queued\x18\x05 \x01(\r\x12\x14\n\x0cjobs_running\x18\x06 \x01(\r\x12\x1b\n\x13ingest_buffer_bytes\x18\x07 \x01(\x04\x12\x10\n\x08uptime_s\x18\x08 \x01(\x04\"\x8e\x01\n\tJobRecord\x12)\n\x06status\x18\x01 \x01(\x0b\x32\x19.file_processor.JobStatus\x12,\n\x07request\x18\x02 \x01(\x0b\x32\x1b.file_processor.FileRequest\x12\x14\n\x0csubmitted_at\x18\x03 \x01(\x03\x12\x12\n\ninput_size\x18\x04 \x01(\x04*I\n\x08JobState\x12\x0e\n\nJOB_QUEUED\x10\x00\x12\x0f\n\x0bJOB_RUNNING\x10\x01\x12\x0c\n\x08JOB_DONE\x10\x02\x12\x0e\n\nJOB_FAILED\x10\x03\x32\x9b\x0b\n\x14\x46ileProcessorService\x12L\n\x0b\x43ompressPDF\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12M\n\x0c\x43onvertToTXT\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12S\n\x12\x43onvertImageFormat\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12L\n\x0bResizeImage\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12Q\n\x10ResizeImageMulti\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12L\n\x0bRunPipeline\x12\x1b.file_processor.FileRequest\x1a\x1c.file_processor.FileResponse(\x01\x30\x01\x12O\n\x0cProcessBatch\x12\x1c.file_processor.BatchRequest\x1a\x1d.file_processor.BatchResponse(\x01\x30\x01\x12O\n\x0bStartUpload\x12\".file_processor.StartUploadRequest\x1a\x1c.file_processor.UploadStatus\x12M\n\x0cUploadChunks\x12\x1b.file_processor.UploadChunk\x1a\x1c.file_processor.UploadStatus(\x01\x30\x01\x12H\n\x0bQueryUpload\x12\x1b.file_processor.UploadQuery\x1a\x1c.file_processor.UploadStatus\x12S\n\rGetSignatures\x12 .file_processor.SignatureRequest\x1a\x1e.file_processor.SignatureBatch0\x01\x12K\n\x0bUploadDelta\x12\x1a.file_processor.DeltaChunk\x1a\x1c.file_processor.UploadStatus(\x01\x30\x01\x12Q\n\x0b\x46\x65tchOutput\x12\".file_processor.FetchOutputRequest\x1a\x1c.file_processor.FileResponse0\x01\x12\x43\n\tSubmitJob\x12\x1b.file_processor.FileRequest\x1a\x19.file_processor.JobStatus\x12\x43\n\x0cGetJobStatus\x12\x18.file_processor.JobQuery\x1a\x19.file_processor.JobStatus\x12G\n\x0b\x46\x65tchResult\x12\x18.file_processor.JobQuery\x1a\x1c.file_processor.FileResponse0\x01\x12N\n\x0fGetLatencyStats\x12\x1c.file_processor.LatencyQuery\x1a\x1d.file_processor.LatencyReport\x12O\n\x0eGetServerState\x12 .file_processor.ServerStateQuery\x1a\x1b.file_processor.ServerStateb\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'proto.file_processor_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
+  _globals['_JOBSTATE']._serialized_start=3837
+  _globals['_JOBSTATE']._serialized_end=3910
   _globals['_FILECHUNK']._serialized_start=46
-  _globals['_FILECHUNK']._serialized_end=74
-  _globals['_FILEREQUEST']._serialized_start=77
-  _globals['_FILEREQUEST']._serialized_end=458
-  _globals['_COMPRESSPDFREQUEST']._serialized_start=460
-  _globals['_COMPRESSPDFREQUEST']._serialized_end=480
-  _globals['_CONVERTTOTXTREQUEST']._serialized_start=482
-  _globals['_CONVERTTOTXTREQUEST']._serialized_end=503
-  _globals['_CONVERTIMAGEFORMATREQUEST']._serialized_start=505
-  _globals['_CONVERTIMAGEFORMATREQUEST']._serialized_end=555
-  _globals['_RESIZEIMAGEREQUEST']._serialized_start=557
-  _globals['_RESIZEIMAGEREQUEST']._serialized_end=608
-  _globals['_FILERESPONSE']._serialized_start=610
-  _globals['_FILERESPONSE']._serialized_end=733
-  _globals['_FILEPROCESSORSERVICE']._serialized_start=736
-  _globals['_FILEPROCESSORSERVICE']._serialized_end=1078
+  _globals['_FILECHUNK']._serialized_end=106
+  _globals['_FILEREQUEST']._serialized_start=109
+  _globals['_FILEREQUEST']._serialized_end=647
+  _globals['_COMPRESSPDFREQUEST']._serialized_start=649
+  _globals['_COMPRESSPDFREQUEST']._serialized_end=669
+  _globals['_CONVERTTOTXTREQUEST']._serialized_start=671
+  _globals['_CONVERTTOTXTREQUEST']._serialized_end=692
+  _globals['_CONVERTIMAGEFORMATREQUEST']._serialized_start=694
+  _globals['_CONVERTIMAGEFORMATREQUEST']._serialized_end=744
+  _globals['_RESIZEIMAGEREQUEST']._serialized_start=746
+  _globals['_RESIZEIMAGEREQUEST']._serialized_end=797
+  _globals['_IMAGESIZE']._serialized_start=799
+  _globals['_IMAGESIZE']._serialized_end=841
+  _globals['_RESIZEIMAGEMULTIREQUEST']._serialized_start=843
+  _globals['_RESIZEIMAGEMULTIREQUEST']._serialized_end=910
+  _globals['_PIPELINESTEP']._serialized_start=913
+  _globals['_PIPELINESTEP']._serialized_end=1198
+  _globals['_PIPELINEREQUEST']._serialized_start=1200
+  _globals['_PIPELINEREQUEST']._serialized_end=1262
+  _globals['_FILERESPONSE']._serialized_start=1265
+  _globals['_FILERESPONSE']._serialized_end=1478
+  _globals['_BATCHREQUEST']._serialized_start=1480
+  _globals['_BATCHREQUEST']._serialized_end=1577
+  _globals['_BATCHRESPONSE']._serialized_start=1579
+  _globals['_BATCHRESPONSE']._serialized_end=1673
+  _globals['_STARTUPLOADREQUEST']._serialized_start=1675
+  _globals['_STARTUPLOADREQUEST']._serialized_end=1734
+  _globals['_UPLOADCHUNK']._serialized_start=1736
+  _globals['_UPLOADCHUNK']._serialized_end=1833
+  _globals['_UPLOADQUERY']._serialized_start=1835
+  _globals['_UPLOADQUERY']._serialized_end=1867
+  _globals['_UPLOADSTATUS']._serialized_start=1870
+  _globals['_UPLOADSTATUS']._serialized_end=2024
+  _globals['_FETCHOUTPUTREQUEST']._serialized_start=2026
+  _globals['_FETCHOUTPUTREQUEST']._serialized_end=2101
+  _globals['_JOBOUTPUT']._serialized_start=2103
+  _globals['_JOBOUTPUT']._serialized_end=2177
+  _globals['_JOBQUERY']._serialized_start=2179
+  _globals['_JOBQUERY']._serialized_end=2205
+  _globals['_JOBSTATUS']._serialized_start=2208
+  _globals['_JOBSTATUS']._serialized_end=2344
+  _globals['_SIGNATUREREQUEST']._serialized_start=2346
+  _globals['_SIGNATUREREQUEST']._serialized_end=2406
+  _globals['_BLOCKSIGNATURE']._serialized_start=2408
+  _globals['_BLOCKSIGNATURE']._serialized_end=2454
+  _globals['_SIGNATUREBATCH']._serialized_start=2457
+  _globals['_SIGNATUREBATCH']._serialized_end=2623
+  _globals['_BLOCKRANGE']._serialized_start=2625
+  _globals['_BLOCKRANGE']._serialized_end=2673
+  _globals['_DELTAOP']._serialized_start=2675
+  _globals['_DELTAOP']._serialized_end=2753
+  _globals['_DELTACHUNK']._serialized_start=2756
+  _globals['_DELTACHUNK']._serialized_end=2908
+  _globals['_LATENCYQUERY']._serialized_start=2910
+  _globals['_LATENCYQUERY']._serialized_end=2943
+  _globals['_LATENCYSERIES']._serialized_start=2946
+  _globals['_LATENCYSERIES']._serialized_end=3124
+  _globals['_LATENCYREPORT']._serialized_start=3126
+  _globals['_LATENCYREPORT']._serialized_end=3188
+  _globals['_SERVERSTATEQUERY']._serialized_start=3190
+  _globals['_SERVERSTATEQUERY']._serialized_end=3208
+  _globals['_ACTIVEREQUEST']._serialized_start=3211
+  _globals['_ACTIVEREQUEST']._serialized_end=3465
+  _globals['_SERVERSTATE']._serialized_start=3468
+  _globals['_SERVERSTATE']._serialized_end=3690
+  _globals['_JOBRECORD']._serialized_start=3693
+  _globals['_JOBRECORD']._serialized_end=3835
+  _globals['_FILEPROCESSORSERVICE']._serialized_start=3913
+  _globals['_FILEPROCESSORSERVICE']._serialized_end=5348
 # @@protoc_insertion_point(module_scope)
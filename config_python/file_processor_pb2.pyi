@@ -1,31 +1,52 @@
+from google.protobuf.internal import containers as _containers
+from google.protobuf.internal import enum_type_wrapper as _enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
-from collections.abc import Mapping as _Mapping
+from collections.abc import Iterable as _Iterable, Mapping as _Mapping
 from typing import ClassVar as _ClassVar, Optional as _Optional, Union as _Union
 
 DESCRIPTOR: _descriptor.FileDescriptor
 
+class JobState(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
+    __slots__ = ()
+    JOB_QUEUED: _ClassVar[JobState]
+    JOB_RUNNING: _ClassVar[JobState]
+    JOB_DONE: _ClassVar[JobState]
+    JOB_FAILED: _ClassVar[JobState]
+JOB_QUEUED: JobState
+JOB_RUNNING: JobState
+JOB_DONE: JobState
+JOB_FAILED: JobState
+
 class FileChunk(_message.Message):
-    __slots__ = ("content",)
+    __slots__ = ("content", "crc32c")
     CONTENT_FIELD_NUMBER: _ClassVar[int]
+    CRC32C_FIELD_NUMBER: _ClassVar[int]
     content: bytes
-    def __init__(self, content: _Optional[bytes] = ...) -> None: ...
+    crc32c: int
+    def __init__(self, content: _Optional[bytes] = ..., crc32c: _Optional[int] = ...) -> None: ...
 
 class FileRequest(_message.Message):
-    __slots__ = ("file_name", "file_content", "compress_pdf_params", "convert_to_txt_params", "convert_image_format_params", "resize_image_params")
+    __slots__ = ("file_name", "file_content", "compress_pdf_params", "convert_to_txt_params", "convert_image_format_params", "resize_image_params", "resize_image_multi_params", "pipeline_params", "upload_id")
     FILE_NAME_FIELD_NUMBER: _ClassVar[int]
     FILE_CONTENT_FIELD_NUMBER: _ClassVar[int]
     COMPRESS_PDF_PARAMS_FIELD_NUMBER: _ClassVar[int]
     CONVERT_TO_TXT_PARAMS_FIELD_NUMBER: _ClassVar[int]
     CONVERT_IMAGE_FORMAT_PARAMS_FIELD_NUMBER: _ClassVar[int]
     RESIZE_IMAGE_PARAMS_FIELD_NUMBER: _ClassVar[int]
+    RESIZE_IMAGE_MULTI_PARAMS_FIELD_NUMBER: _ClassVar[int]
+    PIPELINE_PARAMS_FIELD_NUMBER: _ClassVar[int]
+    UPLOAD_ID_FIELD_NUMBER: _ClassVar[int]
     file_name: str
     file_content: FileChunk
     compress_pdf_params: CompressPDFRequest
     convert_to_txt_params: ConvertToTXTRequest
     convert_image_format_params: ConvertImageFormatRequest
     resize_image_params: ResizeImageRequest
-    def __init__(self, file_name: _Optional[str] = ..., file_content: _Optional[_Union[FileChunk, _Mapping]] = ..., compress_pdf_params: _Optional[_Union[CompressPDFRequest, _Mapping]] = ..., convert_to_txt_params: _Optional[_Union[ConvertToTXTRequest, _Mapping]] = ..., convert_image_format_params: _Optional[_Union[ConvertImageFormatRequest, _Mapping]] = ..., resize_image_params: _Optional[_Union[ResizeImageRequest, _Mapping]] = ...) -> None: ...
+    resize_image_multi_params: ResizeImageMultiRequest
+    pipeline_params: PipelineRequest
+    upload_id: str
+    def __init__(self, file_name: _Optional[str] = ..., file_content: _Optional[_Union[FileChunk, _Mapping]] = ..., compress_pdf_params: _Optional[_Union[CompressPDFRequest, _Mapping]] = ..., convert_to_txt_params: _Optional[_Union[ConvertToTXTRequest, _Mapping]] = ..., convert_image_format_params: _Optional[_Union[ConvertImageFormatRequest, _Mapping]] = ..., resize_image_params: _Optional[_Union[ResizeImageRequest, _Mapping]] = ..., resize_image_multi_params: _Optional[_Union[ResizeImageMultiRequest, _Mapping]] = ..., pipeline_params: _Optional[_Union[PipelineRequest, _Mapping]] = ..., upload_id: _Optional[str] = ...) -> None: ...
 
 class CompressPDFRequest(_message.Message):
     __slots__ = ()
@@ -49,14 +70,320 @@ class ResizeImageRequest(_message.Message):
     height: int
     def __init__(self, width: _Optional[int] = ..., height: _Optional[int] = ...) -> None: ...
 
+class ImageSize(_message.Message):
+    __slots__ = ("width", "height")
+    WIDTH_FIELD_NUMBER: _ClassVar[int]
+    HEIGHT_FIELD_NUMBER: _ClassVar[int]
+    width: int
+    height: int
+    def __init__(self, width: _Optional[int] = ..., height: _Optional[int] = ...) -> None: ...
+
+class ResizeImageMultiRequest(_message.Message):
+    __slots__ = ("sizes",)
+    SIZES_FIELD_NUMBER: _ClassVar[int]
+    sizes: _containers.RepeatedCompositeFieldContainer[ImageSize]
+    def __init__(self, sizes: _Optional[_Iterable[_Union[ImageSize, _Mapping]]] = ...) -> None: ...
+
+class PipelineStep(_message.Message):
+    __slots__ = ("compress_pdf", "convert_to_txt", "convert_image_format", "resize_image")
+    COMPRESS_PDF_FIELD_NUMBER: _ClassVar[int]
+    CONVERT_TO_TXT_FIELD_NUMBER: _ClassVar[int]
+    CONVERT_IMAGE_FORMAT_FIELD_NUMBER: _ClassVar[int]
+    RESIZE_IMAGE_FIELD_NUMBER: _ClassVar[int]
+    compress_pdf: CompressPDFRequest
+    convert_to_txt: ConvertToTXTRequest
+    convert_image_format: ConvertImageFormatRequest
+    resize_image: ResizeImageRequest
+    def __init__(self, compress_pdf: _Optional[_Union[CompressPDFRequest, _Mapping]] = ..., convert_to_txt: _Optional[_Union[ConvertToTXTRequest, _Mapping]] = ..., convert_image_format: _Optional[_Union[ConvertImageFormatRequest, _Mapping]] = ..., resize_image: _Optional[_Union[ResizeImageRequest, _Mapping]] = ...) -> None: ...
+
+class PipelineRequest(_message.Message):
+    __slots__ = ("steps",)
+    STEPS_FIELD_NUMBER: _ClassVar[int]
+    steps: _containers.RepeatedCompositeFieldContainer[PipelineStep]
+    def __init__(self, steps: _Optional[_Iterable[_Union[PipelineStep, _Mapping]]] = ...) -> None: ...
+
 class FileResponse(_message.Message):
-    __slots__ = ("file_name", "file_content", "status_message", "success")
+    __slots__ = ("file_name", "file_content", "status_message", "success", "result_handle", "output_size", "output_crc32c")
     FILE_NAME_FIELD_NUMBER: _ClassVar[int]
     FILE_CONTENT_FIELD_NUMBER: _ClassVar[int]
     STATUS_MESSAGE_FIELD_NUMBER: _ClassVar[int]
     SUCCESS_FIELD_NUMBER: _ClassVar[int]
+    RESULT_HANDLE_FIELD_NUMBER: _ClassVar[int]
+    OUTPUT_SIZE_FIELD_NUMBER: _ClassVar[int]
+    OUTPUT_CRC32C_FIELD_NUMBER: _ClassVar[int]
     file_name: str
     file_content: FileChunk
     status_message: str
     success: bool
-    def __init__(self, file_name: _Optional[str] = ..., file_content: _Optional[_Union[FileChunk, _Mapping]] = ..., status_message: _Optional[str] = ..., success: bool = ...) -> None: ...
+    result_handle: str
+    output_size: int
+    output_crc32c: int
+    def __init__(self, file_name: _Optional[str] = ..., file_content: _Optional[_Union[FileChunk, _Mapping]] = ..., status_message: _Optional[str] = ..., success: bool = ..., result_handle: _Optional[str] = ..., output_size: _Optional[int] = ..., output_crc32c: _Optional[int] = ...) -> None: ...
+
+class BatchRequest(_message.Message):
+    __slots__ = ("file_id", "request", "last_chunk")
+    FILE_ID_FIELD_NUMBER: _ClassVar[int]
+    REQUEST_FIELD_NUMBER: _ClassVar[int]
+    LAST_CHUNK_FIELD_NUMBER: _ClassVar[int]
+    file_id: str
+    request: FileRequest
+    last_chunk: bool
+    def __init__(self, file_id: _Optional[str] = ..., request: _Optional[_Union[FileRequest, _Mapping]] = ..., last_chunk: bool = ...) -> None: ...
+
+class BatchResponse(_message.Message):
+    __slots__ = ("file_id", "response", "done")
+    FILE_ID_FIELD_NUMBER: _ClassVar[int]
+    RESPONSE_FIELD_NUMBER: _ClassVar[int]
+    DONE_FIELD_NUMBER: _ClassVar[int]
+    file_id: str
+    response: FileResponse
+    done: bool
+    def __init__(self, file_id: _Optional[str] = ..., response: _Optional[_Union[FileResponse, _Mapping]] = ..., done: bool = ...) -> None: ...
+
+class StartUploadRequest(_message.Message):
+    __slots__ = ("file_name", "total_size")
+    FILE_NAME_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_SIZE_FIELD_NUMBER: _ClassVar[int]
+    file_name: str
+    total_size: int
+    def __init__(self, file_name: _Optional[str] = ..., total_size: _Optional[int] = ...) -> None: ...
+
+class UploadChunk(_message.Message):
+    __slots__ = ("upload_id", "offset", "content", "crc32c")
+    UPLOAD_ID_FIELD_NUMBER: _ClassVar[int]
+    OFFSET_FIELD_NUMBER: _ClassVar[int]
+    CONTENT_FIELD_NUMBER: _ClassVar[int]
+    CRC32C_FIELD_NUMBER: _ClassVar[int]
+    upload_id: str
+    offset: int
+    content: bytes
+    crc32c: int
+    def __init__(self, upload_id: _Optional[str] = ..., offset: _Optional[int] = ..., content: _Optional[bytes] = ..., crc32c: _Optional[int] = ...) -> None: ...
+
+class UploadQuery(_message.Message):
+    __slots__ = ("upload_id",)
+    UPLOAD_ID_FIELD_NUMBER: _ClassVar[int]
+    upload_id: str
+    def __init__(self, upload_id: _Optional[str] = ...) -> None: ...
+
+class UploadStatus(_message.Message):
+    __slots__ = ("upload_id", "committed_offset", "total_size", "complete", "success", "status_message", "sha256")
+    UPLOAD_ID_FIELD_NUMBER: _ClassVar[int]
+    COMMITTED_OFFSET_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_SIZE_FIELD_NUMBER: _ClassVar[int]
+    COMPLETE_FIELD_NUMBER: _ClassVar[int]
+    SUCCESS_FIELD_NUMBER: _ClassVar[int]
+    STATUS_MESSAGE_FIELD_NUMBER: _ClassVar[int]
+    SHA256_FIELD_NUMBER: _ClassVar[int]
+    upload_id: str
+    committed_offset: int
+    total_size: int
+    complete: bool
+    success: bool
+    status_message: str
+    sha256: str
+    def __init__(self, upload_id: _Optional[str] = ..., committed_offset: _Optional[int] = ..., total_size: _Optional[int] = ..., complete: bool = ..., success: bool = ..., status_message: _Optional[str] = ..., sha256: _Optional[str] = ...) -> None: ...
+
+class FetchOutputRequest(_message.Message):
+    __slots__ = ("result_handle", "offset", "length")
+    RESULT_HANDLE_FIELD_NUMBER: _ClassVar[int]
+    OFFSET_FIELD_NUMBER: _ClassVar[int]
+    LENGTH_FIELD_NUMBER: _ClassVar[int]
+    result_handle: str
+    offset: int
+    length: int
+    def __init__(self, result_handle: _Optional[str] = ..., offset: _Optional[int] = ..., length: _Optional[int] = ...) -> None: ...
+
+class JobOutput(_message.Message):
+    __slots__ = ("file_name", "result_handle", "output_size")
+    FILE_NAME_FIELD_NUMBER: _ClassVar[int]
+    RESULT_HANDLE_FIELD_NUMBER: _ClassVar[int]
+    OUTPUT_SIZE_FIELD_NUMBER: _ClassVar[int]
+    file_name: str
+    result_handle: str
+    output_size: int
+    def __init__(self, file_name: _Optional[str] = ..., result_handle: _Optional[str] = ..., output_size: _Optional[int] = ...) -> None: ...
+
+class JobQuery(_message.Message):
+    __slots__ = ("job_id",)
+    JOB_ID_FIELD_NUMBER: _ClassVar[int]
+    job_id: str
+    def __init__(self, job_id: _Optional[str] = ...) -> None: ...
+
+class JobStatus(_message.Message):
+    __slots__ = ("job_id", "state", "status_message", "outputs")
+    JOB_ID_FIELD_NUMBER: _ClassVar[int]
+    STATE_FIELD_NUMBER: _ClassVar[int]
+    STATUS_MESSAGE_FIELD_NUMBER: _ClassVar[int]
+    OUTPUTS_FIELD_NUMBER: _ClassVar[int]
+    job_id: str
+    state: JobState
+    status_message: str
+    outputs: _containers.RepeatedCompositeFieldContainer[JobOutput]
+    def __init__(self, job_id: _Optional[str] = ..., state: _Optional[_Union[JobState, str]] = ..., status_message: _Optional[str] = ..., outputs: _Optional[_Iterable[_Union[JobOutput, _Mapping]]] = ...) -> None: ...
+
+class SignatureRequest(_message.Message):
+    __slots__ = ("basis_sha256", "block_size")
+    BASIS_SHA256_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_SIZE_FIELD_NUMBER: _ClassVar[int]
+    basis_sha256: str
+    block_size: int
+    def __init__(self, basis_sha256: _Optional[str] = ..., block_size: _Optional[int] = ...) -> None: ...
+
+class BlockSignature(_message.Message):
+    __slots__ = ("weak", "strong")
+    WEAK_FIELD_NUMBER: _ClassVar[int]
+    STRONG_FIELD_NUMBER: _ClassVar[int]
+    weak: int
+    strong: bytes
+    def __init__(self, weak: _Optional[int] = ..., strong: _Optional[bytes] = ...) -> None: ...
+
+class SignatureBatch(_message.Message):
+    __slots__ = ("success", "status_message", "block_size", "basis_size", "blocks", "first_block")
+    SUCCESS_FIELD_NUMBER: _ClassVar[int]
+    STATUS_MESSAGE_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_SIZE_FIELD_NUMBER: _ClassVar[int]
+    BASIS_SIZE_FIELD_NUMBER: _ClassVar[int]
+    BLOCKS_FIELD_NUMBER: _ClassVar[int]
+    FIRST_BLOCK_FIELD_NUMBER: _ClassVar[int]
+    success: bool
+    status_message: str
+    block_size: int
+    basis_size: int
+    blocks: _containers.RepeatedCompositeFieldContainer[BlockSignature]
+    first_block: int
+    def __init__(self, success: bool = ..., status_message: _Optional[str] = ..., block_size: _Optional[int] = ..., basis_size: _Optional[int] = ..., blocks: _Optional[_Iterable[_Union[BlockSignature, _Mapping]]] = ..., first_block: _Optional[int] = ...) -> None: ...
+
+class BlockRange(_message.Message):
+    __slots__ = ("first_block", "count")
+    FIRST_BLOCK_FIELD_NUMBER: _ClassVar[int]
+    COUNT_FIELD_NUMBER: _ClassVar[int]
+    first_block: int
+    count: int
+    def __init__(self, first_block: _Optional[int] = ..., count: _Optional[int] = ...) -> None: ...
+
+class DeltaOp(_message.Message):
+    __slots__ = ("literal", "copy")
+    LITERAL_FIELD_NUMBER: _ClassVar[int]
+    COPY_FIELD_NUMBER: _ClassVar[int]
+    literal: bytes
+    copy: BlockRange
+    def __init__(self, literal: _Optional[bytes] = ..., copy: _Optional[_Union[BlockRange, _Mapping]] = ...) -> None: ...
+
+class DeltaChunk(_message.Message):
+    __slots__ = ("basis_sha256", "block_size", "file_name", "total_size", "file_sha256", "ops")
+    BASIS_SHA256_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_SIZE_FIELD_NUMBER: _ClassVar[int]
+    FILE_NAME_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_SIZE_FIELD_NUMBER: _ClassVar[int]
+    FILE_SHA256_FIELD_NUMBER: _ClassVar[int]
+    OPS_FIELD_NUMBER: _ClassVar[int]
+    basis_sha256: str
+    block_size: int
+    file_name: str
+    total_size: int
+    file_sha256: str
+    ops: _containers.RepeatedCompositeFieldContainer[DeltaOp]
+    def __init__(self, basis_sha256: _Optional[str] = ..., block_size: _Optional[int] = ..., file_name: _Optional[str] = ..., total_size: _Optional[int] = ..., file_sha256: _Optional[str] = ..., ops: _Optional[_Iterable[_Union[DeltaOp, _Mapping]]] = ...) -> None: ...
+
+class LatencyQuery(_message.Message):
+    __slots__ = ("operation",)
+    OPERATION_FIELD_NUMBER: _ClassVar[int]
+    operation: str
+    def __init__(self, operation: _Optional[str] = ...) -> None: ...
+
+class LatencySeries(_message.Message):
+    __slots__ = ("operation", "success", "phase", "count", "sum_us", "max_us", "p50_us", "p90_us", "p99_us", "p999_us")
+    OPERATION_FIELD_NUMBER: _ClassVar[int]
+    SUCCESS_FIELD_NUMBER: _ClassVar[int]
+    PHASE_FIELD_NUMBER: _ClassVar[int]
+    COUNT_FIELD_NUMBER: _ClassVar[int]
+    SUM_US_FIELD_NUMBER: _ClassVar[int]
+    MAX_US_FIELD_NUMBER: _ClassVar[int]
+    P50_US_FIELD_NUMBER: _ClassVar[int]
+    P90_US_FIELD_NUMBER: _ClassVar[int]
+    P99_US_FIELD_NUMBER: _ClassVar[int]
+    P999_US_FIELD_NUMBER: _ClassVar[int]
+    operation: str
+    success: bool
+    phase: str
+    count: int
+    sum_us: int
+    max_us: int
+    p50_us: int
+    p90_us: int
+    p99_us: int
+    p999_us: int
+    def __init__(self, operation: _Optional[str] = ..., success: bool = ..., phase: _Optional[str] = ..., count: _Optional[int] = ..., sum_us: _Optional[int] = ..., max_us: _Optional[int] = ..., p50_us: _Optional[int] = ..., p90_us: _Optional[int] = ..., p99_us: _Optional[int] = ..., p999_us: _Optional[int] = ...) -> None: ...
+
+class LatencyReport(_message.Message):
+    __slots__ = ("series",)
+    SERIES_FIELD_NUMBER: _ClassVar[int]
+    series: _containers.RepeatedCompositeFieldContainer[LatencySeries]
+    def __init__(self, series: _Optional[_Iterable[_Union[LatencySeries, _Mapping]]] = ...) -> None: ...
+
+class ServerStateQuery(_message.Message):
+    __slots__ = ()
+    def __init__(self) -> None: ...
+
+class ActiveRequest(_message.Message):
+    __slots__ = ("id", "rpc", "operation", "file_name", "phase", "elapsed_us", "phase_elapsed_us", "bytes_received", "bytes_sent", "child_pid", "child_tool", "peer", "trace_id")
+    ID_FIELD_NUMBER: _ClassVar[int]
+    RPC_FIELD_NUMBER: _ClassVar[int]
+    OPERATION_FIELD_NUMBER: _ClassVar[int]
+    FILE_NAME_FIELD_NUMBER: _ClassVar[int]
+    PHASE_FIELD_NUMBER: _ClassVar[int]
+    ELAPSED_US_FIELD_NUMBER: _ClassVar[int]
+    PHASE_ELAPSED_US_FIELD_NUMBER: _ClassVar[int]
+    BYTES_RECEIVED_FIELD_NUMBER: _ClassVar[int]
+    BYTES_SENT_FIELD_NUMBER: _ClassVar[int]
+    CHILD_PID_FIELD_NUMBER: _ClassVar[int]
+    CHILD_TOOL_FIELD_NUMBER: _ClassVar[int]
+    PEER_FIELD_NUMBER: _ClassVar[int]
+    TRACE_ID_FIELD_NUMBER: _ClassVar[int]
+    id: int
+    rpc: str
+    operation: str
+    file_name: str
+    phase: str
+    elapsed_us: int
+    phase_elapsed_us: int
+    bytes_received: int
+    bytes_sent: int
+    child_pid: int
+    child_tool: str
+    peer: str
+    trace_id: str
+    def __init__(self, id: _Optional[int] = ..., rpc: _Optional[str] = ..., operation: _Optional[str] = ..., file_name: _Optional[str] = ..., phase: _Optional[str] = ..., elapsed_us: _Optional[int] = ..., phase_elapsed_us: _Optional[int] = ..., bytes_received: _Optional[int] = ..., bytes_sent: _Optional[int] = ..., child_pid: _Optional[int] = ..., child_tool: _Optional[str] = ..., peer: _Optional[str] = ..., trace_id: _Optional[str] = ...) -> None: ...
+
+class ServerState(_message.Message):
+    __slots__ = ("requests", "worker_threads", "worker_active", "worker_queued", "jobs_queued", "jobs_running", "ingest_buffer_bytes", "uptime_s")
+    REQUESTS_FIELD_NUMBER: _ClassVar[int]
+    WORKER_THREADS_FIELD_NUMBER: _ClassVar[int]
+    WORKER_ACTIVE_FIELD_NUMBER: _ClassVar[int]
+    WORKER_QUEUED_FIELD_NUMBER: _ClassVar[int]
+    JOBS_QUEUED_FIELD_NUMBER: _ClassVar[int]
+    JOBS_RUNNING_FIELD_NUMBER: _ClassVar[int]
+    INGEST_BUFFER_BYTES_FIELD_NUMBER: _ClassVar[int]
+    UPTIME_S_FIELD_NUMBER: _ClassVar[int]
+    requests: _containers.RepeatedCompositeFieldContainer[ActiveRequest]
+    worker_threads: int
+    worker_active: int
+    worker_queued: int
+    jobs_queued: int
+    jobs_running: int
+    ingest_buffer_bytes: int
+    uptime_s: int
+    def __init__(self, requests: _Optional[_Iterable[_Union[ActiveRequest, _Mapping]]] = ..., worker_threads: _Optional[int] = ..., worker_active: _Optional[int] = ..., worker_queued: _Optional[int] = ..., jobs_queued: _Optional[int] = ..., jobs_running: _Optional[int] = ..., ingest_buffer_bytes: _Optional[int] = ..., uptime_s: _Optional[int] = ...) -> None: ...
+
+class JobRecord(_message.Message):
+    __slots__ = ("status", "request", "submitted_at", "input_size")
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    REQUEST_FIELD_NUMBER: _ClassVar[int]
+    SUBMITTED_AT_FIELD_NUMBER: _ClassVar[int]
+    INPUT_SIZE_FIELD_NUMBER: _ClassVar[int]
+    status: JobStatus
+    request: FileRequest
+    submitted_at: int
+    input_size: int
+    def __init__(self, status: _Optional[_Union[JobStatus, _Mapping]] = ..., request: _Optional[_Union[FileRequest, _Mapping]] = ..., submitted_at: _Optional[int] = ..., input_size: _Optional[int] = ...) -> None: ...
@@ -55,6 +55,76 @@ class FileProcessorServiceStub(object):
                 request_serializer=proto_dot_file__processor__pb2.FileRequest.SerializeToString,
                 response_deserializer=proto_dot_file__processor__pb2.FileResponse.FromString,
                 _registered_method=True)
+        self.ResizeImageMulti = channel.stream_stream(
+                '/file_processor.FileProcessorService/ResizeImageMulti',
+                request_serializer=proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.FileResponse.FromString,
+                _registered_method=True)
+        self.RunPipeline = channel.stream_stream(
+                '/file_processor.FileProcessorService/RunPipeline',
+                request_serializer=proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.FileResponse.FromString,
+                _registered_method=True)
+        self.ProcessBatch = channel.stream_stream(
+                '/file_processor.FileProcessorService/ProcessBatch',
+                request_serializer=proto_dot_file__processor__pb2.BatchRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.BatchResponse.FromString,
+                _registered_method=True)
+        self.StartUpload = channel.unary_unary(
+                '/file_processor.FileProcessorService/StartUpload',
+                request_serializer=proto_dot_file__processor__pb2.StartUploadRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.UploadStatus.FromString,
+                _registered_method=True)
+        self.UploadChunks = channel.stream_stream(
+                '/file_processor.FileProcessorService/UploadChunks',
+                request_serializer=proto_dot_file__processor__pb2.UploadChunk.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.UploadStatus.FromString,
+                _registered_method=True)
+        self.QueryUpload = channel.unary_unary(
+                '/file_processor.FileProcessorService/QueryUpload',
+                request_serializer=proto_dot_file__processor__pb2.UploadQuery.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.UploadStatus.FromString,
+                _registered_method=True)
+        self.GetSignatures = channel.unary_stream(
+                '/file_processor.FileProcessorService/GetSignatures',
+                request_serializer=proto_dot_file__processor__pb2.SignatureRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.SignatureBatch.FromString,
+                _registered_method=True)
+        self.UploadDelta = channel.stream_stream(
+                '/file_processor.FileProcessorService/UploadDelta',
+                request_serializer=proto_dot_file__processor__pb2.DeltaChunk.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.UploadStatus.FromString,
+                _registered_method=True)
+        self.FetchOutput = channel.unary_stream(
+                '/file_processor.FileProcessorService/FetchOutput',
+                request_serializer=proto_dot_file__processor__pb2.FetchOutputRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.FileResponse.FromString,
+                _registered_method=True)
+        self.SubmitJob = channel.unary_unary(
+                '/file_processor.FileProcessorService/SubmitJob',
+                request_serializer=proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.JobStatus.FromString,
+                _registered_method=True)
+        self.GetJobStatus = channel.unary_unary(
+                '/file_processor.FileProcessorService/GetJobStatus',
+                request_serializer=proto_dot_file__processor__pb2.JobQuery.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.JobStatus.FromString,
+                _registered_method=True)
+        self.FetchResult = channel.unary_stream(
+                '/file_processor.FileProcessorService/FetchResult',
+                request_serializer=proto_dot_file__processor__pb2.JobQuery.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.FileResponse.FromString,
+                _registered_method=True)
+        self.GetLatencyStats = channel.unary_unary(
+                '/file_processor.FileProcessorService/GetLatencyStats',
+                request_serializer=proto_dot_file__processor__pb2.LatencyQuery.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.LatencyReport.FromString,
+                _registered_method=True)
+        self.GetServerState = channel.unary_unary(
+                '/file_processor.FileProcessorService/GetServerState',
+                request_serializer=proto_dot_file__processor__pb2.ServerStateQuery.SerializeToString,
+                response_deserializer=proto_dot_file__processor__pb2.ServerState.FromString,
+                _registered_method=True)
 
 
 class FileProcessorServiceServicer(object):
@@ -84,6 +154,90 @@ class FileProcessorServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def ResizeImageMulti(self, request_iterator, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def RunPipeline(self, request_iterator, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def ProcessBatch(self, request_iterator, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def StartUpload(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def UploadChunks(self, request_iterator, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def QueryUpload(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetSignatures(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def UploadDelta(self, request_iterator, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def FetchOutput(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def SubmitJob(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetJobStatus(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def FetchResult(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetLatencyStats(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetServerState(self, request, context):
+        """Missing associated documentation comment in .proto file."""
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_FileProcessorServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -107,6 +261,76 @@ def add_FileProcessorServiceServicer_to_server(servicer, server):
                     request_deserializer=proto_dot_file__processor__pb2.FileRequest.FromString,
                     response_serializer=proto_dot_file__processor__pb2.FileResponse.SerializeToString,
             ),
+            'ResizeImageMulti': grpc.stream_stream_rpc_method_handler(
+                    servicer.ResizeImageMulti,
+                    request_deserializer=proto_dot_file__processor__pb2.FileRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.FileResponse.SerializeToString,
+            ),
+            'RunPipeline': grpc.stream_stream_rpc_method_handler(
+                    servicer.RunPipeline,
+                    request_deserializer=proto_dot_file__processor__pb2.FileRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.FileResponse.SerializeToString,
+            ),
+            'ProcessBatch': grpc.stream_stream_rpc_method_handler(
+                    servicer.ProcessBatch,
+                    request_deserializer=proto_dot_file__processor__pb2.BatchRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.BatchResponse.SerializeToString,
+            ),
+            'StartUpload': grpc.unary_unary_rpc_method_handler(
+                    servicer.StartUpload,
+                    request_deserializer=proto_dot_file__processor__pb2.StartUploadRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.UploadStatus.SerializeToString,
+            ),
+            'UploadChunks': grpc.stream_stream_rpc_method_handler(
+                    servicer.UploadChunks,
+                    request_deserializer=proto_dot_file__processor__pb2.UploadChunk.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.UploadStatus.SerializeToString,
+            ),
+            'QueryUpload': grpc.unary_unary_rpc_method_handler(
+                    servicer.QueryUpload,
+                    request_deserializer=proto_dot_file__processor__pb2.UploadQuery.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.UploadStatus.SerializeToString,
+            ),
+            'GetSignatures': grpc.unary_stream_rpc_method_handler(
+                    servicer.GetSignatures,
+                    request_deserializer=proto_dot_file__processor__pb2.SignatureRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.SignatureBatch.SerializeToString,
+            ),
+            'UploadDelta': grpc.stream_stream_rpc_method_handler(
+                    servicer.UploadDelta,
+                    request_deserializer=proto_dot_file__processor__pb2.DeltaChunk.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.UploadStatus.SerializeToString,
+            ),
+            'FetchOutput': grpc.unary_stream_rpc_method_handler(
+                    servicer.FetchOutput,
+                    request_deserializer=proto_dot_file__processor__pb2.FetchOutputRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.FileResponse.SerializeToString,
+            ),
+            'SubmitJob': grpc.unary_unary_rpc_method_handler(
+                    servicer.SubmitJob,
+                    request_deserializer=proto_dot_file__processor__pb2.FileRequest.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.JobStatus.SerializeToString,
+            ),
+            'GetJobStatus': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetJobStatus,
+                    request_deserializer=proto_dot_file__processor__pb2.JobQuery.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.JobStatus.SerializeToString,
+            ),
+            'FetchResult': grpc.unary_stream_rpc_method_handler(
+                    servicer.FetchResult,
+                    request_deserializer=proto_dot_file__processor__pb2.JobQuery.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.FileResponse.SerializeToString,
+            ),
+            'GetLatencyStats': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetLatencyStats,
+                    request_deserializer=proto_dot_file__processor__pb2.LatencyQuery.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.LatencyReport.SerializeToString,
+            ),
+            'GetServerState': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetServerState,
+                    request_deserializer=proto_dot_file__processor__pb2.ServerStateQuery.FromString,
+                    response_serializer=proto_dot_file__processor__pb2.ServerState.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'file_processor.FileProcessorService', rpc_method_handlers)
@@ -225,3 +449,381 @@ class FileProcessorService(object):
             timeout,
             metadata,
             _registered_method=True)
+
+    @staticmethod
+    def ResizeImageMulti(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/file_processor.FileProcessorService/ResizeImageMulti',
+            proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+            proto_dot_file__processor__pb2.FileResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def RunPipeline(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/file_processor.FileProcessorService/RunPipeline',
+            proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+            proto_dot_file__processor__pb2.FileResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def ProcessBatch(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/file_processor.FileProcessorService/ProcessBatch',
+            proto_dot_file__processor__pb2.BatchRequest.SerializeToString,
+            proto_dot_file__processor__pb2.BatchResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def StartUpload(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/StartUpload',
+            proto_dot_file__processor__pb2.StartUploadRequest.SerializeToString,
+            proto_dot_file__processor__pb2.UploadStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def UploadChunks(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/file_processor.FileProcessorService/UploadChunks',
+            proto_dot_file__processor__pb2.UploadChunk.SerializeToString,
+            proto_dot_file__processor__pb2.UploadStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def QueryUpload(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/QueryUpload',
+            proto_dot_file__processor__pb2.UploadQuery.SerializeToString,
+            proto_dot_file__processor__pb2.UploadStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetSignatures(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/file_processor.FileProcessorService/GetSignatures',
+            proto_dot_file__processor__pb2.SignatureRequest.SerializeToString,
+            proto_dot_file__processor__pb2.SignatureBatch.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def UploadDelta(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(
+            request_iterator,
+            target,
+            '/file_processor.FileProcessorService/UploadDelta',
+            proto_dot_file__processor__pb2.DeltaChunk.SerializeToString,
+            proto_dot_file__processor__pb2.UploadStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def FetchOutput(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/file_processor.FileProcessorService/FetchOutput',
+            proto_dot_file__processor__pb2.FetchOutputRequest.SerializeToString,
+            proto_dot_file__processor__pb2.FileResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def SubmitJob(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/SubmitJob',
+            proto_dot_file__processor__pb2.FileRequest.SerializeToString,
+            proto_dot_file__processor__pb2.JobStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetJobStatus(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/GetJobStatus',
+            proto_dot_file__processor__pb2.JobQuery.SerializeToString,
+            proto_dot_file__processor__pb2.JobStatus.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def FetchResult(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(
+            request,
+            target,
+            '/file_processor.FileProcessorService/FetchResult',
+            proto_dot_file__processor__pb2.JobQuery.SerializeToString,
+            proto_dot_file__processor__pb2.FileResponse.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetLatencyStats(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/GetLatencyStats',
+            proto_dot_file__processor__pb2.LatencyQuery.SerializeToString,
+            proto_dot_file__processor__pb2.LatencyReport.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
+
+    @staticmethod
+    def GetServerState(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(
+            request,
+            target,
+            '/file_processor.FileProcessorService/GetServerState',
+            proto_dot_file__processor__pb2.ServerStateQuery.SerializeToString,
+            proto_dot_file__processor__pb2.ServerState.FromString,
+            options,
+            channel_credentials,
+            insecure,
+            call_credentials,
+            compression,
+            wait_for_ready,
+            timeout,
+            metadata,
+            _registered_method=True)
@@ -0,0 +1,77 @@
+#!/usr/bin/env bash
+# Benchmark de vazão por tamanho de chunk: envia e recebe um arquivo com o cliente C++
+# (CompressPDF) fixando CHUNK_SIZE_KB em cada valor e também no modo adaptativo ("auto").
+# Com root e tc disponíveis, repete cada rodada com latência emulada no loopback (tc netem).
+#
+# Variáveis: BENCH_MB (tamanho do arquivo, padrão 64), BENCH_SIZES (KB; padrão
+# "16 64 256 1024 2048 auto"), NETEM_DELAYS (padrão "0 20ms 50ms"; 0 = sem netem).
+# Requer servidor e cliente já compilados (scripts/run_tests.sh).
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+SERVER_BIN="${SERVER_BIN:-${ROOT_DIR}/server_cpp/servidor}"
+CLIENT_BIN="${CLIENT_BIN:-${ROOT_DIR}/client_cpp/cliente}"
+BENCH_MB="${BENCH_MB:-64}"
+BENCH_SIZES="${BENCH_SIZES:-16 64 256 1024 2048 auto}"
+NETEM_DELAYS="${NETEM_DELAYS:-0 20ms 50ms}"
+
+log() { echo "[bench] $*"; }
+
+for b in "$SERVER_BIN" "$CLIENT_BIN"; do
+  [[ -x "$b" ]] || { echo "Binário ausente: $b (rode scripts/run_tests.sh)" >&2; exit 1; }
+done
+
+# Diretório isolado: o cliente escolhe o arquivo pelo índice na pasta storage,
+# então ela contém apenas o arquivo do benchmark
+WORK_DIR="$(mktemp -d)"
+mkdir -p "${WORK_DIR}/server_cpp" "${WORK_DIR}/client_cpp/storage" "${WORK_DIR}/nobin"
+head -c "$((BENCH_MB * 1024 * 1024))" /dev/urandom > "${WORK_DIR}/client_cpp/storage/bench.pdf"
+
+NETEM_ON=0
+SERVER_PID=""
+cleanup() {
+  if (( NETEM_ON )); then tc qdisc del dev lo root 2>/dev/null || true; fi
+  if [[ -n "$SERVER_PID" ]]; then kill "$SERVER_PID" 2>/dev/null || true; wait "$SERVER_PID" 2>/dev/null || true; fi
+  rm -rf "$WORK_DIR"
+}
+trap cleanup EXIT
+
+# PATH sem ferramentas: a operação cai no fallback de cópia e o tempo medido é só de transferência
+cd "$WORK_DIR"
+PATH="${WORK_DIR}/nobin" "$SERVER_BIN" "127.0.0.1:50051" > server_cpp/server.out 2>&1 &
+SERVER_PID=$!
+sleep 1
+
+can_netem() { [[ "$(id -u)" == "0" ]] && command -v tc >/dev/null 2>&1; }
+
+printf "%-8s %-8s %10s %10s\n" "latência" "chunk" "tempo(s)" "MB/s"
+for delay in $NETEM_DELAYS; do
+  if [[ "$delay" != "0" ]]; then
+    if ! can_netem || ! tc qdisc add dev lo root netem delay "$delay" 2>/dev/null; then
+      log "tc netem indisponível (requer root e sch_netem): pulando latência ${delay}"; continue
+    fi
+    NETEM_ON=1
+  fi
+
+  for kb in $BENCH_SIZES; do
+    rm -f client_cpp/storage/bench_compressed.pdf
+    chunk_env=""
+    [[ "$kb" != "auto" ]] && chunk_env="$kb"
+    start=$(date +%s%N)
+    printf '1\n1\n0\n' | CHUNK_SIZE_KB="$chunk_env" timeout 600 "$CLIENT_BIN" > client.out 2>&1 || true
+    end=$(date +%s%N)
+    if ! cmp -s client_cpp/storage/bench.pdf client_cpp/storage/bench_compressed.pdf; then
+      log "falha na rodada chunk=${kb} latência=${delay} (veja ${WORK_DIR}/client.out)"; continue
+    fi
+
+    # Arquivo vai e volta: 2 * BENCH_MB transferidos
+    awk -v d="$delay" -v k="$kb" -v ns="$((end - start))" -v mb="$BENCH_MB" \
+      'BEGIN { s = ns / 1e9; printf "%-8s %-8s %10.2f %10.1f\n", d, k, s, 2 * mb / s }'
+  done
+
+  if (( NETEM_ON )); then tc qdisc del dev lo root; NETEM_ON=0; fi
+done
+
+# Tamanho final escolhido pelo servidor em cada rodada (modo adaptativo inclusive)
+log "Chunks registrados pelo servidor:"
+grep -o "\[chunk [^]]*\]" server_cpp/server.log || true
@@ -0,0 +1,77 @@
+#!/usr/bin/env bash
+# Benchmark de transporte: TCP no loopback contra socket Unix (UDS) para arquivos de vários tamanhos.
+# O servidor ouve nos dois endereços ao mesmo tempo; para cada tamanho, o cliente C++ faz várias
+# chamadas CompressPDF seguidas no mesmo processo (canal reaproveitado) por GRPC_TARGET.
+#
+# Variáveis: BENCH_SIZES (padrão "1K 1M 100M", sufixos do head -c), BENCH_REPS (chamadas por
+# tamanho; padrão 200 para 1K, 50 para 1M e 3 para os maiores), BENCH_PORT (padrão 50071).
+# Requer servidor e cliente já compilados (scripts/run_tests.sh).
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+SERVER_BIN="${SERVER_BIN:-${ROOT_DIR}/server_cpp/servidor}"
+CLIENT_BIN="${CLIENT_BIN:-${ROOT_DIR}/client_cpp/cliente}"
+BENCH_SIZES="${BENCH_SIZES:-1K 1M 100M}"
+BENCH_PORT="${BENCH_PORT:-50071}"
+
+log() { echo "[bench] $*"; }
+
+for b in "$SERVER_BIN" "$CLIENT_BIN"; do
+  [[ -x "$b" ]] || { echo "Binário ausente: $b (rode scripts/run_tests.sh)" >&2; exit 1; }
+done
+
+# Diretório isolado: o cliente escolhe o arquivo pelo índice na pasta storage (ordem alfabética),
+# então ela contém apenas o arquivo do benchmark e a saída dele
+WORK_DIR="$(mktemp -d)"
+mkdir -p "${WORK_DIR}/server_cpp" "${WORK_DIR}/client_cpp/storage" "${WORK_DIR}/nobin"
+SOCKET="${WORK_DIR}/servidor.sock"
+
+SERVER_PID=""
+cleanup() {
+  if [[ -n "$SERVER_PID" ]]; then kill "$SERVER_PID" 2>/dev/null || true; wait "$SERVER_PID" 2>/dev/null || true; fi
+  rm -rf "$WORK_DIR"
+}
+trap cleanup EXIT
+
+# PATH sem ferramentas: a operação cai no fallback de cópia e o tempo medido é só de transporte.
+# Sem compressão gRPC, para comparar apenas o caminho dos bytes.
+cd "$WORK_DIR"
+PATH="${WORK_DIR}/nobin" GRPC_COMPRESSION=none "$SERVER_BIN" "127.0.0.1:${BENCH_PORT}" "unix:${SOCKET}" > server_cpp/server.out 2>&1 &
+SERVER_PID=$!
+sleep 1
+
+reps_for() {
+  if [[ -n "${BENCH_REPS:-}" ]]; then echo "$BENCH_REPS"; return; fi
+  case "$1" in
+    *K) echo 200 ;;
+    1M) echo 50 ;;
+    *) echo 3 ;;
+  esac
+}
+
+printf "%-6s %-5s %6s %12s %10s\n" "arquivo" "via" "chamadas" "ms/chamada" "MB/s"
+for size in $BENCH_SIZES; do
+  rm -f client_cpp/storage/*
+  head -c "$size" /dev/urandom > client_cpp/storage/bench.pdf
+  bytes=$(stat -c%s client_cpp/storage/bench.pdf)
+  reps=$(reps_for "$size")
+  input=""
+  for ((i = 0; i < reps; i++)); do input+=$'1\n1\n'; done
+  input+=$'0\n'
+
+  for via in tcp uds; do
+    target="127.0.0.1:${BENCH_PORT}"
+    [[ "$via" == "uds" ]] && target="unix:${SOCKET}"
+    rm -f client_cpp/storage/bench_compressed.pdf
+    start=$(date +%s%N)
+    printf '%s' "$input" | GRPC_TARGET="$target" GRPC_COMPRESSION=none timeout 900 "$CLIENT_BIN" > client.out 2>&1 || true
+    end=$(date +%s%N)
+    if ! cmp -s client_cpp/storage/bench.pdf client_cpp/storage/bench_compressed.pdf; then
+      log "falha na rodada ${size} via ${via} (veja ${WORK_DIR}/client.out)"; continue
+    fi
+
+    # Arquivo vai e volta: 2 * bytes transferidos por chamada
+    awk -v s="$size" -v v="$via" -v r="$reps" -v ns="$((end - start))" -v b="$bytes" \
+      'BEGIN { t = ns / 1e9; printf "%-6s %-5s %6d %12.3f %10.1f\n", s, v, r, 1000 * t / r, 2 * b * r / t / 1048576 }'
+  done
+done
@@ -19,7 +19,7 @@ which grpc_cpp_plugin >/dev/null 2>&1 || { echo "grpc_cpp_plugin não encontrado
 
 echo "[setup] Instalando dependências Python..."
 python3 -m pip install --upgrade pip
-python3 -m pip install --upgrade grpcio>=1.75.1 protobuf>=4.25.1
+python3 -m pip install --upgrade grpcio>=1.75.1 protobuf>=4.25.1 google-crc32c>=1.5.0
 
 echo "[setup] Preparando diretórios de storage..."
 mkdir -p client_python/storage client_cpp/storage server_cpp/storage config_cpp config_python
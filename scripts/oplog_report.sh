@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+# Relatório do log binário de operações (servidor com OPLOG_DIR): vazão, percentis de latência
+# e taxa de erro por operação e, com --by day|hour, por período. Compila o leitor na primeira
+# execução (ou quando o código muda) e repassa os argumentos.
+#
+# Exemplos: bash scripts/oplog_report.sh /var/log/projeto_grpc/oplog
+#           bash scripts/oplog_report.sh --since 2026-09-01 --by day --op CompressPDF oplog/
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+SRC="${ROOT_DIR}/server_cpp/tools/oplog_report.cpp"
+BIN="${ROOT_DIR}/server_cpp/tools/oplog_report"
+
+if [[ ! -x "$BIN" || "$SRC" -nt "$BIN" || "${ROOT_DIR}/server_cpp/oplog.h" -nt "$BIN" || "${ROOT_DIR}/server_cpp/oplog.cpp" -nt "$BIN" ]]; then
+  echo "[oplog] Compilando leitor..." >&2
+  g++ -std=c++17 -O2 "$SRC" "${ROOT_DIR}/server_cpp/oplog.cpp" -pthread -o "$BIN"
+fi
+
+exec "$BIN" "$@"
@@ -20,7 +20,7 @@ build_cpp_client() {
   echo "[clients] Compilando cliente C++..."
   g++ -std=c++17 client_cpp/cliente.cpp \
     config_cpp/file_processor.pb.cc config_cpp/file_processor.grpc.pb.cc \
-    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) \
+    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) $(pkg-config --cflags --libs openssl) \
     -o client_cpp/cliente
 }
 
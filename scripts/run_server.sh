@@ -14,9 +14,9 @@ build_cpp() {
     proto/file_processor.proto
 
   echo "[server] Compilando servidor..."
-  g++ -std=c++17 server_cpp/servidor.cpp \
+  g++ -std=c++17 server_cpp/*.cpp \
     config_cpp/file_processor.pb.cc config_cpp/file_processor.grpc.pb.cc \
-    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) \
+    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) $(pkg-config --cflags --libs openssl) \
     -o server_cpp/servidor
 }
 
@@ -27,6 +27,8 @@ if [[ ! -x server_cpp/servidor ]]; then
   build_cpp
 fi
 
-ADDR="${1:-0.0.0.0:50051}"
-echo "[server] Iniciando servidor em ${ADDR}"
-exec server_cpp/servidor "${ADDR}"
+# Endereços: host:porta e/ou unix:/caminho.sock (padrão: 0.0.0.0:50051)
+ADDRS=("$@")
+(( ${#ADDRS[@]} )) || ADDRS=("0.0.0.0:50051")
+echo "[server] Iniciando servidor em ${ADDRS[*]}"
+exec server_cpp/servidor "${ADDRS[@]}"
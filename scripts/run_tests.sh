@@ -9,6 +9,9 @@ log() { echo "[tests] $*"; }
 
 ensure_env() { bash scripts/env_setup.sh; }
 
+# Spans do servidor e do cliente Python (verify_trace_propagation)
+TRACE_TEST_DIR="$(mktemp -d)"
+
 build_all() {
   log "Gerando código gRPC C++ (protoc)..."
   protoc -I=proto \
@@ -18,14 +21,14 @@ build_all() {
     proto/file_processor.proto
 
   log "Compilando servidor e cliente C++..."
-  g++ -std=c++17 server_cpp/servidor.cpp \
+  g++ -std=c++17 server_cpp/*.cpp \
     config_cpp/file_processor.pb.cc config_cpp/file_processor.grpc.pb.cc \
-    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) \
+    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) $(pkg-config --cflags --libs openssl) \
     -o server_cpp/servidor
 
   g++ -std=c++17 client_cpp/cliente.cpp \
     config_cpp/file_processor.pb.cc config_cpp/file_processor.grpc.pb.cc \
-    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) \
+    -Iconfig_cpp $(pkg-config --cflags --libs grpc++) $(pkg-config --cflags --libs protobuf) $(pkg-config --cflags --libs openssl) \
     -o client_cpp/cliente
 }
 
@@ -61,7 +64,7 @@ EOF
 
 start_server_bg() {
   log "Iniciando servidor em background..."
-  server_cpp/servidor "0.0.0.0:50051" > server_cpp/server.out 2>&1 &
+  TRACE_DIR="${TRACE_TEST_DIR}" TRACE_FLUSH_MS=200 server_cpp/servidor "0.0.0.0:50051" > server_cpp/server.out 2>&1 &
   echo $! > server_cpp/server.pid
   # Espera porta abrir rapidamente
   sleep 1
@@ -78,6 +81,7 @@ stop_server_bg() {
     fi
     rm -f server_cpp/server.pid
   fi
+  rm -rf "${TRACE_TEST_DIR}"
 }
 
 run_batch_client() {
@@ -85,6 +89,40 @@ run_batch_client() {
   PYTHONPATH="${ROOT_DIR}" python3 client_python/batch.py
 }
 
+# Menu do cliente Python com TRACE_DIR (opção 1, CompressPDF): o trace do cliente
+# deve chegar ao servidor pelo metadado traceparent
+verify_trace_propagation() {
+  log "Verificando propagação do trace (cliente Python -> servidor)..."
+  local n
+  n=$(PYTHONPATH="${ROOT_DIR}" python3 -c "from client_python.cliente import list_storage_files; print(list_storage_files().index('sample.pdf') + 1)")
+  printf '1\n%s\n0\n' "${n}" | TRACE_DIR="${TRACE_TEST_DIR}" PYTHONPATH="${ROOT_DIR}" python3 -m client_python.cliente > /dev/null
+  # O servidor grava os spans a cada TRACE_FLUSH_MS
+  sleep 1
+  python3 - "${TRACE_TEST_DIR}" << 'EOF'
+import json, os, sys
+
+def spans(path):
+    out = []
+    with open(path) as f:
+        for line in f:
+            for rs in json.loads(line)['resourceSpans']:
+                for ss in rs['scopeSpans']:
+                    out += ss['spans']
+    return out
+
+d = sys.argv[1]
+client = spans(os.path.join(d, 'client-python.otlp.jsonl'))
+server = spans(os.path.join(d, 'server.otlp.jsonl'))
+rpc = [s for s in client if s['name'] == 'CompressPDF' and s['kind'] == 3]    # Span de cliente da RPC
+if not rpc:
+    sys.exit('Nenhum span de RPC CompressPDF no cliente Python')
+children = [s for s in server if s['traceId'] == rpc[-1]['traceId']]
+if not any(s.get('parentSpanId') == rpc[-1]['spanId'] for s in children):
+    sys.exit('Spans do servidor sem o trace_id/span pai do cliente Python')
+print(f"Trace {rpc[-1]['traceId']}: {len(children)} span(s) no servidor")
+EOF
+}
+
 verify_outputs() {
   log "Verificando saídas no storage do cliente Python..."
   shopt -s nullglob
@@ -108,6 +146,7 @@ main() {
   prepare_samples
   start_server_bg
   run_batch_client
+  verify_trace_propagation
   verify_outputs
   log "Teste concluído com sucesso. Verifique também o log: server_cpp/server.log"
 }
@@ -0,0 +1,199 @@
+/*
+ * Implementação do log assíncrono.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "async_log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <ctime>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Buffer circular de uma thread: head avança só no produtor, tail só na thread de escrita.
+// Os contadores são absolutos (posição = contador % capacidade) e o conteúdo são linhas inteiras.
+struct AsyncLogger::Ring {
+    explicit Ring(size_t capacity) : buf(capacity) {}
+
+    std::vector<char> buf;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+};
+
+const std::string& CachedTimestamp() {
+    thread_local std::time_t cached = -1;
+    thread_local std::string text;
+    std::time_t now = std::time(nullptr);
+    if (now != cached) {
+        std::tm tm{};
+        localtime_r(&now, &tm);
+        char buf[32];
+        std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tm);
+        text = buf;
+        cached = now;
+    }
+    return text;
+}
+
+// Grava todos os iovecs (em lotes de IOV_MAX, retomando escritas parciais); retorna os bytes gravados
+static uint64_t WritevAll(int fd, std::vector<struct iovec>& iov) {
+    uint64_t total = 0;
+    size_t i = 0;
+    while (i < iov.size()) {
+        int count = (int)std::min<size_t>(iov.size() - i, IOV_MAX);
+        ssize_t r = writev(fd, &iov[i], count);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        total += (uint64_t)r;
+        size_t left = (size_t)r;
+        while (i < iov.size() && left >= iov[i].iov_len) left -= iov[i++].iov_len;
+        if (left > 0) {
+            iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + left;
+            iov[i].iov_len -= left;
+        }
+    }
+    return total;
+}
+
+static std::atomic<uint64_t> g_next_logger_id{1};
+
+AsyncLogger::AsyncLogger(LogConfig cfg) : cfg_(std::move(cfg)), id_(g_next_logger_id.fetch_add(1)) {
+    if (cfg_.thread_buffer < 4096) cfg_.thread_buffer = 4096;
+    OpenFile();
+    writer_ = std::thread(&AsyncLogger::WriterLoop, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) writer_.join();
+    Drain();
+    if (fd_ >= 0) close(fd_);
+}
+
+bool AsyncLogger::OpenFile() {
+    fd_ = open(cfg_.path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    struct stat st;
+    size_ = (fd_ >= 0 && fstat(fd_, &st) == 0) ? (uint64_t)st.st_size : 0;
+    return fd_ >= 0;
+}
+
+AsyncLogger::Ring* AsyncLogger::ThreadRing() {
+    // Um buffer por logger em cada thread, registrado no primeiro uso; a thread de escrita
+    // libera o buffer depois que a thread termina e o conteúdo foi gravado. A chave é o id
+    // do logger (nunca reutilizado, ao contrário do endereço)
+    thread_local std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> rings;
+    for (const auto& r : rings) {
+        if (r.first == id_) return r.second.get();
+    }
+
+    // Buffers de loggers já destruídos (só esta thread ainda os referencia)
+    rings.erase(std::remove_if(rings.begin(), rings.end(), [](const std::pair<uint64_t, std::shared_ptr<Ring>>& r) {
+        return r.second.use_count() == 1;
+    }), rings.end());
+    auto ring = std::make_shared<Ring>(cfg_.thread_buffer);
+    rings.emplace_back(id_, ring);
+    std::lock_guard<std::mutex> lk(rings_mu_);
+    rings_.push_back(ring);
+    return ring.get();
+}
+
+bool AsyncLogger::Append(const std::string& line) {
+    Ring* r = ThreadRing();
+    size_t cap = r->buf.size();
+    size_t n = line.size() + 1;
+    uint64_t head = r->head.load(std::memory_order_relaxed);
+    uint64_t tail = r->tail.load(std::memory_order_acquire);
+    if (n > cap - (size_t)(head - tail)) {
+        // Sobrecarga: descarta em vez de bloquear a requisição
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        dropped_total_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Copia com a volta do fim para o início do buffer
+    size_t pos = (size_t)(head % cap);
+    size_t first = std::min(line.size(), cap - pos);
+    std::copy(line.data(), line.data() + first, &r->buf[pos]);
+    std::copy(line.data() + first, line.data() + line.size(), &r->buf[0]);
+    r->buf[(pos + line.size()) % cap] = '\n';
+    r->head.store(head + n, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::WriterLoop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!stop_) {
+        cv_.wait_for(lk, cfg_.flush_interval, [this] { return stop_; });
+        lk.unlock();
+        Drain();
+        lk.lock();
+    }
+}
+
+void AsyncLogger::Drain() {
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lk(rings_mu_);
+        rings = rings_;
+    }
+
+    // Um iovec por trecho contíguo de cada buffer (dois se o trecho dá a volta)
+    std::vector<struct iovec> iov;
+    std::vector<uint64_t> heads(rings.size());
+    for (size_t i = 0; i < rings.size(); i++) {
+        Ring& r = *rings[i];
+        size_t cap = r.buf.size();
+        uint64_t head = r.head.load(std::memory_order_acquire);
+        uint64_t tail = r.tail.load(std::memory_order_relaxed);
+        heads[i] = head;
+        if (head == tail) continue;
+        size_t pos = (size_t)(tail % cap);
+        size_t len = (size_t)(head - tail);
+        size_t first = std::min(len, cap - pos);
+        iov.push_back({&r.buf[pos], first});
+        if (len > first) iov.push_back({&r.buf[0], len - first});
+    }
+    std::string warning;
+    uint64_t dropped = dropped_.exchange(0);
+    if (dropped > 0) {
+        warning = "[" + CachedTimestamp() + "] WARN - Logger: " + std::to_string(dropped) + " linha(s) descartada(s) (buffer cheio)\n";
+        iov.push_back({&warning[0], warning.size()});
+    }
+    if (!iov.empty() && fd_ >= 0) size_ += WritevAll(fd_, iov);
+    for (size_t i = 0; i < rings.size(); i++) rings[i]->tail.store(heads[i], std::memory_order_release);
+    if (cfg_.max_bytes > 0 && size_ >= cfg_.max_bytes) Rotate();
+
+    // Buffers de threads encerradas (só o registro ainda os referencia) e já esvaziados
+    rings.clear();
+    std::lock_guard<std::mutex> lk(rings_mu_);
+    rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<Ring>& r) {
+        return r.use_count() == 1 && r->head.load(std::memory_order_acquire) == r->tail.load(std::memory_order_relaxed);
+    }), rings_.end());
+}
+
+void AsyncLogger::Rotate() {
+    if (fd_ >= 0) close(fd_);
+
+    // server.log -> server.log.1 -> ... -> server.log.<keep> (o mais antigo é sobrescrito)
+    if (cfg_.keep > 0) {
+        for (int i = cfg_.keep - 1; i >= 1; i--) {
+            std::string from = cfg_.path + "." + std::to_string(i);
+            std::string to = cfg_.path + "." + std::to_string(i + 1);
+            std::rename(from.c_str(), to.c_str());
+        }
+        std::rename(cfg_.path.c_str(), (cfg_.path + ".1").c_str());
+    } else {
+        truncate(cfg_.path.c_str(), 0);
+    }
+    OpenFile();
+}
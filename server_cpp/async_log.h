@@ -0,0 +1,75 @@
+/*
+ * Log assíncrono do servidor (server.log).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada thread que registra tem um buffer circular próprio (um produtor, um consumidor, sem
+ * lock): Append só copia a linha para o buffer e retorna. Uma thread de escrita esvazia os
+ * buffers periodicamente com um único writev por rodada, gira o arquivo por tamanho e, se um
+ * buffer está cheio (sobrecarga), a linha é descartada e contada; o total descartado é
+ * registrado no próprio log. O timestamp formatado fica em cache por thread e só é refeito
+ * quando o segundo muda.
+ */
+
+#ifndef SERVER_CPP_ASYNC_LOG_H
+#define SERVER_CPP_ASYNC_LOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Configuração do log
+struct LogConfig {
+    std::string path;
+    uint64_t max_bytes = 64ULL * 1024 * 1024;       // Tamanho que dispara a rotação (0 = sem rotação)
+    int keep = 3;                                   // Arquivos girados mantidos (server.log.1 ... .N)
+    size_t thread_buffer = 256 * 1024;              // Buffer de cada thread
+    std::chrono::milliseconds flush_interval{50};   // Intervalo entre escritas
+};
+
+// "AAAA-MM-DD HH:MM:SS" do horário local atual (cache por thread, refeito a cada segundo)
+const std::string& CachedTimestamp();
+
+class AsyncLogger {
+public:
+    explicit AsyncLogger(LogConfig cfg);
+    ~AsyncLogger();     // Escreve o que ainda está nos buffers
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // Enfileira uma linha (sem '\n'); false se foi descartada por falta de espaço
+    bool Append(const std::string& line);
+
+    // Linhas descartadas desde o início
+    uint64_t dropped() const { return dropped_total_; }
+
+private:
+    struct Ring;
+
+    Ring* ThreadRing();
+    void WriterLoop();
+    void Drain();
+    void Rotate();
+    bool OpenFile();
+
+    LogConfig cfg_;
+    const uint64_t id_;                             // Identifica os buffers deste logger nas threads
+    int fd_ = -1;
+    uint64_t size_ = 0;
+    std::mutex rings_mu_;                           // Só no registro de uma thread nova e na escrita
+    std::vector<std::shared_ptr<Ring>> rings_;
+    std::atomic<uint64_t> dropped_{0};              // Descartadas ainda não registradas
+    std::atomic<uint64_t> dropped_total_{0};
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread writer_;
+};
+
+#endif  // SERVER_CPP_ASYNC_LOG_H
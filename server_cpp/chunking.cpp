@@ -0,0 +1,60 @@
+/*
+ * Implementação da negociação e adaptação do tamanho de chunk.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "chunking.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+size_t ClampChunk(size_t n) {
+    if (n < CHUNK_MIN) return CHUNK_MIN;
+    if (n > CHUNK_MAX) return CHUNK_MAX;
+    return n;
+}
+
+// Lê metadado numérico do cliente (def se ausente/inválido)
+static long long MetadataNumber(const grpc::ServerContext& context, const char* key, long long def) {
+    auto it = context.client_metadata().find(key);
+    if (it == context.client_metadata().end()) return def;
+    std::string v(it->second.data(), it->second.size());
+    char* end = nullptr;
+    long long n = std::strtoll(v.c_str(), &end, 10);
+    return (end && *end == '\0' && !v.empty()) ? n : def;
+}
+
+ChunkPolicy NegotiateChunkPolicy(const grpc::ServerContext& context, size_t server_default) {
+    ChunkPolicy p;
+    long long pref = MetadataNumber(context, CHUNK_SIZE_KEY, 0);
+    p.initial = ClampChunk(pref > 0 ? (size_t)pref : server_default);
+    p.adaptive = MetadataNumber(context, CHUNK_ADAPT_KEY, 1) != 0;
+    return p;
+}
+
+ChunkSizer::ChunkSizer(const ChunkPolicy& policy) : size_(ClampChunk(policy.initial)), adaptive_(policy.adaptive) {}
+
+void ChunkSizer::Observe(size_t bytes, std::chrono::steady_clock::duration elapsed) {
+    double secs = std::chrono::duration<double>(elapsed).count();
+    // Chunks parciais (fim do arquivo) medem mais a latência por mensagem que a vazão
+    if (secs <= 0 || bytes < size_) return;
+
+    // Média móvel exponencial da vazão
+    double sample = bytes / secs;
+    bps_ = bps_ == 0 ? sample : 0.7 * bps_ + 0.3 * sample;
+    if (!adaptive_) return;
+
+    // Próximo chunk leva ~CHUNK_TARGET_MS na vazão atual; arredonda para múltiplo de 16 KB
+    // e limita a variação a 2x por passo para não oscilar
+    size_t target = (size_t)(bps_ * CHUNK_TARGET_MS / 1000.0);
+    if (target > size_ * 2) target = size_ * 2;
+    if (target < size_ / 2) target = size_ / 2;
+    size_ = ClampChunk(target / CHUNK_MIN * CHUNK_MIN);
+}
+
+std::string ChunkSizer::Describe() const {
+    char buf[64];
+    if (bps_ == 0) std::snprintf(buf, sizeof(buf), "chunk %zu KB", size_ / 1024);
+    else std::snprintf(buf, sizeof(buf), "chunk %zu KB, %.1f MB/s", size_ / 1024, bps_ / (1024.0 * 1024.0));
+    return buf;
+}
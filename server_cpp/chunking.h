@@ -0,0 +1,64 @@
+/*
+ * Tamanho de chunk negociado no início da chamada e adaptado pela vazão observada.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Negociação: o cliente envia sua preferência no metadado "chunk-size" (0/ausente = padrão do
+ * servidor) e "chunk-adapt: 0" para fixar o tamanho; o servidor responde nos metadados iniciais
+ * com o tamanho escolhido, usado pelo cliente nos envios.
+ *
+ * Adaptação: o tempo de cada Write (que bloqueia pelo controle de fluxo do HTTP/2) dá a vazão;
+ * o próximo chunk é dimensionado para levar ~CHUNK_TARGET_MS, entre CHUNK_MIN e CHUNK_MAX.
+ */
+
+#ifndef SERVER_CPP_CHUNKING_H
+#define SERVER_CPP_CHUNKING_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include <grpcpp/grpcpp.h>
+
+#define CHUNK_SIZE_KEY "chunk-size"
+#define CHUNK_ADAPT_KEY "chunk-adapt"
+
+// Limites (o máximo fica abaixo do limite padrão de 4 MB por mensagem do gRPC)
+const size_t CHUNK_MIN = 16 * 1024;
+const size_t CHUNK_MAX = 2 * 1024 * 1024;
+const int CHUNK_TARGET_MS = 20;
+
+// Tamanho negociado para uma chamada
+struct ChunkPolicy {
+    size_t initial = 256 * 1024;
+    bool adaptive = true;
+};
+
+// Combina a preferência do cliente (metadados) com o padrão do servidor
+ChunkPolicy NegotiateChunkPolicy(const grpc::ServerContext& context, size_t server_default);
+
+class ChunkSizer {
+public:
+    explicit ChunkSizer(const ChunkPolicy& policy);
+
+    // Tamanho a usar no próximo chunk
+    size_t Size() const { return size_; }
+
+    // Registra o envio de bytes que levou elapsed
+    void Observe(size_t bytes, std::chrono::steady_clock::duration elapsed);
+
+    // Vazão estimada (bytes/s, 0 enquanto não houver amostras)
+    double Throughput() const { return bps_; }
+
+    // Resumo para o log (ex.: "chunk 512 KB, 83.2 MB/s"; sem vazão se não houve chunk completo)
+    std::string Describe() const;
+
+private:
+    size_t size_;
+    bool adaptive_;
+    double bps_ = 0;
+};
+
+// Limita ao intervalo [CHUNK_MIN, CHUNK_MAX]
+size_t ClampChunk(size_t n);
+
+#endif  // SERVER_CPP_CHUNKING_H
@@ -0,0 +1,55 @@
+/*
+ * Implementação da escolha de compressão pelo conteúdo.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "compression.h"
+
+#include <cmath>
+#include <cstring>
+
+bool ParseCompression(const std::string& name, grpc_compression_algorithm& alg) {
+    if (name == "gzip") alg = GRPC_COMPRESS_GZIP;
+    else if (name == "deflate") alg = GRPC_COMPRESS_DEFLATE;
+    else if (name == "none" || name == "identity") alg = GRPC_COMPRESS_NONE;
+    else return false;
+    return true;
+}
+
+// Procura um marcador dentro da amostra (memmem não é padrão)
+static bool Contains(const char* data, size_t n, const char* marker) {
+    size_t m = std::strlen(marker);
+    for (size_t i = 0; i + m <= n; ++i)
+        if (std::memcmp(data + i, marker, m) == 0) return true;
+    return false;
+}
+
+bool LooksCompressible(const char* data, size_t n) {
+    const size_t SAMPLE = 64 * 1024;
+    if (n > SAMPLE) n = SAMPLE;
+    if (n < 64) return false; // Pequeno demais para compensar
+    auto starts = [&](const char* magic, size_t len) { return n >= len && std::memcmp(data, magic, len) == 0; };
+
+    // Formatos já comprimidos, pela assinatura
+    if (starts("\xFF\xD8\xFF", 3) || starts("\x89PNG", 4) || starts("GIF8", 4) ||
+        starts("\x1F\x8B", 2) || starts("PK\x03\x04", 4) || starts("\x28\xB5\x2F\xFD", 4) ||
+        starts("BZh", 3) || starts("\xFD" "7zXZ", 5) || starts("7z\xBC\xAF", 4))
+        return false;
+    if (starts("RIFF", 4) && n >= 12 && std::memcmp(data + 8, "WEBP", 4) == 0) return false;
+
+    // PDF com streams comprimidos (ex.: saída do CompressPDF) não ganha com nova compressão
+    if (starts("%PDF", 4))
+        return !(Contains(data, n, "/FlateDecode") || Contains(data, n, "/DCTDecode") ||
+                 Contains(data, n, "/JPXDecode") || Contains(data, n, "/ObjStm"));
+
+    // Demais formatos: entropia alta (> 7.5 bits/byte) indica conteúdo já comprimido/aleatório
+    size_t hist[256] = {0};
+    for (size_t i = 0; i < n; ++i) hist[(unsigned char)data[i]]++;
+    double entropy = 0;
+    for (size_t c : hist) {
+        if (!c) continue;
+        double p = (double)c / n;
+        entropy -= p * std::log2(p);
+    }
+    return entropy < 7.5;
+}
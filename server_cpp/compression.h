@@ -0,0 +1,35 @@
+/*
+ * Compressão de transporte (gRPC) escolhida pelo tipo de conteúdo.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * O algoritmo é definido por chamada (padrão do servidor ou preferência enviada pelo cliente
+ * no metadado "response-compression"); cada mensagem de conteúdo já comprimido (JPEG, PNG,
+ * WebP, PDF com streams comprimidos, zip/gzip...) é enviada sem compressão.
+ */
+
+#ifndef SERVER_CPP_COMPRESSION_H
+#define SERVER_CPP_COMPRESSION_H
+
+#include <cstddef>
+#include <string>
+
+#include <grpc/compression.h>
+#include <grpcpp/grpcpp.h>
+
+// Metadado com o algoritmo preferido pelo cliente para as respostas
+#define RESPONSE_COMPRESSION_KEY "response-compression"
+
+// Converte "gzip", "deflate" ou "none" no algoritmo do gRPC; false se desconhecido
+bool ParseCompression(const std::string& name, grpc_compression_algorithm& alg);
+
+// Verifica pelo início do conteúdo se vale a pena comprimir
+bool LooksCompressible(const char* data, size_t n);
+
+// Opções de escrita de uma mensagem (desliga a compressão para conteúdo já comprimido)
+inline grpc::WriteOptions ChunkWriteOptions(bool compress) {
+    grpc::WriteOptions opts;
+    if (!compress) opts.set_no_compression();
+    return opts;
+}
+
+#endif  // SERVER_CPP_COMPRESSION_H
@@ -0,0 +1,119 @@
+/*
+ * Implementação do CRC32C com seleção da versão em hardware em tempo de execução.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "crc32c.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+// Polinômio de Castagnoli (refletido)
+static const uint32_t POLY = 0x82F63B78;
+
+// Tabelas para processar 8 bytes por iteração em software
+static const std::array<std::array<uint32_t, 256>, 8>& Tables() {
+    static const auto tables = [] {
+        std::array<std::array<uint32_t, 256>, 8> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? (c >> 1) ^ POLY : c >> 1;
+            t[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+            for (int s = 1; s < 8; ++s) t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+        return t;
+    }();
+    return tables;
+}
+
+static uint32_t Software(uint32_t crc, const uint8_t* p, size_t n) {
+    const auto& t = Tables();
+    crc = ~crc;
+    while (n >= 8) {
+        uint32_t lo, hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + 4, 4);
+        lo ^= crc;
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        p += 8;
+        n -= 8;
+    }
+    while (n--) crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    return ~crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t Hardware(uint32_t crc, const uint8_t* p, size_t n) {
+    uint64_t c = ~crc;
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+    }
+    uint32_t c32 = (uint32_t)c;
+    while (n--) c32 = _mm_crc32_u8(c32, *p++);
+    return ~c32;
+}
+
+static bool HardwareAvailable() { return __builtin_cpu_supports("sse4.2"); }
+static const char* HARDWARE_NAME = "sse4.2";
+#elif defined(__aarch64__)
+__attribute__((target("+crc")))
+static uint32_t Hardware(uint32_t crc, const uint8_t* p, size_t n) {
+    crc = ~crc;
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        crc = __crc32cd(crc, v);
+    }
+    while (n--) crc = __crc32cb(crc, *p++);
+    return ~crc;
+}
+
+static bool HardwareAvailable() { return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0; }
+static const char* HARDWARE_NAME = "armv8-crc";
+#else
+static uint32_t Hardware(uint32_t crc, const uint8_t* p, size_t n) { return Software(crc, p, n); }
+static bool HardwareAvailable() { return false; }
+static const char* HARDWARE_NAME = "software";
+#endif
+
+// Escolhida uma vez, na primeira chamada
+static bool UseHardware() {
+    static const bool hw = HardwareAvailable();
+    return hw;
+}
+
+uint32_t Crc32c(const void* data, size_t n, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    return UseHardware() ? Hardware(crc, p, n) : Software(crc, p, n);
+}
+
+bool Crc32cFile(const std::filesystem::path& path, uint32_t& crc) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::vector<char> buf(1024 * 1024);
+    crc = 0;
+    while (in) {
+        in.read(buf.data(), (std::streamsize)buf.size());
+        if (in.gcount() > 0) crc = Crc32c(buf.data(), (size_t)in.gcount(), crc);
+    }
+    return in.eof();
+}
+
+const char* Crc32cImplementation() {
+    return UseHardware() ? HARDWARE_NAME : "software";
+}
@@ -0,0 +1,25 @@
+/*
+ * CRC32C (Castagnoli) para verificar a integridade dos chunks e das saídas.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Usa as instruções de hardware quando o processador as tem (crc32 do SSE4.2 no x86,
+ * extensão CRC do ARMv8), detectadas em tempo de execução; senão, tabela em software.
+ */
+
+#ifndef SERVER_CPP_CRC32C_H
+#define SERVER_CPP_CRC32C_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// Continua o CRC crc (0 no início) com n bytes de data
+uint32_t Crc32c(const void* data, size_t n, uint32_t crc = 0);
+
+// CRC do arquivo inteiro; false se não conseguiu ler
+bool Crc32cFile(const std::filesystem::path& path, uint32_t& crc);
+
+// Implementação em uso ("sse4.2", "armv8-crc" ou "software")
+const char* Crc32cImplementation();
+
+#endif  // SERVER_CPP_CRC32C_H
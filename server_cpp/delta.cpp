@@ -0,0 +1,154 @@
+/*
+ * Implementação dos uploads por delta.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * SHA-256 e MD5 vêm do OpenSSL (libcrypto, já ligada junto com o gRPC).
+ */
+
+#include "delta.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <openssl/evp.h>
+
+namespace fs = std::filesystem;
+
+uint32_t RollingChecksum(const void* data, size_t n) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint32_t a = 0, b = 0;
+    for (size_t i = 0; i < n; i++) {
+        a += p[i];
+        b += (uint32_t)(n - i) * p[i];
+    }
+    return ((b & 0xffff) << 16) | (a & 0xffff);
+}
+
+size_t ChooseBlockSize(uint64_t size, size_t requested) {
+    size_t block = requested;
+    if (block == 0) block = (size_t)std::sqrt((double)size) / 1024 * 1024;
+    if (block < DELTA_BLOCK_MIN) block = DELTA_BLOCK_MIN;
+    if (block > DELTA_BLOCK_MAX) block = DELTA_BLOCK_MAX;
+    return block;
+}
+
+bool Sha256File(const fs::path& path, std::string& hex) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    bool ok = ctx && EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) == 1;
+    std::vector<char> buf(1024 * 1024);
+    while (ok && in) {
+        in.read(buf.data(), (std::streamsize)buf.size());
+        if (in.gcount() > 0) ok = EVP_DigestUpdate(ctx, buf.data(), (size_t)in.gcount()) == 1;
+    }
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    ok = ok && in.eof() && EVP_DigestFinal_ex(ctx, md, &len) == 1;
+    EVP_MD_CTX_free(ctx);
+    if (!ok) return false;
+
+    static const char digits[] = "0123456789abcdef";
+    hex.clear();
+    for (unsigned int i = 0; i < len; i++) {
+        hex += digits[md[i] >> 4];
+        hex += digits[md[i] & 0xf];
+    }
+    return true;
+}
+
+// Hash vindo do cliente: 64 dígitos hex minúsculos (impede caminhos arbitrários)
+static bool IsSha256Hex(const std::string& s) {
+    if (s.size() != 64) return false;
+    for (char c : s) {
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) return false;
+    }
+    return true;
+}
+
+fs::path BasisStore::DataPath(const std::string& sha256) {
+    return storage_.ShardFor(sha256) / (sha256 + ".basis");
+}
+
+bool BasisStore::Register(const fs::path& data, const std::string& sha256) {
+    // Hard link: os dados do upload não são copiados e a base sobrevive à expiração do upload
+    fs::path dst = DataPath(sha256);
+    std::error_code ec;
+    if (!fs::exists(dst, ec)) {
+        fs::create_hard_link(data, dst, ec);
+        if (ec && !fs::exists(dst)) {
+            fs::copy_file(data, dst, ec);
+            if (ec) return false;
+        }
+        return true;
+    }
+    // Mesmo conteúdo já registrado: apenas renova o TTL
+    fs::last_write_time(dst, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+bool BasisStore::Lookup(const std::string& sha256, fs::path& path, uint64_t& size) {
+    if (!IsSha256Hex(sha256)) return false;
+    path = DataPath(sha256);
+    std::error_code ec;
+    size = fs::file_size(path, ec);
+    if (ec) return false;
+
+    // Base em uso continua disponível para as próximas versões do arquivo
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+bool BasisStore::Signatures(const fs::path& path, size_t block_size,
+                            const std::function<bool(const BlockSignature&)>& emit) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    std::vector<char> block(block_size);
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int len = 0;
+    BlockSignature sig;
+    // O último bloco, se incompleto, fica de fora: seus bytes seguem como literais
+    while (in.read(block.data(), (std::streamsize)block_size)) {
+        sig.weak = RollingChecksum(block.data(), block_size);
+        if (EVP_Digest(block.data(), block_size, md, &len, EVP_md5(), nullptr) != 1) return false;
+        sig.strong.assign(reinterpret_cast<const char*>(md), len);
+        if (!emit(sig)) return false;
+    }
+    return in.eof();
+}
+
+DeltaApplier::DeltaApplier(const fs::path& basis, uint64_t basis_size, size_t block_size, UploadWriter& out)
+    : in_(basis, std::ios::binary), basis_size_(basis_size), block_size_(block_size), out_(out) {}
+
+bool DeltaApplier::Literal(const std::string& data, std::string& err) {
+    if (!out_.Write(out_.info().committed, data, err)) return false;
+    literal_bytes_ += data.size();
+    return true;
+}
+
+bool DeltaApplier::Copy(uint64_t first_block, uint64_t count, std::string& err) {
+    // Apenas blocos completos da base podem ser referenciados
+    uint64_t full_blocks = basis_size_ / block_size_;
+    if (!in_ || count == 0 || first_block >= full_blocks || count > full_blocks - first_block) {
+        err = "Referência inválida aos blocos " + std::to_string(first_block) + "+" + std::to_string(count) + " da base";
+        return false;
+    }
+
+    // Copia em pedaços de até 1 MB (a sequência pode cobrir boa parte da base)
+    uint64_t offset = first_block * block_size_;
+    uint64_t remaining = count * block_size_;
+    in_.clear();
+    in_.seekg((std::streamoff)offset);
+    while (remaining > 0) {
+        size_t n = (size_t)std::min<uint64_t>(remaining, 1024 * 1024);
+        buf_.resize(n);
+        if (!in_.read(&buf_[0], (std::streamsize)n)) { err = "Falha ao ler a base"; return false; }
+        if (!out_.Write(out_.info().committed, buf_, err)) return false;
+        remaining -= n;
+    }
+    copied_bytes_ += count * block_size_;
+    return true;
+}
@@ -0,0 +1,94 @@
+/*
+ * Uploads por delta (estilo rsync): só os trechos alterados de um arquivo já enviado trafegam.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Fluxo:
+ *  - Todo upload concluído vira uma base identificada pelo SHA-256 do conteúdo
+ *    (<sha256>.basis, hard link para os dados do upload; expira pelo TTL como os demais).
+ *  - GetSignatures devolve, para cada bloco completo da base, o checksum rolante (fraco) e o MD5 (forte).
+ *  - O cliente procura esses blocos no arquivo novo e envia em UploadDelta apenas bytes literais
+ *    e referências a blocos da base; DeltaApplier reconstrói o arquivo em uma sessão de upload comum,
+ *    conferida pelo SHA-256 declarado antes de ser aceita.
+ */
+
+#ifndef SERVER_CPP_DELTA_H
+#define SERVER_CPP_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "storage_lifecycle.h"
+#include "uploads.h"
+
+// Limites do tamanho de bloco (o padrão é ~raiz quadrada do tamanho da base, como no rsync)
+constexpr size_t DELTA_BLOCK_MIN = 2 * 1024;
+constexpr size_t DELTA_BLOCK_MAX = 128 * 1024;
+
+// Assinaturas por mensagem de GetSignatures (~25 bytes cada)
+constexpr size_t DELTA_SIGNATURES_PER_MESSAGE = 4096;
+
+// Assinatura de um bloco da base
+struct BlockSignature {
+    uint32_t weak = 0;          // Checksum rolante
+    std::string strong;         // MD5 (16 bytes)
+};
+
+// Checksum rolante do rsync: a = soma dos bytes, b = soma ponderada; (b << 16) | a, ambos mod 2^16
+uint32_t RollingChecksum(const void* data, size_t n);
+
+// Tamanho de bloco para uma base de size bytes (requested > 0 é respeitado dentro dos limites)
+size_t ChooseBlockSize(uint64_t size, size_t requested = 0);
+
+// SHA-256 do arquivo em hex minúsculo; false se não conseguiu ler
+bool Sha256File(const std::filesystem::path& path, std::string& hex);
+
+// Bases disponíveis para uploads por delta
+class BasisStore {
+public:
+    explicit BasisStore(StorageLifecycle& storage) : storage_(storage) {}
+
+    // Registra os dados de um upload concluído (já conferidos por Sha256File) como base
+    bool Register(const std::filesystem::path& data, const std::string& sha256);
+
+    // Localiza a base (false se o hash é inválido, não existe ou expirou); renova o TTL
+    bool Lookup(const std::string& sha256, std::filesystem::path& path, uint64_t& size);
+
+    // Assinaturas dos blocos completos, em ordem; emit retorna false para interromper
+    static bool Signatures(const std::filesystem::path& path, size_t block_size,
+                           const std::function<bool(const BlockSignature&)>& emit);
+
+private:
+    std::filesystem::path DataPath(const std::string& sha256);
+
+    StorageLifecycle& storage_;
+};
+
+// Reconstrói um arquivo a partir da base e das instruções do delta, gravando no upload
+class DeltaApplier {
+public:
+    DeltaApplier(const std::filesystem::path& basis, uint64_t basis_size, size_t block_size, UploadWriter& out);
+
+    // Bytes novos
+    bool Literal(const std::string& data, std::string& err);
+
+    // count blocos da base a partir de first_block
+    bool Copy(uint64_t first_block, uint64_t count, std::string& err);
+
+    uint64_t literal_bytes() const { return literal_bytes_; }
+    uint64_t copied_bytes() const { return copied_bytes_; }
+
+private:
+    std::ifstream in_;
+    uint64_t basis_size_;
+    size_t block_size_;
+    UploadWriter& out_;
+    std::string buf_;
+    uint64_t literal_bytes_ = 0;
+    uint64_t copied_bytes_ = 0;
+};
+
+#endif  // SERVER_CPP_DELTA_H
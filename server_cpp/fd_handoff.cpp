@@ -0,0 +1,200 @@
+/*
+ * Implementação da entrega local por descritores.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "fd_handoff.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+using file_processor::FileRequest;
+using file_processor::FileResponse;
+
+// Maior quadro aceito (a requisição leva só parâmetros)
+static const size_t MAX_FRAME = 64 * 1024;
+
+// Envia um quadro com um descritor anexado (fd < 0: sem descritor)
+static bool SendFrame(int sock, const std::string& payload, int fd) {
+    struct iovec iov;
+    iov.iov_base = const_cast<char*>(payload.data());
+    iov.iov_len = payload.size();
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    char cbuf[CMSG_SPACE(sizeof(int))];
+    if (fd >= 0) {
+        std::memset(cbuf, 0, sizeof(cbuf));
+        msg.msg_control = cbuf;
+        msg.msg_controllen = sizeof(cbuf);
+        struct cmsghdr* c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type = SCM_RIGHTS;
+        c->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(c), &fd, sizeof(int));
+    }
+    return sendmsg(sock, &msg, MSG_NOSIGNAL) == (ssize_t)payload.size();
+}
+
+// Recebe um quadro; fd recebe o descritor anexado (-1 se não houver). Descritores extras são fechados.
+static bool RecvFrame(int sock, std::string& payload, int& fd) {
+    payload.resize(MAX_FRAME);
+    struct iovec iov;
+    iov.iov_base = &payload[0];
+    iov.iov_len = payload.size();
+    char cbuf[CMSG_SPACE(4 * sizeof(int))];
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+
+    // CLOEXEC: o descritor não vaza para as ferramentas executadas pelas operações
+    ssize_t n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+    fd = -1;
+    if (n >= 0) {
+        for (struct cmsghdr* c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+            if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) continue;
+            size_t count = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            for (size_t i = 0; i < count; i++) {
+                int received;
+                std::memcpy(&received, CMSG_DATA(c) + i * sizeof(int), sizeof(int));
+                if (fd < 0) fd = received;
+                else close(received);
+            }
+        }
+    }
+    if (n <= 0 || (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC))) {
+        if (fd >= 0) close(fd);
+        fd = -1;
+        return false;
+    }
+    payload.resize((size_t)n);
+    return true;
+}
+
+// Quadro final sem descritor, com a falha
+static void SendFailureFrame(int sock, const std::string& msg) {
+    FileResponse resp;
+    resp.set_success(false);
+    resp.set_status_message(msg);
+    SendFrame(sock, resp.SerializeAsString(), -1);
+}
+
+FdHandoffServer::~FdHandoffServer() {
+    stop_ = true;
+    // shutdown desbloqueia o accept pendente
+    if (listen_fd_ >= 0) shutdown(listen_fd_, SHUT_RDWR);
+    if (acceptor_.joinable()) acceptor_.join();
+    if (listen_fd_ >= 0) close(listen_fd_);
+}
+
+bool FdHandoffServer::Start(const std::string& path, size_t max_connections, std::string& err) {
+    max_connections_ = max_connections > 0 ? max_connections : 1;
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) { err = "Caminho do socket inválido: " + path; return false; }
+    std::memcpy(addr.sun_path, path.c_str(), path.size());
+
+    // Socket deixado por uma execução anterior
+    std::error_code ec;
+    if (fs::is_socket(path, ec)) fs::remove(path, ec);
+
+    listen_fd_ = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0 || bind(listen_fd_, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(listen_fd_, 64) != 0) {
+        err = std::string("Falha ao criar o socket local: ") + std::strerror(errno);
+        return false;
+    }
+    acceptor_ = std::thread(&FdHandoffServer::AcceptLoop, this);
+    return true;
+}
+
+void FdHandoffServer::AcceptLoop() {
+    while (!stop_) {
+        int conn = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (conn < 0) {
+            if (stop_ || (errno != EINTR && errno != ECONNABORTED && errno != EMFILE && errno != ENFILE)) break;
+            if (errno == EMFILE || errno == ENFILE) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        // Cada conexão é uma requisição, atendida pelo pool. Clientes locais ociosos ou em
+        // excesso não podem ocupar o pool inteiro (a ProcessBatch depende dele)
+        if (connections_.load() >= max_connections_) {
+            SendFailureFrame(conn, "Servidor ocupado: " + std::to_string(max_connections_) + " entregas locais em andamento");
+            close(conn);
+            continue;
+        }
+        connections_++;
+        pool_.Submit([this, conn] {
+            Serve(conn);
+            connections_--;
+        });
+    }
+}
+
+void FdHandoffServer::Serve(int conn) {
+    // Cliente que conecta e não envia nada não prende a thread do pool
+    struct timeval tv = {5, 0};
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    std::string payload, err;
+    int in_fd = -1;
+    struct stat st;
+    FileRequest req;
+    FileResponse resp;
+    if (!RecvFrame(conn, payload, in_fd) || !req.ParseFromString(payload)) err = "Requisição local inválida";
+    else if (in_fd < 0) err = "Descritor da entrada ausente";
+    else if (fstat(in_fd, &st) != 0 || !S_ISREG(st.st_mode)) err = "A entrada deve ser um arquivo regular ou memfd";
+    else if (OperationName(req).empty()) err = "Parâmetros ausentes";
+    else {
+        // A entrada é lida pelo caminho do descritor neste processo (as ferramentas externas,
+        // processos filhos, também o enxergam)
+        std::string fname = fs::path(req.file_name().empty() ? "entrada" : req.file_name()).filename().string();
+        fs::path in = fs::path("/proc") / std::to_string(getpid()) / "fd" / std::to_string(in_fd);
+        ScratchScope scratch(scratch_);
+        OperationResult res = runner_(req, fname, in, scratch);
+
+        // Cada saída segue como descritor; o arquivo do scratch é removido depois, mas o
+        // conteúdo continua acessível ao cliente pelo descritor recebido. A saída de uma
+        // operação com falha não é enviada (só o quadro final, com o motivo)
+        if (res.ok) for (const auto& o : res.outputs) {
+            int out_fd = open(o.path.c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat ost;
+            if (out_fd < 0 || fstat(out_fd, &ost) != 0) {
+                if (out_fd >= 0) close(out_fd);
+                res.ok = false;
+                continue;
+            }
+            FileResponse r;
+            r.set_success(res.ok);
+            r.set_status_message(res.msg);
+            r.set_file_name(o.name);
+            r.set_output_size((uint64_t)ost.st_size);
+            bool sent = SendFrame(conn, r.SerializeAsString(), out_fd);
+            close(out_fd);
+            if (!sent) { res.ok = false; break; }
+        }
+        resp.set_success(res.ok && !res.outputs.empty());
+        resp.set_status_message(res.msg.empty() ? "Sem saídas" : res.msg);
+    }
+    if (!err.empty()) {
+        resp.set_success(false);
+        resp.set_status_message(err);
+    }
+    SendFrame(conn, resp.SerializeAsString(), -1);
+
+    if (in_fd >= 0) close(in_fd);
+    close(conn);
+}
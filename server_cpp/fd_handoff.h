@@ -0,0 +1,64 @@
+/*
+ * Entrega local por descritores: clientes no mesmo host passam o arquivo aberto em vez dos bytes.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Protocolo em um socket Unix SOCK_SEQPACKET (cada mensagem é um quadro, sem prefixo de tamanho):
+ *  - Cliente -> servidor: FileRequest serializado (parâmetros e file_name; sem conteúdo) com o
+ *    descritor da entrada em SCM_RIGHTS (arquivo regular ou memfd, aberto para leitura).
+ *  - Servidor -> cliente: um FileResponse por saída (file_name, output_size) com o descritor da
+ *    saída em SCM_RIGHTS; por fim um FileResponse sem descritor com o status final.
+ * As conexões dividem o WorkerPool com a ProcessBatch: acima de max_connections atendidas ou
+ * aguardando thread, a conexão nova recebe só o quadro final com a recusa (servidor ocupado).
+ * A operação lê a entrada direto do descritor (/proc/<pid>/fd/N, também visível às ferramentas
+ * externas) e as saídas não são retidas: o cliente fica com o descritor, e os arquivos do scratch
+ * somem do storage ao fim da requisição. Nenhum byte do arquivo passa pelo socket.
+ */
+
+#ifndef SERVER_CPP_FD_HANDOFF_H
+#define SERVER_CPP_FD_HANDOFF_H
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "../config_cpp/file_processor.pb.h"
+
+#include "operations.h"
+#include "scratch.h"
+#include "worker_pool.h"
+
+class FdHandoffServer {
+public:
+    // Executa a operação da requisição (a mesma usada pelas RPCs) sobre a entrada
+    using Runner = std::function<OperationResult(const file_processor::FileRequest& request, const std::string& fname,
+                                                 const std::filesystem::path& in, ScratchScope& scratch)>;
+
+    FdHandoffServer(ScratchStorage& scratch, WorkerPool& pool, Runner runner)
+        : scratch_(scratch), pool_(pool), runner_(std::move(runner)) {}
+    ~FdHandoffServer();
+
+    FdHandoffServer(const FdHandoffServer&) = delete;
+    FdHandoffServer& operator=(const FdHandoffServer&) = delete;
+
+    // Cria o socket em path (removendo um socket antigo) e inicia a thread de accept
+    bool Start(const std::string& path, size_t max_connections, std::string& err);
+
+private:
+    void AcceptLoop();
+
+    // Atende uma conexão no pool: lê a requisição, executa e devolve os descritores das saídas
+    void Serve(int conn);
+
+    ScratchStorage& scratch_;
+    WorkerPool& pool_;
+    Runner runner_;
+    int listen_fd_ = -1;
+    size_t max_connections_ = 1;
+    std::atomic<size_t> connections_{0};        // No pool (em atendimento ou na fila)
+    std::atomic<bool> stop_{false};
+    std::thread acceptor_;
+};
+
+#endif  // SERVER_CPP_FD_HANDOFF_H
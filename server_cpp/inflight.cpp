@@ -0,0 +1,156 @@
+/*
+ * Implementação do registro de requisições em andamento.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "inflight.h"
+
+static std::atomic<uint64_t> g_ingest_bytes{0};
+static thread_local InFlightRequest* t_current = nullptr;
+
+static int64_t SteadyNanos(InFlightRequest::Clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+InFlightRequest::InFlightRequest(uint64_t id, const std::string& rpc, const std::string& peer)
+    : id_(id), rpc_(rpc), peer_(peer), start_(Clock::now()), phase_start_ns_(SteadyNanos(start_)) {}
+
+void InFlightRequest::SetPhase(int phase) {
+    phase_start_ns_.store(SteadyNanos(Clock::now()), std::memory_order_relaxed);
+    phase_.store(phase, std::memory_order_relaxed);
+}
+
+void InFlightRequest::SetDetails(const std::string& operation, const std::string& file_name) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (!operation.empty()) operation_ = operation;
+    if (!file_name.empty()) file_name_ = file_name;
+}
+
+void InFlightRequest::SetTraceId(const std::string& trace_id) {
+    std::lock_guard<std::mutex> lk(mu_);
+    trace_id_ = trace_id;
+}
+
+void InFlightRequest::SetChild(int pid, const std::string& tool) {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        child_tool_ = tool;
+    }
+    child_pid_.store(pid, std::memory_order_relaxed);
+}
+
+void InFlightRequest::ClearChild() {
+    child_pid_.store(0, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lk(mu_);
+    child_tool_.clear();
+}
+
+InFlightRequest::Snapshot InFlightRequest::Read() const {
+    Snapshot s;
+    Clock::time_point now = Clock::now();
+    s.id = id_;
+    s.rpc = rpc_;
+    s.peer = peer_;
+    s.phase = phase_.load(std::memory_order_relaxed);
+    s.elapsed = now - start_;
+    s.phase_elapsed = std::chrono::nanoseconds(SteadyNanos(now) - phase_start_ns_.load(std::memory_order_relaxed));
+    s.bytes_received = bytes_received_.load(std::memory_order_relaxed);
+    s.bytes_sent = bytes_sent_.load(std::memory_order_relaxed);
+    s.child_pid = child_pid_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lk(mu_);
+    s.operation = operation_;
+    s.file_name = file_name_;
+    s.trace_id = trace_id_;
+    s.child_tool = s.child_pid ? child_tool_ : "";
+    return s;
+}
+
+InFlight::InFlight(InFlightRegistry& registry, const std::string& rpc, const std::string& peer)
+    : registry_(&registry), req_(registry.Add(rpc, peer)) {}
+
+InFlight::~InFlight() {
+    Release();
+}
+
+InFlight::InFlight(InFlight&& other) noexcept : registry_(other.registry_), req_(std::move(other.req_)) {
+    other.registry_ = nullptr;
+}
+
+InFlight& InFlight::operator=(InFlight&& other) noexcept {
+    if (this != &other) {
+        Release();
+        registry_ = other.registry_;
+        req_ = std::move(other.req_);
+        other.registry_ = nullptr;
+    }
+    return *this;
+}
+
+void InFlight::Release() {
+    if (registry_ && req_) registry_->Remove(req_->id());
+    registry_ = nullptr;
+    req_.reset();
+}
+
+std::shared_ptr<InFlightRequest> InFlightRegistry::Add(const std::string& rpc, const std::string& peer) {
+    std::lock_guard<std::mutex> lk(mu_);
+    uint64_t id = next_id_++;
+    auto req = std::make_shared<InFlightRequest>(id, rpc, peer);
+    entries_.emplace(id, req);
+    return req;
+}
+
+void InFlightRegistry::Remove(uint64_t id) {
+    std::lock_guard<std::mutex> lk(mu_);
+    entries_.erase(id);
+}
+
+std::vector<InFlightRequest::Snapshot> InFlightRegistry::List() const {
+    // Copia os ponteiros e lê fora do lock do registro (as entradas são compartilhadas)
+    std::vector<std::shared_ptr<InFlightRequest>> reqs;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        reqs.reserve(entries_.size());
+        for (const auto& kv : entries_) reqs.push_back(kv.second);
+    }
+    std::vector<InFlightRequest::Snapshot> out;
+    out.reserve(reqs.size());
+    for (const auto& r : reqs) out.push_back(r->Read());
+    return out;
+}
+
+size_t InFlightRegistry::Count() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return entries_.size();
+}
+
+InFlightRequest* CurrentInFlight() {
+    return t_current;
+}
+
+InFlightThread::InFlightThread(InFlightRequest* req) : prev_(t_current) {
+    t_current = req;
+}
+
+InFlightThread::~InFlightThread() {
+    t_current = prev_;
+}
+
+IngestBuffer& IngestBuffer::operator=(IngestBuffer&& other) noexcept {
+    if (this != &other) {
+        Track(0);
+        bytes_ = other.bytes_;
+        other.bytes_ = 0;
+    }
+    return *this;
+}
+
+void IngestBuffer::Track(size_t bytes) {
+    if (bytes >= bytes_) g_ingest_bytes.fetch_add(bytes - bytes_, std::memory_order_relaxed);
+    else g_ingest_bytes.fetch_sub(bytes_ - bytes, std::memory_order_relaxed);
+    bytes_ = bytes;
+}
+
+uint64_t IngestBufferBytes() {
+    return g_ingest_bytes.load(std::memory_order_relaxed);
+}
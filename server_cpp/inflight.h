@@ -0,0 +1,158 @@
+/*
+ * Requisições em andamento (introspecção pela RPC GetServerState).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada requisição registra uma entrada (InFlight) com a RPC de origem, a fase atual, os bytes
+ * recebidos e enviados e a ferramenta externa em execução (PID), atualizados com operações
+ * atômicas pelo caminho da requisição; GetServerState tira uma cópia das entradas sem parar o
+ * processamento. A entrada corrente da thread (InFlightThread) permite que código sem acesso à
+ * requisição (RunShell, envio das saídas) atualize PID, fase e bytes enviados. Os arquivos
+ * recebidos em memória são contados à parte (IngestBuffer), para medir a memória de entrada.
+ */
+
+#ifndef SERVER_CPP_INFLIGHT_H
+#define SERVER_CPP_INFLIGHT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "latency.h"
+
+// Estado de uma requisição em andamento
+class InFlightRequest {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    InFlightRequest(uint64_t id, const std::string& rpc, const std::string& peer);
+
+    uint64_t id() const { return id_; }
+
+    void SetPhase(int phase);
+    void SetDetails(const std::string& operation, const std::string& file_name);
+    void SetTraceId(const std::string& trace_id);
+    void SetChild(int pid, const std::string& tool);
+    void ClearChild();
+    void AddReceived(uint64_t n) { bytes_received_.fetch_add(n, std::memory_order_relaxed); }
+    void AddSent(uint64_t n) { bytes_sent_.fetch_add(n, std::memory_order_relaxed); }
+
+    // Cópia consistente para a RPC
+    struct Snapshot {
+        uint64_t id = 0;
+        std::string rpc, peer, operation, file_name, trace_id, child_tool;
+        int phase = PHASE_RECEIVE;
+        std::chrono::nanoseconds elapsed{0};
+        std::chrono::nanoseconds phase_elapsed{0};
+        uint64_t bytes_received = 0;
+        uint64_t bytes_sent = 0;
+        int child_pid = 0;
+    };
+    Snapshot Read() const;
+
+private:
+    const uint64_t id_;
+    const std::string rpc_;
+    const std::string peer_;
+    const Clock::time_point start_;
+    std::atomic<int> phase_{PHASE_RECEIVE};
+    std::atomic<int64_t> phase_start_ns_;           // Clock desde a época do steady_clock
+    std::atomic<uint64_t> bytes_received_{0};
+    std::atomic<uint64_t> bytes_sent_{0};
+    std::atomic<int> child_pid_{0};
+
+    mutable std::mutex mu_;                         // Campos de texto (mudam poucas vezes)
+    std::string operation_;
+    std::string file_name_;
+    std::string trace_id_;
+    std::string child_tool_;
+};
+
+class InFlightRegistry;
+
+// Entrada registrada enquanto o objeto existir (pode ser movida, ex.: dentro de ReceivedFile)
+class InFlight {
+public:
+    InFlight() = default;
+    InFlight(InFlightRegistry& registry, const std::string& rpc, const std::string& peer = "");
+    ~InFlight();
+
+    InFlight(InFlight&& other) noexcept;
+    InFlight& operator=(InFlight&& other) noexcept;
+    InFlight(const InFlight&) = delete;
+    InFlight& operator=(const InFlight&) = delete;
+
+    InFlightRequest* get() const { return req_.get(); }
+    InFlightRequest* operator->() const { return req_.get(); }
+    explicit operator bool() const { return req_ != nullptr; }
+
+private:
+    void Release();
+
+    InFlightRegistry* registry_ = nullptr;
+    std::shared_ptr<InFlightRequest> req_;
+};
+
+class InFlightRegistry {
+public:
+    InFlightRegistry() = default;
+
+    InFlightRegistry(const InFlightRegistry&) = delete;
+    InFlightRegistry& operator=(const InFlightRegistry&) = delete;
+
+    // Cópia das entradas, mais antigas primeiro
+    std::vector<InFlightRequest::Snapshot> List() const;
+    size_t Count() const;
+
+private:
+    friend class InFlight;
+
+    std::shared_ptr<InFlightRequest> Add(const std::string& rpc, const std::string& peer);
+    void Remove(uint64_t id);
+
+    mutable std::mutex mu_;
+    uint64_t next_id_ = 1;
+    std::map<uint64_t, std::shared_ptr<InFlightRequest>> entries_;
+};
+
+// Entrada corrente da thread (nullptr fora de uma requisição)
+InFlightRequest* CurrentInFlight();
+
+class InFlightThread {
+public:
+    explicit InFlightThread(InFlightRequest* req);
+    ~InFlightThread();
+
+    InFlightThread(const InFlightThread&) = delete;
+    InFlightThread& operator=(const InFlightThread&) = delete;
+
+private:
+    InFlightRequest* prev_;
+};
+
+// Memória ocupada pelos buffers de entrada de um arquivo (capacidade do vetor); o total do
+// processo é IngestBufferBytes. Pode ser movido junto com o buffer.
+class IngestBuffer {
+public:
+    IngestBuffer() = default;
+    ~IngestBuffer() { Track(0); }
+
+    IngestBuffer(IngestBuffer&& other) noexcept : bytes_(other.bytes_) { other.bytes_ = 0; }
+    IngestBuffer& operator=(IngestBuffer&& other) noexcept;
+    IngestBuffer(const IngestBuffer&) = delete;
+    IngestBuffer& operator=(const IngestBuffer&) = delete;
+
+    // Capacidade atual do buffer
+    void Track(size_t bytes);
+
+private:
+    size_t bytes_ = 0;
+};
+
+uint64_t IngestBufferBytes();
+
+#endif  // SERVER_CPP_INFLIGHT_H
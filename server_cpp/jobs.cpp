@@ -0,0 +1,246 @@
+/*
+ * Implementação da fila de jobs assíncronos.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "jobs.h"
+
+#include <chrono>
+#include <exception>
+#include <fstream>
+
+#include "storage_io.h"
+
+namespace fs = std::filesystem;
+
+using file_processor::FileRequest;
+using file_processor::JobRecord;
+using file_processor::JobStatus;
+
+static int64_t NowUnix() {
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+JobQueue::JobQueue(StorageLifecycle& storage, UploadStore& uploads, size_t threads, Runner runner)
+    : storage_(storage), uploads_(uploads), runner_(std::move(runner)) {
+    Recover();
+    if (threads == 0) threads = 1;
+    for (size_t i = 0; i < threads; ++i) threads_.emplace_back(&JobQueue::Loop, this);
+}
+
+JobQueue::~JobQueue() {
+    // Jobs em execução terminam; os pendentes continuam persistidos para o próximo início
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+fs::path JobQueue::RecordPath(const std::string& id) {
+    return storage_.ShardFor(id) / (id + ".job");
+}
+
+fs::path JobQueue::InputPath(const std::string& id) {
+    return storage_.ShardFor(id) / (id + ".in");
+}
+
+bool JobQueue::Persist(const JobRecord& rec) {
+    // Grava em arquivo temporário e renomeia: leitores nunca veem um registro pela metade
+    fs::path path = RecordPath(rec.status().job_id());
+    fs::path tmp = path.string() + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out || !rec.SerializeToOstream(&out)) return false;
+    }
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if (ec) fs::remove(tmp, ec);
+    return !ec;
+}
+
+bool JobQueue::Store(const JobRecord& rec) {
+    bool ok = Persist(rec);
+    std::lock_guard<std::mutex> lk(mu_);
+    if (ok) unpersisted_.erase(rec.status().job_id());
+    else unpersisted_[rec.status().job_id()] = rec.status();
+    return ok;
+}
+
+bool JobQueue::Prepare(Entry& e, std::string& err) {
+    const FileRequest& req = e.rec.request();
+    const std::string& id = e.rec.status().job_id();
+    e.fname = req.file_name();
+
+    if (!req.upload_id().empty()) {
+        UploadInfo info;
+        if (!uploads_.Lookup(req.upload_id(), info)) { err = "Upload inexistente ou expirado"; return false; }
+        if (!info.complete()) { err = "Upload incompleto"; return false; }
+        if (e.fname.empty()) e.fname = info.file_name;
+        e.in = uploads_.DataPath(info.id);
+        e.rec.set_input_size(info.total_size);
+    } else {
+        e.in = InputPath(id);
+        std::error_code ec;
+        e.rec.set_input_size(fs::file_size(e.in, ec));
+        if (ec) { err = "Entrada do job expirada"; return false; }
+    }
+
+    // Entrada e registro não podem ser removidos pelo varredor enquanto o job está pendente
+    e.pin_in.reset(new PinScope(storage_, e.in));
+    e.pin_rec.reset(new PinScope(storage_, RecordPath(id)));
+    return true;
+}
+
+bool JobQueue::Submit(const FileRequest& request, JobStatus& status) {
+    std::unique_ptr<Entry> e(new Entry);
+    JobStatus* st = e->rec.mutable_status();
+    st->set_job_id(RandomId());
+    st->set_state(file_processor::JOB_QUEUED);
+    st->set_status_message("Job na fila");
+    e->rec.set_submitted_at(NowUnix());
+
+    // O conteúdo enviado junto do SubmitJob vira o arquivo de entrada do job
+    FileRequest* req = e->rec.mutable_request();
+    *req = request;
+    req->clear_file_content();
+    auto fail = [&](const std::string& m) {
+        status.Clear();
+        status.set_state(file_processor::JOB_FAILED);
+        status.set_status_message(m);
+        return false;
+    };
+    if (request.parameters_case() == FileRequest::PARAMETERS_NOT_SET) return fail("Parâmetros ausentes");
+    if (request.upload_id().empty()) {
+        if (request.file_name().empty()) return fail("Nome do arquivo ausente");
+        const auto& c = request.file_content().content();
+        if (!IoWriteFile(InputPath(st->job_id()), c.data(), c.size())) return fail("Falha ao salvar entrada");
+    }
+
+    std::string err;
+    if (!Prepare(*e, err)) return fail(err);
+    if (!Persist(e->rec)) return fail("Falha ao persistir job");
+
+    status = e->rec.status();
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        queued_[st->job_id()] = std::move(e);
+    }
+    cv_.notify_one();
+    return true;
+}
+
+bool JobQueue::Lookup(const std::string& job_id, JobStatus& status) {
+    if (!IsRandomId(job_id)) return false;
+    {
+        // Estado mais recente que o registro em disco (gravação falhou)
+        std::lock_guard<std::mutex> lk(mu_);
+        auto it = unpersisted_.find(job_id);
+        if (it != unpersisted_.end()) { status = it->second; return true; }
+    }
+    std::ifstream in(RecordPath(job_id), std::ios::binary);
+    JobRecord rec;
+    if (!in || !rec.ParseFromIstream(&in)) return false;
+    status = rec.status();
+    return true;
+}
+
+size_t JobQueue::Queued() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return queued_.size();
+}
+
+size_t JobQueue::Running() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return running_;
+}
+
+void JobQueue::Recover() {
+    std::error_code ec;
+    fs::path root(storage_.config().root);
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->path().extension() != ".job") continue;
+
+        std::unique_ptr<Entry> e(new Entry);
+        {
+            std::ifstream in(it->path(), std::ios::binary);
+            if (!in || !e->rec.ParseFromIstream(&in)) continue;
+        }
+        auto state = e->rec.status().state();
+        if (state != file_processor::JOB_QUEUED && state != file_processor::JOB_RUNNING) continue;
+
+        // Job interrompido pelo reinício volta para a fila
+        std::string err;
+        JobStatus* st = e->rec.mutable_status();
+        if (!Prepare(*e, err)) {
+            st->set_state(file_processor::JOB_FAILED);
+            st->set_status_message(err);
+            Store(e->rec);
+            continue;
+        }
+        st->set_state(file_processor::JOB_QUEUED);
+        st->set_status_message("Job na fila (recuperado)");
+        Store(e->rec);
+        queued_[st->job_id()] = std::move(e);
+    }
+}
+
+void JobQueue::Loop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (true) {
+        cv_.wait(lk, [this] { return stop_ || !queued_.empty(); });
+        if (stop_) return;
+
+        // Menor tamanho efetivo: input_size reduzido pela metade a cada minuto de espera
+        int64_t now = NowUnix();
+        auto best = queued_.end();
+        uint64_t best_key = 0;
+        for (auto it = queued_.begin(); it != queued_.end(); ++it) {
+            const JobRecord& r = it->second->rec;
+            int64_t waited = (now - r.submitted_at()) / 60;
+            uint64_t key = waited >= 63 ? 0 : (r.input_size() >> (waited > 0 ? waited : 0));
+            if (best == queued_.end() || key < best_key ||
+                (key == best_key && r.submitted_at() < best->second->rec.submitted_at())) {
+                best = it;
+                best_key = key;
+            }
+        }
+        std::unique_ptr<Entry> e = std::move(best->second);
+        queued_.erase(best);
+        running_++;
+        lk.unlock();
+
+        JobStatus* st = e->rec.mutable_status();
+        st->set_state(file_processor::JOB_RUNNING);
+        st->set_status_message("Job em execução");
+        if (!Store(e->rec)) {
+            // Sem registro o job não sobreviveria a um reinício: falha antes de executar
+            st->set_state(file_processor::JOB_FAILED);
+            st->set_status_message("Falha ao persistir job");
+        } else {
+            // Uma exceção do runner não pode derrubar a thread da fila (e o servidor)
+            try {
+                runner_(e->rec.request(), e->fname, e->in, std::chrono::steady_clock::now() - e->enqueued, *st);
+            } catch (const std::exception& ex) {
+                st->set_state(file_processor::JOB_FAILED);
+                st->set_status_message(std::string("Erro interno: ") + ex.what());
+            } catch (...) {
+                st->set_state(file_processor::JOB_FAILED);
+                st->set_status_message("Erro interno");
+            }
+        }
+        if (st->state() != file_processor::JOB_DONE) st->set_state(file_processor::JOB_FAILED);
+        Store(e->rec);
+
+        // A entrada própria do job não é mais necessária (uploads expiram pelo TTL)
+        if (e->rec.request().upload_id().empty()) {
+            std::error_code ec;
+            fs::remove(e->in, ec);
+        }
+        e.reset();
+
+        lk.lock();
+        running_--;
+    }
+}
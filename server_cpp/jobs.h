@@ -0,0 +1,94 @@
+/*
+ * Fila de jobs assíncronos (SubmitJob / GetJobStatus / FetchResult).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada job é persistido como <job_id>.job (JobRecord serializado) no shard do job_id,
+ * reescrito a cada mudança de estado. Entradas enviadas no próprio SubmitJob ficam em
+ * <job_id>.in; entradas por upload_id são lidas direto do upload. Ao reiniciar, o servidor
+ * recoloca na fila os jobs que estavam pendentes ou em execução.
+ *
+ * Escalonamento: menor entrada primeiro, com envelhecimento (o tamanho efetivo cai pela
+ * metade a cada minuto de espera), para que jobs grandes não fiquem esperando para sempre.
+ */
+
+#ifndef SERVER_CPP_JOBS_H
+#define SERVER_CPP_JOBS_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../config_cpp/file_processor.pb.h"
+
+#include "storage_lifecycle.h"
+#include "uploads.h"
+
+class JobQueue {
+public:
+    // Executa a operação do job sobre a entrada e preenche estado final, mensagem e saídas
+    // (queued: tempo de espera na fila desde o envio ou a recuperação)
+    using Runner = std::function<void(const file_processor::FileRequest& request, const std::string& fname,
+                                      const std::filesystem::path& in, std::chrono::nanoseconds queued,
+                                      file_processor::JobStatus& status)>;
+
+    JobQueue(StorageLifecycle& storage, UploadStore& uploads, size_t threads, Runner runner);
+    ~JobQueue();
+
+    JobQueue(const JobQueue&) = delete;
+    JobQueue& operator=(const JobQueue&) = delete;
+
+    // Persiste e enfileira o job; em caso de recusa, status traz JOB_FAILED e o motivo
+    bool Submit(const file_processor::FileRequest& request, file_processor::JobStatus& status);
+
+    // Estado atual do job (false se não existe ou expirou)
+    bool Lookup(const std::string& job_id, file_processor::JobStatus& status);
+
+    // Ocupação atual
+    size_t Queued();
+    size_t Running();
+
+private:
+    struct Entry {
+        file_processor::JobRecord rec;
+        std::filesystem::path in;
+        std::string fname;
+        std::unique_ptr<PinScope> pin_in;
+        std::unique_ptr<PinScope> pin_rec;
+        std::chrono::steady_clock::time_point enqueued = std::chrono::steady_clock::now();
+    };
+
+    std::filesystem::path RecordPath(const std::string& id);
+    std::filesystem::path InputPath(const std::string& id);
+    bool Persist(const file_processor::JobRecord& rec);
+
+    // Persiste o estado; se a gravação falhar, o estado fica em memória para Lookup
+    bool Store(const file_processor::JobRecord& rec);
+
+    // Resolve a entrada do job e marca os arquivos como em uso
+    bool Prepare(Entry& e, std::string& err);
+
+    void Recover();
+    void Loop();
+
+    StorageLifecycle& storage_;
+    UploadStore& uploads_;
+    Runner runner_;
+
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::map<std::string, std::unique_ptr<Entry>> queued_;
+    std::map<std::string, file_processor::JobStatus> unpersisted_;    // Estados que não foram gravados
+    size_t running_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+#endif  // SERVER_CPP_JOBS_H
@@ -0,0 +1,208 @@
+/*
+ * Implementação dos histogramas de latência.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "latency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <vector>
+
+static const char* const PHASE_NAMES[PHASE_COUNT] = {"receive", "persist", "queue", "execute", "stream", "total"};
+
+const char* PhaseName(int phase) {
+    return (phase >= 0 && phase < PHASE_COUNT) ? PHASE_NAMES[phase] : "?";
+}
+
+LatencyHistogram::LatencyHistogram() {
+    for (auto& b : buckets_) b.store(0, std::memory_order_relaxed);
+}
+
+int LatencyHistogram::BucketOf(uint64_t us) {
+    // Abaixo de 16 us: uma faixa por valor; acima, 16 faixas por potência de 2
+    if (us < (1u << SUB_BITS)) return (int)us;
+    if (us >= (1ULL << (MAX_EXP + 1))) us = (1ULL << (MAX_EXP + 1)) - 1;
+    int exp = 63 - __builtin_clzll(us);
+    int sub = (int)((us >> (exp - SUB_BITS)) & ((1u << SUB_BITS) - 1));
+    return ((exp - SUB_BITS + 1) << SUB_BITS) | sub;
+}
+
+uint64_t LatencyHistogram::BucketUpper(int bucket) {
+    if (bucket < (1 << SUB_BITS)) return (uint64_t)bucket;
+    int exp = (bucket >> SUB_BITS) + SUB_BITS - 1;
+    uint64_t sub = (uint64_t)(bucket & ((1 << SUB_BITS) - 1));
+    uint64_t width = 1ULL << (exp - SUB_BITS);
+    return (((1ULL << SUB_BITS) + sub) << (exp - SUB_BITS)) + width - 1;
+}
+
+void LatencyHistogram::Record(uint64_t us) {
+    buckets_[(size_t)BucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(us, std::memory_order_relaxed);
+    uint64_t prev = max_.load(std::memory_order_relaxed);
+    while (us > prev && !max_.compare_exchange_weak(prev, us, std::memory_order_relaxed)) {}
+}
+
+uint64_t LatencyHistogram::Percentile(double q) const {
+    uint64_t n = count();
+    if (n == 0) return 0;
+    uint64_t target = (uint64_t)std::ceil(q * (double)n);
+    if (target == 0) target = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+        seen += buckets_[(size_t)i].load(std::memory_order_relaxed);
+        if (seen >= target) return std::min(BucketUpper(i), max());
+    }
+    return max();
+}
+
+uint64_t LatencyHistogram::CountAtMost(uint64_t us) const {
+    uint64_t n = 0;
+    for (int i = 0; i < BUCKETS && BucketUpper(i) <= us; i++) n += buckets_[(size_t)i].load(std::memory_order_relaxed);
+    return n;
+}
+
+LatencyRecorder::~LatencyRecorder() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (dumper_.joinable()) dumper_.join();
+}
+
+void LatencyRecorder::Record(const std::string& operation, bool ok, int phase, std::chrono::nanoseconds d) {
+    // O lock só cobre a busca da série; a gravação no histograma é atômica
+    Phases* phases;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        auto& slot = series_[{operation, ok}];
+        if (!slot) slot.reset(new Phases());
+        phases = slot.get();
+    }
+    uint64_t us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    (*phases)[(size_t)phase].Record(us);
+}
+
+void LatencyRecorder::ForEach(const std::function<void(const std::string&, bool, int, const LatencyHistogram&)>& fn) {
+    std::vector<std::pair<std::pair<std::string, bool>, Phases*>> snapshot;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        for (auto& kv : series_) snapshot.emplace_back(kv.first, kv.second.get());
+    }
+    for (auto& s : snapshot) {
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            const LatencyHistogram& h = (*s.second)[(size_t)p];
+            if (h.count() > 0) fn(s.first.first, s.first.second, p, h);
+        }
+    }
+}
+
+std::string LatencyRecorder::Report() {
+    std::string out;
+    char line[256];
+    std::time_t now = std::time(nullptr);
+    std::tm tm{};
+    localtime_r(&now, &tm);
+    std::strftime(line, sizeof(line), "# Latência por fase (us) - %Y-%m-%d %H:%M:%S\n", &tm);
+    out += line;
+    std::snprintf(line, sizeof(line), "%-20s %-5s %-8s %10s %10s %10s %10s %10s %10s %10s\n",
+                  "operacao", "res", "fase", "amostras", "media", "p50", "p90", "p99", "p99.9", "max");
+    out += line;
+    ForEach([&](const std::string& op, bool ok, int phase, const LatencyHistogram& h) {
+        std::snprintf(line, sizeof(line), "%-20s %-5s %-8s %10llu %10llu %10llu %10llu %10llu %10llu %10llu\n",
+                      op.c_str(), ok ? "ok" : "falha", PhaseName(phase),
+                      (unsigned long long)h.count(), (unsigned long long)(h.sum() / h.count()),
+                      (unsigned long long)h.Percentile(0.50), (unsigned long long)h.Percentile(0.90),
+                      (unsigned long long)h.Percentile(0.99), (unsigned long long)h.Percentile(0.999),
+                      (unsigned long long)h.max());
+        out += line;
+    });
+    return out;
+}
+
+void LatencyRecorder::StartDump(const std::string& path, std::chrono::seconds interval) {
+    if (dumper_.joinable() || interval.count() <= 0) return;
+    dumper_ = std::thread(&LatencyRecorder::DumpLoop, this, path, interval);
+}
+
+void LatencyRecorder::DumpLoop(std::string path, std::chrono::seconds interval) {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!stop_) {
+        cv_.wait_for(lk, interval, [this] { return stop_; });
+        if (stop_) break;
+        lk.unlock();
+
+        // Quem lê o arquivo nunca vê uma tabela pela metade
+        std::string tmp = path + ".tmp";
+        {
+            std::ofstream f(tmp, std::ios::trunc);
+            f << Report();
+        }
+        std::rename(tmp.c_str(), path.c_str());
+        lk.lock();
+    }
+}
+
+// Instante do relógio de parede correspondente a um instante do relógio monotônico
+static std::chrono::system_clock::time_point ToSystem(RequestTimer::Clock::time_point t) {
+    auto delta = RequestTimer::Clock::now() - t;
+    return std::chrono::system_clock::now() - std::chrono::duration_cast<std::chrono::system_clock::duration>(delta);
+}
+
+void RequestTimer::StartTrace(const TraceContext& parent) {
+    if (!TracingEnabled() || span_) return;
+    span_.reset(new Span("request", parent, SPAN_SERVER, ToSystem(start_ - std::chrono::duration_cast<Clock::duration>(before_))));
+
+    // Fases somadas antes do cronômetro (em sequência, terminando no início dele)
+    Clock::time_point t = start_ - std::chrono::duration_cast<Clock::duration>(before_);
+    for (const auto& a : added_) {
+        Clock::time_point end = t + std::chrono::duration_cast<Clock::duration>(a.second);
+        TracePhase(a.first, t, end);
+        t = end;
+    }
+}
+
+const TraceContext& RequestTimer::trace() const {
+    static const TraceContext none;
+    return span_ ? span_->context() : none;
+}
+
+void RequestTimer::TracePhase(int phase, Clock::time_point from, Clock::time_point to) {
+    if (!span_ || !span_->recording()) return;
+    Span s(PhaseName(phase), span_->context(), SPAN_INTERNAL, ToSystem(from));
+    s.End(ToSystem(to));
+}
+
+void RequestTimer::Mark(int phase) {
+    Clock::time_point now = Clock::now();
+    phases_[(size_t)phase] += now - last_;
+    marked_ |= 1u << phase;
+    TracePhase(phase, last_, now);
+    last_ = now;
+}
+
+void RequestTimer::Add(int phase, std::chrono::nanoseconds d) {
+    phases_[(size_t)phase] += d;
+    marked_ |= 1u << phase;
+    before_ += d;
+    added_.emplace_back(phase, d);
+}
+
+std::chrono::nanoseconds RequestTimer::Finish(LatencyRecorder& recorder, const std::string& operation, bool ok) {
+    for (int p = 0; p < PHASE_TOTAL; p++) {
+        if (marked_ & (1u << p)) recorder.Record(operation, ok, p, phases_[(size_t)p]);
+    }
+    std::chrono::nanoseconds total = Clock::now() - start_ + before_;
+    recorder.Record(operation, ok, PHASE_TOTAL, total);
+    if (span_) {
+        span_->SetName(operation);
+        span_->SetStatus(ok, "falha");
+        span_->End();
+    }
+    return total;
+}
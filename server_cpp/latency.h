@@ -0,0 +1,142 @@
+/*
+ * Latência por fase das requisições (recebimento, gravação, fila, execução, envio).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada requisição mede suas fases com um RequestTimer e, ao terminar, registra as durações em
+ * histogramas por operação e resultado (sucesso/falha). Os histogramas são log-lineares (estilo
+ * HDR): 16 faixas por potência de 2, erro relativo abaixo de 6,25%, de 1 us a ~12 dias, com
+ * contadores atômicos (registrar não bloqueia as outras requisições). Consultados pela RPC
+ * GetLatencyStats e gravados periodicamente em um arquivo texto. Com tracing ligado, o cronômetro
+ * também abre o span da requisição e cada fase marcada vira um span filho (ver tracing.h).
+ */
+
+#ifndef SERVER_CPP_LATENCY_H
+#define SERVER_CPP_LATENCY_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tracing.h"
+
+// Fases de uma requisição (PHASE_TOTAL: do início ao fim, incluindo a espera em fila)
+enum LatencyPhase { PHASE_RECEIVE, PHASE_PERSIST, PHASE_QUEUE, PHASE_EXECUTE, PHASE_STREAM, PHASE_TOTAL, PHASE_COUNT };
+
+// Nome da fase ("receive", "persist", ...)
+const char* PhaseName(int phase);
+
+// Histograma de durações em microssegundos
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void Record(uint64_t us);
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    // Limite superior da faixa que contém o quantil q (0..1)
+    uint64_t Percentile(double q) const;
+
+    // Amostras em faixas cujo limite superior não passa de us (histograma cumulativo)
+    uint64_t CountAtMost(uint64_t us) const;
+
+private:
+    static const int SUB_BITS = 4;                  // 16 faixas por potência de 2
+    static const int MAX_EXP = 39;                  // Até 2^40 us
+    static const int BUCKETS = (MAX_EXP - SUB_BITS + 2) << SUB_BITS;
+
+    static int BucketOf(uint64_t us);
+    static uint64_t BucketUpper(int bucket);
+
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+// Histogramas por (operação, resultado) e fase
+class LatencyRecorder {
+public:
+    LatencyRecorder() = default;
+    ~LatencyRecorder();
+
+    LatencyRecorder(const LatencyRecorder&) = delete;
+    LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+    void Record(const std::string& operation, bool ok, int phase, std::chrono::nanoseconds d);
+
+    // Visita as séries com amostras, ordenadas por operação, resultado e fase
+    void ForEach(const std::function<void(const std::string& operation, bool ok, int phase, const LatencyHistogram& h)>& fn);
+
+    // Tabela de texto com contagem, média, p50/p90/p99/p99.9 e máximo de cada série
+    std::string Report();
+
+    // Grava Report() em path a cada interval (substituição atômica por rename)
+    void StartDump(const std::string& path, std::chrono::seconds interval);
+
+private:
+    using Phases = std::array<LatencyHistogram, PHASE_COUNT>;
+
+    void DumpLoop(std::string path, std::chrono::seconds interval);
+
+    std::mutex mu_;
+    std::map<std::pair<std::string, bool>, std::unique_ptr<Phases>> series_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread dumper_;
+};
+
+// Cronômetro das fases de uma requisição
+class RequestTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RequestTimer() : start_(Clock::now()), last_(start_) {}
+
+    // Atribui à fase o tempo desde a marca anterior (ou desde o início)
+    void Mark(int phase);
+
+    // Soma à fase uma duração medida antes do cronômetro existir (ex.: espera na fila de jobs);
+    // chamado antes de StartTrace, para entrar no span
+    void Add(int phase, std::chrono::nanoseconds d);
+
+    // Abre o span da requisição a partir do início do cronômetro (filho de parent; sem parent
+    // válido, inicia um trace). Sem exportador de traces não faz nada.
+    void StartTrace(const TraceContext& parent);
+
+    // Contexto do span da requisição (pai das ferramentas executadas; inválido sem tracing)
+    const TraceContext& trace() const;
+
+    // Registra as fases marcadas e o total (e encerra o span com o nome da operação); retorna o total
+    std::chrono::nanoseconds Finish(LatencyRecorder& recorder, const std::string& operation, bool ok);
+
+    // Duração atribuída à fase (zero se não foi medida)
+    std::chrono::nanoseconds phase(int p) const { return phases_[(size_t)p]; }
+    bool measured(int p) const { return (marked_ & (1u << p)) != 0; }
+
+private:
+    // Span filho da requisição para uma fase [from, to)
+    void TracePhase(int phase, Clock::time_point from, Clock::time_point to);
+
+    Clock::time_point start_;
+    Clock::time_point last_;
+    std::array<std::chrono::nanoseconds, PHASE_COUNT> phases_{};
+    unsigned marked_ = 0;                           // Bitmask das fases medidas
+    std::chrono::nanoseconds before_{0};            // Tempo anterior ao início (Add)
+    std::vector<std::pair<int, std::chrono::nanoseconds>> added_;   // Fases de Add, na ordem
+    std::unique_ptr<Span> span_;                    // Span da requisição (só com tracing)
+};
+
+#endif  // SERVER_CPP_LATENCY_H
@@ -0,0 +1,258 @@
+/*
+ * Implementação das métricas e do listener HTTP.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "metrics.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <netdb.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+// Maior requisição HTTP aceita (só a linha de requisição e os cabeçalhos importam)
+static const size_t MAX_HTTP_REQUEST = 8 * 1024;
+
+// Escapa \, " e quebra de linha no valor de um rótulo
+static std::string EscapeLabel(const std::string& v) {
+    std::string out;
+    out.reserve(v.size());
+    for (char c : v) {
+        if (c == '\\') out += "\\\\";
+        else if (c == '"') out += "\\\"";
+        else if (c == '\n') out += "\\n";
+        else out += c;
+    }
+    return out;
+}
+
+// {nome="valor",...} (vazio sem rótulos)
+static std::string FormatLabels(const MetricLabels& labels) {
+    if (labels.empty()) return "";
+    std::string out = "{";
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (i > 0) out += ",";
+        out += labels[i].first + "=\"" + EscapeLabel(labels[i].second) + "\"";
+    }
+    return out + "}";
+}
+
+// Inteiros sem casas decimais; demais valores com 9 dígitos significativos
+static std::string FormatValue(double v) {
+    char buf[64];
+    if (std::isinf(v)) return v > 0 ? "+Inf" : "-Inf";
+    if (v == std::floor(v) && std::fabs(v) < 1e15) std::snprintf(buf, sizeof(buf), "%.0f", v);
+    else std::snprintf(buf, sizeof(buf), "%.9g", v);
+    return buf;
+}
+
+void MetricsWriter::Family(const std::string& name, const std::string& help, const char* type) {
+    out_ += "# HELP " + name + " " + help + "\n";
+    out_ += "# TYPE " + name + " " + type + "\n";
+}
+
+void MetricsWriter::Sample(const std::string& name, const MetricLabels& labels, double value) {
+    out_ += name + FormatLabels(labels) + " " + FormatValue(value) + "\n";
+}
+
+void MetricsWriter::Histogram(const std::string& name, const MetricLabels& labels, const std::vector<double>& bounds,
+                              const std::vector<uint64_t>& cumulative, uint64_t count, double sum) {
+    MetricLabels with_le = labels;
+    with_le.emplace_back("le", "");
+    for (size_t i = 0; i < bounds.size() && i < cumulative.size(); i++) {
+        with_le.back().second = FormatValue(bounds[i]);
+        Sample(name + "_bucket", with_le, (double)cumulative[i]);
+    }
+    with_le.back().second = "+Inf";
+    Sample(name + "_bucket", with_le, (double)count);
+    Sample(name + "_sum", labels, sum);
+    Sample(name + "_count", labels, (double)count);
+}
+
+MetricsRegistry::Family& MetricsRegistry::GetFamily(const std::string& name, const std::string& help, const char* type) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        it = families_.emplace(name, Family()).first;
+        it->second.help = help;
+        it->second.type = type;
+    }
+    return it->second;
+}
+
+Counter& MetricsRegistry::GetCounter(const std::string& name, const std::string& help, const MetricLabels& labels) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto& slot = GetFamily(name, help, "counter").counters[FormatLabels(labels)];
+    if (!slot) slot.reset(new Counter());
+    return *slot;
+}
+
+Gauge& MetricsRegistry::GetGauge(const std::string& name, const std::string& help, const MetricLabels& labels) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto& slot = GetFamily(name, help, "gauge").gauges[FormatLabels(labels)];
+    if (!slot) slot.reset(new Gauge());
+    return *slot;
+}
+
+void MetricsRegistry::AddCollector(Collector fn) {
+    std::lock_guard<std::mutex> lk(mu_);
+    collectors_.push_back(std::move(fn));
+}
+
+std::string MetricsRegistry::Render() {
+    std::string out;
+    std::vector<Collector> collectors;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        for (auto& kv : families_) {
+            const Family& f = kv.second;
+            out += "# HELP " + kv.first + " " + f.help + "\n";
+            out += "# TYPE " + kv.first + " " + f.type + "\n";
+            for (auto& s : f.counters) out += kv.first + s.first + " " + FormatValue((double)s.second->value()) + "\n";
+            for (auto& s : f.gauges) out += kv.first + s.first + " " + FormatValue((double)s.second->value()) + "\n";
+        }
+        collectors = collectors_;
+    }
+
+    // Os coletores leem estruturas com locks próprios: chamados fora do lock do registro
+    MetricsWriter w;
+    for (auto& c : collectors) c(w);
+    return out + w.text();
+}
+
+void WriteProcessMetrics(MetricsWriter& w) {
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) {
+        double cpu = (double)ru.ru_utime.tv_sec + (double)ru.ru_utime.tv_usec / 1e6 +
+                     (double)ru.ru_stime.tv_sec + (double)ru.ru_stime.tv_usec / 1e6;
+        w.Family("process_cpu_seconds_total", "Tempo de CPU (usuário + sistema) do processo.", "counter");
+        w.Sample("process_cpu_seconds_total", {}, cpu);
+    }
+
+    // Segundo campo de /proc/self/statm: páginas residentes
+    std::ifstream statm("/proc/self/statm");
+    unsigned long long size = 0, resident = 0;
+    if (statm >> size >> resident) {
+        w.Family("process_resident_memory_bytes", "Memória residente do processo.", "gauge");
+        w.Sample("process_resident_memory_bytes", {}, (double)resident * (double)sysconf(_SC_PAGESIZE));
+    }
+
+    std::error_code ec;
+    size_t fds = 0, threads = 0;
+    for (auto it = fs::directory_iterator("/proc/self/fd", ec); !ec && it != fs::directory_iterator(); it.increment(ec)) fds++;
+    for (auto it = fs::directory_iterator("/proc/self/task", ec); !ec && it != fs::directory_iterator(); it.increment(ec)) threads++;
+    w.Family("process_open_fds", "Descritores de arquivo abertos.", "gauge");
+    w.Sample("process_open_fds", {}, (double)fds);
+    w.Family("process_threads", "Threads do processo.", "gauge");
+    w.Sample("process_threads", {}, (double)threads);
+}
+
+MetricsHttpServer::~MetricsHttpServer() {
+    stop_ = true;
+    // shutdown desbloqueia o accept pendente
+    if (listen_fd_ >= 0) shutdown(listen_fd_, SHUT_RDWR);
+    if (acceptor_.joinable()) acceptor_.join();
+    if (listen_fd_ >= 0) close(listen_fd_);
+}
+
+bool MetricsHttpServer::Start(const std::string& address, std::string& err) {
+    size_t colon = address.rfind(':');
+    if (colon == std::string::npos || colon + 1 == address.size()) { err = "Endereço de métricas inválido: " + address; return false; }
+    std::string host = address.substr(0, colon);
+    std::string port = address.substr(colon + 1);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') host = host.substr(1, host.size() - 2);
+
+    struct addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    struct addrinfo* res = nullptr;
+    int rc = getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &res);
+    if (rc != 0) { err = "Endereço de métricas inválido: " + address + " (" + gai_strerror(rc) + ")"; return false; }
+
+    for (struct addrinfo* ai = res; ai; ai = ai->ai_next) {
+        int fd = socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 && listen(fd, 16) == 0) {
+            listen_fd_ = fd;
+            break;
+        }
+        err = std::string("Falha ao ouvir em ") + address + ": " + std::strerror(errno);
+        close(fd);
+    }
+    freeaddrinfo(res);
+    if (listen_fd_ < 0) {
+        if (err.empty()) err = "Falha ao ouvir em " + address;
+        return false;
+    }
+    acceptor_ = std::thread(&MetricsHttpServer::AcceptLoop, this);
+    return true;
+}
+
+void MetricsHttpServer::AcceptLoop() {
+    while (!stop_) {
+        int conn = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (conn < 0) {
+            if (stop_ || (errno != EINTR && errno != ECONNABORTED && errno != EMFILE && errno != ENFILE)) break;
+            if (errno == EMFILE || errno == ENFILE) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        // Leituras de métricas são raras e curtas: atendidas na própria thread
+        Serve(conn);
+        close(conn);
+    }
+}
+
+void MetricsHttpServer::Serve(int conn) {
+    // Cliente lento não prende o listener
+    struct timeval tv = {2, 0};
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(conn, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    // Lê até o fim dos cabeçalhos
+    std::string req;
+    char buf[1024];
+    while (req.find("\r\n\r\n") == std::string::npos && req.size() < MAX_HTTP_REQUEST) {
+        ssize_t n = recv(conn, buf, sizeof(buf), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        req.append(buf, (size_t)n);
+    }
+
+    // Linha de requisição: MÉTODO caminho versão
+    std::string line = req.substr(0, req.find("\r\n"));
+    size_t sp1 = line.find(' ');
+    size_t sp2 = sp1 == std::string::npos ? std::string::npos : line.find(' ', sp1 + 1);
+    std::string method = line.substr(0, sp1);
+    std::string path = sp2 == std::string::npos ? "" : line.substr(sp1 + 1, sp2 - sp1 - 1);
+    path = path.substr(0, path.find('?'));
+
+    std::string status = "200 OK", type = "text/plain; version=0.0.4; charset=utf-8", body;
+    if (method != "GET" && method != "HEAD") { status = "405 Method Not Allowed"; type = "text/plain"; body = "Método não suportado\n"; }
+    else if (path == "/metrics") body = registry_.Render();
+    else if (path == "/") { type = "text/html"; body = "<a href=\"/metrics\">/metrics</a>\n"; }
+    else { status = "404 Not Found"; type = "text/plain"; body = "Não encontrado\n"; }
+
+    std::string out = "HTTP/1.1 " + status + "\r\nContent-Type: " + type + "\r\nContent-Length: " +
+                      std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n";
+    if (method != "HEAD") out += body;
+    size_t sent = 0;
+    while (sent < out.size()) {
+        ssize_t n = send(conn, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        sent += (size_t)n;
+    }
+}
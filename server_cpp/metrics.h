@@ -0,0 +1,141 @@
+/*
+ * Métricas do servidor no formato de texto do Prometheus.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Contadores e gauges ficam em um registro (MetricsRegistry) e são atualizados com operações
+ * atômicas; quem atualiza com frequência guarda a referência devolvida por GetCounter/GetGauge.
+ * Valores que já existem em outro lugar (histogramas de latência, filas, uso do storage) não são
+ * duplicados: coletores registrados com AddCollector os escrevem na hora da leitura.
+ * MetricsHttpServer serve o texto em GET /metrics (um listener HTTP mínimo, uma conexão por vez).
+ */
+
+#ifndef SERVER_CPP_METRICS_H
+#define SERVER_CPP_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Rótulos de uma série (nome, valor), na ordem em que aparecem
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+class Counter {
+public:
+    void Inc(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+class Gauge {
+public:
+    void Add(int64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+    void Set(int64_t n) { value_.store(n, std::memory_order_relaxed); }
+    // Guarda o maior valor já visto (picos)
+    void SetMax(int64_t n) {
+        int64_t cur = value_.load(std::memory_order_relaxed);
+        while (n > cur && !value_.compare_exchange_weak(cur, n, std::memory_order_relaxed)) {}
+    }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+// Soma 1 ao gauge enquanto o objeto existir (ex.: streams ativos)
+class GaugeScope {
+public:
+    explicit GaugeScope(Gauge& g) : gauge_(g) { gauge_.Add(1); }
+    ~GaugeScope() { gauge_.Add(-1); }
+
+    GaugeScope(const GaugeScope&) = delete;
+    GaugeScope& operator=(const GaugeScope&) = delete;
+
+private:
+    Gauge& gauge_;
+};
+
+// Monta o texto de exposição (HELP/TYPE uma vez por métrica, seguidos das amostras)
+class MetricsWriter {
+public:
+    void Family(const std::string& name, const std::string& help, const char* type);
+    void Sample(const std::string& name, const MetricLabels& labels, double value);
+
+    // Histograma: bounds crescentes e, para cada um, as amostras <= bound (a faixa +Inf é count)
+    void Histogram(const std::string& name, const MetricLabels& labels, const std::vector<double>& bounds,
+                   const std::vector<uint64_t>& cumulative, uint64_t count, double sum);
+
+    const std::string& text() const { return out_; }
+
+private:
+    std::string out_;
+};
+
+class MetricsRegistry {
+public:
+    using Collector = std::function<void(MetricsWriter& w)>;
+
+    MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // Série da métrica com os rótulos dados (criada na primeira chamada; a referência é estável)
+    Counter& GetCounter(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+    Gauge& GetGauge(const std::string& name, const std::string& help, const MetricLabels& labels = {});
+
+    // Escreve métricas calculadas na leitura; registrados antes de o servidor iniciar
+    void AddCollector(Collector fn);
+
+    // Texto completo no formato do Prometheus (version=0.0.4)
+    std::string Render();
+
+private:
+    struct Family {
+        std::string help;
+        const char* type;
+        std::map<std::string, std::unique_ptr<Counter>> counters;  // Rótulos formatados -> série
+        std::map<std::string, std::unique_ptr<Gauge>> gauges;
+    };
+
+    Family& GetFamily(const std::string& name, const std::string& help, const char* type);
+
+    std::mutex mu_;
+    std::map<std::string, Family> families_;
+    std::vector<Collector> collectors_;
+};
+
+// Métricas do próprio processo (CPU, memória residente, descritores e threads abertos)
+void WriteProcessMetrics(MetricsWriter& w);
+
+// Listener HTTP de GET /metrics
+class MetricsHttpServer {
+public:
+    explicit MetricsHttpServer(MetricsRegistry& registry) : registry_(registry) {}
+    ~MetricsHttpServer();
+
+    MetricsHttpServer(const MetricsHttpServer&) = delete;
+    MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+    // Ouve em host:porta ([::1]:porta para IPv6) e inicia a thread de accept
+    bool Start(const std::string& address, std::string& err);
+
+private:
+    void AcceptLoop();
+    void Serve(int conn);
+
+    MetricsRegistry& registry_;
+    int listen_fd_ = -1;
+    std::atomic<bool> stop_{false};
+    std::thread acceptor_;
+};
+
+#endif  // SERVER_CPP_METRICS_H
@@ -0,0 +1,432 @@
+/*
+ * Implementação das transformações (ferramentas externas com fallback de cópia).
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "operations.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <utility>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "inflight.h"
+
+extern char** environ;
+
+namespace fs = std::filesystem;
+
+using file_processor::FileRequest;
+using file_processor::PipelineStep;
+
+bool CommandExists(const std::string& cmd) {
+    std::string c = "command -v '" + cmd + "' >/dev/null 2>&1";
+    int r = std::system(c.c_str());
+    return r == 0;
+}
+
+static ToolObserver g_tool_observer;
+
+void SetToolObserver(ToolObserver observer) {
+    g_tool_observer = std::move(observer);
+}
+
+// Execuções da RunOperation em andamento na thread (nullptr fora dela)
+static thread_local std::vector<ToolInvocation>* t_tools = nullptr;
+
+static std::chrono::microseconds ToMicros(const struct timeval& tv) {
+    return std::chrono::seconds(tv.tv_sec) + std::chrono::microseconds(tv.tv_usec);
+}
+
+// Repassa a saída de erro capturada ao stderr do servidor e guarda o final em tail
+static void DrainStderr(int fd, std::string& tail) {
+    char buf[16 * 1024];
+    off_t off = 0;
+    for (;;) {
+        ssize_t n = pread(fd, buf, sizeof(buf), off);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        off += n;
+        ssize_t w = write(STDERR_FILENO, buf, (size_t)n);
+        (void)w;
+        tail.append(buf, (size_t)n);
+        if (tail.size() > TOOL_STDERR_TAIL) tail.erase(0, tail.size() - TOOL_STDERR_TAIL);
+    }
+}
+
+int RunShell(const std::string& tool, const std::string& cmd) {
+    ToolInvocation inv;
+    inv.tool = tool;
+    inv.command = cmd;
+    auto t0 = std::chrono::steady_clock::now();
+
+    // stderr do filho em um arquivo anônimo em memória (lido depois do término, sem pipe a drenar)
+    int err_fd = memfd_create("tool-stderr", MFD_CLOEXEC);
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (err_fd >= 0) posix_spawn_file_actions_adddup2(&actions, err_fd, STDERR_FILENO);
+
+    // posix_spawn + wait4 no lugar de system(): mesmo sh -c, mas o rusage do filho (somado ao dos
+    // descendentes que ele esperou) volta junto com o status
+    const char* argv[] = {"sh", "-c", cmd.c_str(), nullptr};
+    pid_t pid;
+    if (posix_spawn(&pid, "/bin/sh", &actions, nullptr, const_cast<char* const*>(argv), environ) == 0) {
+        // PID visível na introspecção enquanto a ferramenta roda
+        InFlightRequest* current = CurrentInFlight();
+        if (current) current->SetChild((int)pid, tool);
+        int status = 0;
+        struct rusage ru;
+        pid_t w;
+        do { w = wait4(pid, &status, 0, &ru); } while (w < 0 && errno == EINTR);
+        if (current) current->ClearChild();
+        if (w == pid) {
+            inv.status = status;
+            inv.usage.user_cpu = ToMicros(ru.ru_utime);
+            inv.usage.system_cpu = ToMicros(ru.ru_stime);
+            inv.usage.max_rss_kb = (uint64_t)ru.ru_maxrss;
+            inv.usage.voluntary_switches = (uint64_t)ru.ru_nvcsw;
+            inv.usage.involuntary_switches = (uint64_t)ru.ru_nivcsw;
+            inv.usage.block_in = (uint64_t)ru.ru_inblock;
+            inv.usage.block_out = (uint64_t)ru.ru_oublock;
+        }
+    }
+    inv.elapsed = std::chrono::steady_clock::now() - t0;
+    posix_spawn_file_actions_destroy(&actions);
+    if (err_fd >= 0) {
+        DrainStderr(err_fd, inv.stderr_tail);
+        close(err_fd);
+    }
+
+    if (t_tools) t_tools->push_back(inv);
+    if (g_tool_observer) g_tool_observer(inv);
+    return inv.status;
+}
+
+std::string DescribeToolUsage(const ToolInvocation& inv) {
+    const ToolUsage& u = inv.usage;
+    double usr = (double)u.user_cpu.count() / 1e6, sys = (double)u.system_cpu.count() / 1e6;
+    char buf[256];
+    std::snprintf(buf, sizeof(buf), "%s %.2fs cpu (%.2f usr + %.2f sys), %llu MB rss, %llu/%llu trocas, %llu/%llu blocos",
+                  inv.tool.c_str(), usr + sys, usr, sys, (unsigned long long)(u.max_rss_kb / 1024),
+                  (unsigned long long)u.voluntary_switches, (unsigned long long)u.involuntary_switches,
+                  (unsigned long long)u.block_in, (unsigned long long)u.block_out);
+    std::string out = buf;
+    if (inv.status != 0) out += ", status " + std::to_string(inv.status);
+    return out;
+}
+
+// Fallback comum: copia a entrada para a saída
+static bool CopyFallback(const fs::path& in, const fs::path& out) {
+    std::error_code ec;
+    fs::copy_file(in, out, fs::copy_options::overwrite_existing, ec);
+    return !ec;
+}
+
+std::string OperationName(const FileRequest& params) {
+    switch (params.parameters_case()) {
+        case FileRequest::kCompressPdfParams: return "CompressPDF";
+        case FileRequest::kConvertToTxtParams: return "ConvertToTXT";
+        case FileRequest::kConvertImageFormatParams: return "ConvertImageFormat";
+        case FileRequest::kResizeImageParams: return "ResizeImage";
+        case FileRequest::kResizeImageMultiParams: return "ResizeImageMulti";
+        case FileRequest::kPipelineParams: return "RunPipeline";
+        default: return "";
+    }
+}
+
+// Comprime PDF com Ghostscript
+static OperationResult CompressPDF(const std::string& fname, const fs::path& in, ScratchScope& scratch) {
+    OperationResult r;
+    std::string name = "out_compressed_" + fs::path(fname).stem().string() + ".pdf";
+    fs::path out = scratch.Path(name);
+
+    // Utiliza o comando do gs para comprimir pdf
+    if (CommandExists("gs")) {
+        std::string cmd = "gs -sDEVICE=pdfwrite -dCompatibilityLevel=1.4 -dPDFSETTINGS=/screen -dNOPAUSE -dQUIET -dBATCH -sOutputFile='"+out.string()+"' '"+in.string()+"'";
+        r.ok = (RunShell("gs", cmd) == 0); r.msg = r.ok?"PDF comprimido":"Falha na compressão (gs)";
+    } else {
+        // Fallback: copia como está
+        r.ok = CopyFallback(in, out); r.msg = r.ok?"Fallback: arquivo copiado":"Falha no fallback";
+    }
+    r.outputs.push_back({name, out});
+    return r;
+}
+
+// Extrai texto de PDF com pdftotext
+static OperationResult ConvertToTXT(const std::string& fname, const fs::path& in, ScratchScope& scratch) {
+    OperationResult r;
+    std::string name = fs::path(fname).stem().string() + ".txt";
+    fs::path out = scratch.Path(name);
+
+    if (CommandExists("pdftotext")) {
+        std::string cmd = "pdftotext '"+in.string()+"' '"+out.string()+"'";
+        r.ok = (RunShell("pdftotext", cmd)==0);
+        r.msg = r.ok?"Convertido para TXT":"Falha pdftotext";
+    } else { // Fallback: trata bytes como texto
+        r.ok = CopyFallback(in, out); r.msg = r.ok?"Fallback: bytes gravados em .txt":"Falha fallback";
+    }
+    r.outputs.push_back({name, out});
+    return r;
+}
+
+// Converte formato de imagem com ImageMagick
+static OperationResult ConvertImageFormat(const std::string& fname, const fs::path& in, ScratchScope& scratch, std::string out_ext) {
+    OperationResult r;
+    if (out_ext.empty()) out_ext = "png";
+    std::string name = fs::path(fname).stem().string() + "." + out_ext;
+    fs::path out = scratch.Path(name);
+
+    if (CommandExists("convert")) {
+        std::string cmd = "convert '"+in.string()+"' -strip '"+out.string()+"'";
+        r.ok=(RunShell("convert", cmd)==0);
+        r.msg = r.ok?"Imagem convertida":"Falha ImageMagick";
+    } else { // Fallback: copia como está
+        r.ok = CopyFallback(in, out);
+        r.msg = r.ok?"Fallback: cópia":"Falha fallback";
+    }
+    r.outputs.push_back({name, out});
+    return r;
+}
+
+// Redimensiona imagem com ImageMagick
+static OperationResult ResizeImage(const std::string& fname, const fs::path& in, ScratchScope& scratch, int width, int height) {
+    OperationResult r;
+    std::string size = std::to_string(width) + "x" + std::to_string(height);
+    std::string name = fs::path(fname).stem().string() + "_" + size + ".img";
+    fs::path out = scratch.Path(name);
+
+    if (CommandExists("convert")) {
+        std::string cmd = "convert '"+in.string()+"' -resize " + size + " '" + out.string() + "'";
+        r.ok=(RunShell("convert", cmd)==0);
+        r.msg = r.ok?"Imagem redimensionada":"Falha ImageMagick";
+    } else {  // Fallback: copia como está
+        r.ok = CopyFallback(in, out);
+        r.msg = r.ok?"Fallback: cópia":"Falha fallback";
+    }
+    r.outputs.push_back({name, out});
+    return r;
+}
+
+// Gera várias miniaturas com uma única decodificação (pirâmide por redução progressiva)
+static OperationResult ResizeImageMulti(const std::string& fname, const fs::path& in, ScratchScope& scratch, std::vector<std::pair<int,int>> sizes) {
+    OperationResult r;
+
+    // Ordena do maior para o menor (por área; empate pelas dimensões, para que tamanhos
+    // repetidos fiquem adjacentes) e remove tamanhos repetidos
+    std::sort(sizes.begin(), sizes.end(), [](const std::pair<int,int>& a, const std::pair<int,int>& b) {
+        long long area_a = (long long)a.first*a.second, area_b = (long long)b.first*b.second;
+        if (area_a != area_b) return area_a > area_b;
+        return a > b;
+    });
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+    // Define um arquivo de saída por tamanho (mesma extensão da entrada)
+    std::string ext = fs::path(fname).extension().string();
+    if (ext.empty()) ext = ".img";
+    for (const auto& sz : sizes) {
+        std::string name = fs::path(fname).stem().string() + "_" + std::to_string(sz.first) + "x" + std::to_string(sz.second) + ext;
+        r.outputs.push_back({name, scratch.Path(name)});
+    }
+
+    // Usa ImageMagick se disponível: decodifica uma única vez e gera a pirâmide
+    // reduzindo progressivamente a partir da saída anterior. Se um tamanho não cabe
+    // no anterior, volta à imagem original mantida em memória (mpr:src).
+    if (CommandExists("convert")) {
+        std::string cmd = "convert '"+in.string()+"' -write mpr:src";
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            bool fits = i > 0 && sizes[i].first <= sizes[i-1].first && sizes[i].second <= sizes[i-1].second;
+            if (i > 0 && !fits) cmd += " +delete mpr:src";
+            cmd += " -resize " + std::to_string(sizes[i].first) + "x" + std::to_string(sizes[i].second) + " -write '" + r.outputs[i].path.string() + "'";
+        }
+        cmd += " null:";
+        r.ok=(RunShell("convert", cmd)==0);
+        r.msg = r.ok?"Imagens redimensionadas":"Falha ImageMagick";
+    } else {  // Fallback: copia como está para cada tamanho
+        r.ok = true;
+        for (const auto& o : r.outputs) r.ok = CopyFallback(in, o.path) && r.ok;
+        r.msg = r.ok?"Fallback: cópia":"Falha fallback";
+    }
+    return r;
+}
+
+// Tipo de conteúdo que flui entre os passos do pipeline
+enum class ContentKind { Unknown, Pdf, Image, Text };
+
+static ContentKind KindOfExtension(std::string ext) {
+    for (auto& c : ext) c = (char)std::tolower((unsigned char)c);
+    if (ext == ".pdf") return ContentKind::Pdf;
+    if (ext == ".txt") return ContentKind::Text;
+    static const char* images[] = {".png", ".jpg", ".jpeg", ".webp", ".gif", ".bmp", ".tif", ".tiff"};
+    for (auto* e : images) if (ext == e) return ContentKind::Image;
+    return ContentKind::Unknown;
+}
+
+// Aceita apenas caracteres seguros para o formato usado na linha de comando
+static bool IsSafeFormat(const std::string& f) {
+    if (f.empty() || f.size() > 10) return false;
+    for (unsigned char c : f) if (!std::isalnum(c)) return false;
+    return true;
+}
+
+// Executa vários passos em uma única requisição. Cada passo lê da entrada padrão e escreve na
+// saída padrão, encadeados por pipes: os intermediários ficam em memória (nunca no storage) e só
+// o artefato final é gravado. Passos de imagem consecutivos viram um único convert (uma decodificação).
+static OperationResult RunPipeline(const std::string& fname, const fs::path& in, ScratchScope& scratch, const file_processor::PipelineRequest& params) {
+    const int MAX_STEPS = 16;
+    OperationResult r;
+    if (params.steps_size() == 0) { r.msg = "Pipeline vazio"; return r; }
+    if (params.steps_size() > MAX_STEPS) { r.msg = "Pipeline com mais de " + std::to_string(MAX_STEPS) + " passos"; return r; }
+
+    std::string stem = fs::path(fname).stem().string();
+    std::string ext = fs::path(fname).extension().string();
+    ContentKind kind = KindOfExtension(ext);
+
+    std::vector<std::string> stages;
+    std::string image_ops;          // Operações de imagem acumuladas para o mesmo convert
+    std::string image_format;       // Formato de saída do convert ("" = mantém o da entrada)
+    bool in_image_group = false;
+    bool fallback = false;
+
+    // Fecha o grupo de passos de imagem em um único estágio
+    auto flush_image = [&]() {
+        if (!in_image_group) return;
+        if (CommandExists("convert")) stages.push_back("convert -" + image_ops + " " + (image_format.empty() ? std::string("-") : image_format + ":-"));
+        else { stages.push_back("cat"); fallback = true; }
+        image_ops.clear(); image_format.clear(); in_image_group = false;
+    };
+
+    for (int i = 0; i < params.steps_size(); ++i) {
+        const PipelineStep& step = params.steps(i);
+        std::string pos = "passo " + std::to_string(i + 1);
+        switch (step.operation_case()) {
+            case PipelineStep::kConvertImageFormat:
+            case PipelineStep::kResizeImage: {
+                if (kind != ContentKind::Image && kind != ContentKind::Unknown) { r.msg = "Pipeline inválido: " + pos + " espera imagem"; return r; }
+                in_image_group = true;
+                if (step.has_convert_image_format()) {
+                    std::string f = step.convert_image_format().output_format();
+                    if (f.empty()) f = "png";
+                    if (!IsSafeFormat(f)) { r.msg = "Pipeline inválido: formato de " + pos; return r; }
+                    image_ops += " -strip";
+                    image_format = f;
+                    ext = "." + f;
+                } else {
+                    // Dimensões não informadas assumem 512
+                    int w = step.resize_image().width() > 0 ? step.resize_image().width() : 512;
+                    int h = step.resize_image().height() > 0 ? step.resize_image().height() : 512;
+                    std::string size = std::to_string(w) + "x" + std::to_string(h);
+                    image_ops += " -resize " + size;
+                    stem += "_" + size;
+                }
+                kind = ContentKind::Image;
+                break;
+            }
+            case PipelineStep::kCompressPdf:
+                if (kind != ContentKind::Pdf && kind != ContentKind::Unknown) { r.msg = "Pipeline inválido: " + pos + " espera PDF"; return r; }
+                flush_image();
+                if (CommandExists("gs")) stages.push_back("gs -sDEVICE=pdfwrite -dCompatibilityLevel=1.4 -dPDFSETTINGS=/screen -dNOPAUSE -dQUIET -dBATCH -sOutputFile=- -");
+                else { stages.push_back("cat"); fallback = true; }
+                stem = "out_compressed_" + stem;
+                ext = ".pdf";
+                kind = ContentKind::Pdf;
+                break;
+            case PipelineStep::kConvertToTxt:
+                if (kind != ContentKind::Pdf && kind != ContentKind::Unknown) { r.msg = "Pipeline inválido: " + pos + " espera PDF"; return r; }
+                flush_image();
+                if (CommandExists("pdftotext")) stages.push_back("pdftotext - -");
+                else { stages.push_back("cat"); fallback = true; }
+                ext = ".txt";
+                kind = ContentKind::Text;
+                break;
+            default:
+                r.msg = "Pipeline inválido: " + pos + " sem operação";
+                return r;
+        }
+    }
+    flush_image();
+
+    // Só o artefato final é gravado no storage
+    std::string name = stem + (ext.empty() ? ".img" : ext);
+    fs::path out = scratch.Path(name);
+    // O sh só devolve o status do último estágio: cada estágio grava "<índice> <status>" no
+    // descritor 3 (um arquivo do scratch), fechado para as próprias ferramentas
+    fs::path status_path = scratch.Path("pipeline.status");
+    std::string cmd = "{ ";
+    for (size_t i = 0; i < stages.size(); ++i) {
+        cmd += (i == 0 ? "" : " | ") + std::string("{ ") + stages[i] + " 3>&-";
+        if (i == 0) cmd += " < '" + in.string() + "'";
+        cmd += "; echo " + std::to_string(i) + " $? >&3; }";
+    }
+    cmd += " > '" + out.string() + "'; } 3> '" + status_path.string() + "'";
+    int status = RunShell("pipeline", cmd);
+
+    // Todos os estágios precisam ter terminado com 0; um estágio que falha no meio pode
+    // deixar saída parcial (não vazia) para os seguintes
+    std::vector<int> stage_status(stages.size(), -1);
+    {
+        std::ifstream st(status_path);
+        size_t idx;
+        int code;
+        while (st >> idx >> code) if (idx < stage_status.size()) stage_status[idx] = code;
+    }
+    size_t failed = stages.size();
+    for (size_t i = 0; i < stages.size() && failed == stages.size(); ++i) if (stage_status[i] != 0) failed = i;
+
+    // Saída vazia também é falha, mesmo com todos os status 0
+    std::error_code ec;
+    r.ok = status == 0 && failed == stages.size() && fs::file_size(out, ec) > 0 && !ec;
+    if (r.ok) r.msg = fallback ? "Fallback: pipeline com cópia (" + std::to_string(params.steps_size()) + " passos)" : "Pipeline concluído (" + std::to_string(params.steps_size()) + " passos)";
+    else if (failed < stages.size()) r.msg = "Falha no pipeline (" + stages[failed].substr(0, stages[failed].find(' ')) + ": status " + std::to_string(stage_status[failed]) + ")";
+    else r.msg = "Falha no pipeline";
+    r.outputs.push_back({name, out});
+    return r;
+}
+
+static OperationResult Dispatch(const FileRequest& params, const std::string& fname, const fs::path& in, ScratchScope& scratch) {
+    switch (params.parameters_case()) {
+        case FileRequest::kCompressPdfParams:
+            return CompressPDF(fname, in, scratch);
+        case FileRequest::kConvertToTxtParams:
+            return ConvertToTXT(fname, in, scratch);
+        case FileRequest::kConvertImageFormatParams:
+            return ConvertImageFormat(fname, in, scratch, params.convert_image_format_params().output_format());
+        case FileRequest::kResizeImageParams: {
+            // Dimensões não informadas assumem 512
+            int width = params.resize_image_params().width() > 0 ? params.resize_image_params().width() : 512;
+            int height = params.resize_image_params().height() > 0 ? params.resize_image_params().height() : 512;
+            return ResizeImage(fname, in, scratch, width, height);
+        }
+        case FileRequest::kResizeImageMultiParams: {
+            std::vector<std::pair<int,int>> sizes;
+            for (const auto& sz : params.resize_image_multi_params().sizes())
+                if (sz.width()>0 && sz.height()>0) sizes.emplace_back(sz.width(), sz.height());
+            if (sizes.empty()) return {false, "Parâmetros ausentes", {}, {}};
+            return ResizeImageMulti(fname, in, scratch, std::move(sizes));
+        }
+        case FileRequest::kPipelineParams:
+            return RunPipeline(fname, in, scratch, params.pipeline_params());
+        default:
+            return {false, "Parâmetros ausentes", {}, {}};
+    }
+}
+
+OperationResult RunOperation(const FileRequest& params, const std::string& fname, const fs::path& in, ScratchScope& scratch) {
+    // RunShell registra cada execução em tools enquanto a operação roda
+    std::vector<ToolInvocation> tools;
+    std::vector<ToolInvocation>* prev = t_tools;
+    t_tools = &tools;
+    OperationResult r = Dispatch(params, fname, in, scratch);
+    t_tools = prev;
+    r.tools = std::move(tools);
+    return r;
+}
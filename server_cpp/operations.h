@@ -0,0 +1,85 @@
+/*
+ * Transformações de arquivos executadas pelo servidor (motor das operações).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada operação recebe o arquivo de entrada já persistido e cria suas saídas através
+ * do ScratchScope da requisição. As RPCs individuais e a ProcessBatch usam as mesmas funções.
+ */
+
+#ifndef SERVER_CPP_OPERATIONS_H
+#define SERVER_CPP_OPERATIONS_H
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../config_cpp/file_processor.pb.h"
+
+#include "scratch.h"
+
+// Arquivo produzido por uma operação
+struct OperationOutput {
+    std::string name;                   // Nome enviado ao cliente (FileResponse.file_name)
+    std::filesystem::path path;         // Caminho no storage do servidor
+};
+
+// Recursos consumidos por uma ferramenta externa (rusage do wait4: o processo e os
+// descendentes que ele esperou, como o gs chamado pelo sh)
+struct ToolUsage {
+    std::chrono::microseconds user_cpu{0};
+    std::chrono::microseconds system_cpu{0};
+    uint64_t max_rss_kb = 0;                    // Maior memória residente entre os processos
+    uint64_t voluntary_switches = 0;            // Trocas de contexto por espera (E/S, locks)
+    uint64_t involuntary_switches = 0;          // Preempções
+    uint64_t block_in = 0;                      // Operações de leitura/escrita de bloco no disco
+    uint64_t block_out = 0;
+};
+
+// Execução de uma ferramenta externa (uma chamada de RunShell)
+struct ToolInvocation {
+    std::string tool;                   // Nome curto ("gs", "convert", "pdftotext", "pipeline")
+    std::string command;                // Linha de comando executada
+    int status = -1;                    // Status do wait4 (0 = sucesso; -1 = não executou)
+    std::chrono::nanoseconds elapsed{0};
+    ToolUsage usage;
+    std::string stderr_tail;            // Final da saída de erro (até TOOL_STDERR_TAIL bytes)
+};
+
+// Quanto da saída de erro de cada ferramenta fica guardado (o restante só vai para o stderr do servidor)
+const size_t TOOL_STDERR_TAIL = 4096;
+
+// Resultado de uma operação
+struct OperationResult {
+    bool ok = false;
+    std::string msg;
+    std::vector<OperationOutput> outputs;
+    std::vector<ToolInvocation> tools;  // Ferramentas executadas, na ordem
+};
+
+// Verifica se comando existe no sistema
+bool CommandExists(const std::string& cmd);
+
+// Chamado ao fim de cada execução de ferramenta, na thread da requisição.
+// Definido uma vez, antes de o servidor aceitar requisições.
+using ToolObserver = std::function<void(const ToolInvocation& inv)>;
+void SetToolObserver(ToolObserver observer);
+
+// Executa comando shell (sh -c) e espera com wait4, medindo os recursos usados e capturando a
+// saída de erro (repassada ao stderr do servidor, como antes, e guardada no fim); a execução vai
+// para o observador e para o OperationResult da RunOperation em andamento na thread.
+// Retorna o status do wait4 (0 = sucesso).
+int RunShell(const std::string& tool, const std::string& cmd);
+
+// Resumo para o log: "gs 1.20s cpu (1.10 usr + 0.10 sys), 85 MB rss, 12/3 trocas, 0/2048 blocos"
+std::string DescribeToolUsage(const ToolInvocation& inv);
+
+// Nome do serviço correspondente aos parâmetros (ex.: "CompressPDF"); vazio se não houver parâmetros
+std::string OperationName(const file_processor::FileRequest& params);
+
+// Executa a operação indicada em params sobre o arquivo de entrada in (fname é o nome original)
+OperationResult RunOperation(const file_processor::FileRequest& params, const std::string& fname,
+                             const std::filesystem::path& in, ScratchScope& scratch);
+
+#endif  // SERVER_CPP_OPERATIONS_H
@@ -0,0 +1,190 @@
+/*
+ * Implementação do log binário de operações.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "oplog.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+static const char OPLOG_MAGIC[8] = {'F', 'P', 'O', 'P', 'L', 'O', 'G', '\0'};
+
+// Nomes na ordem do OpCode
+static const char* const OP_NAMES[OP_CODE_COUNT] = {
+    "unknown", "CompressPDF", "ConvertToTXT", "ConvertImageFormat", "ResizeImage", "ResizeImageMulti",
+    "RunPipeline", "ProcessBatch", "UploadChunks", "UploadDelta", "FetchOutput", "FetchResult",
+};
+
+OpCode OpCodeOf(const std::string& operation, OpMode& mode) {
+    std::string name = operation;
+    mode = OPMODE_STREAM;
+    size_t slash = name.find('/');
+    if (slash != std::string::npos) {
+        std::string suffix = name.substr(slash + 1);
+        if (suffix == "job") mode = OPMODE_JOB;
+        else if (suffix == "local") mode = OPMODE_LOCAL;
+        name.resize(slash);
+    }
+    for (int i = 1; i < OP_CODE_COUNT; i++) {
+        if (name == OP_NAMES[i]) return (OpCode)i;
+    }
+    return OP_UNKNOWN;
+}
+
+const char* OpCodeName(uint16_t op) {
+    return op < OP_CODE_COUNT ? OP_NAMES[op] : "unknown";
+}
+
+const char* OpModeName(uint8_t mode) {
+    switch (mode) {
+        case OPMODE_STREAM: return "stream";
+        case OPMODE_JOB: return "job";
+        case OPMODE_LOCAL: return "local";
+        default: return "?";
+    }
+}
+
+static uint64_t NowMicros() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+OpLog::OpLog(OpLogConfig cfg) : cfg_(std::move(cfg)) {
+    std::error_code ec;
+    fs::create_directories(cfg_.dir, ec);
+    writer_ = std::thread(&OpLog::Loop, this);
+}
+
+OpLog::~OpLog() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) writer_.join();
+    Flush();
+    if (fd_ >= 0) close(fd_);
+}
+
+void OpLog::Append(const OpLogRecord& r) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (pending_.size() >= cfg_.max_pending) { dropped_++; return; }
+    pending_.push_back(r);
+}
+
+void OpLog::Loop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!stop_) {
+        cv_.wait_for(lk, cfg_.flush_interval, [this] { return stop_; });
+        lk.unlock();
+        Flush();
+        lk.lock();
+    }
+}
+
+bool OpLog::OpenDay(const std::string& path) {
+    if (fd_ >= 0) close(fd_);
+    fd_ = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    path_ = path;
+    if (fd_ < 0) return false;
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0) return false;
+    uint64_t size = (uint64_t)st.st_size;
+    if (size < sizeof(OpLogHeader)) {
+        // Arquivo novo (ou cabeçalho truncado): recomeça
+        if (size > 0 && ftruncate(fd_, 0) != 0) return false;
+        OpLogHeader h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, OPLOG_MAGIC, sizeof(h.magic));
+        h.version = OPLOG_VERSION;
+        h.record_size = sizeof(OpLogRecord);
+        h.created_us = NowMicros();
+        return write(fd_, &h, sizeof(h)) == (ssize_t)sizeof(h);
+    }
+
+    // Registro parcial de uma queda anterior: descartado para manter o alinhamento
+    uint64_t tail = (size - sizeof(OpLogHeader)) % sizeof(OpLogRecord);
+    if (tail != 0 && ftruncate(fd_, (off_t)(size - tail)) != 0) return false;
+    return true;
+}
+
+void OpLog::Flush() {
+    std::vector<OpLogRecord> records;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        records.swap(pending_);
+    }
+    if (records.empty()) return;
+
+    // Um arquivo por dia (UTC), pelo momento da gravação
+    time_t now = std::time(nullptr);
+    struct tm tm;
+    gmtime_r(&now, &tm);
+    char name[32];
+    std::strftime(name, sizeof(name), "oplog-%Y%m%d.bin", &tm);
+    std::string path = (fs::path(cfg_.dir) / name).string();
+    if ((path != path_ || fd_ < 0) && !OpenDay(path)) {
+        dropped_ += records.size();
+        return;
+    }
+
+    const char* p = reinterpret_cast<const char*>(records.data());
+    size_t left = records.size() * sizeof(OpLogRecord);
+    while (left > 0) {
+        ssize_t n = write(fd_, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            dropped_ += (left + sizeof(OpLogRecord) - 1) / sizeof(OpLogRecord);
+            // Reabre na próxima rodada (e corta o registro parcial)
+            close(fd_);
+            fd_ = -1;
+            return;
+        }
+        p += n;
+        left -= (size_t)n;
+    }
+}
+
+MappedOpLog::~MappedOpLog() {
+    if (map_) munmap(map_, size_);
+}
+
+bool MappedOpLog::Open(const std::string& path, std::string& err) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { err = path + ": " + std::strerror(errno); return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(OpLogHeader)) {
+        close(fd);
+        err = path + ": arquivo sem cabeçalho";
+        return false;
+    }
+    size_ = (size_t)st.st_size;
+    map_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map_ == MAP_FAILED) {
+        map_ = nullptr;
+        err = path + ": mmap: " + std::strerror(errno);
+        return false;
+    }
+    madvise(map_, size_, MADV_SEQUENTIAL);
+
+    const OpLogHeader* h = static_cast<const OpLogHeader*>(map_);
+    if (std::memcmp(h->magic, OPLOG_MAGIC, sizeof(OPLOG_MAGIC)) != 0) { err = path + ": não é um oplog"; return false; }
+    if (h->version != OPLOG_VERSION || h->record_size != sizeof(OpLogRecord)) {
+        err = path + ": versão " + std::to_string(h->version) + " não suportada";
+        return false;
+    }
+    records_ = reinterpret_cast<const OpLogRecord*>(static_cast<const char*>(map_) + sizeof(OpLogHeader));
+    count_ = (size_ - sizeof(OpLogHeader)) / sizeof(OpLogRecord);
+    return true;
+}
@@ -0,0 +1,140 @@
+/*
+ * Log binário de operações (opcional, OPLOG_DIR) e leitura por mmap.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada requisição terminada vira um registro de 64 bytes (timestamp, operação, modo, tamanhos,
+ * durações por fase, status e recursos das ferramentas), acrescentado a um arquivo por dia
+ * (oplog-AAAAMMDD.bin, UTC). O arquivo começa com um cabeçalho de 64 bytes; os registros são
+ * little-endian e alinhados, então o leitor mapeia o arquivo e percorre um vetor de structs.
+ * A gravação é feita por uma thread em lote (Append só copia o registro para um buffer); um
+ * registro parcial deixado por uma queda é descartado na reabertura.
+ * O relatório offline fica em server_cpp/tools/oplog_report.cpp (scripts/oplog_report.sh).
+ */
+
+#ifndef SERVER_CPP_OPLOG_H
+#define SERVER_CPP_OPLOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Códigos gravados em disco: não reordenar (novos códigos vão no fim)
+enum OpCode : uint16_t {
+    OP_UNKNOWN = 0,
+    OP_COMPRESS_PDF = 1,
+    OP_CONVERT_TO_TXT = 2,
+    OP_CONVERT_IMAGE_FORMAT = 3,
+    OP_RESIZE_IMAGE = 4,
+    OP_RESIZE_IMAGE_MULTI = 5,
+    OP_RUN_PIPELINE = 6,
+    OP_PROCESS_BATCH = 7,
+    OP_UPLOAD_CHUNKS = 8,
+    OP_UPLOAD_DELTA = 9,
+    OP_FETCH_OUTPUT = 10,
+    OP_FETCH_RESULT = 11,
+    OP_CODE_COUNT
+};
+
+// Como a operação chegou: stream gRPC, job assíncrono ou entrega local por descritor
+enum OpMode : uint8_t { OPMODE_STREAM = 0, OPMODE_JOB = 1, OPMODE_LOCAL = 2 };
+
+// Fases gravadas (mesma ordem do LatencyPhase, sem o total)
+const int OPLOG_PHASES = 5;
+
+struct OpLogRecord {
+    uint64_t time_us;                   // Fim da requisição (microssegundos desde 1970, UTC)
+    uint64_t input_bytes;
+    uint64_t output_bytes;
+    uint32_t total_us;                  // Durações saturam em ~71 minutos
+    uint32_t phase_us[OPLOG_PHASES];    // Recebimento, gravação, fila, execução, envio
+    uint32_t tool_cpu_us;               // CPU (usuário + sistema) das ferramentas externas
+    uint32_t tool_max_rss_kb;           // Maior memória residente entre as ferramentas
+    uint16_t op;                        // OpCode
+    uint8_t mode;                       // OpMode
+    uint8_t ok;                         // 1 = sucesso
+    uint8_t tool_status;                // Primeira ferramenta com falha: código de saída, 128 + sinal, ou 255 se não executou
+    uint8_t tool_count;
+    uint16_t reserved;
+};
+static_assert(sizeof(OpLogRecord) == 64, "registro do oplog deve ter 64 bytes");
+
+struct OpLogHeader {
+    char magic[8];                      // "FPOPLOG\0"
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t created_us;
+    uint8_t reserved[40];
+};
+static_assert(sizeof(OpLogHeader) == 64, "cabeçalho do oplog deve ter 64 bytes");
+
+const uint32_t OPLOG_VERSION = 1;
+
+// "CompressPDF", "CompressPDF/job", "UploadChunks"... -> código e modo (OP_UNKNOWN se não conhecido)
+OpCode OpCodeOf(const std::string& operation, OpMode& mode);
+const char* OpCodeName(uint16_t op);
+const char* OpModeName(uint8_t mode);
+
+// Configuração do gravador
+struct OpLogConfig {
+    std::string dir;
+    std::chrono::milliseconds flush_interval{1000};
+    size_t max_pending = 1 << 20;       // Registros acumulados além disso são descartados
+};
+
+class OpLog {
+public:
+    explicit OpLog(OpLogConfig cfg);
+    ~OpLog();   // Grava o que ainda está pendente
+
+    OpLog(const OpLog&) = delete;
+    OpLog& operator=(const OpLog&) = delete;
+
+    void Append(const OpLogRecord& r);
+
+    uint64_t dropped() const { return dropped_; }
+
+private:
+    void Loop();
+    void Flush();
+    bool OpenDay(const std::string& path);
+
+    OpLogConfig cfg_;
+    int fd_ = -1;
+    std::string path_;                  // Arquivo aberto (muda na virada do dia)
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::vector<OpLogRecord> pending_;
+    bool stop_ = false;
+    std::atomic<uint64_t> dropped_{0};
+    std::thread writer_;
+};
+
+// Arquivo do oplog mapeado em memória (somente leitura)
+class MappedOpLog {
+public:
+    MappedOpLog() = default;
+    ~MappedOpLog();
+
+    MappedOpLog(const MappedOpLog&) = delete;
+    MappedOpLog& operator=(const MappedOpLog&) = delete;
+
+    // Mapeia e confere o cabeçalho; um registro final incompleto é ignorado
+    bool Open(const std::string& path, std::string& err);
+
+    const OpLogRecord* records() const { return records_; }
+    size_t count() const { return count_; }
+
+private:
+    void* map_ = nullptr;
+    size_t size_ = 0;
+    const OpLogRecord* records_ = nullptr;
+    size_t count_ = 0;
+};
+
+#endif  // SERVER_CPP_OPLOG_H
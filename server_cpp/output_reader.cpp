@@ -0,0 +1,53 @@
+/*
+ * Implementação da leitura das saídas.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "output_reader.h"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+OutputReader::~OutputReader() {
+    if (map_) munmap(const_cast<char*>(map_), size_);
+    if (fd_ >= 0) close(fd_);
+}
+
+bool OutputReader::Open(const std::string& path, uint64_t offset) {
+    fd_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd_ < 0 || fstat(fd_, &st) != 0) return false;
+    size_ = (uint64_t)st.st_size;
+
+    // Readahead agressivo a partir do trecho pedido (vale também para o mmap, que usa o mesmo cache)
+    if (offset < size_) posix_fadvise(fd_, (off_t)offset, 0, POSIX_FADV_SEQUENTIAL);
+    if (size_ == 0) return true;
+
+    void* p = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) return true;
+    map_ = static_cast<const char*>(p);
+    madvise(p, size_, MADV_SEQUENTIAL);
+    return true;
+}
+
+bool OutputReader::Read(uint64_t offset, size_t n, std::string& dst) {
+    if (offset > size_ || n > size_ - offset) return false;
+    if (map_) {
+        dst.assign(map_ + offset, n);
+        return true;
+    }
+
+    // Sem mapeamento: o kernel copia direto para o buffer da mensagem
+    dst.resize(n);
+    size_t done = 0;
+    while (done < n) {
+        ssize_t r = pread(fd_, &dst[done], n - done, (off_t)(offset + done));
+        if (r <= 0) return false;
+        done += (size_t)r;
+    }
+    return true;
+}
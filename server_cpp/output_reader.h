@@ -0,0 +1,40 @@
+/*
+ * Leitura das saídas enviadas ao cliente (StreamFileRange).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * O arquivo é mapeado em memória (mmap, leitura sequencial sinalizada com madvise) e cada chunk
+ * é copiado das páginas do cache direto para o campo da mensagem: uma única cópia em espaço de
+ * usuário, sem buffer intermediário. Sem mmap (arquivo vazio ou sistema de arquivos que não
+ * permite), usa pread direto no campo da mensagem com posix_fadvise(SEQUENTIAL).
+ */
+
+#ifndef SERVER_CPP_OUTPUT_READER_H
+#define SERVER_CPP_OUTPUT_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class OutputReader {
+public:
+    OutputReader() = default;
+    ~OutputReader();
+
+    OutputReader(const OutputReader&) = delete;
+    OutputReader& operator=(const OutputReader&) = delete;
+
+    // Abre o arquivo e sinaliza ao kernel a leitura sequencial a partir de offset
+    bool Open(const std::string& path, uint64_t offset = 0);
+
+    uint64_t size() const { return size_; }
+
+    // Substitui o conteúdo de dst por n bytes a partir de offset
+    bool Read(uint64_t offset, size_t n, std::string& dst);
+
+private:
+    int fd_ = -1;
+    uint64_t size_ = 0;
+    const char* map_ = nullptr;
+};
+
+#endif  // SERVER_CPP_OUTPUT_READER_H
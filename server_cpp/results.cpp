@@ -0,0 +1,64 @@
+/*
+ * Implementação das saídas retidas.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "results.h"
+
+#include <fstream>
+
+#include "crc32c.h"
+
+namespace fs = std::filesystem;
+
+fs::path ResultStore::DataPath(const std::string& handle) {
+    return storage_.ShardFor(handle) / (handle + ".out");
+}
+
+fs::path ResultStore::MetaPath(const std::string& handle) {
+    return storage_.ShardFor(handle) / (handle + ".meta");
+}
+
+bool ResultStore::Retain(const fs::path& src, const std::string& name, ResultInfo& info) {
+    std::error_code ec;
+    info.handle = RandomId();
+    info.name = name;
+    info.size = fs::file_size(src, ec);
+    if (ec) return false;
+
+    // Digest calculado uma vez aqui; cada envio da saída (inclusive FetchOutput) o repete
+    info.has_crc32c = Crc32cFile(src, info.crc32c);
+
+    // Metadados antes do conteúdo: um .out sem .meta nunca fica visível
+    {
+        std::ofstream meta(MetaPath(info.handle), std::ios::trunc);
+        if (!(meta << info.name << "\n")) return false;
+        if (info.has_crc32c && !(meta << info.crc32c << "\n")) return false;
+    }
+    fs::rename(src, DataPath(info.handle), ec);
+    if (ec == std::errc::cross_device_link) {
+        // Scratch em outro sistema de arquivos (tmpfs): copia e remove o original
+        fs::copy_file(src, DataPath(info.handle), fs::copy_options::overwrite_existing, ec);
+        std::error_code rec;
+        if (!ec) fs::remove(src, rec);
+    }
+    if (ec) {
+        fs::remove(MetaPath(info.handle), ec);
+        return false;
+    }
+    return true;
+}
+
+bool ResultStore::Lookup(const std::string& handle, ResultInfo& info) {
+    if (!IsRandomId(handle)) return false;
+
+    std::ifstream meta(MetaPath(handle));
+    if (!meta || !std::getline(meta, info.name)) return false;
+    info.has_crc32c = (bool)(meta >> info.crc32c);
+
+    std::error_code ec;
+    info.size = fs::file_size(DataPath(handle), ec);
+    if (ec) return false;
+    info.handle = handle;
+    return true;
+}
@@ -0,0 +1,49 @@
+/*
+ * Saídas retidas: cada arquivo produzido fica disponível por um result_handle.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * A saída é movida (rename, sem cópia) para o shard do handle:
+ *  - <handle>.out: conteúdo.
+ *  - <handle>.meta: nome enviado ao cliente e CRC32C do conteúdo.
+ * FetchOutput lê intervalos arbitrários desses arquivos, permitindo retomar um download
+ * interrompido ou baixar partes em paralelo sem refazer a transformação. Expiram pelo TTL.
+ */
+
+#ifndef SERVER_CPP_RESULTS_H
+#define SERVER_CPP_RESULTS_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "storage_lifecycle.h"
+
+// Saída retida
+struct ResultInfo {
+    std::string handle;
+    std::string name;
+    uint64_t size = 0;
+    bool has_crc32c = false;
+    uint32_t crc32c = 0;        // CRC32C do conteúdo (enviado como output_crc32c)
+};
+
+class ResultStore {
+public:
+    explicit ResultStore(StorageLifecycle& storage) : storage_(storage) {}
+
+    // Move src para o storage de resultados; info recebe o handle gerado
+    bool Retain(const std::filesystem::path& src, const std::string& name, ResultInfo& info);
+
+    // Carrega a saída retida (false se não existe ou expirou)
+    bool Lookup(const std::string& handle, ResultInfo& info);
+
+    // Caminho do conteúdo de uma saída retida
+    std::filesystem::path DataPath(const std::string& handle);
+
+private:
+    std::filesystem::path MetaPath(const std::string& handle);
+
+    StorageLifecycle& storage_;
+};
+
+#endif  // SERVER_CPP_RESULTS_H
@@ -0,0 +1,84 @@
+/*
+ * Implementação dos arquivos temporários das requisições.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "scratch.h"
+
+#include <algorithm>
+
+#include <linux/magic.h>
+#include <sys/mman.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+bool ParseScratchBackend(const std::string& name, ScratchBackend& backend) {
+    if (name == "disk") backend = ScratchBackend::DISK;
+    else if (name == "tmpfs") backend = ScratchBackend::TMPFS;
+    else if (name == "memfd") backend = ScratchBackend::MEMFD;
+    else return false;
+    return true;
+}
+
+const char* ScratchBackendName(ScratchBackend backend) {
+    switch (backend) {
+        case ScratchBackend::TMPFS: return "tmpfs";
+        case ScratchBackend::MEMFD: return "memfd";
+        default: return "disk";
+    }
+}
+
+bool IsMemoryFilesystem(const fs::path& dir) {
+    struct statfs st;
+    if (statfs(dir.c_str(), &st) != 0) return false;
+    return st.f_type == TMPFS_MAGIC || st.f_type == RAMFS_MAGIC;
+}
+
+ScratchScope::ScratchScope(ScratchStorage& scratch) : scratch_(scratch) {
+    std::string id = RandomId();
+    dir_ = scratch.files().ShardFor(id) / id;
+    std::error_code ec;
+    fs::create_directory(dir_, ec);
+}
+
+ScratchScope::~ScratchScope() {
+    for (auto& p : files_) {
+        std::error_code ec;
+        fs::remove(p, ec);
+        scratch_.files().Unpin(p);
+    }
+    for (int fd : fds_) close(fd);
+
+    // Só sai se estiver vazio (um arquivo mantido com Keep fica para o varredor)
+    std::error_code ec;
+    fs::remove(dir_, ec);
+}
+
+fs::path ScratchScope::Path(const std::string& name) {
+    // Usa apenas o nome do arquivo, impedindo que a requisição escreva fora do seu diretório
+    fs::path p = dir_ / fs::path(name).filename();
+    scratch_.files().Pin(p);
+    files_.push_back(p);
+    return p;
+}
+
+fs::path ScratchScope::Anonymous(const std::string& name, uint64_t size) {
+    const ScratchConfig& cfg = scratch_.config();
+    if (cfg.backend != ScratchBackend::MEMFD || size > cfg.memfd_max_bytes) return Path(name);
+
+    // O nome aparece só em /proc/<pid>/fd (diagnóstico); sem memfd cai no arquivo com nome.
+    // As ferramentas são processos filhos: abrem o caminho do pid do servidor, não /proc/self.
+    int fd = memfd_create(fs::path(name).filename().c_str(), MFD_CLOEXEC);
+    if (fd < 0) return Path(name);
+    fds_.push_back(fd);
+    return fs::path("/proc") / std::to_string(getpid()) / "fd" / std::to_string(fd);
+}
+
+void ScratchScope::Keep(const fs::path& p) {
+    auto it = std::find(files_.begin(), files_.end(), p);
+    if (it == files_.end()) return;
+    scratch_.files().Unpin(p);
+    files_.erase(it);
+}
@@ -0,0 +1,85 @@
+/*
+ * Arquivos temporários das requisições (entradas recebidas e saídas das ferramentas).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Backends intercambiáveis (SCRATCH_BACKEND):
+ *  - disk: shards no diretório do storage (padrão).
+ *  - tmpfs: shards em um diretório em memória (SCRATCH_DIR, padrão /dev/shm/projeto_grpc), com
+ *    o mesmo TTL e limite do storage; a requisição inteira roda sem tocar o disco.
+ *  - memfd: a entrada recebida vira um arquivo anônimo (memfd_create) entregue às ferramentas
+ *    por /proc/<pid>/fd/N; acima de SCRATCH_MEMFD_MAX_MB vai para os shards do disco. As saídas
+ *    continuam com nome, pois as ferramentas escolhem o formato pela extensão.
+ * Os objetos persistentes (uploads, resultados, jobs) ficam sempre no storage em disco.
+ *
+ * Cada requisição tem um diretório próprio (<shard>/<id aleatório>/), então requisições
+ * simultâneas com o mesmo nome de arquivo nunca compartilham caminhos. As saídas só saem dele
+ * por rename atômico (ResultStore::Retain) ou pelo descritor (entrega local).
+ */
+
+#ifndef SERVER_CPP_SCRATCH_H
+#define SERVER_CPP_SCRATCH_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "storage_lifecycle.h"
+
+enum class ScratchBackend { DISK, TMPFS, MEMFD };
+
+// Configuração do scratch
+struct ScratchConfig {
+    ScratchBackend backend = ScratchBackend::DISK;
+    uint64_t memfd_max_bytes = 64ULL * 1024 * 1024;  // Maior entrada mantida em memfd
+};
+
+// Converte "disk", "tmpfs" ou "memfd"; false se desconhecido
+bool ParseScratchBackend(const std::string& name, ScratchBackend& backend);
+
+const char* ScratchBackendName(ScratchBackend backend);
+
+// Verifica se o diretório está em um sistema de arquivos em memória (tmpfs/ramfs)
+bool IsMemoryFilesystem(const std::filesystem::path& dir);
+
+// Onde ficam os temporários: os arquivos com nome vão para files (storage em disco ou tmpfs)
+class ScratchStorage {
+public:
+    ScratchStorage(StorageLifecycle& files, ScratchConfig cfg) : files_(files), cfg_(cfg) {}
+
+    StorageLifecycle& files() { return files_; }
+    const ScratchConfig& config() const { return cfg_; }
+
+private:
+    StorageLifecycle& files_;
+    ScratchConfig cfg_;
+};
+
+// Arquivos temporários de uma requisição; removidos (ou fechados, no caso de memfd) no destrutor,
+// junto com o diretório da requisição
+class ScratchScope {
+public:
+    explicit ScratchScope(ScratchStorage& scratch);
+    ~ScratchScope();
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    // Caminho de um arquivo com nome dentro do diretório da requisição (registrado para limpeza)
+    std::filesystem::path Path(const std::string& name);
+
+    // Caminho para um arquivo de size bytes que só é lido pelo nome do caminho (entrada da
+    // operação): memfd no backend memfd, arquivo com nome nos demais ou acima do limite
+    std::filesystem::path Anonymous(const std::string& name, uint64_t size);
+
+    // Mantém o arquivo após o fim da requisição (passa a ser responsabilidade do varredor)
+    void Keep(const std::filesystem::path& p);
+
+private:
+    ScratchStorage& scratch_;
+    std::filesystem::path dir_;
+    std::vector<std::filesystem::path> files_;
+    std::vector<int> fds_;              // memfds abertos pela requisição
+};
+
+#endif  // SERVER_CPP_SCRATCH_H
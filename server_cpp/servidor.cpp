@@ -4,9 +4,29 @@
  *
  * Fluxo geral:
  *  - Recebe stream de FileRequest (primeiro com parâmetros, demais com chunks do arquivo).
- *  - Persiste o arquivo recebido em server_cpp/storage/.
+ *  - Persiste o arquivo recebido em um shard de server_cpp/storage/ (removido ao fim da requisição).
  *  - Executa a transformação solicitada (usando ferramentas externas quando disponíveis).
  *  - Envia stream de FileResponse contendo os chunks do arquivo de saída e mensagens de status.
+ *  - RunPipeline encadeia operações sem gravar os intermediários no storage.
+ *  - ProcessBatch multiplexa vários arquivos (identificados por file_id) em um único stream.
+ *  - Uploads retomáveis (StartUpload/UploadChunks/QueryUpload) gravam a entrada por offset;
+ *    depois a operação é chamada com upload_id no lugar do conteúdo.
+ *  - Uploads concluídos servem de base para uploads por delta (GetSignatures/UploadDelta), que
+ *    enviam só os trechos alterados de um arquivo já enviado antes.
+ *  - Cada saída fica retida sob um result_handle; FetchOutput devolve qualquer intervalo dela.
+ *  - Jobs assíncronos (SubmitJob/GetJobStatus/FetchResult) executam de uma fila persistida.
+ *  - Respostas com arquivos usam compressão gRPC por chamada, desligada por mensagem para
+ *    conteúdo já comprimido.
+ *  - O tamanho dos chunks é negociado no início da chamada (metadados) e adaptado à vazão.
+ *  - Ouve em um ou mais endereços: TCP (host:porta) e/ou socket Unix (unix:/caminho) para clientes
+ *    no mesmo host.
+ *  - Clientes no mesmo host podem passar descritores de arquivo em vez dos bytes
+ *    (LOCAL_HANDOFF_SOCKET; ver fd_handoff.h).
+ *  - Chunks podem trazer CRC32C (verificado no recebimento); cada saída enviada leva o CRC32C
+ *    por chunk e o da saída inteira na última mensagem, para o cliente rebuscar só o trecho corrompido.
+ *  - Métricas no formato do Prometheus em GET /metrics (METRICS_ADDRESS; ver metrics.h).
+ *  - Tracing: o contexto do cliente chega no metadado traceparent; fases e ferramentas viram spans
+ *    gravados em OTLP-JSON (TRACE_DIR; ver tracing.h).
  */
 
 #include <iostream>
@@ -19,6 +39,28 @@
 #include "../config_cpp/file_processor.grpc.pb.h"
 #include "../config_cpp/file_processor.pb.h"
 
+#include "async_log.h"
+#include "chunking.h"
+#include "compression.h"
+#include "crc32c.h"
+#include "delta.h"
+#include "fd_handoff.h"
+#include "inflight.h"
+#include "jobs.h"
+#include "latency.h"
+#include "metrics.h"
+#include "operations.h"
+#include "oplog.h"
+#include "output_reader.h"
+#include "results.h"
+#include "scratch.h"
+#include "slow_log.h"
+#include "storage_io.h"
+#include "storage_lifecycle.h"
+#include "tracing.h"
+#include "uploads.h"
+#include "worker_pool.h"
+
 using grpc::Server;
 using grpc::ServerBuilder;
 using grpc::ServerContext;
@@ -29,6 +71,23 @@ using file_processor::FileProcessorService;
 using file_processor::FileRequest;
 using file_processor::FileResponse;
 using file_processor::FileChunk;
+using file_processor::BatchRequest;
+using file_processor::BatchResponse;
+using file_processor::StartUploadRequest;
+using file_processor::UploadChunk;
+using file_processor::UploadQuery;
+using file_processor::UploadStatus;
+using file_processor::SignatureRequest;
+using file_processor::SignatureBatch;
+using file_processor::DeltaChunk;
+using file_processor::FetchOutputRequest;
+using file_processor::JobQuery;
+using file_processor::JobStatus;
+using file_processor::LatencyQuery;
+using file_processor::LatencyReport;
+using file_processor::ServerState;
+using file_processor::ServerStateQuery;
+using grpc::ServerWriter;
 
 #include <vector>
 #include <filesystem>
@@ -37,418 +96,1309 @@ using file_processor::FileChunk;
 #include <mutex>
 #include <chrono>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <sys/wait.h>
 
 namespace fs = std::filesystem;
 
-// Lista diretório de armazenamento
+// Diretório de armazenamento (STORAGE_DIR; padrão: server_cpp/storage ao lado do código-fonte)
 static std::string StorageDir() {
+    const char* dir = std::getenv("STORAGE_DIR");
+    if (dir && *dir) return dir;
     return (fs::path(__FILE__).parent_path() / "storage").string();
 }
 
-// Arquivos de log
-static std::mutex g_log_mutex;
+// Log assíncrono (criado em RunServer; antes disso as linhas são ignoradas)
+static std::unique_ptr<AsyncLogger> g_logger;
+
+// Log de requisições lentas (criado em RunServer com SLOW_REQUEST_MS > 0)
+static std::unique_ptr<SlowLog> g_slow_log;
+
+// Log binário de operações (criado em RunServer com OPLOG_DIR)
+static std::unique_ptr<OpLog> g_oplog;
 
 // Retorna o caminho do arquivo de log
 static std::string LogFilePath() {
     return (fs::path(__FILE__).parent_path() / "server.log").string();
 }
 
-// Obtém horário atual
-static std::string NowTimestamp() {
-
-    using clock = std::chrono::system_clock;
-    auto now = clock::now(); // Horário atual
-
-    // Converte para time_t
-    std::time_t t = clock::to_time_t(now);
-    std::tm tm{};
-
-    // Plataforma específica para conversão thread-safe
-    #if defined(_WIN32)
-        localtime_s(&tm, &t);
-    #else
-        localtime_r(&t, &tm);
-    #endif
-        std::ostringstream oss;
-        oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-        return oss.str();
-}
-
-// Registra operação no arquivo de log
+// Registra operação no arquivo de log (só copia a linha para o buffer da thread)
 static void LogOperation(const std::string& service_name,
                          const std::string& file_name,
                          bool success,
                          const std::string& message) {
-
-    std::lock_guard<std::mutex> lk(g_log_mutex);
-    std::ofstream log(LogFilePath(), std::ios::app);
-    if (log.is_open()) {
-        log << "[" << NowTimestamp() << "] "
-            << (success ? "SUCCESS" : "FAIL")
-            << " - Service: " << service_name
-            << ", File: " << (file_name.empty() ? "-" : file_name)
-            << ", Message: " << message
-            << std::endl;
-    }
+    if (!g_logger) return;
+
+    // Linha montada em um buffer reaproveitado pela thread
+    thread_local std::string line;
+    line.clear();
+    line += "[";
+    line += CachedTimestamp();
+    line += "] ";
+    line += success ? "SUCCESS" : "FAIL";
+    line += " - Service: ";
+    line += service_name;
+    line += ", File: ";
+    line += file_name.empty() ? "-" : file_name;
+    line += ", Message: ";
+    line += message;
+    g_logger->Append(line);
 }
 
-// Verifica se comando existe no sistema
-static bool CommandExists(const std::string& cmd) {
-    std::string c = "command -v '" + cmd + "' >/dev/null 2>&1";
-    int r = std::system(c.c_str());
-    return r == 0;
+// Escreve vetor de bytes em arquivo
+static bool WriteAll(const std::string& path, const std::vector<uint8_t>& data) {
+    // Segmentos em lote pelo backend de E/S do storage
+    return IoWriteFile(path, data.data(), data.size());
 }
 
-// Executa comando shell
-static int RunShell(const std::string& cmd) {
-    return std::system(cmd.c_str());
-}
+// Arquivo recebido por stream de FileRequest
+struct ReceivedFile {
+    std::string fname;
+    std::vector<uint8_t> data;
+    FileRequest params;
+    bool has_params = false;
+    std::string error;          // Primeiro chunk com CRC32C inválido
+    RequestTimer timer;         // Fases do arquivo, a partir da primeira mensagem
+    InFlight inflight;          // Entrada em GetServerState (vazia se não registrada)
+    IngestBuffer ingest;        // Memória ocupada por data
+};
 
-// Escreve vetor de bytes em arquivo
-static bool WriteAll(const std::string& path, const std::vector<uint8_t>& data) {
-    std::ofstream out(path, std::ios::binary);
-    if (!out) return false; // Não conseguiu abrir o arquivo
+// Acumula uma mensagem FileRequest: nome, bytes do chunk e a última mensagem com parâmetros
+static void AccumulateRequest(const FileRequest& req, ReceivedFile& file) {
+    // Primeiro nome do arquivo recebido
+    if (file.fname.empty() && !req.file_name().empty()) {
+        file.fname = req.file_name();
+        if (file.inflight) file.inflight->SetDetails("", file.fname);
+    }
 
-    // Escreve todos os bytes
-    out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
-    return true;
+    // Adiciona conteúdo do chunk ao vetor (conferindo o CRC32C quando presente)
+    if (req.has_file_content()) {
+        const auto& c = req.file_content().content();
+        if (req.file_content().has_crc32c() && file.error.empty() && Crc32c(c.data(), c.size()) != req.file_content().crc32c())
+            file.error = "CRC32C inválido no chunk do offset " + std::to_string(file.data.size());
+        file.data.insert(file.data.end(), c.begin(), c.end());
+        file.ingest.Track(file.data.capacity());
+        if (file.inflight) file.inflight->AddReceived(c.size());
+    }
+
+    // Qualquer um dos params sinaliza a operação escolhida (guardados sem o conteúdo)
+    if (req.parameters_case() != FileRequest::PARAMETERS_NOT_SET) {
+        file.params = req;
+        file.params.clear_file_content();
+        file.has_params = true;
+        if (file.inflight) file.inflight->SetDetails(OperationName(req), file.fname);
+    }
 }
 
-// Lê stream de FileRequest para vetor de bytes
-static bool ReadStreamToVector(ServerReaderWriter<FileResponse, FileRequest>* stream, std::string& file_name, std::vector<uint8_t>& out_data) {
-    
-    FileRequest req;
-    bool has_params = false;
+// Contexto de trace enviado pelo cliente (metadado traceparent; inválido se ausente)
+static TraceContext IncomingTrace(const ServerContext* context) {
+    TraceContext ctx;
+    auto it = context->client_metadata().find("traceparent");
+    if (it != context->client_metadata().end()) ParseTraceparent(std::string(it->second.data(), it->second.size()), ctx);
+    return ctx;
+}
 
-    // Lê todas as mensagens do stream
-    while (stream->Read(&req)) {
-        // Primeiro nome do arquivo recebido
-        if (file_name.empty() && !req.file_name().empty()) file_name = req.file_name();
-        
-        // Adiciona conteúdo do chunk ao vetor
-        if (req.has_file_content()) {
-            const auto& c = req.file_content().content();
-            out_data.insert(out_data.end(), c.begin(), c.end());
-        }
+// Durações do oplog em microssegundos de 32 bits (saturadas)
+static uint32_t SaturatedMicros(std::chrono::nanoseconds d) {
+    uint64_t us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    return us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+}
 
-        // Qualquer um dos quatro params sinaliza a operação escolhida
-        if (req.has_compress_pdf_params() || req.has_convert_to_txt_params() || req.has_convert_image_format_params() || req.has_resize_image_params()) {
-            has_params = true;
+// Registro de tamanho fixo da requisição no log binário
+static void AppendOpLog(const RequestTimer& timer, std::chrono::nanoseconds total, const std::string& operation, bool ok,
+                        uint64_t input_bytes, uint64_t output_bytes, const std::vector<ToolInvocation>& tools) {
+    OpLogRecord rec;
+    std::memset(&rec, 0, sizeof(rec));
+    rec.time_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    rec.input_bytes = input_bytes;
+    rec.output_bytes = output_bytes;
+    rec.total_us = SaturatedMicros(total);
+    for (int p = 0; p < OPLOG_PHASES; p++) rec.phase_us[p] = SaturatedMicros(timer.phase(p));
+    OpMode mode;
+    rec.op = OpCodeOf(operation, mode);
+    rec.mode = mode;
+    rec.ok = ok ? 1 : 0;
+    uint64_t cpu_us = 0;
+    for (const auto& inv : tools) {
+        cpu_us += (uint64_t)(inv.usage.user_cpu + inv.usage.system_cpu).count();
+        rec.tool_max_rss_kb = std::max(rec.tool_max_rss_kb, (uint32_t)std::min<uint64_t>(inv.usage.max_rss_kb, UINT32_MAX));
+        if (inv.status != 0 && rec.tool_status == 0) {
+            if (inv.status < 0) rec.tool_status = 255;
+            else if (WIFSIGNALED(inv.status)) rec.tool_status = (uint8_t)(128 + WTERMSIG(inv.status));
+            else rec.tool_status = (uint8_t)WEXITSTATUS(inv.status);
         }
-        // Observação: os valores específicos de params serão lidos diretamente nos handlers (ver abaixo)
     }
-    return has_params;
+    rec.tool_cpu_us = (uint32_t)std::min<uint64_t>(cpu_us, UINT32_MAX);
+    rec.tool_count = (uint8_t)std::min<size_t>(tools.size(), 255);
+    g_oplog->Append(rec);
 }
 
-// Envia stream de FileResponse com arquivo de saída
-static void StreamFileBack(ServerReaderWriter<FileResponse, FileRequest>* stream, const std::string& out_file, const std::string& status_prefix, bool success) {
-    const size_t CHUNK = 1024 * 1024;
+// Fim de uma requisição: registro no log binário e, se o total (retornado por
+// RequestTimer::Finish) passou do limite, no slow log. input é a entrada no storage, que dá o
+// tamanho e o tipo; vazio se a requisição não chegou a gravá-la (tamanho em input_bytes, tipo
+// pela extensão do nome).
+static void RecordRequest(const RequestTimer& timer, std::chrono::nanoseconds total, const std::string& operation, const std::string& fname,
+                          bool ok, const std::string& message, uint64_t input_bytes = 0, uint64_t output_bytes = 0,
+                          const fs::path& input = {}, const std::vector<ToolInvocation>& tools = {}) {
+    bool slow = g_slow_log && g_slow_log->IsSlow(total);
+    if (!slow && !g_oplog) return;
+    if (!input.empty()) {
+        std::error_code ec;
+        uint64_t size = fs::file_size(input, ec);
+        if (!ec) input_bytes = size;
+    }
+    if (g_oplog) AppendOpLog(timer, total, operation, ok, input_bytes, output_bytes, tools);
+    if (!slow) return;
+
+    SlowRequest r;
+    r.operation = operation;
+    r.file_name = fname;
+    r.ok = ok;
+    r.message = message;
+    r.trace_id = timer.trace().trace_id;
+    r.input_bytes = input_bytes;
+    r.input_type = SniffFileType(input.string(), fname);
+    r.total = total;
+    for (int p = 0; p < PHASE_TOTAL; p++) {
+        if (!timer.measured(p)) continue;
+        r.phases[(size_t)p] = timer.phase(p);
+        r.measured |= 1u << p;
+    }
+    r.tools = tools;
+    g_slow_log->Write(r);
+}
 
-    // Abre arquivo de saída
-    std::ifstream in(out_file, std::ios::binary);
+// Soma os recursos usados pelas ferramentas da operação nas métricas (por operação e ferramenta)
+// e devolve o resumo para a linha de log (" [ferramentas: ...]"; vazio sem ferramentas)
+static std::string AccountTools(MetricsRegistry& metrics, const std::string& operation, const std::vector<ToolInvocation>& tools) {
+    std::string summary;
+    for (const auto& inv : tools) {
+        const ToolUsage& u = inv.usage;
+        MetricLabels labels = {{"operation", operation}, {"tool", inv.tool}};
+        auto with = [&labels](const char* name, const char* value) {
+            MetricLabels l = labels;
+            l.emplace_back(name, value);
+            return l;
+        };
+        metrics.GetCounter("file_processor_tool_cpu_microseconds_total", "Tempo de CPU das ferramentas externas (com descendentes).", with("mode", "user"))
+            .Inc((uint64_t)u.user_cpu.count());
+        metrics.GetCounter("file_processor_tool_cpu_microseconds_total", "Tempo de CPU das ferramentas externas (com descendentes).", with("mode", "system"))
+            .Inc((uint64_t)u.system_cpu.count());
+        metrics.GetCounter("file_processor_tool_context_switches_total", "Trocas de contexto das ferramentas externas.", with("kind", "voluntary"))
+            .Inc(u.voluntary_switches);
+        metrics.GetCounter("file_processor_tool_context_switches_total", "Trocas de contexto das ferramentas externas.", with("kind", "involuntary"))
+            .Inc(u.involuntary_switches);
+        metrics.GetCounter("file_processor_tool_block_operations_total", "Operações de bloco no disco das ferramentas externas.", with("direction", "in"))
+            .Inc(u.block_in);
+        metrics.GetCounter("file_processor_tool_block_operations_total", "Operações de bloco no disco das ferramentas externas.", with("direction", "out"))
+            .Inc(u.block_out);
+        metrics.GetGauge("file_processor_tool_max_rss_bytes", "Maior memória residente de uma execução de ferramenta.", labels)
+            .SetMax((int64_t)u.max_rss_kb * 1024);
+
+        summary += summary.empty() ? " [ferramentas: " : "; ";
+        summary += DescribeToolUsage(inv);
+    }
+    if (!summary.empty()) summary += "]";
+    return summary;
+}
+
+// Envia uma FileResponse ao cliente (false se o stream foi encerrado);
+// compress indica se a mensagem deve usar a compressão da chamada
+using ResponseWriter = std::function<bool(const FileResponse&, bool compress)>;
+
+// Envia resposta de falha e registra no log
+static void SendFailure(const ResponseWriter& write, const std::string& service, const std::string& fname, const std::string& msg, const std::string& log_suffix = "") {
+    FileResponse r;
+    r.set_success(false);
+    r.set_status_message(msg);
+    write(r, false);
+    LogOperation(service, fname, false, msg + log_suffix);
+}
+
+// Envia stream de FileResponse com o intervalo [offset, offset+length) do arquivo
+// (header define nome, status e handle repetidos em cada resposta; length 0 = até o fim).
+// O tamanho de cada chunk vem do sizer, que é realimentado com o tempo de cada escrita.
+// Cada chunk leva seu CRC32C; o output_crc32c do header vai só na última mensagem.
+// Retorna os bytes do arquivo enviados.
+static uint64_t StreamFileRange(const ResponseWriter& write, const std::string& out_file, uint64_t offset, uint64_t length, const FileResponse& header, ChunkSizer& sizer) {
+    // Abre arquivo de saída (mapeado em memória; ver output_reader.h)
+    OutputReader in;
 
     // Caso não consiga abrir, retornar erro
-    if (!in) {
-        FileResponse resp; resp.set_success(false); 
+    if (!in.Open(out_file, offset)) {
+        FileResponse resp = header; resp.set_success(false); 
         resp.set_status_message("Falha ao abrir saída: " + out_file);
-        stream->Write(resp); return;
+        write(resp, false); return 0;
+    }
+    uint64_t remaining = offset >= in.size() ? 0 : in.size() - offset;
+    if (length > 0 && length < remaining) remaining = length;
+    bool first = true, compress = false;
+    uint64_t sent = 0;
+    InFlightRequest* current = CurrentInFlight();
+
+    // Saída vazia (ou offset no fim): o header sozinho leva status, handle e tamanho
+    if (remaining == 0) {
+        write(header, false);
+        return 0;
     }
 
-    // Envia arquivo em chunks
-    std::vector<char> buf(CHUNK);
-    while (in) {
-        // Lê dados do buffer
-        in.read(buf.data(), buf.size());
-        
-        // Obtém número de bytes lidos
-        auto n = in.gcount();
+    // Envia arquivo em chunks: os bytes vão das páginas mapeadas direto para o campo da mensagem
+    while (remaining > 0) {
+        size_t n = (size_t)std::min<uint64_t>(sizer.Size(), remaining);
+        FileResponse resp = header; 
+        auto* ch = resp.mutable_file_content();
+        if (!in.Read(offset, n, *ch->mutable_content())) {
+            FileResponse fail = header; fail.set_success(false);
+            fail.set_status_message("Falha ao ler saída: " + out_file);
+            write(fail, false); return sent;
+        }
+        offset += n;
+        remaining -= n;
+        const std::string& data = ch->content();
 
-        if (n<=0) break;
+        // O tipo do conteúdo é decidido pelo primeiro chunk
+        if (first) { compress = LooksCompressible(data.data(), n); first = false; }
 
         // Envia chunk lido
-        FileResponse resp; 
-        resp.set_success(success); 
-        resp.set_status_message(status_prefix);
-        auto* ch = resp.mutable_file_content(); ch->set_content(buf.data(), (size_t)n);
-        stream->Write(resp);
+        ch->set_crc32c(Crc32c(data.data(), n));
+        if (remaining > 0) resp.clear_output_crc32c();
+        auto t0 = std::chrono::steady_clock::now();
+        if (!write(resp, compress)) return sent;
+        sizer.Observe(n, std::chrono::steady_clock::now() - t0);
+        sent += n;
+        if (current) current->AddSent(n);
     }
+    return sent;
 }
 
 // Implementação do serviço FileProcessorService
 class FileProcessorServiceImpl final : public FileProcessorService::Service {
 public:
+    FileProcessorServiceImpl(StorageLifecycle& storage, ScratchStorage& scratch, WorkerPool& pool, LatencyRecorder& latency, MetricsRegistry& metrics, size_t job_threads, grpc_compression_algorithm compression, size_t chunk_size)
+        : storage_(storage), scratch_(scratch), pool_(pool), latency_(latency), metrics_(metrics),
+          bytes_received_(metrics.GetCounter("file_processor_received_bytes_total", "Bytes de arquivos recebidos dos clientes (conteúdo dos chunks; literais nos deltas).")),
+          bytes_sent_(metrics.GetCounter("file_processor_sent_bytes_total", "Bytes de saídas enviados aos clientes.")),
+          compression_(compression), chunk_size_(chunk_size), uploads_(storage), bases_(storage), results_(storage),
+          jobs_(storage, uploads_, job_threads,
+                [this](const FileRequest& req, const std::string& fname, const fs::path& in, std::chrono::nanoseconds queued, JobStatus& st) {
+                    RunJob(req, fname, in, queued, st);
+                }) {}
+
     Status CompressPDF(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
-        
-        // Lê stream de FileRequest
-        std::string fname; 
-        std::vector<uint8_t> data; 
-        bool got_params=false;
-        FileRequest req;
+        return ProcessSingle(context, stream, "CompressPDF", FileRequest::kCompressPdfParams);
+    }
+
+    Status ConvertToTXT(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
+        return ProcessSingle(context, stream, "ConvertToTXT", FileRequest::kConvertToTxtParams);
+    }
 
-        while (stream->Read(&req)) {
-            // Atribui nome do arquivo 
-            if (fname.empty() && !req.file_name().empty()) fname = req.file_name(); // Nome do arquivo
-            if (req.has_compress_pdf_params()) got_params = true; // Parâmetros
+    Status ConvertImageFormat(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
+        return ProcessSingle(context, stream, "ConvertImageFormat", FileRequest::kConvertImageFormatParams);
+    }
 
-            // Adiciona conteúdo do chunk ao vetor
-            if (req.has_file_content()) {
-                const auto& c = req.file_content().content(); 
-                data.insert(data.end(), c.begin(), c.end());
+    Status ResizeImage(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
+        return ProcessSingle(context, stream, "ResizeImage", FileRequest::kResizeImageParams);
+    }
+
+    Status ResizeImageMulti(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
+        return ProcessSingle(context, stream, "ResizeImageMulti", FileRequest::kResizeImageMultiParams);
+    }
+
+    // Vários passos em sequência sobre o mesmo arquivo; só o resultado final volta ao cliente
+    Status RunPipeline(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
+        return ProcessSingle(context, stream, "RunPipeline", FileRequest::kPipelineParams);
+    }
+
+    // Vários arquivos multiplexados em um único stream. Cada mensagem carrega um file_id;
+    // ao receber last_chunk o arquivo é despachado ao pool e o resultado volta assim que
+    // fica pronto (fora de ordem), terminando com uma mensagem done=true para aquele file_id.
+    Status ProcessBatch(ServerContext* context, ServerReaderWriter<BatchResponse, BatchRequest>* stream) override {
+        GaugeScope active(ActiveStreams("ProcessBatch"));
+        ChunkPolicy chunk = StartCall(context, stream);
+
+        // Arquivos em recebimento (cada um com seu span, filho do span do cliente)
+        std::map<std::string, ReceivedFile> pending;
+        TraceContext parent = IncomingTrace(context);
+
+        // Limita arquivos completos aguardando/em processamento (backpressure sobre o cliente)
+        std::mutex mu;
+        std::condition_variable cv;
+        size_t inflight = 0;
+        const size_t max_inflight = pool_.Threads() * 2;
+
+        // O gRPC não permite Writes concorrentes no mesmo stream
+        std::mutex write_mu;
+
+        auto dispatch = [&](const std::string& id, ReceivedFile&& p) {
+            p.timer.Mark(PHASE_RECEIVE);
+            p.inflight->SetPhase(PHASE_QUEUE);
+            bytes_received_.Inc(p.data.size());
+            auto job = std::make_shared<ReceivedFile>(std::move(p));
+            {
+                std::unique_lock<std::mutex> lk(mu);
+                cv.wait(lk, [&] { return inflight < max_inflight; });
+                inflight++;
             }
-        }
+            pool_.Submit([&, id, job] {
+                job->timer.Mark(PHASE_QUEUE);
+                InFlightThread current(job->inflight.get());
+                auto write = [&](const FileResponse& r, bool compress) {
+                    BatchResponse br;
+                    br.set_file_id(id);
+                    *br.mutable_response() = r;
+                    std::lock_guard<std::mutex> lk(write_mu);
+                    return stream->Write(br, ChunkWriteOptions(compress));
+                };
+
+                // Cliente cancelou: não processa o restante
+                bool ok = false;
+                std::string msg = "Cancelado";
+                if (!context->IsCancelled()) {
+                    std::string service = job->has_params ? OperationName(job->params) : "ProcessBatch";
+                    if (!job->error.empty()) {
+                        SendFailure(write, service, job->fname, msg = job->error);
+                        RecordRequest(job->timer, job->timer.Finish(latency_, service, false), service, job->fname, false, msg, job->data.size());
+                    } else {
+                        ok = ProcessFile(write, service, job->fname, job->data, job->has_params ? &job->params : nullptr, chunk, job->timer, msg);
+                    }
+                }
+
+                // Marca o fim deste arquivo com o status final
+                FileResponse last;
+                last.set_file_name(job->fname);
+                last.set_success(ok);
+                last.set_status_message(msg);
+                BatchResponse br;
+                br.set_file_id(id);
+                *br.mutable_response() = last;
+                br.set_done(true);
+                {
+                    std::lock_guard<std::mutex> lk(write_mu);
+                    stream->Write(br);
+                }
+
+                std::lock_guard<std::mutex> lk(mu);
+                inflight--;
+                cv.notify_all();
+            });
+        };
+
+        BatchRequest breq;
+        while (stream->Read(&breq)) {
+            auto ins = pending.emplace(breq.file_id(), ReceivedFile());
+            auto& p = ins.first->second;
+            if (ins.second) {
+                p.timer.StartTrace(parent);
+                p.inflight = TrackRequest(context, "ProcessBatch", p.timer);
+            }
+            AccumulateRequest(breq.request(), p);
+            if (!breq.last_chunk()) continue;
 
-        // Se não tem parâmetros, retorna que requisição não foi bem sucedida
-        if (!got_params) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Parâmetros ausentes"); 
-            stream->Write(r); 
-            LogOperation("CompressPDF", fname, false, "Parâmetros ausentes"); 
-            return Status::OK; 
+            // Arquivo completo: sai do mapa e vai para o pool
+            ReceivedFile done = std::move(p);
+            pending.erase(breq.file_id());
+            dispatch(breq.file_id(), std::move(done));
         }
 
-        // Salva arquivo de entrada no storage do servidor
-        fs::create_directories(StorageDir());
-        fs::path in = fs::path(StorageDir()) / ("in_" + fname);
-        fs::path out = fs::path(StorageDir()) / ("out_compressed_" + fs::path(fname).stem().string() + ".pdf");
-        if (!WriteAll(in.string(), data)) { FileResponse r; r.set_success(false); r.set_status_message("Falha ao salvar entrada"); stream->Write(r); LogOperation("CompressPDF", fname, false, "Falha ao salvar entrada"); return Status::OK; }
+        // Arquivos sem last_chunk são processados quando o cliente encerra o envio
+        for (auto& kv : pending) dispatch(kv.first, std::move(kv.second));
+        pending.clear();
 
-        bool ok = false; 
-        std::string msg;
+        // Aguarda todos os arquivos terminarem antes de encerrar a RPC
+        std::unique_lock<std::mutex> lk(mu);
+        cv.wait(lk, [&] { return inflight == 0; });
+        return Status::OK;
+    }
 
-        // Utiliza o comando do gs para comprimir pdf 
-        if (CommandExists("gs")) {
-            std::string cmd = "gs -sDEVICE=pdfwrite -dCompatibilityLevel=1.4 -dPDFSETTINGS=/screen -dNOPAUSE -dQUIET -dBATCH -sOutputFile='"+out.string()+"' '"+in.string()+"'";
-            ok = (RunShell(cmd) == 0); msg = ok?"PDF comprimido":"Falha na compressão (gs)";
-        } else {
-            // Fallback: copia como está
-            std::ofstream o(out, std::ios::binary); std::ifstream i(in, std::ios::binary); o<<i.rdbuf(); ok = o.good(); msg = ok?"Fallback: arquivo copiado":"Falha no fallback";
+    // Abre uma sessão de upload retomável
+    Status StartUpload(ServerContext* context, const StartUploadRequest* req, UploadStatus* resp) override {
+        UploadInfo info;
+        std::string err;
+        if (req->file_name().empty()) err = "Nome do arquivo ausente";
+        else if (uploads_.Create(req->file_name(), req->total_size(), info, err)) {
+            FillUploadStatus(info, true, "Upload iniciado", resp);
+            return Status::OK;
         }
+        resp->set_success(false);
+        resp->set_status_message(err);
+        return Status::OK;
+    }
 
-        StreamFileBack(stream, out.string(), msg, ok);
-        LogOperation("CompressPDF", fname, ok, msg);
+    // Recebe chunks com offset explícito; responde com o offset confirmado ao final
+    // (ou assim que um chunk é recusado, para o cliente retomar dali)
+    Status UploadChunks(ServerContext* context, ServerReaderWriter<UploadStatus, UploadChunk>* stream) override {
+        // Informa ao cliente o tamanho de chunk a usar nos envios
+        RequestTimer timer;
+        timer.StartTrace(IncomingTrace(context));
+        GaugeScope active(ActiveStreams("UploadChunks"));
+        InFlight inflight = TrackRequest(context, "UploadChunks", timer);
+        StartCall(context, stream);
+
+        UploadChunk chunk;
+        std::unique_ptr<UploadWriter> writer;
+        std::string err;
+        while (stream->Read(&chunk)) {
+            // O primeiro chunk identifica a sessão
+            if (!writer) {
+                writer = uploads_.OpenWriter(chunk.upload_id(), err);
+                if (!writer) break;
+                inflight->SetDetails("", writer->info().file_name);
+            } else if (chunk.upload_id() != writer->info().id) {
+                err = "upload_id diferente no mesmo stream";
+                break;
+            }
+            if (chunk.has_crc32c() && Crc32c(chunk.content().data(), chunk.content().size()) != chunk.crc32c()) {
+                // Nada do chunk é gravado: o cliente reenvia a partir do offset confirmado
+                err = "CRC32C inválido no chunk do offset " + std::to_string(chunk.offset());
+                break;
+            }
+            if (!writer->Write(chunk.offset(), chunk.content(), err)) break;
+            bytes_received_.Inc(chunk.content().size());
+            inflight->AddReceived(chunk.content().size());
+        }
+        timer.Mark(PHASE_RECEIVE);
+        inflight->SetPhase(PHASE_PERSIST);
+        // O offset respondido só vale depois que as gravações terminaram
+        if (writer) writer->Flush(err);
+        timer.Mark(PHASE_PERSIST);
+
+        UploadStatus resp;
+        if (writer) FillUploadStatus(writer->info(), err.empty(), err.empty() ? (writer->info().complete() ? "Upload completo" : "Dados gravados") : err, &resp);
+        else {
+            resp.set_success(false);
+            resp.set_status_message(err.empty() ? "Nenhum chunk recebido" : err);
+        }
+        // Upload completo vira base para o próximo envio do mesmo arquivo por delta
+        std::string sha256;
+        if (writer && err.empty() && writer->info().complete() && Sha256File(uploads_.DataPath(writer->info().id), sha256) &&
+            bases_.Register(uploads_.DataPath(writer->info().id), sha256)) {
+            resp.set_sha256(sha256);
+        }
+        stream->Write(resp);
+        auto total = timer.Finish(latency_, "UploadChunks", err.empty() && writer);
+        if (writer) RecordRequest(timer, total, "UploadChunks", writer->info().file_name, err.empty(), resp.status_message(), writer->info().committed);
         return Status::OK;
     }
 
-    Status ConvertToTXT(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
-        // Recebe arquivo e parâmetros
-        std::string fname; std::vector<uint8_t> data; 
-        bool got_params=false; 
-        FileRequest req;
+    // Assinaturas dos blocos de uma base (checksum rolante + MD5), em lotes
+    Status GetSignatures(ServerContext* context, const SignatureRequest* req, ServerWriter<SignatureBatch>* writer) override {
+        GaugeScope active(ActiveStreams("GetSignatures"));
+        fs::path basis;
+        uint64_t size = 0;
+        SignatureBatch batch;
+        if (!CacheLookup("delta_basis", bases_.Lookup(req->basis_sha256(), basis, size))) {
+            batch.set_success(false);
+            batch.set_status_message("Base inexistente ou expirada");
+            writer->Write(batch);
+            return Status::OK;
+        }
 
-        // Lê stream de FileRequest
-        while (stream->Read(&req)) {
-            if (fname.empty() && !req.file_name().empty()) fname = req.file_name(); // Nome do arquivo
-            if (req.has_convert_to_txt_params()) got_params = true; // Parâmetros da requisição
-            if (req.has_file_content()) { // Verifica se há conteúdo e adiciona ao vetor de dados
-                const auto& c = req.file_content().content(); 
-                data.insert(data.end(), c.begin(), c.end()); 
+        size_t block_size = ChooseBlockSize(size, req->block_size());
+        auto reset = [&](uint64_t first_block) {
+            batch.Clear();
+            batch.set_success(true);
+            batch.set_status_message("Assinaturas da base");
+            batch.set_block_size((uint32_t)block_size);
+            batch.set_basis_size(size);
+            batch.set_first_block(first_block);
+        };
+        reset(0);
+
+        PinScope pin(storage_, basis);
+        uint64_t count = 0;
+        bool sent = true;
+        bool ok = BasisStore::Signatures(basis, block_size, [&](const BlockSignature& sig) {
+            file_processor::BlockSignature* b = batch.add_blocks();
+            b->set_weak(sig.weak);
+            b->set_strong(sig.strong);
+            if (++count % DELTA_SIGNATURES_PER_MESSAGE != 0) return true;
+            sent = writer->Write(batch);
+            reset(count);
+            return sent;
+        });
+        if (!sent) return Status::OK;
+        if (!ok) {
+            batch.Clear();
+            batch.set_success(false);
+            batch.set_status_message("Falha ao ler a base");
+        }
+        // Última mensagem (vazia quando a base não tem blocos completos além dos já enviados)
+        writer->Write(batch);
+        return Status::OK;
+    }
+
+    // Reconstrói um arquivo a partir de uma base e das instruções do delta. O resultado é um
+    // upload completo comum: o upload_id devolvido serve para qualquer operação.
+    Status UploadDelta(ServerContext* context, ServerReaderWriter<UploadStatus, DeltaChunk>* stream) override {
+        RequestTimer timer;
+        timer.StartTrace(IncomingTrace(context));
+        GaugeScope active(ActiveStreams("UploadDelta"));
+        InFlight inflight = TrackRequest(context, "UploadDelta", timer);
+        DeltaChunk chunk;
+        std::string err, fname, expected_sha256;
+        std::unique_ptr<UploadWriter> writer;
+        std::unique_ptr<PinScope> pin;
+        std::unique_ptr<DeltaApplier> delta;
+        while (err.empty() && stream->Read(&chunk)) {
+            // A primeira mensagem identifica a base e o arquivo novo
+            if (!delta) {
+                fs::path basis;
+                uint64_t basis_size = 0;
+                UploadInfo info;
+                fname = chunk.file_name();
+                expected_sha256 = chunk.file_sha256();
+                inflight->SetDetails("", fname);
+                if (!CacheLookup("delta_basis", bases_.Lookup(chunk.basis_sha256(), basis, basis_size))) err = "Base inexistente ou expirada";
+                else if (fname.empty()) err = "Nome do arquivo ausente";
+                else if (uploads_.Create(fname, chunk.total_size(), info, err)) writer = uploads_.OpenWriter(info.id, err);
+                if (!writer) break;
+                pin.reset(new PinScope(storage_, basis));
+                delta.reset(new DeltaApplier(basis, basis_size, ChooseBlockSize(basis_size, chunk.block_size()), *writer));
+            }
+            for (const auto& op : chunk.ops()) {
+                bool ok = op.has_copy() ? delta->Copy(op.copy().first_block(), op.copy().count(), err)
+                                        : delta->Literal(op.literal(), err);
+                if (!ok) break;
+                if (!op.has_copy()) inflight->AddReceived(op.literal().size());
             }
         }
-        
-        // Caso não tenha parâmetros, retorna falha na requisição
-        if (!got_params) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Parâmetros ausentes"); 
-            stream->Write(r); 
-            LogOperation("ConvertToTXT", fname, false, "Parâmetros ausentes"); 
-            return Status::OK; 
+
+        timer.Mark(PHASE_RECEIVE);
+        inflight->SetPhase(PHASE_PERSIST);
+        if (delta) bytes_received_.Inc(delta->literal_bytes());
+
+        // Só aceita o arquivo reconstruído inteiro e com o conteúdo declarado
+        std::string sha256;
+        if (writer) writer->Flush(err);
+        if (writer && err.empty()) {
+            const UploadInfo& info = writer->info();
+            if (!info.complete()) err = "Delta incompleto (" + std::to_string(info.committed) + "/" + std::to_string(info.total_size) + " bytes)";
+            else if (!Sha256File(uploads_.DataPath(info.id), sha256) || sha256 != expected_sha256) err = "SHA-256 do arquivo reconstruído não confere";
+            else if (!bases_.Register(uploads_.DataPath(info.id), sha256)) err = "Falha ao registrar a base";
         }
+        timer.Mark(PHASE_PERSIST);
 
-        // Cria arquivo de entrada no storage do servidor
-        fs::create_directories(StorageDir()); fs::path in = fs::path(StorageDir()) / ("in_" + fname);
-        fs::path out = fs::path(StorageDir()) / (fs::path(fname).stem().string() + ".txt");
-
-        // Retorna falha na requisição se não consegue escrever os bytes no arquivo
-        if (!WriteAll(in.string(), data)) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Falha ao salvar entrada"); 
-            stream->Write(r); 
-            LogOperation("ConvertToTXT", fname, false, "Falha ao salvar entrada"); 
-            return Status::OK; 
+        UploadStatus resp;
+        if (writer) FillUploadStatus(writer->info(), err.empty(), err.empty() ? "Upload completo (delta)" : err, &resp);
+        else {
+            resp.set_success(false);
+            resp.set_status_message(err.empty() ? "Nenhuma instrução recebida" : err);
         }
+        if (err.empty()) resp.set_sha256(sha256);
+        stream->Write(resp);
 
-        bool ok=false; std::string msg;
-        // Tenta usar pdftotext para converter PDF em TXT
-        if (CommandExists("pdftotext")) { 
-            std::string cmd = "pdftotext '"+in.string()+"' '"+out.string()+"'"; 
-            ok = (RunShell(cmd)==0); 
-            msg = ok?"Convertido para TXT":"Falha pdftotext"; 
+        std::string stats = err.empty() ? "Arquivo reconstruído" : err;
+        if (delta) stats += " (literais " + std::to_string(delta->literal_bytes()) + " bytes, copiados da base " + std::to_string(delta->copied_bytes()) + " bytes)";
+        LogOperation("UploadDelta", fname, err.empty(), stats);
+        auto total = timer.Finish(latency_, "UploadDelta", err.empty() && writer);
+        RecordRequest(timer, total, "UploadDelta", fname, err.empty() && writer, stats, writer ? writer->info().committed : 0);
+        return Status::OK;
+    }
+
+    // Consulta o offset confirmado de uma sessão (usado ao reconectar)
+    Status QueryUpload(ServerContext* context, const UploadQuery* req, UploadStatus* resp) override {
+        UploadInfo info;
+        if (uploads_.Lookup(req->upload_id(), info)) FillUploadStatus(info, true, info.complete() ? "Upload completo" : "Upload parcial", resp);
+        else {
+            resp->set_success(false);
+            resp->set_status_message("Upload inexistente ou expirado");
+        }
+        return Status::OK;
+    }
+
+    // Devolve um intervalo de uma saída retida (retomar download ou baixar partes em paralelo)
+    Status FetchOutput(ServerContext* context, const FetchOutputRequest* req, ServerWriter<FileResponse>* writer) override {
+        RequestTimer timer;
+        timer.StartTrace(IncomingTrace(context));
+        GaugeScope active(ActiveStreams("FetchOutput"));
+        ResultInfo info;
+        FileResponse header;
+        if (!CacheLookup("results", results_.Lookup(req->result_handle(), info))) {
+            header.set_success(false);
+            header.set_status_message("Resultado inexistente ou expirado");
+            writer->Write(header);
+            return Status::OK;
         }
-        else { // Fallback: tenta tratar bytes como texto
-            std::ofstream o(out, std::ios::binary); o.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size()); ok=o.good(); msg = ok?"Fallback: bytes gravados em .txt":"Falha fallback";
+        header.set_file_name(info.name);
+        header.set_result_handle(info.handle);
+        header.set_output_size(info.size);
+        if (info.has_crc32c) header.set_output_crc32c(info.crc32c);
+        if (req->offset() > info.size) {
+            header.set_success(false);
+            header.set_status_message("Offset além do fim da saída (" + std::to_string(info.size) + " bytes)");
+            writer->Write(header);
+            return Status::OK;
         }
-        StreamFileBack(stream, out.string(), msg, ok); 
-        LogOperation("ConvertToTXT", fname, ok, msg);
+        header.set_success(true);
+        header.set_status_message("Intervalo da saída");
+
+        InFlight inflight = TrackRequest(context, "FetchOutput", timer);
+        inflight->SetDetails("", info.name);
+        inflight->SetPhase(PHASE_STREAM);
+        InFlightThread current(inflight.get());
+
+        // Mantém o arquivo fora do alcance do varredor durante a leitura
+        ChunkSizer sizer(StartCall(context, writer));
+        PinScope pin(storage_, results_.DataPath(info.handle));
+        uint64_t sent = StreamFileRange([writer](const FileResponse& r, bool compress) { return writer->Write(r, ChunkWriteOptions(compress)); }, results_.DataPath(info.handle).string(), req->offset(), req->length(), header, sizer);
+        bytes_sent_.Inc(sent);
+        RecordChunking("FetchOutput", sizer);
+        timer.Mark(PHASE_STREAM);
+        RecordRequest(timer, timer.Finish(latency_, "FetchOutput", true), "FetchOutput", info.name, true, "Intervalo da saída", 0, sent);
         return Status::OK;
     }
 
-    Status ConvertImageFormat(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
-        std::string fname; 
-        std::vector<uint8_t> data; 
-        bool got_params=false; std::string out_ext="png"; 
-        FileRequest req;
+    // Enfileira um job; a entrada vem de um upload_id ou do próprio file_content (arquivos pequenos)
+    Status SubmitJob(ServerContext* context, const FileRequest* req, JobStatus* resp) override {
+        jobs_.Submit(*req, *resp);
+        return Status::OK;
+    }
 
-        // Lê as requisições do stream
-        while (stream->Read(&req)) {
-            if (fname.empty() && !req.file_name().empty()) fname = req.file_name(); // Nome do arquivo
-            if (req.has_convert_image_format_params()) { // Parâmetros da requisição
-                got_params = true;
+    Status GetJobStatus(ServerContext* context, const JobQuery* req, JobStatus* resp) override {
+        if (!jobs_.Lookup(req->job_id(), *resp)) {
+            resp->set_job_id(req->job_id());
+            resp->set_state(file_processor::JOB_FAILED);
+            resp->set_status_message("Job inexistente ou expirado");
+        }
+        return Status::OK;
+    }
 
-                // Define o formato de saída se especificado
-                if (!req.convert_image_format_params().output_format().empty()) 
-                    out_ext = req.convert_image_format_params().output_format(); 
-            }
+    // Envia todas as saídas de um job concluído (cada uma identificada por file_name)
+    Status FetchResult(ServerContext* context, const JobQuery* req, ServerWriter<FileResponse>* writer) override {
+        RequestTimer timer;
+        timer.StartTrace(IncomingTrace(context));
+        GaugeScope active(ActiveStreams("FetchResult"));
+        JobStatus st;
+        FileResponse header;
+        if (!jobs_.Lookup(req->job_id(), st)) {
+            header.set_success(false);
+            header.set_status_message("Job inexistente ou expirado");
+            writer->Write(header);
+            return Status::OK;
+        }
+        if (st.state() != file_processor::JOB_DONE) {
+            header.set_success(false);
+            header.set_status_message(st.state() == file_processor::JOB_FAILED ? st.status_message() : "Job ainda não concluído");
+            writer->Write(header);
+            return Status::OK;
+        }
 
-            // Adiciona conteúdo do chunk ao vetor
-            if (req.has_file_content()) { 
-                const auto& c = req.file_content().content(); 
-                data.insert(data.end(), c.begin(), c.end()); 
+        InFlight inflight = TrackRequest(context, "FetchResult", timer);
+        if (st.outputs_size() > 0) inflight->SetDetails("", st.outputs(0).file_name());
+        inflight->SetPhase(PHASE_STREAM);
+        InFlightThread current(inflight.get());
+
+        ChunkSizer sizer(StartCall(context, writer));
+        auto write = [writer](const FileResponse& r, bool compress) { return writer->Write(r, ChunkWriteOptions(compress)); };
+        uint64_t sent = 0;
+        for (const auto& o : st.outputs()) {
+            ResultInfo info;
+            FileResponse h;
+            h.set_file_name(o.file_name());
+            if (!CacheLookup("results", results_.Lookup(o.result_handle(), info))) {
+                h.set_success(false);
+                h.set_status_message("Resultado expirado");
+                writer->Write(h);
+                continue;
             }
+            h.set_success(true);
+            h.set_status_message(st.status_message());
+            h.set_result_handle(info.handle);
+            h.set_output_size(info.size);
+            if (info.has_crc32c) h.set_output_crc32c(info.crc32c);
+            PinScope pin(storage_, results_.DataPath(info.handle));
+            sent += StreamFileRange(write, results_.DataPath(info.handle).string(), 0, 0, h, sizer);
         }
+        bytes_sent_.Inc(sent);
+        RecordChunking("FetchResult", sizer);
+        timer.Mark(PHASE_STREAM);
+        RecordRequest(timer, timer.Finish(latency_, "FetchResult", true), "FetchResult", "", true, st.status_message(), 0, sent);
+        return Status::OK;
+    }
 
-        // Caso não tenha parâmetros, retorna falha na requisição
-        if (!got_params) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Parâmetros ausentes"); 
-            stream->Write(r); 
-            return Status::OK; 
-        }
-        // Salva arquivo de entrada no storage do servidor
-        fs::create_directories(StorageDir()); 
-        fs::path in = fs::path(StorageDir()) / ("in_" + fname);
-
-        // Retorna falha na requisição se não consegue escrever os bytes no arquivo
-        if (!WriteAll(in.string(), data)) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Falha ao salvar entrada"); 
-            stream->Write(r); 
-            LogOperation("ConvertImageFormat", fname, false, "Falha ao salvar entrada"); 
-            return Status::OK; 
+    // Introspecção: percentis de latência por operação, resultado e fase
+    Status GetLatencyStats(ServerContext* context, const LatencyQuery* req, LatencyReport* resp) override {
+        latency_.ForEach([&](const std::string& op, bool ok, int phase, const LatencyHistogram& h) {
+            if (!req->operation().empty() && req->operation() != op) return;
+            auto* s = resp->add_series();
+            s->set_operation(op);
+            s->set_success(ok);
+            s->set_phase(PhaseName(phase));
+            s->set_count(h.count());
+            s->set_sum_us(h.sum());
+            s->set_max_us(h.max());
+            s->set_p50_us(h.Percentile(0.50));
+            s->set_p90_us(h.Percentile(0.90));
+            s->set_p99_us(h.Percentile(0.99));
+            s->set_p999_us(h.Percentile(0.999));
+        });
+        return Status::OK;
+    }
+
+    // Introspecção: requisições em andamento, ocupação do pool e da fila de jobs
+    Status GetServerState(ServerContext* context, const ServerStateQuery* req, ServerState* resp) override {
+        for (const auto& r : requests_.List()) {
+            auto* a = resp->add_requests();
+            a->set_id(r.id);
+            a->set_rpc(r.rpc);
+            a->set_operation(r.operation);
+            a->set_file_name(r.file_name);
+            a->set_phase(PhaseName(r.phase));
+            a->set_elapsed_us((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(r.elapsed).count());
+            a->set_phase_elapsed_us((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(r.phase_elapsed).count());
+            a->set_bytes_received(r.bytes_received);
+            a->set_bytes_sent(r.bytes_sent);
+            a->set_child_pid(r.child_pid);
+            a->set_child_tool(r.child_tool);
+            a->set_peer(r.peer);
+            a->set_trace_id(r.trace_id);
         }
-        
-        // Define caminho do arquivo de saída
-        fs::path out = fs::path(StorageDir()) / (fs::path(fname).stem().string() + "." + out_ext);
+        resp->set_worker_threads((uint32_t)pool_.Threads());
+        resp->set_worker_active((uint32_t)pool_.Active());
+        resp->set_worker_queued((uint32_t)pool_.Queued());
+        resp->set_jobs_queued((uint32_t)jobs_.Queued());
+        resp->set_jobs_running((uint32_t)jobs_.Running());
+        resp->set_ingest_buffer_bytes(IngestBufferBytes());
+        resp->set_uptime_s((uint64_t)std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - started_).count());
+        return Status::OK;
+    }
 
-        // Converte imagem
-        bool ok=false; 
-        std::string msg;
+    // Ocupação da fila de jobs (métricas)
+    size_t JobsQueued() { return jobs_.Queued(); }
+    size_t JobsRunning() { return jobs_.Running(); }
+
+    // Requisições em andamento (entrega local por descritor e métricas)
+    InFlightRegistry& Requests() { return requests_; }
 
-        // Usa ImageMagick se disponível
-        if (CommandExists("convert")) {
-            std::string cmd = "convert '"+in.string()+"' -strip '"+out.string()+"'"; 
-            ok=(RunShell(cmd)==0); 
-            msg = ok?"Imagem convertida":"Falha ImageMagick";
-        } else { // Fallback: copia como está
-            std::ofstream o(out, std::ios::binary); 
-            std::ifstream i(in, std::ios::binary); 
-            o<<i.rdbuf(); ok=o.good(); 
-            msg = ok?"Fallback: cópia":"Falha fallback"; 
+private:
+    // Streams abertos da RPC (gauge por rpc)
+    Gauge& ActiveStreams(const std::string& rpc) {
+        return metrics_.GetGauge("file_processor_active_streams", "Chamadas com stream em andamento.", {{"rpc", rpc}});
+    }
+
+    // Tamanho final do chunk e vazão observada na última resposta da RPC (gauges por rpc)
+    void RecordChunking(const std::string& rpc, const ChunkSizer& sizer) {
+        metrics_.GetGauge("file_processor_chunk_size_bytes", "Tamanho do chunk ao fim da última resposta da RPC.", {{"rpc", rpc}})
+            .Set((int64_t)sizer.Size());
+        if (sizer.Throughput() > 0)
+            metrics_.GetGauge("file_processor_chunk_throughput_bytes_per_second", "Vazão das escritas na última resposta da RPC.", {{"rpc", rpc}})
+                .Set((int64_t)sizer.Throughput());
+    }
+
+    // Conta o acerto ou a falta de uma busca em um armazenamento reaproveitado; retorna hit
+    bool CacheLookup(const char* cache, bool hit) {
+        metrics_.GetCounter(hit ? "file_processor_cache_hits_total" : "file_processor_cache_misses_total",
+                            hit ? "Buscas encontradas (results: saídas retidas; delta_basis: bases de delta)."
+                                : "Buscas não encontradas ou expiradas (results: saídas retidas; delta_basis: bases de delta).",
+                            {{"cache", cache}}).Inc();
+        return hit;
+    }
+
+    // Define a compressão das respostas da chamada: preferência do cliente (metadado) ou padrão do servidor.
+    // Deve ser chamado antes da primeira escrita (vai nos metadados iniciais).
+    void NegotiateCompression(ServerContext* context) {
+        grpc_compression_algorithm alg = compression_;
+        auto it = context->client_metadata().find(RESPONSE_COMPRESSION_KEY);
+        if (it != context->client_metadata().end()) ParseCompression(std::string(it->second.data(), it->second.size()), alg);
+        if (alg != GRPC_COMPRESS_NONE) context->set_compression_algorithm(alg);
+    }
+
+    // Início de uma chamada com streaming: negocia compressão e tamanho de chunk e envia os
+    // metadados iniciais já (o cliente espera o chunk-size antes de enviar o arquivo)
+    template <typename Stream>
+    ChunkPolicy StartCall(ServerContext* context, Stream* stream) {
+        NegotiateCompression(context);
+        ChunkPolicy chunk = NegotiateChunkPolicy(*context, chunk_size_);
+        context->AddInitialMetadata(CHUNK_SIZE_KEY, std::to_string(chunk.initial));
+        stream->SendInitialMetadata();
+        return chunk;
+    }
+
+    // Executa um job da fila: as saídas ficam retidas e são registradas no status do job
+    void RunJob(const FileRequest& req, const std::string& fname, const fs::path& in, std::chrono::nanoseconds queued, JobStatus& st) {
+        RequestTimer timer;
+        timer.Add(PHASE_QUEUE, queued);
+        timer.StartTrace(TraceContext());
+        InFlight inflight(requests_, "job");
+        inflight->SetDetails(OperationName(req), fname);
+        inflight->SetTraceId(timer.trace().trace_id);
+        inflight->SetPhase(PHASE_EXECUTE);
+        InFlightThread current(inflight.get());
+        ScratchScope scratch(scratch_);
+        OperationResult res;
+        {
+            TraceScope trace(timer.trace());
+            res = RunOperation(req, fname, in, scratch);
+        }
+        timer.Mark(PHASE_EXECUTE);
+        inflight->SetPhase(PHASE_PERSIST);
+
+        bool ok = res.ok && !res.outputs.empty();
+        uint64_t output_bytes = 0;
+        // Saídas de um job com falha não são retidas
+        if (ok) for (const auto& o : res.outputs) {
+            ResultInfo info;
+            if (!results_.Retain(o.path, o.name, info)) { ok = false; continue; }
+            output_bytes += info.size;
+            auto* out = st.add_outputs();
+            out->set_file_name(info.name);
+            out->set_result_handle(info.handle);
+            out->set_output_size(info.size);
         }
+        timer.Mark(PHASE_PERSIST);
+        RecordRequest(timer, timer.Finish(latency_, OperationName(req) + "/job", ok), OperationName(req) + "/job", fname, ok, res.msg,
+                      0, output_bytes, in, res.tools);
+        st.set_state(ok ? file_processor::JOB_DONE : file_processor::JOB_FAILED);
+        st.set_status_message(res.msg);
+        LogOperation(OperationName(req), fname, ok, res.msg + " (job " + st.job_id() + ")" + AccountTools(metrics_, OperationName(req), res.tools));
+    }
 
-        // Envia arquivo de volta ao cliente
-        StreamFileBack(stream, out.string(), msg, ok);
-        LogOperation("ConvertImageFormat", fname, ok, msg);
-        return Status::OK;
+    static void FillUploadStatus(const UploadInfo& info, bool success, const std::string& msg, UploadStatus* resp) {
+        resp->set_upload_id(info.id);
+        resp->set_committed_offset(info.committed);
+        resp->set_total_size(info.total_size);
+        resp->set_complete(info.complete());
+        resp->set_success(success);
+        resp->set_status_message(msg);
     }
 
-    Status ResizeImage(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream) override {
-        std::string fname; 
-        std::vector<uint8_t> data; 
-        bool got_params=false; 
-        int width=512, height=512; 
+    // Fluxo comum das RPCs de arquivo único: recebe tudo, processa e devolve
+    Status ProcessSingle(ServerContext* context, ServerReaderWriter<FileResponse, FileRequest>* stream, const std::string& service, FileRequest::ParametersCase expected) {
+        GaugeScope active(ActiveStreams(service));
+        ChunkPolicy chunk = StartCall(context, stream);
+        ReceivedFile file;
+        file.timer.StartTrace(IncomingTrace(context));
+        file.inflight = TrackRequest(context, service, file.timer);
+        file.inflight->SetDetails(service, "");
         FileRequest req;
+        while (stream->Read(&req)) AccumulateRequest(req, file);
+        file.timer.Mark(PHASE_RECEIVE);
+        bytes_received_.Inc(file.data.size());
 
-        // Lê as requisições do stream
-        while (stream->Read(&req)) {
-            if (fname.empty() && !req.file_name().empty()) fname = req.file_name();
-            if (req.has_resize_image_params()) { 
-                got_params=true; 
-                if (req.resize_image_params().width()>0) 
-                    width = req.resize_image_params().width(); 
-                if (req.resize_image_params().height()>0) 
-                    height = req.resize_image_params().height(); 
-            }
+        // Apenas os parâmetros da própria operação são aceitos
+        bool got_params = file.has_params && file.params.parameters_case() == expected;
 
-            if (req.has_file_content()) { 
-                const auto& c = req.file_content().content(); 
-                data.insert(data.end(), c.begin(), c.end()); 
-            }
+        std::string msg;
+        auto write = [stream](const FileResponse& r, bool compress) { return stream->Write(r, ChunkWriteOptions(compress)); };
+        if (!file.error.empty()) {
+            SendFailure(write, service, file.fname, file.error);
+            RecordRequest(file.timer, file.timer.Finish(latency_, service, false), service, file.fname, false, file.error, file.data.size());
+        } else {
+            InFlightThread current(file.inflight.get());
+            ProcessFile(write, service, file.fname, file.data, got_params ? &file.params : nullptr, chunk, file.timer, msg);
         }
+        return Status::OK;
+    }
+
+    // Registra a requisição na lista de GetServerState
+    InFlight TrackRequest(const ServerContext* context, const std::string& rpc, const RequestTimer& timer) {
+        InFlight r(requests_, rpc, context->peer());
+        r->SetTraceId(timer.trace().trace_id);
+        return r;
+    }
+
+    // Persiste a entrada, executa a operação e envia as saídas pelo writer.
+    // Retorna sucesso da operação; msg recebe a mensagem de status final.
+    // Com upload_id nos parâmetros, a entrada é o upload já concluído (data é ignorado).
+    // As fases seguintes são marcadas em timer, registrado ao final com o resultado.
+    bool ProcessFile(const ResponseWriter& write, const std::string& service, std::string fname, const std::vector<uint8_t>& data, const FileRequest* params, const ChunkPolicy& chunk, RequestTimer& timer, std::string& msg) {
+        fs::path in;
+        auto fail = [&](const std::string& m, const std::vector<ToolInvocation>& tools = {}) {
+            SendFailure(write, service, fname, m, tools.empty() ? "" : AccountTools(metrics_, service, tools));
+            RecordRequest(timer, timer.Finish(latency_, service, false), service, fname, false, m, data.size(), 0, in, tools);
+            msg = m;
+            return false;
+        };
+
         // Caso não tenha parâmetros, retorna falha na requisição
-        if (!got_params) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Parâmetros ausentes"); 
-            stream->Write(r); 
-            return Status::OK; 
+        if (!params) return fail("Parâmetros ausentes");
+        InFlightRequest* current = CurrentInFlight();
+        auto phase = [current](int p) { if (current) current->SetPhase(p); };
+
+        // Entrada enviada antes por upload retomável: usada direto do storage
+        std::unique_ptr<PinScope> upload_pin;
+        if (!params->upload_id().empty()) {
+            UploadInfo info;
+            if (!uploads_.Lookup(params->upload_id(), info)) return fail("Upload inexistente ou expirado");
+            if (!info.complete()) return fail("Upload incompleto (" + std::to_string(info.committed) + "/" + std::to_string(info.total_size) + " bytes)");
+            if (fname.empty()) fname = info.file_name;
+            in = uploads_.DataPath(info.id);
+            if (current) current->SetDetails(service, fname);
+            upload_pin.reset(new PinScope(storage_, in));
         }
 
         // Salva arquivo de entrada no storage do servidor
-        fs::create_directories(StorageDir()); 
-        fs::path in = fs::path(StorageDir()) / ("in_" + fname);
-
-        // Retorna falha na requisição se não consegue escrever os bytes no arquivo
-        if (!WriteAll(in.string(), data)) { 
-            FileResponse r; 
-            r.set_success(false); 
-            r.set_status_message("Falha ao salvar entrada"); 
-            stream->Write(r); 
-            LogOperation("ResizeImage", fname, false, "Falha ao salvar entrada"); 
-            return Status::OK; 
+        ScratchScope scratch(scratch_);
+        if (in.empty()) {
+            phase(PHASE_PERSIST);
+            in = scratch.Anonymous("in_" + fname, data.size());
+            if (!WriteAll(in.string(), data)) return fail("Falha ao salvar entrada");
+            timer.Mark(PHASE_PERSIST);
         }
 
-        // Define caminho do arquivo de saída
-        fs::path out = fs::path(StorageDir()) / (fs::path(fname).stem().string() + "_" + std::to_string(width) + "x" + std::to_string(height) + ".img");
-        bool ok=false; std::string msg;
-
-        // Usa ImageMagick se disponível
-        if (CommandExists("convert")) {
-            std::string size = std::to_string(width) + "x" + std::to_string(height);
-            std::string cmd = "convert '"+in.string()+"' -resize " + size + " '" + out.string() + "'";
-            ok=(RunShell(cmd)==0); 
-            msg = ok?"Imagem redimensionada":"Falha ImageMagick";
-        } else {  // Fallback: copia como está
-            std::ofstream o(out, std::ios::binary); 
-            std::ifstream i(in, std::ios::binary); 
-            o<<i.rdbuf(); ok=o.good(); 
-            msg = ok?"Fallback: cópia":"Falha fallback"; 
+        // Executa a transformação (as ferramentas viram spans filhos da requisição)
+        OperationResult res;
+        phase(PHASE_EXECUTE);
+        {
+            TraceScope trace(timer.trace());
+            res = RunOperation(*params, fname, in, scratch);
         }
-
-        // Envia arquivo de volta ao cliente
-        StreamFileBack(stream, out.string(), msg, ok);
-        LogOperation("ResizeImage", fname, ok, msg);
-        return Status::OK;
+        timer.Mark(PHASE_EXECUTE);
+        // A saída de uma operação com falha (vazia ou parcial) não é retida nem enviada
+        if (!res.ok || res.outputs.empty()) return fail(res.msg, res.tools);
+
+        // Envia cada saída de volta ao cliente, identificada pelo nome. A saída é retida
+        // sob um result_handle antes do envio, para que o cliente possa buscá-la de novo com FetchOutput.
+        ChunkSizer sizer(chunk);
+        uint64_t sent = 0;
+        phase(PHASE_STREAM);
+        for (const auto& o : res.outputs) {
+            FileResponse header;
+            header.set_success(res.ok);
+            header.set_status_message(res.msg);
+            header.set_file_name(o.name);
+
+            ResultInfo info;
+            fs::path path = o.path;
+            std::unique_ptr<PinScope> pin;
+            if (results_.Retain(o.path, o.name, info)) {
+                path = results_.DataPath(info.handle);
+                pin.reset(new PinScope(storage_, path));
+                header.set_result_handle(info.handle);
+                header.set_output_size(info.size);
+                if (info.has_crc32c) header.set_output_crc32c(info.crc32c);
+            }
+            sent += StreamFileRange(write, path.string(), 0, 0, header, sizer);
+        }
+        bytes_sent_.Inc(sent);
+        RecordChunking(service, sizer);
+        timer.Mark(PHASE_STREAM);
+        RecordRequest(timer, timer.Finish(latency_, service, res.ok), service, fname, res.ok, res.msg, 0, sent, in, res.tools);
+        std::string log_msg = res.outputs.size() > 1 ? res.msg + " (" + std::to_string(res.outputs.size()) + " saídas)" : res.msg;
+        LogOperation(service, fname, res.ok, log_msg + " [" + sizer.Describe() + "]" + AccountTools(metrics_, service, res.tools));
+        msg = res.msg;
+        return res.ok;
     }
+
+    // Armazenamento compartilhado entre as requisições (uploads, resultados e jobs)
+    StorageLifecycle& storage_;
+
+    // Arquivos temporários das requisições (disco, tmpfs ou memfd)
+    ScratchStorage& scratch_;
+
+    // Threads que executam os arquivos da ProcessBatch
+    WorkerPool& pool_;
+
+    // Latência por fase das requisições
+    LatencyRecorder& latency_;
+
+    // Métricas expostas em /metrics
+    MetricsRegistry& metrics_;
+    Counter& bytes_received_;
+    Counter& bytes_sent_;
+
+    // Compressão padrão das respostas
+    grpc_compression_algorithm compression_;
+
+    // Tamanho de chunk inicial quando o cliente não indica preferência
+    size_t chunk_size_;
+
+    // Sessões de upload retomável
+    UploadStore uploads_;
+
+    // Bases dos uploads por delta
+    BasisStore bases_;
+
+    // Saídas retidas para FetchOutput
+    ResultStore results_;
+
+    // Requisições em andamento, listadas por GetServerState
+    InFlightRegistry requests_;
+    const std::chrono::steady_clock::time_point started_ = std::chrono::steady_clock::now();
+
+    // Fila de jobs assíncronos (declarada por último: as threads usam os membros acima)
+    JobQueue jobs_;
 };
 
-// Executa o servidor gRPC
-void RunServer(const std::string& server_address) {
-    // Instancia serviço
-    FileProcessorServiceImpl service;
+// Lê variável de ambiente numérica, com valor padrão
+static long long EnvOr(const char* name, long long def) {
+    const char* v = std::getenv(name);
+    if (!v || !*v) return def;
+    char* end = nullptr;
+    long long n = std::strtoll(v, &end, 10);
+    return (end && *end == '\0') ? n : def;
+}
+
+// Remove o socket Unix deixado por uma execução anterior (o bind falharia com o arquivo presente)
+static void RemoveStaleUnixSocket(const std::string& address) {
+    if (address.rfind("unix:", 0) != 0) return;
+    std::string path = address.substr(5);
+    if (path.rfind("//", 0) == 0) path = path.substr(2);     // unix:///caminho/absoluto
+    std::error_code ec;
+    if (fs::is_socket(path, ec)) fs::remove(path, ec);
+}
+
+// Limites das faixas do histograma de duração exportado (segundos)
+static const std::vector<double> DURATION_BOUNDS = {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60, 300};
+
+// Requisições e duração por operação, lidas dos histogramas de latência (fase total)
+static void WriteRequestMetrics(MetricsWriter& w, LatencyRecorder& latency) {
+    std::vector<std::pair<MetricLabels, const LatencyHistogram*>> totals;
+    latency.ForEach([&](const std::string& op, bool ok, int phase, const LatencyHistogram& h) {
+        if (phase == PHASE_TOTAL) totals.push_back({{{"operation", op}, {"result", ok ? "success" : "failure"}}, &h});
+    });
+    w.Family("file_processor_requests_total", "Requisições concluídas por operação e resultado.", "counter");
+    for (auto& t : totals) w.Sample("file_processor_requests_total", t.first, (double)t.second->count());
+    w.Family("file_processor_request_duration_seconds", "Duração total das requisições (faixas com erro relativo abaixo de 6,25%).", "histogram");
+    for (auto& t : totals) {
+        std::vector<uint64_t> cumulative;
+        for (double b : DURATION_BOUNDS) cumulative.push_back(t.second->CountAtMost((uint64_t)(b * 1e6)));
+        w.Histogram("file_processor_request_duration_seconds", t.first, DURATION_BOUNDS, cumulative, t.second->count(), (double)t.second->sum() / 1e6);
+    }
+}
+
+// Uso dos armazenamentos (medido na última varredura) e espaço livre no sistema de arquivos
+static void WriteStorageMetrics(MetricsWriter& w, const std::vector<std::pair<std::string, StorageLifecycle*>>& stores) {
+    w.Family("file_processor_storage_used_bytes", "Bytes nos shards do armazenamento na última varredura.", "gauge");
+    for (auto& st : stores) w.Sample("file_processor_storage_used_bytes", {{"store", st.first}}, (double)st.second->used_bytes());
+    w.Family("file_processor_storage_files", "Arquivos nos shards do armazenamento na última varredura.", "gauge");
+    for (auto& st : stores) w.Sample("file_processor_storage_files", {{"store", st.first}}, (double)st.second->used_files());
+    w.Family("file_processor_storage_swept_files_total", "Arquivos removidos pelas varreduras (TTL ou limite de uso).", "counter");
+    for (auto& st : stores) w.Sample("file_processor_storage_swept_files_total", {{"store", st.first}}, (double)st.second->removed_files());
+    w.Family("file_processor_storage_free_bytes", "Espaço livre no sistema de arquivos do armazenamento.", "gauge");
+    for (auto& st : stores) {
+        std::error_code ec;
+        fs::space_info sp = fs::space(st.second->config().root, ec);
+        if (!ec) w.Sample("file_processor_storage_free_bytes", {{"store", st.first}}, (double)sp.available);
+    }
+}
+
+// Executa o servidor gRPC em todos os endereços (TCP host:porta ou unix:/caminho)
+void RunServer(const std::vector<std::string>& addresses) {
+    // Log assíncrono com rotação por tamanho
+    LogConfig log_cfg;
+    log_cfg.path = LogFilePath();
+    log_cfg.max_bytes = (uint64_t)EnvOr("LOG_MAX_MB", 64) * 1024 * 1024;
+    log_cfg.keep = (int)EnvOr("LOG_KEEP", 3);
+    log_cfg.thread_buffer = (size_t)EnvOr("LOG_BUFFER_KB", 256) * 1024;
+    log_cfg.flush_interval = std::chrono::milliseconds(EnvOr("LOG_FLUSH_MS", 50));
+    g_logger.reset(new AsyncLogger(log_cfg));
+
+    // Requisições acima de SLOW_REQUEST_MS (padrão 2000; 0 desliga) vão para server_cpp/slow.log
+    long long slow_ms = EnvOr("SLOW_REQUEST_MS", 2000);
+    if (slow_ms > 0) {
+        LogConfig slow_cfg = log_cfg;
+        slow_cfg.path = (fs::path(__FILE__).parent_path() / "slow.log").string();
+        g_slow_log.reset(new SlowLog(slow_cfg, std::chrono::milliseconds(slow_ms)));
+    }
 
-    // Configura servidor gRPC
+    // Log binário de operações (OPLOG_DIR; um arquivo por dia, lido por scripts/oplog_report.sh)
+    const char* oplog_dir = std::getenv("OPLOG_DIR");
+    if (oplog_dir && *oplog_dir) {
+        OpLogConfig oplog_cfg;
+        oplog_cfg.dir = oplog_dir;
+        oplog_cfg.flush_interval = std::chrono::milliseconds(EnvOr("OPLOG_FLUSH_MS", 1000));
+        g_oplog.reset(new OpLog(oplog_cfg));
+        std::cout << "Oplog em " << oplog_dir << std::endl;
+    }
+
+    // Spans em OTLP-JSON (TRACE_DIR; sem ele o tracing fica desligado)
+    std::unique_ptr<TraceExporter> tracer;
+    const char* trace_dir = std::getenv("TRACE_DIR");
+    if (trace_dir && *trace_dir) {
+        TraceConfig trace_cfg;
+        std::error_code ec;
+        fs::create_directories(trace_dir, ec);
+        trace_cfg.path = (fs::path(trace_dir) / "server.otlp.jsonl").string();
+        trace_cfg.flush_interval = std::chrono::milliseconds(EnvOr("TRACE_FLUSH_MS", 1000));
+        tracer.reset(new TraceExporter(trace_cfg));
+        SetTraceExporter(tracer.get());
+    }
+
+    // Configura o ciclo de vida do storage (TTL, limite de disco e fan-out)
+    StorageConfig cfg;
+    cfg.root = StorageDir();
+    cfg.shard_levels = (int)EnvOr("STORAGE_SHARD_LEVELS", 2);
+    cfg.ttl = std::chrono::seconds(EnvOr("STORAGE_TTL_SECONDS", 3600));
+    cfg.max_bytes = (uint64_t)EnvOr("STORAGE_MAX_MB", 0) * 1024 * 1024;
+    cfg.sweep_interval = std::chrono::seconds(EnvOr("STORAGE_SWEEP_SECONDS", 60));
+    StorageLifecycle storage(cfg);
+
+    // Backend de E/S das gravações no storage (io_uring com fallback para pread/pwrite)
+    const char* io_mode = std::getenv("STORAGE_IO");
+    if (io_mode && !ConfigureStorageIo(io_mode)) std::cerr << "STORAGE_IO inválido: " << io_mode << " (usando auto)" << std::endl;
+
+    // Temporários das requisições: shards do storage em disco, tmpfs ou memfd
+    ScratchConfig scratch_cfg;
+    const char* backend = std::getenv("SCRATCH_BACKEND");
+    if (backend && *backend && !ParseScratchBackend(backend, scratch_cfg.backend)) std::cerr << "SCRATCH_BACKEND inválido: " << backend << " (usando disk)" << std::endl;
+    scratch_cfg.memfd_max_bytes = (uint64_t)EnvOr("SCRATCH_MEMFD_MAX_MB", 64) * 1024 * 1024;
+    std::unique_ptr<StorageLifecycle> tmpfs;
+    if (scratch_cfg.backend == ScratchBackend::TMPFS) {
+        // Mesmo TTL, limite e fan-out do storage, com varredor próprio
+        StorageConfig tmpfs_cfg = cfg;
+        const char* scratch_dir = std::getenv("SCRATCH_DIR");
+        tmpfs_cfg.root = (scratch_dir && *scratch_dir) ? scratch_dir : "/dev/shm/projeto_grpc";
+        tmpfs.reset(new StorageLifecycle(tmpfs_cfg));
+        if (!IsMemoryFilesystem(tmpfs_cfg.root)) std::cerr << "Aviso: " << tmpfs_cfg.root << " não está em tmpfs" << std::endl;
+    }
+    ScratchStorage scratch(tmpfs ? *tmpfs : storage, scratch_cfg);
+
+    // Latência por fase, gravada periodicamente ao lado do server.log (0 desliga)
+    LatencyRecorder latency;
+    latency.StartDump((fs::path(__FILE__).parent_path() / "latency.txt").string(), std::chrono::seconds(EnvOr("LATENCY_DUMP_SECONDS", 60)));
+
+    // Métricas (contadores atualizados pelas requisições; o restante é lido na hora da coleta)
+    MetricsRegistry metrics;
+    SetToolObserver([&metrics](const ToolInvocation& inv) {
+        MetricLabels labels = {{"tool", inv.tool}, {"result", inv.status == 0 ? "success" : "failure"}};
+        metrics.GetCounter("file_processor_tool_invocations_total", "Execuções de ferramentas externas por ferramenta e resultado.", labels).Inc();
+        metrics.GetCounter("file_processor_tool_microseconds_total", "Tempo total de execução das ferramentas externas.", {{"tool", inv.tool}})
+            .Inc((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(inv.elapsed).count());
+
+        // Span da ferramenta, filho da requisição que a executou
+        if (CurrentTrace().valid()) {
+            auto end = std::chrono::system_clock::now();
+            Span span(inv.tool, CurrentTrace(), SPAN_INTERNAL, end - std::chrono::duration_cast<std::chrono::system_clock::duration>(inv.elapsed));
+            span.SetAttribute("process.command_line", inv.command);
+            span.SetAttribute("process.exit_status", std::to_string(inv.status));
+            span.SetAttribute("process.cpu.user_us", std::to_string(inv.usage.user_cpu.count()));
+            span.SetAttribute("process.cpu.system_us", std::to_string(inv.usage.system_cpu.count()));
+            span.SetAttribute("process.max_rss_kb", std::to_string(inv.usage.max_rss_kb));
+            span.SetStatus(inv.status == 0, "Ferramenta terminou com status " + std::to_string(inv.status));
+            span.End(end);
+        }
+    });
+
+    // Pool que processa os arquivos da ProcessBatch
+    long long threads = EnvOr("WORKER_THREADS", (long long)std::thread::hardware_concurrency());
+    WorkerPool pool(threads > 0 ? (size_t)threads : 1);
+
+    // Instancia serviço (recupera jobs pendentes antes de iniciar a varredura do storage)
+    long long job_threads = EnvOr("JOB_THREADS", (long long)std::thread::hardware_concurrency());
+    grpc_compression_algorithm compression = GRPC_COMPRESS_GZIP;
+    const char* comp = std::getenv("GRPC_COMPRESSION");
+    if (comp && *comp && !ParseCompression(comp, compression)) std::cerr << "GRPC_COMPRESSION inválido: " << comp << " (usando gzip)" << std::endl;
+    // Tamanho de chunk inicial (em KB; adaptado depois pela vazão de cada chamada)
+    long long chunk_kb = EnvOr("CHUNK_SIZE_KB", 256);
+    size_t chunk_size = ClampChunk((size_t)(chunk_kb > 0 ? chunk_kb : 256) * 1024);
+    FileProcessorServiceImpl service(storage, scratch, pool, latency, metrics, job_threads > 0 ? (size_t)job_threads : 1, compression, chunk_size);
+    storage.Start();
+    if (tmpfs) tmpfs->Start();
+
+    std::vector<std::pair<std::string, StorageLifecycle*>> stores = {{"storage", &storage}};
+    if (tmpfs) stores.push_back({"scratch", tmpfs.get()});
+    metrics.AddCollector([&latency](MetricsWriter& w) { WriteRequestMetrics(w, latency); });
+    metrics.AddCollector([stores](MetricsWriter& w) { WriteStorageMetrics(w, stores); });
+    metrics.AddCollector([&pool, &service](MetricsWriter& w) {
+        w.Family("file_processor_worker_threads", "Threads do pool de processamento.", "gauge");
+        w.Sample("file_processor_worker_threads", {}, (double)pool.Threads());
+        w.Family("file_processor_worker_active", "Tarefas em execução no pool.", "gauge");
+        w.Sample("file_processor_worker_active", {}, (double)pool.Active());
+        w.Family("file_processor_worker_queued", "Tarefas aguardando uma thread do pool.", "gauge");
+        w.Sample("file_processor_worker_queued", {}, (double)pool.Queued());
+        w.Family("file_processor_jobs", "Jobs assíncronos por estado.", "gauge");
+        w.Sample("file_processor_jobs", {{"state", "queued"}}, (double)service.JobsQueued());
+        w.Sample("file_processor_jobs", {{"state", "running"}}, (double)service.JobsRunning());
+        w.Family("file_processor_inflight_requests", "Requisições em andamento (as mesmas de GetServerState).", "gauge");
+        w.Sample("file_processor_inflight_requests", {}, (double)service.Requests().Count());
+        w.Family("file_processor_ingest_buffer_bytes", "Memória ocupada pelos arquivos recebidos em memória.", "gauge");
+        w.Sample("file_processor_ingest_buffer_bytes", {}, (double)IngestBufferBytes());
+    });
+    metrics.AddCollector([](MetricsWriter& w) {
+        w.Family("file_processor_log_dropped_lines_total", "Linhas do server.log descartadas por buffer cheio.", "counter");
+        w.Sample("file_processor_log_dropped_lines_total", {}, g_logger ? (double)g_logger->dropped() : 0);
+        if (g_oplog) {
+            w.Family("file_processor_oplog_dropped_records_total", "Registros do oplog descartados (buffer cheio ou falha de escrita).", "counter");
+            w.Sample("file_processor_oplog_dropped_records_total", {}, (double)g_oplog->dropped());
+        }
+        WriteProcessMetrics(w);
+    });
+
+    // Entrega local por descritores (opcional): a entrada e as saídas não passam pelo gRPC
+    FdHandoffServer handoff(scratch, pool, [&latency, &metrics, &service](const FileRequest& req, const std::string& fname, const fs::path& in, ScratchScope& scratch) {
+        RequestTimer timer;
+        timer.StartTrace(TraceContext());
+        InFlight inflight(service.Requests(), "local");
+        inflight->SetDetails(OperationName(req), fname);
+        inflight->SetTraceId(timer.trace().trace_id);
+        inflight->SetPhase(PHASE_EXECUTE);
+        InFlightThread current(inflight.get());
+        OperationResult res;
+        {
+            TraceScope trace(timer.trace());
+            res = RunOperation(req, fname, in, scratch);
+        }
+        timer.Mark(PHASE_EXECUTE);
+        uint64_t output_bytes = 0;
+        for (const auto& o : res.outputs) {
+            std::error_code ec;
+            uint64_t size = fs::file_size(o.path, ec);
+            if (!ec) output_bytes += size;
+        }
+        RecordRequest(timer, timer.Finish(latency, OperationName(req) + "/local", res.ok), OperationName(req) + "/local", fname, res.ok, res.msg,
+                      0, output_bytes, in, res.tools);
+        LogOperation(OperationName(req), fname, res.ok, res.msg + " (local, por descritor)" + AccountTools(metrics, OperationName(req), res.tools));
+        return res;
+    });
+    // Métricas no formato do Prometheus (METRICS_ADDRESS=off desliga)
+    MetricsHttpServer metrics_http(metrics);
+    const char* metrics_env = std::getenv("METRICS_ADDRESS");
+    std::string metrics_address = metrics_env ? metrics_env : "127.0.0.1:9464";
+    if (!metrics_address.empty() && metrics_address != "off") {
+        std::string err;
+        if (metrics_http.Start(metrics_address, err)) std::cout << "Métricas em http://" << metrics_address << "/metrics" << std::endl;
+        else std::cerr << err << std::endl;
+    }
+
+    const char* handoff_path = std::getenv("LOCAL_HANDOFF_SOCKET");
+    if (handoff_path && *handoff_path) {
+        // Conexões locais no pool; por padrão metade das threads, o resto fica para a ProcessBatch
+        long long handoff_max = EnvOr("LOCAL_HANDOFF_MAX", (long long)std::max<size_t>(1, pool.Threads() / 2));
+        std::string err;
+        if (handoff.Start(handoff_path, handoff_max > 0 ? (size_t)handoff_max : 1, err)) std::cout << "Entrega local por descritores em " << handoff_path << std::endl;
+        else std::cerr << err << std::endl;
+    }
+
+    // Configura servidor gRPC; clientes no mesmo host podem usar o socket Unix e evitar a pilha TCP/IP
     ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    for (const auto& address : addresses) {
+        RemoveStaleUnixSocket(address);
+        builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+    }
     builder.RegisterService(&service);
 
     // Inicia servidor
     std::unique_ptr<Server> server(builder.BuildAndStart());
-    std::cout << "Servidor gRPC ouvindo em " << server_address << std::endl;
+    if (!server) {
+        std::cerr << "Falha ao iniciar o servidor (endereço inválido ou em uso)" << std::endl;
+        return;
+    }
+    for (const auto& address : addresses) std::cout << "Servidor gRPC ouvindo em " << address << std::endl;
+    std::cout << "CRC32C: " << Crc32cImplementation() << std::endl;
+    std::cout << "E/S do storage: " << StorageIoBackend() << std::endl;
+    if (trace_dir && *trace_dir) std::cout << "Traces: " << (fs::path(trace_dir) / "server.otlp.jsonl").string() << std::endl;
+    std::cout << "Scratch: " << ScratchBackendName(scratch_cfg.backend) << " (" << scratch.files().config().root << ")" << std::endl;
 
     // Aguarda conexões
     server->Wait();
 }
 
+// Uso: servidor [endereço ...]; cada endereço é host:porta ou unix:/caminho.sock.
+// UNIX_SOCKET acrescenta um socket Unix ao endereço TCP padrão.
 int main(int argc, char** argv) {
-    std::string address = "0.0.0.0:50051";
-    if (argc >= 2) address = argv[1];
-    RunServer(address);
+    std::vector<std::string> addresses;
+    for (int i = 1; i < argc; i++) addresses.push_back(argv[i]);
+    if (addresses.empty()) addresses.push_back("0.0.0.0:50051");
+    const char* unix_socket = std::getenv("UNIX_SOCKET");
+    if (unix_socket && *unix_socket) addresses.push_back(std::string("unix:") + unix_socket);
+    RunServer(addresses);
     return 0;
 }
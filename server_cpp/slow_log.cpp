@@ -0,0 +1,115 @@
+/*
+ * Implementação do log de requisições lentas.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "slow_log.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <sys/wait.h>
+
+#include "tracing.h"
+
+namespace fs = std::filesystem;
+
+std::string SniffFileType(const std::string& path, const std::string& file_name) {
+    unsigned char h[12] = {0};
+    size_t n = 0;
+    if (!path.empty()) {
+        std::ifstream f(path, std::ios::binary);
+        f.read(reinterpret_cast<char*>(h), sizeof(h));
+        n = (size_t)f.gcount();
+    }
+    if (n >= 4 && std::memcmp(h, "%PDF", 4) == 0) return "pdf";
+    if (n >= 4 && std::memcmp(h, "\x89PNG", 4) == 0) return "png";
+    if (n >= 3 && h[0] == 0xFF && h[1] == 0xD8 && h[2] == 0xFF) return "jpeg";
+    if (n >= 4 && std::memcmp(h, "GIF8", 4) == 0) return "gif";
+    if (n >= 12 && std::memcmp(h, "RIFF", 4) == 0 && std::memcmp(h + 8, "WEBP", 4) == 0) return "webp";
+    if (n >= 4 && (std::memcmp(h, "II*\0", 4) == 0 || std::memcmp(h, "MM\0*", 4) == 0)) return "tiff";
+    if (n >= 2 && h[0] == 'B' && h[1] == 'M') return "bmp";
+
+    // Sem assinatura conhecida: extensão declarada pelo cliente
+    std::string ext = fs::path(file_name).extension().string();
+    if (ext.size() > 1) {
+        ext.erase(0, 1);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return ext;
+    }
+    return "unknown";
+}
+
+// Milissegundos com três casas (resolução de microssegundo)
+static std::string Millis(std::chrono::nanoseconds d) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.3f", (double)std::chrono::duration_cast<std::chrono::microseconds>(d).count() / 1000.0);
+    return buf;
+}
+
+static void AppendField(std::string& out, const char* key, const std::string& raw) {
+    if (out.back() != '{') out += ",";
+    out += "\"";
+    out += key;
+    out += "\":";
+    out += raw;
+}
+
+static void AppendStringField(std::string& out, const char* key, const std::string& value) {
+    std::string s;
+    AppendJsonString(s, value);
+    AppendField(out, key, s);
+}
+
+// Uma execução de ferramenta: comando, término e recursos
+static void AppendTool(std::string& out, const ToolInvocation& inv) {
+    out += "{";
+    AppendStringField(out, "tool", inv.tool);
+    AppendStringField(out, "command", inv.command);
+    AppendField(out, "status", std::to_string(inv.status));
+    if (inv.status >= 0 && WIFEXITED(inv.status)) AppendField(out, "exit_code", std::to_string(WEXITSTATUS(inv.status)));
+    else if (inv.status >= 0 && WIFSIGNALED(inv.status)) AppendField(out, "signal", std::to_string(WTERMSIG(inv.status)));
+    AppendField(out, "elapsed_ms", Millis(inv.elapsed));
+    AppendField(out, "cpu_user_ms", Millis(inv.usage.user_cpu));
+    AppendField(out, "cpu_system_ms", Millis(inv.usage.system_cpu));
+    AppendField(out, "max_rss_kb", std::to_string(inv.usage.max_rss_kb));
+    AppendField(out, "voluntary_switches", std::to_string(inv.usage.voluntary_switches));
+    AppendField(out, "involuntary_switches", std::to_string(inv.usage.involuntary_switches));
+    AppendField(out, "block_in", std::to_string(inv.usage.block_in));
+    AppendField(out, "block_out", std::to_string(inv.usage.block_out));
+    AppendStringField(out, "stderr", inv.stderr_tail);
+    out += "}";
+}
+
+void SlowLog::Write(const SlowRequest& r) {
+    std::string line = "{";
+    AppendStringField(line, "time", CachedTimestamp());
+    AppendStringField(line, "operation", r.operation);
+    AppendStringField(line, "file", r.file_name);
+    AppendField(line, "ok", r.ok ? "true" : "false");
+    AppendStringField(line, "message", r.message);
+    if (!r.trace_id.empty()) AppendStringField(line, "trace_id", r.trace_id);
+    AppendField(line, "input_bytes", std::to_string(r.input_bytes));
+    AppendStringField(line, "input_type", r.input_type);
+    AppendField(line, "total_ms", Millis(r.total));
+    AppendField(line, "queue_ms", Millis(r.phases[PHASE_QUEUE]));
+
+    std::string phases = "{";
+    for (int p = 0; p < PHASE_TOTAL; p++) {
+        if (r.measured & (1u << p)) AppendField(phases, PhaseName(p), Millis(r.phases[(size_t)p]));
+    }
+    AppendField(line, "phases_ms", phases + "}");
+
+    std::string tools = "[";
+    for (size_t i = 0; i < r.tools.size(); i++) {
+        if (i > 0) tools += ",";
+        AppendTool(tools, r.tools[i]);
+    }
+    AppendField(line, "tools", tools + "]");
+    line += "}";
+    log_.Append(line);
+}
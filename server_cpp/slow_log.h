@@ -0,0 +1,61 @@
+/*
+ * Log de requisições lentas (slow.log).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Requisições cujo total passa do limite (SLOW_REQUEST_MS) são gravadas com o contexto para
+ * diagnóstico: fases, espera na fila, tamanho e tipo da entrada e, para cada ferramenta externa,
+ * a linha de comando, o status de saída, os recursos usados e o final da saída de erro. Um
+ * registro é um objeto JSON por linha; a escrita usa um AsyncLogger próprio (buffer por thread,
+ * rotação por tamanho), então a requisição lenta não espera o disco.
+ */
+
+#ifndef SERVER_CPP_SLOW_LOG_H
+#define SERVER_CPP_SLOW_LOG_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "async_log.h"
+#include "latency.h"
+#include "operations.h"
+
+// Contexto de uma requisição lenta
+struct SlowRequest {
+    std::string operation;
+    std::string file_name;
+    bool ok = false;
+    std::string message;
+    std::string trace_id;                               // Vazio sem tracing
+    uint64_t input_bytes = 0;
+    std::string input_type;                             // "pdf", "png", ... (ver SniffFileType)
+    std::chrono::nanoseconds total{0};
+    std::array<std::chrono::nanoseconds, PHASE_COUNT> phases{};
+    unsigned measured = 0;                              // Bitmask das fases medidas
+    std::vector<ToolInvocation> tools;
+};
+
+// Tipo do arquivo pelos primeiros bytes; sem assinatura conhecida, pela extensão do nome
+// ("unknown" se nenhum dos dois ajuda)
+std::string SniffFileType(const std::string& path, const std::string& file_name);
+
+class SlowLog {
+public:
+    SlowLog(LogConfig cfg, std::chrono::milliseconds threshold) : log_(std::move(cfg)), threshold_(threshold) {}
+
+    SlowLog(const SlowLog&) = delete;
+    SlowLog& operator=(const SlowLog&) = delete;
+
+    bool IsSlow(std::chrono::nanoseconds total) const { return total >= threshold_; }
+
+    // Grava o registro (uma linha JSON)
+    void Write(const SlowRequest& r);
+
+private:
+    AsyncLogger log_;
+    std::chrono::milliseconds threshold_;
+};
+
+#endif  // SERVER_CPP_SLOW_LOG_H
@@ -0,0 +1,380 @@
+/*
+ * Implementação da E/S de disco do storage (io_uring com fallback pread/pwrite).
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "storage_io.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+// Dimensões de cada anel
+static const unsigned RING_DEPTH = 16;                  // Operações por submissão
+static const unsigned RING_BUFFERS = 4;                 // Buffers registrados
+static const size_t RING_BUFFER_SIZE = 1024 * 1024;
+static const size_t WRITE_SEGMENT = 1024 * 1024;        // Segmento de cada escrita em lote
+
+enum StorageIoMode { IO_AUTO, IO_URING, IO_SYNC };
+static std::atomic<int> g_io_mode{IO_AUTO};
+
+namespace {
+
+// Anel io_uring de uma thread (submissão e conclusão mapeadas do kernel)
+class Ring {
+public:
+    ~Ring() { Release(); }
+
+    bool Init();
+    bool ok() const { return fd_ >= 0; }
+
+    // Prepara uma operação; retorna o identificador (0 se a fila de submissão está cheia)
+    uint64_t Prep(uint8_t opcode, int fd, const void* addr, unsigned len, uint64_t offset, int buf_index);
+
+    // Submete o que foi preparado, sem esperar. Na falha as operações preparadas são retiradas
+    // da fila (não serão executadas nem concluídas) e o chamador as refaz por pwrite
+    bool Submit();
+
+    // Espera a conclusão da operação id; res recebe o resultado (bytes ou -errno)
+    bool Wait(uint64_t id, int& res);
+
+    // Buffers registrados (-1 se não há livre)
+    int AcquireBuffer();
+    void ReleaseBuffer(int idx) { if (idx >= 0) free_bufs_ |= 1u << idx; }
+    char* Buffer(int idx) { return bufs_[(size_t)idx]; }
+    bool fixed() const { return fixed_; }
+
+private:
+    int Enter(unsigned to_submit, unsigned min_complete, unsigned flags);
+    void Reap();
+    void Release();
+
+    int fd_ = -1;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0, sq_entries_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    struct io_uring_sqe* sqes_ = nullptr;
+    struct io_uring_cqe* cqes_ = nullptr;
+    void* sq_map_ = MAP_FAILED;
+    void* cq_map_ = MAP_FAILED;
+    size_t sq_map_len_ = 0, cq_map_len_ = 0, sqes_len_ = 0;
+    unsigned unsubmitted_ = 0;
+    uint64_t next_id_ = 1;
+    std::map<uint64_t, int> done_;                      // Concluídas ainda não consultadas
+    std::vector<char*> bufs_;
+    unsigned free_bufs_ = 0;                            // Bitmask dos buffers livres
+    bool fixed_ = false;                                // Buffers registrados no kernel
+};
+
+bool Ring::Init() {
+    struct io_uring_params p;
+    std::memset(&p, 0, sizeof(p));
+    fd_ = (int)syscall(__NR_io_uring_setup, RING_DEPTH, &p);
+    if (fd_ < 0) return false;
+
+    sq_map_len_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_map_len_ = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single) sq_map_len_ = cq_map_len_ = std::max(sq_map_len_, cq_map_len_);
+    sq_map_ = mmap(nullptr, sq_map_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+    if (sq_map_ != MAP_FAILED) {
+        cq_map_ = single ? sq_map_ : mmap(nullptr, cq_map_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+    }
+    sqes_len_ = p.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = cq_map_ == MAP_FAILED ? MAP_FAILED : mmap(nullptr, sqes_len_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) { Release(); return false; }
+    sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(sq_map_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+    sq_entries_ = p.sq_entries;
+    char* cq = static_cast<char*>(cq_map_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + p.cq_off.cqes);
+
+    // Buffers registrados: o kernel fixa as páginas uma vez, em vez de a cada operação.
+    // Sem registro (limite de memória travada), os mesmos buffers seguem em escritas comuns.
+    std::vector<struct iovec> iov;
+    for (unsigned i = 0; i < RING_BUFFERS; i++) {
+        void* b = nullptr;
+        if (posix_memalign(&b, 4096, RING_BUFFER_SIZE) != 0) break;
+        bufs_.push_back(static_cast<char*>(b));
+        iov.push_back({b, RING_BUFFER_SIZE});
+    }
+    free_bufs_ = (1u << bufs_.size()) - 1;
+    fixed_ = !iov.empty() && syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, iov.data(), (unsigned)iov.size()) == 0;
+    return true;
+}
+
+void Ring::Release() {
+    if (sqes_) munmap(sqes_, sqes_len_);
+    if (cq_map_ != MAP_FAILED && cq_map_ != sq_map_) munmap(cq_map_, cq_map_len_);
+    if (sq_map_ != MAP_FAILED) munmap(sq_map_, sq_map_len_);
+    if (fd_ >= 0) close(fd_);
+    for (char* b : bufs_) std::free(b);
+    sqes_ = nullptr;
+    sq_map_ = cq_map_ = MAP_FAILED;
+    fd_ = -1;
+    bufs_.clear();
+    free_bufs_ = 0;
+}
+
+uint64_t Ring::Prep(uint8_t opcode, int fd, const void* addr, unsigned len, uint64_t offset, int buf_index) {
+    unsigned tail = *sq_tail_;
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) return 0;
+
+    unsigned idx = tail & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[idx];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)addr;
+    sqe->len = len;
+    sqe->off = offset;
+    if (buf_index >= 0) sqe->buf_index = (uint16_t)buf_index;
+    sqe->user_data = next_id_;
+    sq_array_[idx] = idx;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    unsubmitted_++;
+    return next_id_++;
+}
+
+int Ring::Enter(unsigned to_submit, unsigned min_complete, unsigned flags) {
+    while (true) {
+        int r = (int)syscall(__NR_io_uring_enter, fd_, to_submit, min_complete, flags, nullptr, 0);
+        if (r >= 0 || errno != EINTR) return r;
+    }
+}
+
+bool Ring::Submit() {
+    if (unsubmitted_ == 0) return true;
+    int r = Enter(unsubmitted_, 0, 0);
+    if (r < 0) {
+        // Com erro o kernel não consumiu nenhuma entrada; as não submetidas são as últimas da fila
+        __atomic_store_n(sq_tail_, *sq_tail_ - unsubmitted_, __ATOMIC_RELEASE);
+        unsubmitted_ = 0;
+        return false;
+    }
+    unsubmitted_ -= std::min((unsigned)r, unsubmitted_);
+    return true;
+}
+
+void Ring::Reap() {
+    unsigned head = *cq_head_;
+    unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        const struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+        done_[cqe->user_data] = cqe->res;
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+}
+
+bool Ring::Wait(uint64_t id, int& res) {
+    while (true) {
+        Reap();
+        auto it = done_.find(id);
+        if (it != done_.end()) {
+            res = it->second;
+            done_.erase(it);
+            return true;
+        }
+        int r = Enter(unsubmitted_, 1, IORING_ENTER_GETEVENTS);
+        if (r < 0) return false;
+        unsubmitted_ -= std::min((unsigned)r, unsubmitted_);
+    }
+}
+
+int Ring::AcquireBuffer() {
+    for (unsigned i = 0; i < bufs_.size(); i++) {
+        if (free_bufs_ & (1u << i)) {
+            free_bufs_ &= ~(1u << i);
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+}  // namespace
+
+// Anel da thread atual; nullptr com o backend síncrono ou se o kernel recusar io_uring
+// (desabilitado por sysctl ou filtrado por seccomp, comum em contêineres)
+static Ring* ThreadRing() {
+    if (g_io_mode == IO_SYNC) return nullptr;
+    thread_local Ring ring;
+    thread_local bool tried = false;
+    if (!tried) {
+        tried = true;
+        ring.Init();
+    }
+    return ring.ok() ? &ring : nullptr;
+}
+
+// Grava tudo com pwrite (backend síncrono e complemento de escritas curtas)
+static bool PwriteAll(int fd, const char* p, size_t n, uint64_t offset) {
+    while (n > 0) {
+        ssize_t r = pwrite(fd, p, n, (off_t)offset);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        p += r;
+        n -= (size_t)r;
+        offset += (uint64_t)r;
+    }
+    return true;
+}
+
+bool ConfigureStorageIo(const std::string& mode) {
+    if (mode.empty() || mode == "auto") g_io_mode = IO_AUTO;
+    else if (mode == "uring") g_io_mode = IO_URING;
+    else if (mode == "sync") g_io_mode = IO_SYNC;
+    else return false;
+    return true;
+}
+
+const char* StorageIoBackend() {
+    return ThreadRing() ? "io_uring" : "pread/pwrite";
+}
+
+bool IoWriteFile(const fs::path& path, const void* data, size_t n) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    const char* p = static_cast<const char*>(data);
+    bool ok = true;
+
+    Ring* ring = ThreadRing();
+    if (!ring) ok = PwriteAll(fd, p, n, 0);
+    uint64_t off = 0;
+    while (ring && ok && off < n) {
+        // Até RING_DEPTH segmentos por submissão
+        struct Segment { uint64_t id, off; size_t len; };
+        std::vector<Segment> batch;
+        while (off < n && batch.size() < RING_DEPTH) {
+            size_t len = (size_t)std::min<uint64_t>(WRITE_SEGMENT, n - off);
+            uint64_t id = ring->Prep(IORING_OP_WRITE, fd, p + off, (unsigned)len, off, -1);
+            if (!id) break;
+            batch.push_back({id, off, len});
+            off += len;
+        }
+        if (batch.empty() || !ring->Submit()) {
+            uint64_t from = batch.empty() ? off : batch.front().off;
+            ok = PwriteAll(fd, p + from, n - from, from);
+            break;
+        }
+
+        // Escrita curta ou recusada pelo kernel: o restante do segmento vai por pwrite
+        for (const auto& s : batch) {
+            int res = 0;
+            if (!ring->Wait(s.id, res)) { ok = false; continue; }
+            size_t done = res > 0 ? (size_t)res : 0;
+            if (done < s.len) ok = PwriteAll(fd, p + s.off + done, s.len - done, s.off + done) && ok;
+        }
+    }
+    return close(fd) == 0 && ok;
+}
+
+IoAppender::~IoAppender() {
+    Flush();
+    Ring* ring = ThreadRing();
+    if (ring) {
+        ring->ReleaseBuffer(buf_[0]);
+        ring->ReleaseBuffer(buf_[1]);
+    }
+    if (fd_ >= 0) close(fd_);
+}
+
+bool IoAppender::Open(const fs::path& path) {
+    fd_ = open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+    struct stat st;
+    if (fd_ < 0 || fstat(fd_, &st) != 0) return false;
+    offset_ = (uint64_t)st.st_size;
+
+    // Dois buffers: um recebe a cópia do próximo chunk enquanto o outro está no disco
+    Ring* ring = ThreadRing();
+    if (ring) {
+        buf_[0] = ring->AcquireBuffer();
+        buf_[1] = ring->AcquireBuffer();
+        if (buf_[1] < 0) {
+            ring->ReleaseBuffer(buf_[0]);
+            buf_[0] = -1;
+        }
+    }
+    return true;
+}
+
+bool IoAppender::Append(const char* data, size_t n) {
+    if (fd_ < 0 || failed_) return false;
+    Ring* ring = ThreadRing();
+    if (!ring || buf_[1] < 0) {
+        if (!PwriteAll(fd_, data, n, offset_)) failed_ = true;
+        else offset_ += n;
+        return !failed_;
+    }
+
+    while (n > 0) {
+        size_t len = std::min(n, RING_BUFFER_SIZE);
+        std::memcpy(ring->Buffer(buf_[cur_]), data, len);
+        if (!Submit(ring->Buffer(buf_[cur_]), len)) return false;
+        cur_ ^= 1;
+        data += len;
+        n -= len;
+    }
+    return true;
+}
+
+bool IoAppender::Submit(const char* data, size_t n) {
+    // A escrita anterior termina antes desta começar (sem lacunas no arquivo)
+    if (!Flush()) return false;
+
+    Ring* ring = ThreadRing();
+    uint64_t id = ring->Prep(ring->fixed() ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE, fd_, data, (unsigned)n, offset_,
+                             ring->fixed() ? buf_[cur_] : -1);
+    if (!id || !ring->Submit()) {
+        if (!PwriteAll(fd_, data, n, offset_)) { failed_ = true; return false; }
+        offset_ += n;
+        return true;
+    }
+    pending_ = id;
+    pending_len_ = n;
+    offset_ += n;
+    return true;
+}
+
+bool IoAppender::Flush() {
+    if (!pending_) return !failed_;
+    Ring* ring = ThreadRing();
+    uint64_t id = pending_;
+    pending_ = 0;
+
+    int res = 0;
+    if (!ring->Wait(id, res)) { failed_ = true; return false; }
+    size_t done = res > 0 ? (size_t)res : 0;
+    if (done < pending_len_) {
+        // Completa a escrita curta a partir do mesmo buffer (o da escrita pendente é o outro)
+        const char* buf = ring->Buffer(buf_[cur_ ^ 1]);
+        uint64_t off = offset_ - pending_len_;
+        if (!PwriteAll(fd_, buf + done, pending_len_ - done, off + done)) failed_ = true;
+    }
+    return !failed_;
+}
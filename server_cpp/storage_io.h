@@ -0,0 +1,63 @@
+/*
+ * E/S de disco do storage: io_uring quando o kernel permite, pread/pwrite caso contrário.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada thread tem o seu anel (criado no primeiro uso, sem liburing: chamadas diretas ao kernel)
+ * com buffers registrados. As gravações de um arquivo inteiro vão em lote, com vários
+ * segmentos por submissão; IoAppender grava em segundo plano enquanto a thread volta para a rede.
+ * STORAGE_IO escolhe o backend: "auto" (padrão), "uring" ou "sync".
+ */
+
+#ifndef SERVER_CPP_STORAGE_IO_H
+#define SERVER_CPP_STORAGE_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// Escolhe o backend (chamado uma vez, na inicialização); false se o modo é desconhecido
+bool ConfigureStorageIo(const std::string& mode);
+
+// Backend em uso pela thread atual ("io_uring" ou "pread/pwrite")
+const char* StorageIoBackend();
+
+// Grava n bytes em path, substituindo o conteúdo
+bool IoWriteFile(const std::filesystem::path& path, const void* data, size_t n);
+
+// Gravação sequencial em segundo plano: Append copia os dados para um buffer registrado,
+// submete a escrita e retorna sem esperar o disco. No máximo uma escrita fica pendente (a
+// anterior termina antes da próxima ser submetida), então o arquivo nunca tem lacunas, mesmo
+// se o processo cair no meio. Usado por uma única thread.
+class IoAppender {
+public:
+    IoAppender() = default;
+    ~IoAppender();
+
+    IoAppender(const IoAppender&) = delete;
+    IoAppender& operator=(const IoAppender&) = delete;
+
+    // Abre para acrescentar ao fim do arquivo (criado se não existir)
+    bool Open(const std::filesystem::path& path);
+
+    // Enfileira n bytes; false se uma escrita anterior falhou
+    bool Append(const char* data, size_t n);
+
+    // Espera a escrita pendente
+    bool Flush();
+
+    bool is_open() const { return fd_ >= 0; }
+
+private:
+    bool Submit(const char* data, size_t n);
+
+    int fd_ = -1;
+    uint64_t offset_ = 0;
+    bool failed_ = false;
+    uint64_t pending_ = 0;      // Identificador da escrita em andamento no anel (0 = nenhuma)
+    size_t pending_len_ = 0;
+    int buf_[2] = {-1, -1};     // Buffers registrados em uso (índices no anel)
+    int cur_ = 0;
+};
+
+#endif  // SERVER_CPP_STORAGE_IO_H
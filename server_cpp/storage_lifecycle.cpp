@@ -0,0 +1,196 @@
+/*
+ * Implementação do ciclo de vida do armazenamento temporário.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "storage_lifecycle.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <random>
+
+namespace fs = std::filesystem;
+
+// Hash FNV-1a de 64 bits (estável entre execuções, ao contrário de std::hash)
+static uint64_t Fnv1a64(const std::string& s) {
+    uint64_t h = 1469598103934665603ULL;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Verifica se o nome corresponde a um diretório de shard (dois dígitos hex)
+static bool IsShardName(const std::string& name) {
+    return name.size() == 2 && std::isxdigit((unsigned char)name[0]) && std::isxdigit((unsigned char)name[1]);
+}
+
+std::string RandomId() {
+    static std::mutex mu;
+    static std::mt19937_64 rng{std::random_device{}()};
+    std::lock_guard<std::mutex> lk(mu);
+    char hex[33];
+    std::snprintf(hex, sizeof(hex), "%016llx%016llx", (unsigned long long)rng(), (unsigned long long)rng());
+    return hex;
+}
+
+bool IsRandomId(const std::string& id) {
+    if (id.size() != 32) return false;
+    for (unsigned char c : id)
+        if (!std::isxdigit(c)) return false;
+    return true;
+}
+
+StorageLifecycle::StorageLifecycle(StorageConfig cfg) : cfg_(std::move(cfg)) {
+    if (cfg_.shard_levels < 0) cfg_.shard_levels = 0;
+    if (cfg_.shard_levels > 8) cfg_.shard_levels = 8;
+    fs::create_directories(cfg_.root);
+}
+
+StorageLifecycle::~StorageLifecycle() {
+    Stop();
+}
+
+void StorageLifecycle::Start() {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (sweeper_.joinable()) return;
+    stop_ = false;
+    sweeper_ = std::thread(&StorageLifecycle::SweepLoop, this);
+}
+
+void StorageLifecycle::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (sweeper_.joinable()) sweeper_.join();
+}
+
+fs::path StorageLifecycle::ShardFor(const std::string& key) {
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)Fnv1a64(key));
+
+    // Cada nível usa dois dígitos do hash: 256 subdiretórios por nível
+    fs::path dir(cfg_.root);
+    for (int i = 0; i < cfg_.shard_levels; ++i) dir /= std::string(hex + 2 * i, 2);
+
+    // Sem exceção (disco cheio, permissão): a falha aparece ao abrir o arquivo no caminho
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    return dir;
+}
+
+void StorageLifecycle::Pin(const fs::path& p) {
+    std::lock_guard<std::mutex> lk(mu_);
+    pinned_[p.string()]++;
+}
+
+void StorageLifecycle::Unpin(const fs::path& p) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = pinned_.find(p.string());
+    if (it != pinned_.end() && --it->second <= 0) pinned_.erase(it);
+}
+
+bool StorageLifecycle::IsPinned(const fs::path& p) {
+    std::lock_guard<std::mutex> lk(mu_);
+    return pinned_.count(p.string()) > 0;
+}
+
+size_t StorageLifecycle::SweepOnce() {
+    struct Entry {
+        fs::path path;
+        fs::file_time_type mtime;
+        uint64_t size;
+    };
+
+    std::error_code ec;
+    fs::path root(cfg_.root);
+    if (!fs::exists(root, ec)) return 0;
+
+    std::vector<Entry> entries;
+    std::vector<fs::path> request_dirs;         // Diretórios de requisição (ScratchScope) expirados
+    uint64_t total = 0;
+    size_t removed = 0;
+    size_t expired = 0;
+    auto now = fs::file_time_type::clock::now();
+
+    // Remove o arquivo apenas se não estiver em uso (verificação e remoção sob o mesmo lock)
+    auto remove_if_unpinned = [&](const fs::path& p) {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (pinned_.count(p.string())) return false;
+        std::error_code rec;
+        return fs::remove(p, rec);
+    };
+
+    // Percorre apenas os diretórios de shard (e, sem shards, os de requisição); arquivos soltos
+    // na raiz não são tocados
+    for (auto& top : fs::directory_iterator(root, ec)) {
+        std::error_code tec;
+        std::string top_name = top.path().filename().string();
+        if (!top.is_directory(tec) || !(IsShardName(top_name) || IsRandomId(top_name))) continue;
+        if (IsRandomId(top_name) && now - top.last_write_time(tec) > cfg_.ttl) request_dirs.push_back(top.path());
+
+        for (auto it = fs::recursive_directory_iterator(top.path(), tec); !tec && it != fs::recursive_directory_iterator(); it.increment(tec)) {
+            std::error_code fec;
+            if (it->is_directory(fec)) {
+                auto mtime = it->last_write_time(fec);
+                if (!fec && IsRandomId(it->path().filename().string()) && now - mtime > cfg_.ttl) request_dirs.push_back(it->path());
+                continue;
+            }
+            if (!it->is_regular_file(fec)) continue;
+            auto mtime = it->last_write_time(fec);
+            if (fec) continue;
+            uint64_t size = it->file_size(fec);
+            if (fec) continue;
+
+            // Expirado pelo TTL
+            if (now - mtime > cfg_.ttl && remove_if_unpinned(it->path())) {
+                removed++;
+                expired++;
+                continue;
+            }
+            total += size;
+            entries.push_back({it->path(), mtime, size});
+        }
+    }
+
+    // Acima do limite: remove os mais antigos até ficar 10% abaixo do limite
+    if (cfg_.max_bytes > 0 && total > cfg_.max_bytes) {
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.mtime < b.mtime; });
+        uint64_t target = cfg_.max_bytes - cfg_.max_bytes / 10;
+        for (auto& e : entries) {
+            if (total <= target) break;
+            if (remove_if_unpinned(e.path)) {
+                total -= e.size;
+                removed++;
+            }
+        }
+    }
+
+    // Diretórios de requisições interrompidas: removidos quando ficam vazios (remove só apaga
+    // diretórios vazios)
+    for (auto& d : request_dirs) {
+        std::error_code dec;
+        fs::remove(d, dec);
+    }
+    used_bytes_ = total;
+    used_files_ = entries.size() - (removed - expired);
+    removed_files_ += removed;
+    return removed;
+}
+
+void StorageLifecycle::SweepLoop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!stop_) {
+        cv_.wait_for(lk, cfg_.sweep_interval, [this] { return stop_; });
+        if (stop_) break;
+
+        // Libera o lock durante a varredura (Pin/Unpin continuam funcionando)
+        lk.unlock();
+        SweepOnce();
+        lk.lock();
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Ciclo de vida do armazenamento temporário do servidor (server_cpp/storage).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Responsabilidades:
+ *  - Distribui os arquivos em subdiretórios por prefixo de hash (fan-out), evitando diretórios gigantes.
+ *  - Os arquivos de cada requisição são removidos assim que ela termina (ScratchScope, em scratch.h).
+ *  - Um varredor em background remove arquivos expirados (TTL) e mantém o uso de disco abaixo do limite.
+ */
+
+#ifndef SERVER_CPP_STORAGE_LIFECYCLE_H
+#define SERVER_CPP_STORAGE_LIFECYCLE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Configuração do armazenamento temporário
+struct StorageConfig {
+    std::string root;                               // Diretório raiz (StorageDir())
+    int shard_levels = 2;                           // Níveis de subdiretórios (2 dígitos hex por nível)
+    std::chrono::seconds ttl{3600};                 // Idade máxima de um arquivo antes de ser removido
+    uint64_t max_bytes = 0;                         // Limite de uso total (0 = sem limite)
+    std::chrono::seconds sweep_interval{60};        // Intervalo entre varreduras
+};
+
+// Gerencia shards, arquivos em uso e a varredura periódica do storage
+class StorageLifecycle {
+public:
+    explicit StorageLifecycle(StorageConfig cfg);
+    ~StorageLifecycle();
+
+    // Inicia/para a thread de varredura
+    void Start();
+    void Stop();
+
+    // Retorna (e tenta criar) o subdiretório correspondente à chave; não lança exceção
+    std::filesystem::path ShardFor(const std::string& key);
+
+    // Marca/desmarca arquivo em uso (a varredura nunca remove arquivos em uso)
+    void Pin(const std::filesystem::path& p);
+    void Unpin(const std::filesystem::path& p);
+
+    // Executa uma varredura completa; retorna número de arquivos removidos
+    size_t SweepOnce();
+
+    const StorageConfig& config() const { return cfg_; }
+
+    // Uso medido pela última varredura (bytes e arquivos nos shards) e removidos desde o início
+    uint64_t used_bytes() const { return used_bytes_; }
+    uint64_t used_files() const { return used_files_; }
+    uint64_t removed_files() const { return removed_files_; }
+
+private:
+    bool IsPinned(const std::filesystem::path& p);
+    void SweepLoop();
+
+    StorageConfig cfg_;
+    std::mutex mu_;
+    std::map<std::string, int> pinned_;             // Caminho -> contagem de referências
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread sweeper_;
+    std::atomic<uint64_t> used_bytes_{0};
+    std::atomic<uint64_t> used_files_{0};
+    std::atomic<uint64_t> removed_files_{0};
+};
+
+// Identificador aleatório de 128 bits (32 dígitos hex) para objetos persistentes do storage
+std::string RandomId();
+
+// Valida um identificador vindo do cliente (impede caminhos arbitrários)
+bool IsRandomId(const std::string& id);
+
+// Mantém um arquivo persistente marcado como em uso enquanto o objeto existir
+class PinScope {
+public:
+    PinScope(StorageLifecycle& storage, std::filesystem::path p) : storage_(storage), path_(std::move(p)) { storage_.Pin(path_); }
+    ~PinScope() { storage_.Unpin(path_); }
+
+    PinScope(const PinScope&) = delete;
+    PinScope& operator=(const PinScope&) = delete;
+
+private:
+    StorageLifecycle& storage_;
+    std::filesystem::path path_;
+};
+
+#endif  // SERVER_CPP_STORAGE_LIFECYCLE_H
@@ -0,0 +1,306 @@
+/*
+ * Relatório offline do log binário de operações (oplog-AAAAMMDD.bin).
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Mapeia os arquivos com mmap e percorre os registros uma vez, acumulando vazão, taxa de erro
+ * e histogramas de latência por operação (e, com --by, por dia ou hora). Fica em um
+ * subdiretório para não entrar no binário do servidor; compilado por scripts/oplog_report.sh.
+ *
+ * Uso: oplog_report [--since DATA] [--until DATA] [--op NOME] [--by day|hour] ARQUIVO|DIRETÓRIO...
+ *      DATA em horário local: AAAA-MM-DD ou "AAAA-MM-DD HH:MM"
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../oplog.h"
+
+namespace fs = std::filesystem;
+
+// Histograma log-linear em microssegundos (mesma escala do latency.h: 16 faixas por potência de 2)
+class Histogram {
+public:
+    Histogram() : buckets_(BUCKETS, 0) {}
+
+    void Record(uint64_t us) {
+        buckets_[(size_t)BucketOf(us)]++;
+        count_++;
+        sum_ += us;
+        max_ = std::max(max_, us);
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t sum() const { return sum_; }
+
+    uint64_t Percentile(double q) const {
+        if (count_ == 0) return 0;
+        uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(q * (double)count_));
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            seen += buckets_[(size_t)i];
+            if (seen >= target) return std::min(BucketUpper(i), max_);
+        }
+        return max_;
+    }
+
+    uint64_t max() const { return max_; }
+
+private:
+    static const int SUB_BITS = 4;
+    static const int MAX_EXP = 31;                  // Durações do oplog têm 32 bits
+    static const int BUCKETS = (MAX_EXP - SUB_BITS + 2) << SUB_BITS;
+
+    static int BucketOf(uint64_t us) {
+        if (us < (1u << SUB_BITS)) return (int)us;
+        if (us >= (1ULL << (MAX_EXP + 1))) us = (1ULL << (MAX_EXP + 1)) - 1;
+        int exp = 63 - __builtin_clzll(us);
+        int sub = (int)((us >> (exp - SUB_BITS)) & ((1u << SUB_BITS) - 1));
+        return ((exp - SUB_BITS + 1) << SUB_BITS) | sub;
+    }
+
+    static uint64_t BucketUpper(int bucket) {
+        if (bucket < (1 << SUB_BITS)) return (uint64_t)bucket;
+        int exp = (bucket >> SUB_BITS) + SUB_BITS - 1;
+        uint64_t sub = (uint64_t)(bucket & ((1 << SUB_BITS) - 1));
+        return ((((1ULL << SUB_BITS) + sub) << (exp - SUB_BITS)) + (1ULL << (exp - SUB_BITS))) - 1;
+    }
+
+    std::vector<uint64_t> buckets_;
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t max_ = 0;
+};
+
+// Acumulado de um grupo (operação ou período)
+struct Stats {
+    uint64_t count = 0;
+    uint64_t errors = 0;
+    uint64_t tool_failures = 0;
+    uint64_t input_bytes = 0;
+    uint64_t output_bytes = 0;
+    uint64_t tool_cpu_us = 0;
+    uint64_t max_rss_kb = 0;
+    uint64_t first_us = UINT64_MAX;
+    uint64_t last_us = 0;
+    Histogram total;
+    std::array<uint64_t, OPLOG_PHASES> phase_sum{};
+
+    void Add(const OpLogRecord& r) {
+        count++;
+        if (!r.ok) errors++;
+        if (r.tool_status != 0) tool_failures++;
+        input_bytes += r.input_bytes;
+        output_bytes += r.output_bytes;
+        tool_cpu_us += r.tool_cpu_us;
+        max_rss_kb = std::max<uint64_t>(max_rss_kb, r.tool_max_rss_kb);
+        first_us = std::min(first_us, r.time_us);
+        last_us = std::max(last_us, r.time_us);
+        total.Record(r.total_us);
+        for (int p = 0; p < OPLOG_PHASES; p++) phase_sum[(size_t)p] += r.phase_us[p];
+    }
+
+    // Duração coberta pelos registros (no mínimo 1 s, para as taxas)
+    double Seconds() const { return count ? std::max(1.0, (double)(last_us - first_us) / 1e6) : 1.0; }
+};
+
+struct Options {
+    uint64_t since_us = 0;
+    uint64_t until_us = UINT64_MAX;
+    std::string op;                                 // Vazio = todas
+    std::string by;                                 // "", "day" ou "hour"
+    std::vector<std::string> paths;
+};
+
+static void Usage() {
+    std::fprintf(stderr,
+                 "Uso: oplog_report [--since DATA] [--until DATA] [--op NOME] [--by day|hour] ARQUIVO|DIRETÓRIO...\n"
+                 "     DATA em horário local: AAAA-MM-DD ou \"AAAA-MM-DD HH:MM\"\n");
+}
+
+// "AAAA-MM-DD[ HH:MM]" (horário local) -> microssegundos desde 1970
+static bool ParseDate(const char* s, uint64_t& us) {
+    struct tm tm;
+    std::memset(&tm, 0, sizeof(tm));
+    int n = std::sscanf(s, "%d-%d-%d %d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min);
+    if (n != 3 && n != 5) return false;
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    tm.tm_isdst = -1;
+    time_t t = mktime(&tm);
+    if (t == (time_t)-1) return false;
+    us = (uint64_t)t * 1000000ULL;
+    return true;
+}
+
+static std::string FormatTime(uint64_t us, const char* fmt) {
+    time_t t = (time_t)(us / 1000000ULL);
+    struct tm tm;
+    localtime_r(&t, &tm);
+    char buf[64];
+    std::strftime(buf, sizeof(buf), fmt, &tm);
+    return buf;
+}
+
+static double Ms(uint64_t us) { return (double)us / 1000.0; }
+static double MB(uint64_t bytes) { return (double)bytes / (1024.0 * 1024.0); }
+static double Pct(uint64_t part, uint64_t whole) { return whole ? 100.0 * (double)part / (double)whole : 0.0; }
+
+// Arquivos do oplog: os dados diretamente ou oplog-*.bin de cada diretório, em ordem
+static std::vector<std::string> ExpandPaths(const std::vector<std::string>& paths) {
+    std::vector<std::string> files;
+    for (const auto& p : paths) {
+        std::error_code ec;
+        if (!fs::is_directory(p, ec)) { files.push_back(p); continue; }
+        std::vector<std::string> in_dir;
+        for (auto it = fs::directory_iterator(p, ec); !ec && it != fs::directory_iterator(); it.increment(ec)) {
+            std::string name = it->path().filename().string();
+            if (name.rfind("oplog-", 0) == 0 && it->path().extension() == ".bin") in_dir.push_back(it->path().string());
+        }
+        std::sort(in_dir.begin(), in_dir.end());
+        files.insert(files.end(), in_dir.begin(), in_dir.end());
+    }
+    return files;
+}
+
+static bool ParseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool has_value = i + 1 < argc;
+        if (a == "--since" && has_value) { if (!ParseDate(argv[++i], opt.since_us)) return false; }
+        else if (a == "--until" && has_value) { if (!ParseDate(argv[++i], opt.until_us)) return false; }
+        else if (a == "--op" && has_value) opt.op = argv[++i];
+        else if (a == "--by" && has_value) {
+            opt.by = argv[++i];
+            if (opt.by != "day" && opt.by != "hour") return false;
+        }
+        else if (a == "-h" || a == "--help" || a.rfind("--", 0) == 0) return false;
+        else opt.paths.push_back(a);
+    }
+    return !opt.paths.empty();
+}
+
+static void PrintSummary(const Stats& all, size_t files) {
+    if (all.count == 0) {
+        std::printf("Nenhum registro no período (%zu arquivo(s)).\n", files);
+        return;
+    }
+    double secs = all.Seconds();
+    std::printf("Arquivos: %zu  Registros: %llu\n", files, (unsigned long long)all.count);
+    std::printf("Período: %s -> %s (%.1f h)\n", FormatTime(all.first_us, "%Y-%m-%d %H:%M:%S").c_str(),
+                FormatTime(all.last_us, "%Y-%m-%d %H:%M:%S").c_str(), secs / 3600.0);
+    std::printf("Vazão média: %.2f req/s, entrada %.2f MB/s, saída %.2f MB/s\n", (double)all.count / secs,
+                MB(all.input_bytes) / secs, MB(all.output_bytes) / secs);
+    std::printf("Erros: %llu (%.2f%%), falhas de ferramenta: %llu\n", (unsigned long long)all.errors, Pct(all.errors, all.count),
+                (unsigned long long)all.tool_failures);
+    std::printf("Latência total (ms): p50 %.1f  p90 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n\n", Ms(all.total.Percentile(0.5)),
+                Ms(all.total.Percentile(0.9)), Ms(all.total.Percentile(0.99)), Ms(all.total.Percentile(0.999)), Ms(all.total.max()));
+}
+
+static void PrintOperations(const std::map<std::string, Stats>& ops) {
+    std::printf("%-30s %10s %7s %9s %9s %9s %9s %9s %10s %10s %9s %8s\n", "operação", "reqs", "erro%", "p50 ms", "p90 ms", "p99 ms",
+                "p99.9 ms", "max ms", "exec ms", "entrada MB", "cpu s", "rss MB");
+    for (const auto& kv : ops) {
+        const Stats& s = kv.second;
+        std::printf("%-28s %10llu %7.2f %9.1f %9.1f %9.1f %9.1f %9.1f %10.1f %10.1f %9.1f %8.1f\n", kv.first.c_str(), (unsigned long long)s.count,
+                    Pct(s.errors, s.count), Ms(s.total.Percentile(0.5)), Ms(s.total.Percentile(0.9)), Ms(s.total.Percentile(0.99)),
+                    Ms(s.total.Percentile(0.999)), Ms(s.total.max()), Ms(s.phase_sum[3] / s.count), MB(s.input_bytes),
+                    (double)s.tool_cpu_us / 1e6, (double)s.max_rss_kb / 1024.0);
+    }
+}
+
+static void PrintPeriods(const std::map<uint64_t, Stats>& periods, const std::string& by) {
+    double width = by == "day" ? 86400.0 : 3600.0;
+    std::printf("\n%-16s %10s %9s %7s %9s %9s %9s %10s\n", by == "day" ? "dia" : "hora", "reqs", "req/s", "erro%", "p50 ms", "p99 ms",
+                "max ms", "entrada MB");
+    for (const auto& kv : periods) {
+        const Stats& s = kv.second;
+        std::printf("%-16s %10llu %9.2f %7.2f %9.1f %9.1f %9.1f %10.1f\n",
+                    FormatTime(kv.first, by == "day" ? "%Y-%m-%d" : "%Y-%m-%d %H:00").c_str(), (unsigned long long)s.count,
+                    (double)s.count / width, Pct(s.errors, s.count), Ms(s.total.Percentile(0.5)), Ms(s.total.Percentile(0.99)),
+                    Ms(s.total.max()), MB(s.input_bytes));
+    }
+}
+
+// Início do dia ou da hora (horário local) que contém o instante
+static uint64_t PeriodStart(uint64_t us, const std::string& by) {
+    time_t t = (time_t)(us / 1000000ULL);
+    struct tm tm;
+    localtime_r(&t, &tm);
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    if (by == "day") tm.tm_hour = 0;
+    tm.tm_isdst = -1;
+    return (uint64_t)mktime(&tm) * 1000000ULL;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!ParseArgs(argc, argv, opt)) {
+        Usage();
+        return 2;
+    }
+
+    Stats all;
+    std::map<std::string, Stats> ops;               // "CompressPDF/job" -> acumulado
+    std::map<uint64_t, Stats> periods;              // Início do período -> acumulado
+    std::map<std::pair<uint16_t, uint8_t>, Stats*> by_code;     // Cache do nome por (op, modo)
+    std::vector<std::string> files = ExpandPaths(opt.paths);
+    int failed = 0;
+
+    // Período corrente [start, end): localtime só na troca de período
+    uint64_t period_start = 0, period_end = 0;
+    Stats* period = nullptr;
+
+    for (const auto& path : files) {
+        MappedOpLog log;
+        std::string err;
+        if (!log.Open(path, err)) {
+            std::fprintf(stderr, "%s\n", err.c_str());
+            failed++;
+            continue;
+        }
+        const OpLogRecord* r = log.records();
+        for (size_t i = 0; i < log.count(); i++, r++) {
+            if (r->time_us < opt.since_us || r->time_us >= opt.until_us) continue;
+
+            auto key = std::make_pair(r->op, r->mode);
+            auto it = by_code.find(key);
+            if (it == by_code.end()) {
+                std::string name = OpCodeName(r->op);
+                if (r->mode != OPMODE_STREAM) name += std::string("/") + OpModeName(r->mode);
+                Stats* s = (opt.op.empty() || opt.op == OpCodeName(r->op) || opt.op == name) ? &ops[name] : nullptr;
+                it = by_code.emplace(key, s).first;
+            }
+            if (!it->second) continue;
+
+            it->second->Add(*r);
+            all.Add(*r);
+            if (!opt.by.empty()) {
+                if (!period || r->time_us < period_start || r->time_us >= period_end) {
+                    period_start = PeriodStart(r->time_us, opt.by);
+                    // Início do período seguinte (folga cobre dias de 23 ou 25 horas)
+                    period_end = PeriodStart(period_start + (opt.by == "day" ? 26ULL * 3600 : 5400ULL) * 1000000ULL, opt.by);
+                    period = &periods[period_start];
+                }
+                period->Add(*r);
+            }
+        }
+    }
+
+    PrintSummary(all, files.size() - (size_t)failed);
+    if (all.count > 0) {
+        PrintOperations(ops);
+        if (!opt.by.empty()) PrintPeriods(periods, opt.by);
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * Implementação dos spans e do exportador OTLP-JSON.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "tracing.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+
+#include <unistd.h>
+
+#include "storage_lifecycle.h"
+
+static std::atomic<TraceExporter*> g_exporter{nullptr};
+
+static bool IsLowerHex(const std::string& s) {
+    bool nonzero = false;
+    for (unsigned char c : s) {
+        if (!std::isxdigit(c) || std::isupper(c)) return false;
+        if (c != '0') nonzero = true;
+    }
+    return nonzero;     // Identificadores só com zeros são inválidos
+}
+
+bool ParseTraceparent(const std::string& value, TraceContext& ctx) {
+    // 00-<32 hex>-<16 hex>-<2 hex>
+    if (value.size() < 55 || value[2] != '-' || value[35] != '-' || value[52] != '-') return false;
+    std::string version = value.substr(0, 2), trace = value.substr(3, 32), span = value.substr(36, 16), flags = value.substr(53, 2);
+    if (version == "ff" || !std::isxdigit((unsigned char)version[0]) || !std::isxdigit((unsigned char)version[1])) return false;
+    if (!IsLowerHex(trace) || !IsLowerHex(span) || !std::isxdigit((unsigned char)flags[0]) || !std::isxdigit((unsigned char)flags[1])) return false;
+    ctx.trace_id = trace;
+    ctx.span_id = span;
+    ctx.sampled = (std::stoi(flags, nullptr, 16) & 1) != 0;
+    return true;
+}
+
+std::string FormatTraceparent(const TraceContext& ctx) {
+    return "00-" + ctx.trace_id + "-" + ctx.span_id + (ctx.sampled ? "-01" : "-00");
+}
+
+void AppendJsonString(std::string& out, const std::string& s) {
+    out += '"';
+    for (unsigned char c : s) {
+        if (c == '"') out += "\\\"";
+        else if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else if (c == '\r') out += "\\r";
+        else if (c == '\t') out += "\\t";
+        else if (c < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else out += (char)c;
+    }
+    out += '"';
+}
+
+static std::string UnixNanos(std::chrono::system_clock::time_point t) {
+    return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count());
+}
+
+static void AppendAttribute(std::string& out, const std::string& key, const std::string& value) {
+    out += "{\"key\":";
+    AppendJsonString(out, key);
+    out += ",\"value\":{\"stringValue\":";
+    AppendJsonString(out, value);
+    out += "}}";
+}
+
+// Um span no mapeamento JSON do OTLP (ids em hex, tempos em string)
+static void AppendSpan(std::string& out, const SpanData& s) {
+    out += "{\"traceId\":\"" + s.ctx.trace_id + "\",\"spanId\":\"" + s.ctx.span_id + "\"";
+    if (!s.parent_span_id.empty()) out += ",\"parentSpanId\":\"" + s.parent_span_id + "\"";
+    out += ",\"name\":";
+    AppendJsonString(out, s.name);
+    out += ",\"kind\":" + std::to_string((int)s.kind);
+    out += ",\"startTimeUnixNano\":\"" + UnixNanos(s.start) + "\",\"endTimeUnixNano\":\"" + UnixNanos(s.end) + "\"";
+    out += ",\"attributes\":[";
+    for (size_t i = 0; i < s.attributes.size(); i++) {
+        if (i > 0) out += ",";
+        AppendAttribute(out, s.attributes[i].first, s.attributes[i].second);
+    }
+    // Status do OTLP: UNSET (0) sem erro, ERROR (2) na falha
+    out += "],\"status\":{\"code\":" + std::string(s.ok ? "0" : "2");
+    if (!s.status_message.empty()) {
+        out += ",\"message\":";
+        AppendJsonString(out, s.status_message);
+    }
+    out += "}}";
+}
+
+TraceExporter::TraceExporter(TraceConfig cfg) : cfg_(std::move(cfg)) {
+    writer_ = std::thread(&TraceExporter::Loop, this);
+}
+
+TraceExporter::~TraceExporter() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) writer_.join();
+    Flush();
+}
+
+void TraceExporter::Export(SpanData span) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (pending_.size() >= cfg_.max_pending) { dropped_++; return; }
+    pending_.push_back(std::move(span));
+}
+
+void TraceExporter::Loop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (!stop_) {
+        cv_.wait_for(lk, cfg_.flush_interval, [this] { return stop_; });
+        lk.unlock();
+        Flush();
+        lk.lock();
+    }
+}
+
+void TraceExporter::Flush() {
+    std::vector<SpanData> spans;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        spans.swap(pending_);
+    }
+    if (spans.empty()) return;
+
+    // Uma linha com todos os spans da rodada
+    std::string line = "{\"resourceSpans\":[{\"resource\":{\"attributes\":[";
+    AppendAttribute(line, "service.name", cfg_.service_name);
+    line += ",";
+    AppendAttribute(line, "process.pid", std::to_string(getpid()));
+    line += "]},\"scopeSpans\":[{\"scope\":{\"name\":\"projeto_grpc\"},\"spans\":[";
+    for (size_t i = 0; i < spans.size(); i++) {
+        if (i > 0) line += ",";
+        AppendSpan(line, spans[i]);
+    }
+    line += "]}]}]}\n";
+
+    std::ofstream f(cfg_.path, std::ios::app | std::ios::binary);
+    f.write(line.data(), (std::streamsize)line.size());
+}
+
+void SetTraceExporter(TraceExporter* exporter) {
+    g_exporter = exporter;
+}
+
+bool TracingEnabled() {
+    return g_exporter.load() != nullptr;
+}
+
+Span::Span(const std::string& name, const TraceContext& parent, SpanKind kind, Clock::time_point start) {
+    if (parent.valid() && !parent.sampled) {
+        data_.ctx = parent;
+        return;
+    }
+    if (!TracingEnabled()) return;
+    recording_ = true;
+    data_.ctx.trace_id = parent.valid() ? parent.trace_id : RandomId();
+    data_.ctx.span_id = RandomId().substr(0, 16);
+    data_.parent_span_id = parent.valid() ? parent.span_id : "";
+    data_.name = name;
+    data_.kind = kind;
+    data_.start = start;
+}
+
+void Span::SetAttribute(const std::string& key, const std::string& value) {
+    if (recording_) data_.attributes.emplace_back(key, value);
+}
+
+void Span::SetStatus(bool ok, const std::string& message) {
+    data_.ok = ok;
+    data_.status_message = ok ? "" : message;
+}
+
+void Span::End(Clock::time_point end) {
+    if (!recording_) return;
+    recording_ = false;
+    data_.end = end;
+    TraceExporter* exporter = g_exporter.load();
+    if (!exporter) return;
+
+    // O contexto continua válido depois do fim (ex.: trace_id no slow log)
+    TraceContext ctx = data_.ctx;
+    exporter->Export(std::move(data_));
+    data_.ctx = std::move(ctx);
+}
+
+static thread_local TraceContext t_current;
+
+const TraceContext& CurrentTrace() {
+    return t_current;
+}
+
+TraceScope::TraceScope(const TraceContext& ctx) : prev_(t_current) {
+    t_current = ctx;
+}
+
+TraceScope::~TraceScope() {
+    t_current = prev_;
+}
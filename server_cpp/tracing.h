@@ -0,0 +1,136 @@
+/*
+ * Spans de tracing (fases das requisições e execuções de ferramentas) exportados em OTLP-JSON.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * O contexto chega do cliente no metadado "traceparent" (formato W3C: 00-<trace>-<span>-<flags>);
+ * o span da requisição é filho do span do cliente e cada fase e ferramenta é filha da requisição.
+ * Sem traceparent a requisição inicia um trace novo; com a flag de amostragem desligada nada é
+ * registrado. O exportador acumula os spans terminados e, a cada intervalo, acrescenta uma linha
+ * ao arquivo (uma ExportTraceServiceRequest em JSON por linha, o formato lido pelo receptor
+ * otlpjsonfile do OpenTelemetry Collector); não é preciso um coletor rodando.
+ */
+
+#ifndef SERVER_CPP_TRACING_H
+#define SERVER_CPP_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Tipo do span (valores do OTLP)
+enum SpanKind { SPAN_INTERNAL = 1, SPAN_SERVER = 2, SPAN_CLIENT = 3 };
+
+// Identificação de um span para propagação
+struct TraceContext {
+    std::string trace_id;                           // 32 dígitos hex
+    std::string span_id;                            // 16 dígitos hex
+    bool sampled = true;
+
+    bool valid() const { return trace_id.size() == 32 && span_id.size() == 16; }
+};
+
+// Lê/gera o valor do metadado traceparent
+bool ParseTraceparent(const std::string& value, TraceContext& ctx);
+std::string FormatTraceparent(const TraceContext& ctx);
+
+// Acrescenta s a out como string JSON (entre aspas, com escapes)
+void AppendJsonString(std::string& out, const std::string& s);
+
+// Span terminado, pronto para exportar
+struct SpanData {
+    TraceContext ctx;
+    std::string parent_span_id;                     // Vazio na raiz do trace
+    std::string name;
+    SpanKind kind = SPAN_INTERNAL;
+    std::chrono::system_clock::time_point start;
+    std::chrono::system_clock::time_point end;
+    bool ok = true;
+    std::string status_message;
+    std::vector<std::pair<std::string, std::string>> attributes;
+};
+
+// Configuração do exportador
+struct TraceConfig {
+    std::string path;                               // Arquivo .jsonl (acrescentado)
+    std::string service_name = "file-processor-server";
+    std::chrono::milliseconds flush_interval{1000};
+    size_t max_pending = 65536;                     // Spans acumulados além disso são descartados
+};
+
+class TraceExporter {
+public:
+    explicit TraceExporter(TraceConfig cfg);
+    ~TraceExporter();   // Grava o que ainda está pendente
+
+    TraceExporter(const TraceExporter&) = delete;
+    TraceExporter& operator=(const TraceExporter&) = delete;
+
+    void Export(SpanData span);
+
+    uint64_t dropped() const { return dropped_; }
+
+private:
+    void Loop();
+    void Flush();
+
+    TraceConfig cfg_;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::vector<SpanData> pending_;
+    bool stop_ = false;
+    std::atomic<uint64_t> dropped_{0};
+    std::thread writer_;
+};
+
+// Exportador do processo (nullptr desliga o tracing); definido antes de aceitar requisições
+void SetTraceExporter(TraceExporter* exporter);
+bool TracingEnabled();
+
+// Span em andamento; exportado em End (ou no destrutor). Sem exportador, ou com o pai não
+// amostrado, não registra nada (e context() devolve o próprio pai, para seguir propagando).
+class Span {
+public:
+    using Clock = std::chrono::system_clock;
+
+    // Filho de parent; com parent inválido, raiz de um trace novo
+    Span(const std::string& name, const TraceContext& parent, SpanKind kind = SPAN_INTERNAL, Clock::time_point start = Clock::now());
+    ~Span() { End(); }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    void SetName(const std::string& name) { data_.name = name; }
+    void SetAttribute(const std::string& key, const std::string& value);
+    void SetStatus(bool ok, const std::string& message = "");
+    void End(Clock::time_point end = Clock::now());
+
+    bool recording() const { return recording_; }
+    const TraceContext& context() const { return data_.ctx; }     // Válido também depois de End
+
+private:
+    SpanData data_;
+    bool recording_ = false;
+};
+
+// Contexto corrente da thread: pai dos spans criados longe da RPC (ex.: execuções de ferramentas)
+const TraceContext& CurrentTrace();
+
+class TraceScope {
+public:
+    explicit TraceScope(const TraceContext& ctx);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceContext prev_;
+};
+
+#endif  // SERVER_CPP_TRACING_H
@@ -0,0 +1,126 @@
+/*
+ * Implementação das sessões de upload retomável.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "uploads.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+fs::path UploadStore::DataPath(const std::string& id) {
+    return storage_.ShardFor(id) / (id + ".part");
+}
+
+fs::path UploadStore::MetaPath(const std::string& id) {
+    return storage_.ShardFor(id) / (id + ".meta");
+}
+
+bool UploadStore::Create(const std::string& file_name, uint64_t total_size, UploadInfo& info, std::string& err) {
+    info.id = RandomId();
+    info.file_name = fs::path(file_name).filename().string();
+    info.total_size = total_size;
+    info.committed = 0;
+
+    // Metadados: tamanho total na primeira linha, nome original na segunda
+    std::ofstream meta(MetaPath(info.id), std::ios::trunc);
+    std::ofstream part(DataPath(info.id), std::ios::binary | std::ios::trunc);
+    if (meta && part) {
+        meta << info.total_size << "\n" << info.file_name << "\n";
+        meta.close();
+        part.close();
+    }
+
+    // Disco cheio etc.: sem metadados completos a sessão não poderia ser retomada
+    if (!meta || !part) {
+        std::error_code ec;
+        fs::remove(MetaPath(info.id), ec);
+        fs::remove(DataPath(info.id), ec);
+        err = "Falha ao criar sessão de upload";
+        return false;
+    }
+    return true;
+}
+
+bool UploadStore::Lookup(const std::string& id, UploadInfo& info) {
+    if (!IsRandomId(id)) return false;
+
+    std::ifstream meta(MetaPath(id));
+    if (!meta) return false;
+    info.id = id;
+    if (!(meta >> info.total_size)) return false;
+    meta.ignore(1, '\n');
+    std::getline(meta, info.file_name);
+
+    // O offset confirmado é o tamanho dos dados já gravados
+    std::error_code ec;
+    uint64_t size = fs::file_size(DataPath(id), ec);
+    if (ec) return false;
+    info.committed = size < info.total_size ? size : info.total_size;
+    return true;
+}
+
+std::unique_ptr<UploadWriter> UploadStore::OpenWriter(const std::string& id, std::string& err) {
+    std::lock_guard<std::mutex> lk(mu_);
+    UploadInfo info;
+    if (!Lookup(id, info)) { err = "Upload inexistente ou expirado"; return nullptr; }
+    if (writing_.count(id)) { err = "Upload em uso por outra conexão"; return nullptr; }
+    writing_.insert(id);
+    return std::unique_ptr<UploadWriter>(new UploadWriter(*this, std::move(info)));
+}
+
+void UploadStore::Release(const std::string& id) {
+    std::lock_guard<std::mutex> lk(mu_);
+    writing_.erase(id);
+}
+
+UploadWriter::UploadWriter(UploadStore& store, UploadInfo info)
+    : store_(store), info_(std::move(info)),
+      pin_part_(store.storage(), store.DataPath(info_.id)),
+      pin_meta_(store.storage(), store.MetaPath(info_.id)) {
+    out_.Open(store.DataPath(info_.id));
+}
+
+UploadWriter::~UploadWriter() {
+    out_.Flush();
+    store_.Release(info_.id);
+}
+
+bool UploadWriter::Write(uint64_t offset, const std::string& data, std::string& err) {
+    if (!out_.is_open()) { err = "Falha ao abrir dados do upload"; return false; }
+    if (offset > info_.committed) {
+        err = "Offset " + std::to_string(offset) + " além do confirmado (" + std::to_string(info_.committed) + ")";
+        return false;
+    }
+
+    // Descarta o trecho já confirmado (chunk reenviado após reconexão)
+    uint64_t skip = info_.committed - offset;
+    if (skip >= data.size()) return true;
+    uint64_t n = data.size() - skip;
+    if (info_.committed + n > info_.total_size) { err = "Dados excedem o tamanho total do upload"; return false; }
+
+    // A escrita segue em segundo plano; Flush confirma antes da resposta ao cliente
+    if (!out_.Append(data.data() + skip, n)) {
+        Flush(err);
+        return false;
+    }
+    info_.committed += n;
+
+    // Mantém os metadados com a mesma idade dos dados (TTL do varredor)
+    std::error_code ec;
+    fs::last_write_time(store_.MetaPath(info_.id), fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+bool UploadWriter::Flush(std::string& err) {
+    if (out_.Flush()) return true;
+
+    // O confirmado volta a ser o que de fato está no disco
+    std::error_code ec;
+    uintmax_t size = fs::file_size(store_.DataPath(info_.id), ec);
+    info_.committed = ec ? 0 : std::min<uint64_t>(size, info_.total_size);
+    if (err.empty()) err = "Falha ao gravar dados do upload";
+    return false;
+}
@@ -0,0 +1,94 @@
+/*
+ * Uploads retomáveis: sessões identificadas por upload_id com dados gravados por offset.
+ * Padrão de comentários: estilo ANSI-C.
+ *
+ * Cada sessão ocupa dois arquivos no shard do upload_id:
+ *  - <id>.meta: nome original e tamanho total declarado.
+ *  - <id>.part: bytes já confirmados (o tamanho do arquivo é o offset confirmado).
+ * Os dados sobrevivem a quedas de conexão e reinícios do servidor; sessões abandonadas
+ * expiram pelo TTL do varredor do StorageLifecycle.
+ */
+
+#ifndef SERVER_CPP_UPLOADS_H
+#define SERVER_CPP_UPLOADS_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "storage_io.h"
+#include "storage_lifecycle.h"
+
+// Estado de uma sessão de upload
+struct UploadInfo {
+    std::string id;
+    std::string file_name;
+    uint64_t total_size = 0;
+    uint64_t committed = 0;             // Bytes gravados de forma contígua a partir do início
+
+    bool complete() const { return committed == total_size; }
+};
+
+class UploadStore;
+
+// Escritor exclusivo de uma sessão (apenas um stream grava em cada upload por vez)
+class UploadWriter {
+public:
+    ~UploadWriter();
+
+    UploadWriter(const UploadWriter&) = delete;
+    UploadWriter& operator=(const UploadWriter&) = delete;
+
+    // Grava data a partir de offset. Bytes anteriores ao offset confirmado são ignorados
+    // (reenvio); offset além do confirmado deixaria lacuna e é recusado.
+    bool Write(uint64_t offset, const std::string& data, std::string& err);
+
+    // Espera as gravações em andamento; chamado antes de ler o arquivo ou responder ao cliente
+    bool Flush(std::string& err);
+
+    const UploadInfo& info() const { return info_; }
+
+private:
+    friend class UploadStore;
+    UploadWriter(UploadStore& store, UploadInfo info);
+
+    UploadStore& store_;
+    UploadInfo info_;
+    IoAppender out_;
+    PinScope pin_part_;
+    PinScope pin_meta_;
+};
+
+// Cria, consulta e abre sessões de upload
+class UploadStore {
+public:
+    explicit UploadStore(StorageLifecycle& storage) : storage_(storage) {}
+
+    // Cria uma sessão nova para um arquivo de total_size bytes
+    bool Create(const std::string& file_name, uint64_t total_size, UploadInfo& info, std::string& err);
+
+    // Carrega o estado atual da sessão (false se não existe ou expirou)
+    bool Lookup(const std::string& id, UploadInfo& info);
+
+    // Abre a sessão para escrita; nullptr se não existe ou já está em uso por outro stream
+    std::unique_ptr<UploadWriter> OpenWriter(const std::string& id, std::string& err);
+
+    // Caminho dos dados da sessão (entrada das operações quando o upload está completo)
+    std::filesystem::path DataPath(const std::string& id);
+
+    StorageLifecycle& storage() { return storage_; }
+
+private:
+    friend class UploadWriter;
+    std::filesystem::path MetaPath(const std::string& id);
+    void Release(const std::string& id);
+
+    StorageLifecycle& storage_;
+    std::mutex mu_;
+    std::set<std::string> writing_;     // Sessões com escritor aberto
+};
+
+#endif  // SERVER_CPP_UPLOADS_H
@@ -0,0 +1,55 @@
+/*
+ * Implementação do pool de threads.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#include "worker_pool.h"
+
+WorkerPool::WorkerPool(size_t threads) {
+    if (threads == 0) threads = 1;
+    for (size_t i = 0; i < threads; ++i) threads_.emplace_back(&WorkerPool::Loop, this);
+}
+
+WorkerPool::~WorkerPool() {
+    // Termina as tarefas já enfileiradas antes de encerrar as threads
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+void WorkerPool::Submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        queue_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+size_t WorkerPool::Active() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return active_;
+}
+
+size_t WorkerPool::Queued() {
+    std::lock_guard<std::mutex> lk(mu_);
+    return queue_.size();
+}
+
+void WorkerPool::Loop() {
+    std::unique_lock<std::mutex> lk(mu_);
+    while (true) {
+        cv_.wait(lk, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) return; // stop_ e nada mais a fazer
+
+        auto task = std::move(queue_.front());
+        queue_.pop_front();
+        active_++;
+        lk.unlock();
+        task();
+        lk.lock();
+        active_--;
+    }
+}
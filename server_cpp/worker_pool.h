@@ -0,0 +1,44 @@
+/*
+ * Pool fixo de threads para executar transformações fora da thread da RPC.
+ * Padrão de comentários: estilo ANSI-C.
+ */
+
+#ifndef SERVER_CPP_WORKER_POOL_H
+#define SERVER_CPP_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Enfileira uma tarefa (executada por uma das threads do pool)
+    void Submit(std::function<void()> task);
+
+    // Ocupação atual
+    size_t Threads() const { return threads_.size(); }
+    size_t Active();
+    size_t Queued();
+
+private:
+    void Loop();
+
+    std::mutex mu_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    size_t active_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+#endif  // SERVER_CPP_WORKER_POOL_H